@@ -173,6 +173,12 @@ try
             "                           Typically, the number of columns of a matrix on the right-hand side of a problem.\n"
             "                           ")
 
+        ("p",
+         value<rocblas_int>(),
+            "Matrix/vector size parameter.\n"
+            "                           Typically, the number of columns (or rows) of the second matrix of a generalized problem.\n"
+            "                           ")
+
         // leading dimension options
         ("lda",
          value<rocblas_int>(),
@@ -192,6 +198,12 @@ try
             "                           Leading dimension of matrices C.\n"
             "                           ")
 
+        ("ldr",
+         value<rocblas_int>(),
+            "Matrix size parameter.\n"
+            "                           Leading dimension of matrices R.\n"
+            "                           ")
+
         ("ldt",
          value<rocblas_int>(),
             "Matrix size parameter.\n"
@@ -247,6 +259,12 @@ try
             "                           Stride for matrices/vectors B.\n"
             "                           ")
 
+        ("strideC",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for matrices/vectors C.\n"
+            "                           ")
+
         ("strideD",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
@@ -265,6 +283,12 @@ try
             "                           Stride for vectors ifail.\n"
             "                           ")
 
+        ("strideJ",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for vectors jpvt.\n"
+            "                           ")
+
 
         ("strideQ",
          value<rocblas_stride>(),
@@ -278,12 +302,30 @@ try
             "                           Stride for vectors tau, taup, and ipiv.\n"
             "                           ")
 
+        ("strideR",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for matrices R.\n"
+            "                           ")
+
         ("strideS",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
             "                           Stride for matrices/vectors S.\n"
             "                           ")
 
+        ("strideTa",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for vectors taua.\n"
+            "                           ")
+
+        ("strideTb",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for vectors taub.\n"
+            "                           ")
+
         ("strideU",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
@@ -308,6 +350,12 @@ try
             "                           Stride for matrices/vectors X.\n"
             "                           ")
 
+        ("strideY",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for matrices/vectors Y.\n"
+            "                           ")
+
         ("strideZ",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
@@ -333,12 +381,13 @@ try
             "                           Only applicable to bdsqr.\n"
             "                           ")
 
-        // bdsvdx options
+        // bdsvdx, bdsdc and gesdd options
         ("svect",
          value<char>()->default_value('N'),
-            "N = none, S or V = the singular vectors are computed.\n"
-            "                           Indicates how the left singular vectors are to be calculated and stored.\n"
-            "                           Only applicable to bdsvdx.\n"
+            "N = none, S or V = the singular vectors are computed,\n"
+            "                           A = the entire orthogonal matrices are computed (only gesdd).\n"
+            "                           Indicates how the singular vectors are to be calculated and stored.\n"
+            "                           Only applicable to bdsvdx, bdsdc and gesdd.\n"
             "                           ")
 
         // laswp options
@@ -383,7 +432,7 @@ try
          value<char>()->default_value('N'),
             "N = non-unit triangular, U = unit triangular.\n"
             "                           Indicates whether the diagonal elements of a triangular matrix are assumed to be one.\n"
-            "                           Only applicable to trtri.\n"
+            "                           Only applicable to trtri and trcon.\n"
             "                           ")
 
         // stebz options
@@ -499,6 +548,18 @@ try
             "                           Problem type for generalized eigenproblems.\n"
             "                           ")
 
+        ("norm",
+         value<char>()->default_value('O'),
+            "O = 1-norm, I = infinity-norm.\n"
+            "                           Matrix norm in which the condition number is estimated.\n"
+            "                           ")
+
+        ("rcond",
+         value<double>()->default_value(0),
+            "Relative tolerance used to determine the effective rank.\n"
+            "                           Used in gelsy and gelss.\n"
+            "                           ")
+
         ("side",
          value<char>(),
             "L = left, R = right.\n"
@@ -511,6 +572,12 @@ try
             "                           Indicates whether data is stored column-wise or row-wise.\n"
             "                           ")
 
+        ("tol",
+         value<double>()->default_value(0),
+            "Relative tolerance used to determine the numerical rank.\n"
+            "                           Used in geqp3.\n"
+            "                           ")
+
         ("trans",
          value<char>()->default_value('N'),
             "N = no transpose, T = transpose, C = conjugate transpose.\n"
@@ -568,6 +635,7 @@ try
     argus.validate_eorder("eorder");
     argus.validate_esort("esort");
     argus.validate_itype("itype");
+    argus.validate_norm_type("norm");
 
     // prepare logging infrastructure and ignore environment variables
     rocsolver_log_begin();
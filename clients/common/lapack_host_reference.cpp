@@ -321,6 +321,47 @@ void dtrtri_(char* uplo, char* diag, int* n, double* A, int* lda, int* info);
 void ctrtri_(char* uplo, char* diag, int* n, rocblas_float_complex* A, int* lda, int* info);
 void ztrtri_(char* uplo, char* diag, int* n, rocblas_double_complex* A, int* lda, int* info);
 
+void strcon_(char* norm_type,
+             char* uplo,
+             char* diag,
+             int* n,
+             float* A,
+             int* lda,
+             float* rcond,
+             float* work,
+             int* iwork,
+             int* info);
+void dtrcon_(char* norm_type,
+             char* uplo,
+             char* diag,
+             int* n,
+             double* A,
+             int* lda,
+             double* rcond,
+             double* work,
+             int* iwork,
+             int* info);
+void ctrcon_(char* norm_type,
+             char* uplo,
+             char* diag,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             float* rcond,
+             rocblas_float_complex* work,
+             float* rwork,
+             int* info);
+void ztrcon_(char* norm_type,
+             char* uplo,
+             char* diag,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             double* rcond,
+             rocblas_double_complex* work,
+             double* rwork,
+             int* info);
+
 void sgetrf_(int* m, int* n, float* A, int* lda, int* ipiv, int* info);
 void dgetrf_(int* m, int* n, double* A, int* lda, int* ipiv, int* info);
 void cgetrf_(int* m, int* n, rocblas_float_complex* A, int* lda, int* ipiv, int* info);
@@ -355,6 +396,43 @@ void zpotrs_(char* uplo,
              int* ldb,
              int* info);
 
+void spocon_(char* uplo,
+             int* n,
+             float* A,
+             int* lda,
+             float* anorm,
+             float* rcond,
+             float* work,
+             int* iwork,
+             int* info);
+void dpocon_(char* uplo,
+             int* n,
+             double* A,
+             int* lda,
+             double* anorm,
+             double* rcond,
+             double* work,
+             int* iwork,
+             int* info);
+void cpocon_(char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             float* anorm,
+             float* rcond,
+             rocblas_float_complex* work,
+             float* rwork,
+             int* info);
+void zpocon_(char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             double* anorm,
+             double* rcond,
+             rocblas_double_complex* work,
+             double* rwork,
+             int* info);
+
 void sposv_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
 void dposv_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
 void cposv_(char* uplo,
@@ -374,6 +452,71 @@ void zposv_(char* uplo,
             int* ldb,
             int* info);
 
+void sporfs_(char* uplo,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             float* AF,
+             int* ldaf,
+             float* B,
+             int* ldb,
+             float* X,
+             int* ldx,
+             float* ferr,
+             float* berr,
+             float* work,
+             int* iwork,
+             int* info);
+void dporfs_(char* uplo,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             double* AF,
+             int* ldaf,
+             double* B,
+             int* ldb,
+             double* X,
+             int* ldx,
+             double* ferr,
+             double* berr,
+             double* work,
+             int* iwork,
+             int* info);
+void cporfs_(char* uplo,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* AF,
+             int* ldaf,
+             rocblas_float_complex* B,
+             int* ldb,
+             rocblas_float_complex* X,
+             int* ldx,
+             float* ferr,
+             float* berr,
+             rocblas_float_complex* work,
+             float* rwork,
+             int* info);
+void zporfs_(char* uplo,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* AF,
+             int* ldaf,
+             rocblas_double_complex* B,
+             int* ldb,
+             rocblas_double_complex* X,
+             int* ldx,
+             double* ferr,
+             double* berr,
+             rocblas_double_complex* work,
+             double* rwork,
+             int* info);
+
 void spotri_(char* uplo, int* n, float* A, int* lda, int* info);
 void dpotri_(char* uplo, int* n, double* A, int* lda, int* info);
 void cpotri_(char* uplo, int* n, rocblas_float_complex* A, int* lda, int* info);
@@ -405,6 +548,43 @@ void zgetrs_(char* trans,
              int* ldb,
              int* info);
 
+void sgecon_(char* norm_type,
+             int* n,
+             float* A,
+             int* lda,
+             float* anorm,
+             float* rcond,
+             float* work,
+             int* iwork,
+             int* info);
+void dgecon_(char* norm_type,
+             int* n,
+             double* A,
+             int* lda,
+             double* anorm,
+             double* rcond,
+             double* work,
+             int* iwork,
+             int* info);
+void cgecon_(char* norm_type,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             float* anorm,
+             float* rcond,
+             rocblas_float_complex* work,
+             float* rwork,
+             int* info);
+void zgecon_(char* norm_type,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             double* anorm,
+             double* rcond,
+             rocblas_double_complex* work,
+             double* rwork,
+             int* info);
+
 void sgesv_(int* n, int* nrhs, float* A, int* lda, int* ipiv, float* B, int* ldb, int* info);
 void dgesv_(int* n, int* nrhs, double* A, int* lda, int* ipiv, double* B, int* ldb, int* info);
 void cgesv_(int* n,
@@ -424,6 +604,75 @@ void zgesv_(int* n,
             int* ldb,
             int* info);
 
+void sgerfs_(char* trans,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             float* AF,
+             int* ldaf,
+             int* ipiv,
+             float* B,
+             int* ldb,
+             float* X,
+             int* ldx,
+             float* ferr,
+             float* berr,
+             float* work,
+             int* iwork,
+             int* info);
+void dgerfs_(char* trans,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             double* AF,
+             int* ldaf,
+             int* ipiv,
+             double* B,
+             int* ldb,
+             double* X,
+             int* ldx,
+             double* ferr,
+             double* berr,
+             double* work,
+             int* iwork,
+             int* info);
+void cgerfs_(char* trans,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* AF,
+             int* ldaf,
+             int* ipiv,
+             rocblas_float_complex* B,
+             int* ldb,
+             rocblas_float_complex* X,
+             int* ldx,
+             float* ferr,
+             float* berr,
+             rocblas_float_complex* work,
+             float* rwork,
+             int* info);
+void zgerfs_(char* trans,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* AF,
+             int* ldaf,
+             int* ipiv,
+             rocblas_double_complex* B,
+             int* ldb,
+             rocblas_double_complex* X,
+             int* ldx,
+             double* ferr,
+             double* berr,
+             rocblas_double_complex* work,
+             double* rwork,
+             int* info);
+
 void sgels_(char* trans,
             int* m,
             int* n,
@@ -469,31 +718,345 @@ void zgels_(char* trans,
             int* lwork,
             int* info);
 
-void sgetri_(int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
-void dgetri_(int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
-void cgetri_(int* n,
+void sgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             int* jpvt,
+             float* rcond,
+             int* rank,
+             float* work,
+             int* lwork,
+             int* info);
+void dgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             int* jpvt,
+             double* rcond,
+             int* rank,
+             double* work,
+             int* lwork,
+             int* info);
+void cgelsy_(int* m,
+             int* n,
+             int* nrhs,
              rocblas_float_complex* A,
              int* lda,
-             int* ipiv,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* jpvt,
+             float* rcond,
+             int* rank,
              rocblas_float_complex* work,
              int* lwork,
+             float* rwork,
              int* info);
-void zgetri_(int* n,
+void zgelsy_(int* m,
+             int* n,
+             int* nrhs,
              rocblas_double_complex* A,
              int* lda,
-             int* ipiv,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* jpvt,
+             double* rcond,
+             int* rank,
              rocblas_double_complex* work,
              int* lwork,
+             double* rwork,
              int* info);
 
-void strtri_(char* uplo, char* diag, int* n, float* A, int* lda, int* info);
-void dtrtri_(char* uplo, char* diag, int* n, double* A, int* lda, int* info);
-void ctrtri_(char* uplo, char* diag, int* n, rocblas_float_complex* A, int* lda, int* info);
-void ztrtri_(char* uplo, char* diag, int* n, rocblas_double_complex* A, int* lda, int* info);
+void sgelss_(int* m,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             float* S,
+             float* rcond,
+             int* rank,
+             float* work,
+             int* lwork,
+             int* info);
+void dgelss_(int* m,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             double* S,
+             double* rcond,
+             int* rank,
+             double* work,
+             int* lwork,
+             int* info);
+void cgelss_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* B,
+             int* ldb,
+             float* S,
+             float* rcond,
+             int* rank,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* info);
+void zgelss_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* B,
+             int* ldb,
+             double* S,
+             double* rcond,
+             int* rank,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* info);
 
-void slarfg_(int* n, float* alpha, float* x, int* incx, float* tau);
-void dlarfg_(int* n, double* alpha, double* x, int* incx, double* tau);
-void clarfg_(int* n,
+void sggqrf_(int* n,
+             int* m,
+             int* p,
+             float* A,
+             int* lda,
+             float* taua,
+             float* B,
+             int* ldb,
+             float* taub,
+             float* work,
+             int* lwork,
+             int* info);
+void dggqrf_(int* n,
+             int* m,
+             int* p,
+             double* A,
+             int* lda,
+             double* taua,
+             double* B,
+             int* ldb,
+             double* taub,
+             double* work,
+             int* lwork,
+             int* info);
+void cggqrf_(int* n,
+             int* m,
+             int* p,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* taua,
+             rocblas_float_complex* B,
+             int* ldb,
+             rocblas_float_complex* taub,
+             rocblas_float_complex* work,
+             int* lwork,
+             int* info);
+void zggqrf_(int* n,
+             int* m,
+             int* p,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* taua,
+             rocblas_double_complex* B,
+             int* ldb,
+             rocblas_double_complex* taub,
+             rocblas_double_complex* work,
+             int* lwork,
+             int* info);
+
+void sggrqf_(int* m,
+             int* p,
+             int* n,
+             float* A,
+             int* lda,
+             float* taua,
+             float* B,
+             int* ldb,
+             float* taub,
+             float* work,
+             int* lwork,
+             int* info);
+void dggrqf_(int* m,
+             int* p,
+             int* n,
+             double* A,
+             int* lda,
+             double* taua,
+             double* B,
+             int* ldb,
+             double* taub,
+             double* work,
+             int* lwork,
+             int* info);
+void cggrqf_(int* m,
+             int* p,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* taua,
+             rocblas_float_complex* B,
+             int* ldb,
+             rocblas_float_complex* taub,
+             rocblas_float_complex* work,
+             int* lwork,
+             int* info);
+void zggrqf_(int* m,
+             int* p,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* taua,
+             rocblas_double_complex* B,
+             int* ldb,
+             rocblas_double_complex* taub,
+             rocblas_double_complex* work,
+             int* lwork,
+             int* info);
+
+void sgglse_(int* m,
+             int* n,
+             int* p,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             float* C,
+             float* D,
+             float* X,
+             float* work,
+             int* lwork,
+             int* info);
+void dgglse_(int* m,
+             int* n,
+             int* p,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             double* C,
+             double* D,
+             double* X,
+             double* work,
+             int* lwork,
+             int* info);
+void cgglse_(int* m,
+             int* n,
+             int* p,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* B,
+             int* ldb,
+             rocblas_float_complex* C,
+             rocblas_float_complex* D,
+             rocblas_float_complex* X,
+             rocblas_float_complex* work,
+             int* lwork,
+             int* info);
+void zgglse_(int* m,
+             int* n,
+             int* p,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* B,
+             int* ldb,
+             rocblas_double_complex* C,
+             rocblas_double_complex* D,
+             rocblas_double_complex* X,
+             rocblas_double_complex* work,
+             int* lwork,
+             int* info);
+
+void sggglm_(int* n,
+             int* m,
+             int* p,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             float* D,
+             float* X,
+             float* Y,
+             float* work,
+             int* lwork,
+             int* info);
+void dggglm_(int* n,
+             int* m,
+             int* p,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             double* D,
+             double* X,
+             double* Y,
+             double* work,
+             int* lwork,
+             int* info);
+void cggglm_(int* n,
+             int* m,
+             int* p,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* B,
+             int* ldb,
+             rocblas_float_complex* D,
+             rocblas_float_complex* X,
+             rocblas_float_complex* Y,
+             rocblas_float_complex* work,
+             int* lwork,
+             int* info);
+void zggglm_(int* n,
+             int* m,
+             int* p,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* B,
+             int* ldb,
+             rocblas_double_complex* D,
+             rocblas_double_complex* X,
+             rocblas_double_complex* Y,
+             rocblas_double_complex* work,
+             int* lwork,
+             int* info);
+
+void sgetri_(int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
+void dgetri_(int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
+void cgetri_(int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_float_complex* work,
+             int* lwork,
+             int* info);
+void zgetri_(int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_double_complex* work,
+             int* lwork,
+             int* info);
+
+void strtri_(char* uplo, char* diag, int* n, float* A, int* lda, int* info);
+void dtrtri_(char* uplo, char* diag, int* n, double* A, int* lda, int* info);
+void ctrtri_(char* uplo, char* diag, int* n, rocblas_float_complex* A, int* lda, int* info);
+void ztrtri_(char* uplo, char* diag, int* n, rocblas_double_complex* A, int* lda, int* info);
+
+void slarfg_(int* n, float* alpha, float* x, int* incx, float* tau);
+void dlarfg_(int* n, double* alpha, double* x, int* incx, double* tau);
+void clarfg_(int* n,
              rocblas_float_complex* alpha,
              rocblas_float_complex* x,
              int* incx,
@@ -794,6 +1357,45 @@ void zgeqrf_(int* m,
              int* lwork,
              int* info);
 
+void sgeqp3_(int* m,
+             int* n,
+             float* A,
+             int* lda,
+             int* jpvt,
+             float* ipiv,
+             float* work,
+             int* lwork,
+             int* info);
+void dgeqp3_(int* m,
+             int* n,
+             double* A,
+             int* lda,
+             int* jpvt,
+             double* ipiv,
+             double* work,
+             int* lwork,
+             int* info);
+void cgeqp3_(int* m,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             int* jpvt,
+             rocblas_float_complex* ipiv,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* info);
+void zgeqp3_(int* m,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             int* jpvt,
+             rocblas_double_complex* ipiv,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* info);
+
 void sgerq2_(int* m, int* n, float* A, int* lda, float* ipiv, float* work, int* info);
 void dgerq2_(int* m, int* n, double* A, int* lda, double* ipiv, double* work, int* info);
 void cgerq2_(int* m,
@@ -1010,6 +1612,46 @@ void zunglq_(int* m,
              int* lwork,
              int* info);
 
+void sorgr2_(int* m, int* n, int* k, float* A, int* lda, float* ipiv, float* work, int* info);
+void dorgr2_(int* m, int* n, int* k, double* A, int* lda, double* ipiv, double* work, int* info);
+void cungr2_(int* m,
+             int* n,
+             int* k,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* ipiv,
+             rocblas_float_complex* work,
+             int* info);
+void zungr2_(int* m,
+             int* n,
+             int* k,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* ipiv,
+             rocblas_double_complex* work,
+             int* info);
+
+void sorgrq_(int* m, int* n, int* k, float* A, int* lda, float* ipiv, float* work, int* lwork, int* info);
+void dorgrq_(int* m, int* n, int* k, double* A, int* lda, double* ipiv, double* work, int* lwork, int* info);
+void cungrq_(int* m,
+             int* n,
+             int* k,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* ipiv,
+             rocblas_float_complex* work,
+             int* lwork,
+             int* info);
+void zungrq_(int* m,
+             int* n,
+             int* k,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* ipiv,
+             rocblas_double_complex* work,
+             int* lwork,
+             int* info);
+
 void sorg2l_(int* m, int* n, int* k, float* A, int* lda, float* ipiv, float* work, int* info);
 void dorg2l_(int* m, int* n, int* k, double* A, int* lda, double* ipiv, double* work, int* info);
 void cung2l_(int* m,
@@ -1314,7 +1956,7 @@ void zunmlq_(char* side,
              int* sizeW,
              int* info);
 
-void sorm2l_(char* side,
+void sormr2_(char* side,
              char* trans,
              int* m,
              int* n,
@@ -1326,7 +1968,7 @@ void sorm2l_(char* side,
              int* ldc,
              float* work,
              int* info);
-void dorm2l_(char* side,
+void dormr2_(char* side,
              char* trans,
              int* m,
              int* n,
@@ -1338,7 +1980,7 @@ void dorm2l_(char* side,
              int* ldc,
              double* work,
              int* info);
-void cunm2l_(char* side,
+void cunmr2_(char* side,
              char* trans,
              int* m,
              int* n,
@@ -1350,7 +1992,7 @@ void cunm2l_(char* side,
              int* ldc,
              rocblas_float_complex* work,
              int* info);
-void zunm2l_(char* side,
+void zunmr2_(char* side,
              char* trans,
              int* m,
              int* n,
@@ -1363,7 +2005,7 @@ void zunm2l_(char* side,
              rocblas_double_complex* work,
              int* info);
 
-void sormql_(char* side,
+void sormrq_(char* side,
              char* trans,
              int* m,
              int* n,
@@ -1376,7 +2018,7 @@ void sormql_(char* side,
              float* work,
              int* sizeW,
              int* info);
-void dormql_(char* side,
+void dormrq_(char* side,
              char* trans,
              int* m,
              int* n,
@@ -1389,7 +2031,7 @@ void dormql_(char* side,
              double* work,
              int* sizeW,
              int* info);
-void cunmql_(char* side,
+void cunmrq_(char* side,
              char* trans,
              int* m,
              int* n,
@@ -1402,7 +2044,7 @@ void cunmql_(char* side,
              rocblas_float_complex* work,
              int* sizeW,
              int* info);
-void zunmql_(char* side,
+void zunmrq_(char* side,
              char* trans,
              int* m,
              int* n,
@@ -1416,8 +2058,7 @@ void zunmql_(char* side,
              int* sizeW,
              int* info);
 
-void sormbr_(char* vect,
-             char* side,
+void sorm2l_(char* side,
              char* trans,
              int* m,
              int* n,
@@ -1428,10 +2069,8 @@ void sormbr_(char* vect,
              float* C,
              int* ldc,
              float* work,
-             int* sizeW,
              int* info);
-void dormbr_(char* vect,
-             char* side,
+void dorm2l_(char* side,
              char* trans,
              int* m,
              int* n,
@@ -1442,7 +2081,112 @@ void dormbr_(char* vect,
              double* C,
              int* ldc,
              double* work,
-             int* sizeW,
+             int* info);
+void cunm2l_(char* side,
+             char* trans,
+             int* m,
+             int* n,
+             int* k,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* ipiv,
+             rocblas_float_complex* C,
+             int* ldc,
+             rocblas_float_complex* work,
+             int* info);
+void zunm2l_(char* side,
+             char* trans,
+             int* m,
+             int* n,
+             int* k,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* ipiv,
+             rocblas_double_complex* C,
+             int* ldc,
+             rocblas_double_complex* work,
+             int* info);
+
+void sormql_(char* side,
+             char* trans,
+             int* m,
+             int* n,
+             int* k,
+             float* A,
+             int* lda,
+             float* ipiv,
+             float* C,
+             int* ldc,
+             float* work,
+             int* sizeW,
+             int* info);
+void dormql_(char* side,
+             char* trans,
+             int* m,
+             int* n,
+             int* k,
+             double* A,
+             int* lda,
+             double* ipiv,
+             double* C,
+             int* ldc,
+             double* work,
+             int* sizeW,
+             int* info);
+void cunmql_(char* side,
+             char* trans,
+             int* m,
+             int* n,
+             int* k,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* ipiv,
+             rocblas_float_complex* C,
+             int* ldc,
+             rocblas_float_complex* work,
+             int* sizeW,
+             int* info);
+void zunmql_(char* side,
+             char* trans,
+             int* m,
+             int* n,
+             int* k,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* ipiv,
+             rocblas_double_complex* C,
+             int* ldc,
+             rocblas_double_complex* work,
+             int* sizeW,
+             int* info);
+
+void sormbr_(char* vect,
+             char* side,
+             char* trans,
+             int* m,
+             int* n,
+             int* k,
+             float* A,
+             int* lda,
+             float* ipiv,
+             float* C,
+             int* ldc,
+             float* work,
+             int* sizeW,
+             int* info);
+void dormbr_(char* vect,
+             char* side,
+             char* trans,
+             int* m,
+             int* n,
+             int* k,
+             double* A,
+             int* lda,
+             double* ipiv,
+             double* C,
+             int* ldc,
+             double* work,
+             int* sizeW,
              int* info);
 void cunmbr_(char* vect,
              char* side,
@@ -2460,6 +3204,105 @@ void zsytrf_(char* uplo,
              int* lwork,
              int* info);
 
+void ssytrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             int* ipiv,
+             float* B,
+             int* ldb,
+             int* info);
+void dsytrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             int* ipiv,
+             double* B,
+             int* ldb,
+             int* info);
+void csytrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* info);
+void zsytrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* info);
+
+void ssysv_(char* uplo,
+            int* n,
+            int* nrhs,
+            float* A,
+            int* lda,
+            int* ipiv,
+            float* B,
+            int* ldb,
+            float* work,
+            int* lwork,
+            int* info);
+void dsysv_(char* uplo,
+            int* n,
+            int* nrhs,
+            double* A,
+            int* lda,
+            int* ipiv,
+            double* B,
+            int* ldb,
+            double* work,
+            int* lwork,
+            int* info);
+void csysv_(char* uplo,
+            int* n,
+            int* nrhs,
+            rocblas_float_complex* A,
+            int* lda,
+            int* ipiv,
+            rocblas_float_complex* B,
+            int* ldb,
+            rocblas_float_complex* work,
+            int* lwork,
+            int* info);
+void zsysv_(char* uplo,
+            int* n,
+            int* nrhs,
+            rocblas_double_complex* A,
+            int* lda,
+            int* ipiv,
+            rocblas_double_complex* B,
+            int* ldb,
+            rocblas_double_complex* work,
+            int* lwork,
+            int* info);
+
+void ssytri_(char* uplo, int* n, float* A, int* lda, int* ipiv, float* work, int* info);
+void dsytri_(char* uplo, int* n, double* A, int* lda, int* ipiv, double* work, int* info);
+void csytri_(char* uplo,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_float_complex* work,
+             int* info);
+void zsytri_(char* uplo,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_double_complex* work,
+             int* info);
+
 void sbdsvdx_(char* uplo,
               char* svect,
               char* srange,
@@ -3540,9 +4383,9 @@ void cpu_orgl2_ungl2<rocblas_double_complex>(rocblas_int m,
     zungl2_(&m, &n, &k, A, &lda, ipiv, work, &info);
 }
 
-// orgql & ungql
+// orgrq & ungrq
 template <>
-void cpu_orgql_ungql<float>(rocblas_int m,
+void cpu_orgrq_ungrq<float>(rocblas_int m,
                             rocblas_int n,
                             rocblas_int k,
                             float* A,
@@ -3552,11 +4395,11 @@ void cpu_orgql_ungql<float>(rocblas_int m,
                             rocblas_int lwork)
 {
     int info;
-    sorgql_(&m, &n, &k, A, &lda, ipiv, work, &lwork, &info);
+    sorgrq_(&m, &n, &k, A, &lda, ipiv, work, &lwork, &info);
 }
 
 template <>
-void cpu_orgql_ungql<double>(rocblas_int m,
+void cpu_orgrq_ungrq<double>(rocblas_int m,
                              rocblas_int n,
                              rocblas_int k,
                              double* A,
@@ -3566,11 +4409,11 @@ void cpu_orgql_ungql<double>(rocblas_int m,
                              rocblas_int lwork)
 {
     int info;
-    dorgql_(&m, &n, &k, A, &lda, ipiv, work, &lwork, &info);
+    dorgrq_(&m, &n, &k, A, &lda, ipiv, work, &lwork, &info);
 }
 
 template <>
-void cpu_orgql_ungql<rocblas_float_complex>(rocblas_int m,
+void cpu_orgrq_ungrq<rocblas_float_complex>(rocblas_int m,
                                             rocblas_int n,
                                             rocblas_int k,
                                             rocblas_float_complex* A,
@@ -3580,11 +4423,11 @@ void cpu_orgql_ungql<rocblas_float_complex>(rocblas_int m,
                                             rocblas_int lwork)
 {
     int info;
-    cungql_(&m, &n, &k, A, &lda, ipiv, work, &lwork, &info);
+    cungrq_(&m, &n, &k, A, &lda, ipiv, work, &lwork, &info);
 }
 
 template <>
-void cpu_orgql_ungql<rocblas_double_complex>(rocblas_int m,
+void cpu_orgrq_ungrq<rocblas_double_complex>(rocblas_int m,
                                              rocblas_int n,
                                              rocblas_int k,
                                              rocblas_double_complex* A,
@@ -3594,12 +4437,12 @@ void cpu_orgql_ungql<rocblas_double_complex>(rocblas_int m,
                                              rocblas_int lwork)
 {
     int info;
-    zungql_(&m, &n, &k, A, &lda, ipiv, work, &lwork, &info);
+    zungrq_(&m, &n, &k, A, &lda, ipiv, work, &lwork, &info);
 }
 
-// org2l & ung2l
+// orgr2 & ungr2
 template <>
-void cpu_org2l_ung2l<float>(rocblas_int m,
+void cpu_orgr2_ungr2<float>(rocblas_int m,
                             rocblas_int n,
                             rocblas_int k,
                             float* A,
@@ -3608,11 +4451,11 @@ void cpu_org2l_ung2l<float>(rocblas_int m,
                             float* work)
 {
     int info;
-    sorg2l_(&m, &n, &k, A, &lda, ipiv, work, &info);
+    sorgr2_(&m, &n, &k, A, &lda, ipiv, work, &info);
 }
 
 template <>
-void cpu_org2l_ung2l<double>(rocblas_int m,
+void cpu_orgr2_ungr2<double>(rocblas_int m,
                              rocblas_int n,
                              rocblas_int k,
                              double* A,
@@ -3621,11 +4464,11 @@ void cpu_org2l_ung2l<double>(rocblas_int m,
                              double* work)
 {
     int info;
-    dorg2l_(&m, &n, &k, A, &lda, ipiv, work, &info);
+    dorgr2_(&m, &n, &k, A, &lda, ipiv, work, &info);
 }
 
 template <>
-void cpu_org2l_ung2l<rocblas_float_complex>(rocblas_int m,
+void cpu_orgr2_ungr2<rocblas_float_complex>(rocblas_int m,
                                             rocblas_int n,
                                             rocblas_int k,
                                             rocblas_float_complex* A,
@@ -3634,11 +4477,11 @@ void cpu_org2l_ung2l<rocblas_float_complex>(rocblas_int m,
                                             rocblas_float_complex* work)
 {
     int info;
-    cung2l_(&m, &n, &k, A, &lda, ipiv, work, &info);
+    cungr2_(&m, &n, &k, A, &lda, ipiv, work, &info);
 }
 
 template <>
-void cpu_org2l_ung2l<rocblas_double_complex>(rocblas_int m,
+void cpu_orgr2_ungr2<rocblas_double_complex>(rocblas_int m,
                                              rocblas_int n,
                                              rocblas_int k,
                                              rocblas_double_complex* A,
@@ -3647,72 +4490,182 @@ void cpu_org2l_ung2l<rocblas_double_complex>(rocblas_int m,
                                              rocblas_double_complex* work)
 {
     int info;
-    zung2l_(&m, &n, &k, A, &lda, ipiv, work, &info);
+    zungr2_(&m, &n, &k, A, &lda, ipiv, work, &info);
 }
 
-// orgbr & ungbr
+// orgql & ungql
 template <>
-void cpu_orgbr_ungbr<float>(rocblas_storev storev,
-                            rocblas_int m,
+void cpu_orgql_ungql<float>(rocblas_int m,
                             rocblas_int n,
                             rocblas_int k,
                             float* A,
                             rocblas_int lda,
-                            float* Ipiv,
+                            float* ipiv,
                             float* work,
-                            rocblas_int size_w)
+                            rocblas_int lwork)
 {
     int info;
-    char vect;
-    if(storev == rocblas_column_wise)
-        vect = 'Q';
-    else
-        vect = 'P';
-    sorgbr_(&vect, &m, &n, &k, A, &lda, Ipiv, work, &size_w, &info);
+    sorgql_(&m, &n, &k, A, &lda, ipiv, work, &lwork, &info);
 }
 
 template <>
-void cpu_orgbr_ungbr<double>(rocblas_storev storev,
-                             rocblas_int m,
+void cpu_orgql_ungql<double>(rocblas_int m,
                              rocblas_int n,
                              rocblas_int k,
                              double* A,
                              rocblas_int lda,
-                             double* Ipiv,
+                             double* ipiv,
                              double* work,
-                             rocblas_int size_w)
+                             rocblas_int lwork)
 {
     int info;
-    char vect;
-    if(storev == rocblas_column_wise)
-        vect = 'Q';
-    else
-        vect = 'P';
-    dorgbr_(&vect, &m, &n, &k, A, &lda, Ipiv, work, &size_w, &info);
+    dorgql_(&m, &n, &k, A, &lda, ipiv, work, &lwork, &info);
 }
 
 template <>
-void cpu_orgbr_ungbr<rocblas_float_complex>(rocblas_storev storev,
-                                            rocblas_int m,
+void cpu_orgql_ungql<rocblas_float_complex>(rocblas_int m,
                                             rocblas_int n,
                                             rocblas_int k,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
-                                            rocblas_float_complex* Ipiv,
+                                            rocblas_float_complex* ipiv,
                                             rocblas_float_complex* work,
-                                            rocblas_int size_w)
+                                            rocblas_int lwork)
 {
     int info;
-    char vect;
-    if(storev == rocblas_column_wise)
-        vect = 'Q';
-    else
-        vect = 'P';
-    cungbr_(&vect, &m, &n, &k, A, &lda, Ipiv, work, &size_w, &info);
+    cungql_(&m, &n, &k, A, &lda, ipiv, work, &lwork, &info);
 }
 
 template <>
-void cpu_orgbr_ungbr<rocblas_double_complex>(rocblas_storev storev,
+void cpu_orgql_ungql<rocblas_double_complex>(rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             rocblas_double_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_double_complex* ipiv,
+                                             rocblas_double_complex* work,
+                                             rocblas_int lwork)
+{
+    int info;
+    zungql_(&m, &n, &k, A, &lda, ipiv, work, &lwork, &info);
+}
+
+// org2l & ung2l
+template <>
+void cpu_org2l_ung2l<float>(rocblas_int m,
+                            rocblas_int n,
+                            rocblas_int k,
+                            float* A,
+                            rocblas_int lda,
+                            float* ipiv,
+                            float* work)
+{
+    int info;
+    sorg2l_(&m, &n, &k, A, &lda, ipiv, work, &info);
+}
+
+template <>
+void cpu_org2l_ung2l<double>(rocblas_int m,
+                             rocblas_int n,
+                             rocblas_int k,
+                             double* A,
+                             rocblas_int lda,
+                             double* ipiv,
+                             double* work)
+{
+    int info;
+    dorg2l_(&m, &n, &k, A, &lda, ipiv, work, &info);
+}
+
+template <>
+void cpu_org2l_ung2l<rocblas_float_complex>(rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_float_complex* work)
+{
+    int info;
+    cung2l_(&m, &n, &k, A, &lda, ipiv, work, &info);
+}
+
+template <>
+void cpu_org2l_ung2l<rocblas_double_complex>(rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             rocblas_double_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_double_complex* ipiv,
+                                             rocblas_double_complex* work)
+{
+    int info;
+    zung2l_(&m, &n, &k, A, &lda, ipiv, work, &info);
+}
+
+// orgbr & ungbr
+template <>
+void cpu_orgbr_ungbr<float>(rocblas_storev storev,
+                            rocblas_int m,
+                            rocblas_int n,
+                            rocblas_int k,
+                            float* A,
+                            rocblas_int lda,
+                            float* Ipiv,
+                            float* work,
+                            rocblas_int size_w)
+{
+    int info;
+    char vect;
+    if(storev == rocblas_column_wise)
+        vect = 'Q';
+    else
+        vect = 'P';
+    sorgbr_(&vect, &m, &n, &k, A, &lda, Ipiv, work, &size_w, &info);
+}
+
+template <>
+void cpu_orgbr_ungbr<double>(rocblas_storev storev,
+                             rocblas_int m,
+                             rocblas_int n,
+                             rocblas_int k,
+                             double* A,
+                             rocblas_int lda,
+                             double* Ipiv,
+                             double* work,
+                             rocblas_int size_w)
+{
+    int info;
+    char vect;
+    if(storev == rocblas_column_wise)
+        vect = 'Q';
+    else
+        vect = 'P';
+    dorgbr_(&vect, &m, &n, &k, A, &lda, Ipiv, work, &size_w, &info);
+}
+
+template <>
+void cpu_orgbr_ungbr<rocblas_float_complex>(rocblas_storev storev,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_float_complex* Ipiv,
+                                            rocblas_float_complex* work,
+                                            rocblas_int size_w)
+{
+    int info;
+    char vect;
+    if(storev == rocblas_column_wise)
+        vect = 'Q';
+    else
+        vect = 'P';
+    cungbr_(&vect, &m, &n, &k, A, &lda, Ipiv, work, &size_w, &info);
+}
+
+template <>
+void cpu_orgbr_ungbr<rocblas_double_complex>(rocblas_storev storev,
                                              rocblas_int m,
                                              rocblas_int n,
                                              rocblas_int k,
@@ -4120,9 +5073,9 @@ void cpu_orml2_unml2<rocblas_double_complex>(rocblas_side side,
     zunml2_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
 }
 
-// ormql & unmql
+// ormrq & unmrq
 template <>
-void cpu_ormql_unmql<float>(rocblas_side side,
+void cpu_ormrq_unmrq<float>(rocblas_side side,
                             rocblas_operation trans,
                             rocblas_int m,
                             rocblas_int n,
@@ -4139,11 +5092,11 @@ void cpu_ormql_unmql<float>(rocblas_side side,
     char sideC = rocblas2char_side(side);
     char transC = rocblas2char_operation(trans);
 
-    sormql_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+    sormrq_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
 }
 
 template <>
-void cpu_ormql_unmql<double>(rocblas_side side,
+void cpu_ormrq_unmrq<double>(rocblas_side side,
                              rocblas_operation trans,
                              rocblas_int m,
                              rocblas_int n,
@@ -4160,11 +5113,11 @@ void cpu_ormql_unmql<double>(rocblas_side side,
     char sideC = rocblas2char_side(side);
     char transC = rocblas2char_operation(trans);
 
-    dormql_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+    dormrq_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
 }
 
 template <>
-void cpu_ormql_unmql<rocblas_float_complex>(rocblas_side side,
+void cpu_ormrq_unmrq<rocblas_float_complex>(rocblas_side side,
                                             rocblas_operation trans,
                                             rocblas_int m,
                                             rocblas_int n,
@@ -4181,11 +5134,11 @@ void cpu_ormql_unmql<rocblas_float_complex>(rocblas_side side,
     char sideC = rocblas2char_side(side);
     char transC = rocblas2char_operation(trans);
 
-    cunmql_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+    cunmrq_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
 }
 
 template <>
-void cpu_ormql_unmql<rocblas_double_complex>(rocblas_side side,
+void cpu_ormrq_unmrq<rocblas_double_complex>(rocblas_side side,
                                              rocblas_operation trans,
                                              rocblas_int m,
                                              rocblas_int n,
@@ -4202,12 +5155,12 @@ void cpu_ormql_unmql<rocblas_double_complex>(rocblas_side side,
     char sideC = rocblas2char_side(side);
     char transC = rocblas2char_operation(trans);
 
-    zunmql_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+    zunmrq_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
 }
 
-// orm2l & unm2l
+// ormr2 & unmr2
 template <>
-void cpu_orm2l_unm2l<float>(rocblas_side side,
+void cpu_ormr2_unmr2<float>(rocblas_side side,
                             rocblas_operation trans,
                             rocblas_int m,
                             rocblas_int n,
@@ -4223,11 +5176,11 @@ void cpu_orm2l_unm2l<float>(rocblas_side side,
     char sideC = rocblas2char_side(side);
     char transC = rocblas2char_operation(trans);
 
-    sorm2l_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
+    sormr2_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
 }
 
 template <>
-void cpu_orm2l_unm2l<double>(rocblas_side side,
+void cpu_ormr2_unmr2<double>(rocblas_side side,
                              rocblas_operation trans,
                              rocblas_int m,
                              rocblas_int n,
@@ -4243,11 +5196,11 @@ void cpu_orm2l_unm2l<double>(rocblas_side side,
     char sideC = rocblas2char_side(side);
     char transC = rocblas2char_operation(trans);
 
-    dorm2l_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
+    dormr2_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
 }
 
 template <>
-void cpu_orm2l_unm2l<rocblas_float_complex>(rocblas_side side,
+void cpu_ormr2_unmr2<rocblas_float_complex>(rocblas_side side,
                                             rocblas_operation trans,
                                             rocblas_int m,
                                             rocblas_int n,
@@ -4263,11 +5216,11 @@ void cpu_orm2l_unm2l<rocblas_float_complex>(rocblas_side side,
     char sideC = rocblas2char_side(side);
     char transC = rocblas2char_operation(trans);
 
-    cunm2l_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
+    cunmr2_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
 }
 
 template <>
-void cpu_orm2l_unm2l<rocblas_double_complex>(rocblas_side side,
+void cpu_ormr2_unmr2<rocblas_double_complex>(rocblas_side side,
                                              rocblas_operation trans,
                                              rocblas_int m,
                                              rocblas_int n,
@@ -4283,13 +5236,12 @@ void cpu_orm2l_unm2l<rocblas_double_complex>(rocblas_side side,
     char sideC = rocblas2char_side(side);
     char transC = rocblas2char_operation(trans);
 
-    zunm2l_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
+    zunmr2_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
 }
 
-// ormbr & unmbr
+// ormql & unmql
 template <>
-void cpu_ormbr_unmbr<float>(rocblas_storev storev,
-                            rocblas_side side,
+void cpu_ormql_unmql<float>(rocblas_side side,
                             rocblas_operation trans,
                             rocblas_int m,
                             rocblas_int n,
@@ -4305,18 +5257,12 @@ void cpu_ormbr_unmbr<float>(rocblas_storev storev,
     int info;
     char sideC = rocblas2char_side(side);
     char transC = rocblas2char_operation(trans);
-    char vect;
-    if(storev == rocblas_column_wise)
-        vect = 'Q';
-    else
-        vect = 'P';
 
-    sormbr_(&vect, &sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+    sormql_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
 }
 
 template <>
-void cpu_ormbr_unmbr<double>(rocblas_storev storev,
-                             rocblas_side side,
+void cpu_ormql_unmql<double>(rocblas_side side,
                              rocblas_operation trans,
                              rocblas_int m,
                              rocblas_int n,
@@ -4332,18 +5278,12 @@ void cpu_ormbr_unmbr<double>(rocblas_storev storev,
     int info;
     char sideC = rocblas2char_side(side);
     char transC = rocblas2char_operation(trans);
-    char vect;
-    if(storev == rocblas_column_wise)
-        vect = 'Q';
-    else
-        vect = 'P';
 
-    dormbr_(&vect, &sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+    dormql_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
 }
 
 template <>
-void cpu_ormbr_unmbr<rocblas_float_complex>(rocblas_storev storev,
-                                            rocblas_side side,
+void cpu_ormql_unmql<rocblas_float_complex>(rocblas_side side,
                                             rocblas_operation trans,
                                             rocblas_int m,
                                             rocblas_int n,
@@ -4359,18 +5299,12 @@ void cpu_ormbr_unmbr<rocblas_float_complex>(rocblas_storev storev,
     int info;
     char sideC = rocblas2char_side(side);
     char transC = rocblas2char_operation(trans);
-    char vect;
-    if(storev == rocblas_column_wise)
-        vect = 'Q';
-    else
-        vect = 'P';
 
-    cunmbr_(&vect, &sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+    cunmql_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
 }
 
 template <>
-void cpu_ormbr_unmbr<rocblas_double_complex>(rocblas_storev storev,
-                                             rocblas_side side,
+void cpu_ormql_unmql<rocblas_double_complex>(rocblas_side side,
                                              rocblas_operation trans,
                                              rocblas_int m,
                                              rocblas_int n,
@@ -4386,129 +5320,314 @@ void cpu_ormbr_unmbr<rocblas_double_complex>(rocblas_storev storev,
     int info;
     char sideC = rocblas2char_side(side);
     char transC = rocblas2char_operation(trans);
-    char vect;
-    if(storev == rocblas_column_wise)
-        vect = 'Q';
-    else
-        vect = 'P';
 
-    zunmbr_(&vect, &sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+    zunmql_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
 }
 
-// ormtr & unmtr
+// orm2l & unm2l
 template <>
-void cpu_ormtr_unmtr<float>(rocblas_side side,
-                            rocblas_fill uplo,
+void cpu_orm2l_unm2l<float>(rocblas_side side,
                             rocblas_operation trans,
                             rocblas_int m,
                             rocblas_int n,
+                            rocblas_int k,
                             float* A,
                             rocblas_int lda,
                             float* ipiv,
                             float* C,
                             rocblas_int ldc,
-                            float* work,
-                            rocblas_int lwork)
+                            float* work)
 {
     int info;
     char sideC = rocblas2char_side(side);
-    char uploC = rocblas2char_fill(uplo);
     char transC = rocblas2char_operation(trans);
 
-    sormtr_(&sideC, &uploC, &transC, &m, &n, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+    sorm2l_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
 }
 
 template <>
-void cpu_ormtr_unmtr<double>(rocblas_side side,
-                             rocblas_fill uplo,
+void cpu_orm2l_unm2l<double>(rocblas_side side,
                              rocblas_operation trans,
                              rocblas_int m,
                              rocblas_int n,
+                             rocblas_int k,
                              double* A,
                              rocblas_int lda,
                              double* ipiv,
                              double* C,
                              rocblas_int ldc,
-                             double* work,
-                             rocblas_int lwork)
+                             double* work)
 {
     int info;
     char sideC = rocblas2char_side(side);
-    char uploC = rocblas2char_fill(uplo);
     char transC = rocblas2char_operation(trans);
 
-    dormtr_(&sideC, &uploC, &transC, &m, &n, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+    dorm2l_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
 }
 
 template <>
-void cpu_ormtr_unmtr<rocblas_float_complex>(rocblas_side side,
-                                            rocblas_fill uplo,
+void cpu_orm2l_unm2l<rocblas_float_complex>(rocblas_side side,
                                             rocblas_operation trans,
                                             rocblas_int m,
                                             rocblas_int n,
+                                            rocblas_int k,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_float_complex* ipiv,
                                             rocblas_float_complex* C,
                                             rocblas_int ldc,
-                                            rocblas_float_complex* work,
-                                            rocblas_int lwork)
+                                            rocblas_float_complex* work)
 {
     int info;
     char sideC = rocblas2char_side(side);
-    char uploC = rocblas2char_fill(uplo);
     char transC = rocblas2char_operation(trans);
 
-    cunmtr_(&sideC, &uploC, &transC, &m, &n, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+    cunm2l_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
 }
 
 template <>
-void cpu_ormtr_unmtr<rocblas_double_complex>(rocblas_side side,
-                                             rocblas_fill uplo,
+void cpu_orm2l_unm2l<rocblas_double_complex>(rocblas_side side,
                                              rocblas_operation trans,
                                              rocblas_int m,
                                              rocblas_int n,
+                                             rocblas_int k,
                                              rocblas_double_complex* A,
                                              rocblas_int lda,
                                              rocblas_double_complex* ipiv,
                                              rocblas_double_complex* C,
                                              rocblas_int ldc,
-                                             rocblas_double_complex* work,
-                                             rocblas_int lwork)
+                                             rocblas_double_complex* work)
 {
     int info;
     char sideC = rocblas2char_side(side);
-    char uploC = rocblas2char_fill(uplo);
     char transC = rocblas2char_operation(trans);
 
-    zunmtr_(&sideC, &uploC, &transC, &m, &n, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
-}
-
-// gemv
-template <>
-void cpu_gemv<float>(rocblas_operation transA,
-                     rocblas_int m,
-                     rocblas_int n,
-                     float alpha,
-                     float* A,
-                     rocblas_int lda,
-                     float* x,
-                     rocblas_int incx,
-                     float beta,
-                     float* y,
-                     rocblas_int incy)
-{
-    char transAC = rocblas2char_operation(transA);
-    sgemv_(&transAC, &m, &n, &alpha, A, &lda, x, &incx, &beta, y, &incy);
+    zunm2l_(&sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &info);
 }
 
+// ormbr & unmbr
 template <>
-void cpu_gemv<double>(rocblas_operation transA,
-                      rocblas_int m,
-                      rocblas_int n,
-                      double alpha,
-                      double* A,
-                      rocblas_int lda,
+void cpu_ormbr_unmbr<float>(rocblas_storev storev,
+                            rocblas_side side,
+                            rocblas_operation trans,
+                            rocblas_int m,
+                            rocblas_int n,
+                            rocblas_int k,
+                            float* A,
+                            rocblas_int lda,
+                            float* ipiv,
+                            float* C,
+                            rocblas_int ldc,
+                            float* work,
+                            rocblas_int lwork)
+{
+    int info;
+    char sideC = rocblas2char_side(side);
+    char transC = rocblas2char_operation(trans);
+    char vect;
+    if(storev == rocblas_column_wise)
+        vect = 'Q';
+    else
+        vect = 'P';
+
+    sormbr_(&vect, &sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+}
+
+template <>
+void cpu_ormbr_unmbr<double>(rocblas_storev storev,
+                             rocblas_side side,
+                             rocblas_operation trans,
+                             rocblas_int m,
+                             rocblas_int n,
+                             rocblas_int k,
+                             double* A,
+                             rocblas_int lda,
+                             double* ipiv,
+                             double* C,
+                             rocblas_int ldc,
+                             double* work,
+                             rocblas_int lwork)
+{
+    int info;
+    char sideC = rocblas2char_side(side);
+    char transC = rocblas2char_operation(trans);
+    char vect;
+    if(storev == rocblas_column_wise)
+        vect = 'Q';
+    else
+        vect = 'P';
+
+    dormbr_(&vect, &sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+}
+
+template <>
+void cpu_ormbr_unmbr<rocblas_float_complex>(rocblas_storev storev,
+                                            rocblas_side side,
+                                            rocblas_operation trans,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_float_complex* C,
+                                            rocblas_int ldc,
+                                            rocblas_float_complex* work,
+                                            rocblas_int lwork)
+{
+    int info;
+    char sideC = rocblas2char_side(side);
+    char transC = rocblas2char_operation(trans);
+    char vect;
+    if(storev == rocblas_column_wise)
+        vect = 'Q';
+    else
+        vect = 'P';
+
+    cunmbr_(&vect, &sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+}
+
+template <>
+void cpu_ormbr_unmbr<rocblas_double_complex>(rocblas_storev storev,
+                                             rocblas_side side,
+                                             rocblas_operation trans,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_int k,
+                                             rocblas_double_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_double_complex* ipiv,
+                                             rocblas_double_complex* C,
+                                             rocblas_int ldc,
+                                             rocblas_double_complex* work,
+                                             rocblas_int lwork)
+{
+    int info;
+    char sideC = rocblas2char_side(side);
+    char transC = rocblas2char_operation(trans);
+    char vect;
+    if(storev == rocblas_column_wise)
+        vect = 'Q';
+    else
+        vect = 'P';
+
+    zunmbr_(&vect, &sideC, &transC, &m, &n, &k, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+}
+
+// ormtr & unmtr
+template <>
+void cpu_ormtr_unmtr<float>(rocblas_side side,
+                            rocblas_fill uplo,
+                            rocblas_operation trans,
+                            rocblas_int m,
+                            rocblas_int n,
+                            float* A,
+                            rocblas_int lda,
+                            float* ipiv,
+                            float* C,
+                            rocblas_int ldc,
+                            float* work,
+                            rocblas_int lwork)
+{
+    int info;
+    char sideC = rocblas2char_side(side);
+    char uploC = rocblas2char_fill(uplo);
+    char transC = rocblas2char_operation(trans);
+
+    sormtr_(&sideC, &uploC, &transC, &m, &n, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+}
+
+template <>
+void cpu_ormtr_unmtr<double>(rocblas_side side,
+                             rocblas_fill uplo,
+                             rocblas_operation trans,
+                             rocblas_int m,
+                             rocblas_int n,
+                             double* A,
+                             rocblas_int lda,
+                             double* ipiv,
+                             double* C,
+                             rocblas_int ldc,
+                             double* work,
+                             rocblas_int lwork)
+{
+    int info;
+    char sideC = rocblas2char_side(side);
+    char uploC = rocblas2char_fill(uplo);
+    char transC = rocblas2char_operation(trans);
+
+    dormtr_(&sideC, &uploC, &transC, &m, &n, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+}
+
+template <>
+void cpu_ormtr_unmtr<rocblas_float_complex>(rocblas_side side,
+                                            rocblas_fill uplo,
+                                            rocblas_operation trans,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_float_complex* C,
+                                            rocblas_int ldc,
+                                            rocblas_float_complex* work,
+                                            rocblas_int lwork)
+{
+    int info;
+    char sideC = rocblas2char_side(side);
+    char uploC = rocblas2char_fill(uplo);
+    char transC = rocblas2char_operation(trans);
+
+    cunmtr_(&sideC, &uploC, &transC, &m, &n, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+}
+
+template <>
+void cpu_ormtr_unmtr<rocblas_double_complex>(rocblas_side side,
+                                             rocblas_fill uplo,
+                                             rocblas_operation trans,
+                                             rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_double_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_double_complex* ipiv,
+                                             rocblas_double_complex* C,
+                                             rocblas_int ldc,
+                                             rocblas_double_complex* work,
+                                             rocblas_int lwork)
+{
+    int info;
+    char sideC = rocblas2char_side(side);
+    char uploC = rocblas2char_fill(uplo);
+    char transC = rocblas2char_operation(trans);
+
+    zunmtr_(&sideC, &uploC, &transC, &m, &n, A, &lda, ipiv, C, &ldc, work, &lwork, &info);
+}
+
+// gemv
+template <>
+void cpu_gemv<float>(rocblas_operation transA,
+                     rocblas_int m,
+                     rocblas_int n,
+                     float alpha,
+                     float* A,
+                     rocblas_int lda,
+                     float* x,
+                     rocblas_int incx,
+                     float beta,
+                     float* y,
+                     rocblas_int incy)
+{
+    char transAC = rocblas2char_operation(transA);
+    sgemv_(&transAC, &m, &n, &alpha, A, &lda, x, &incx, &beta, y, &incy);
+}
+
+template <>
+void cpu_gemv<double>(rocblas_operation transA,
+                      rocblas_int m,
+                      rocblas_int n,
+                      double alpha,
+                      double* A,
+                      rocblas_int lda,
                       double* x,
                       rocblas_int incx,
                       double beta,
@@ -5134,40 +6253,105 @@ void cpu_potrs(rocblas_fill uplo,
     zpotrs_(&uploC, &n, &nrhs, A, &lda, B, &ldb, &info);
 }
 
-// posv
+// pocon
 template <>
-void cpu_posv(rocblas_fill uplo,
-              rocblas_int n,
-              rocblas_int nrhs,
-              float* A,
-              rocblas_int lda,
-              float* B,
-              rocblas_int ldb,
-              rocblas_int* info)
+void cpu_pocon(rocblas_fill uplo,
+               rocblas_int n,
+               float* A,
+               rocblas_int lda,
+               float anorm,
+               float* rcond,
+               float* work,
+               float* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
 {
     char uploC = rocblas2char_fill(uplo);
-    sposv_(&uploC, &n, &nrhs, A, &lda, B, &ldb, info);
+    spocon_(&uploC, &n, A, &lda, &anorm, rcond, work, iwork, info);
 }
 
 template <>
-void cpu_posv(rocblas_fill uplo,
-              rocblas_int n,
-              rocblas_int nrhs,
-              double* A,
-              rocblas_int lda,
-              double* B,
-              rocblas_int ldb,
-              rocblas_int* info)
+void cpu_pocon(rocblas_fill uplo,
+               rocblas_int n,
+               double* A,
+               rocblas_int lda,
+               double anorm,
+               double* rcond,
+               double* work,
+               double* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
 {
     char uploC = rocblas2char_fill(uplo);
-    dposv_(&uploC, &n, &nrhs, A, &lda, B, &ldb, info);
+    dpocon_(&uploC, &n, A, &lda, &anorm, rcond, work, iwork, info);
 }
 
 template <>
-void cpu_posv(rocblas_fill uplo,
-              rocblas_int n,
-              rocblas_int nrhs,
-              rocblas_float_complex* A,
+void cpu_pocon(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               float anorm,
+               float* rcond,
+               rocblas_float_complex* work,
+               float* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    cpocon_(&uploC, &n, A, &lda, &anorm, rcond, work, rwork, info);
+}
+
+template <>
+void cpu_pocon(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               double anorm,
+               double* rcond,
+               rocblas_double_complex* work,
+               double* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    zpocon_(&uploC, &n, A, &lda, &anorm, rcond, work, rwork, info);
+}
+
+// posv
+template <>
+void cpu_posv(rocblas_fill uplo,
+              rocblas_int n,
+              rocblas_int nrhs,
+              float* A,
+              rocblas_int lda,
+              float* B,
+              rocblas_int ldb,
+              rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    sposv_(&uploC, &n, &nrhs, A, &lda, B, &ldb, info);
+}
+
+template <>
+void cpu_posv(rocblas_fill uplo,
+              rocblas_int n,
+              rocblas_int nrhs,
+              double* A,
+              rocblas_int lda,
+              double* B,
+              rocblas_int ldb,
+              rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    dposv_(&uploC, &n, &nrhs, A, &lda, B, &ldb, info);
+}
+
+template <>
+void cpu_posv(rocblas_fill uplo,
+              rocblas_int n,
+              rocblas_int nrhs,
+              rocblas_float_complex* A,
               rocblas_int lda,
               rocblas_float_complex* B,
               rocblas_int ldb,
@@ -5191,6 +6375,98 @@ void cpu_posv(rocblas_fill uplo,
     zposv_(&uploC, &n, &nrhs, A, &lda, B, &ldb, info);
 }
 
+// porfs
+template <>
+void cpu_porfs(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int nrhs,
+               float* A,
+               rocblas_int lda,
+               float* AF,
+               rocblas_int ldaf,
+               float* B,
+               rocblas_int ldb,
+               float* X,
+               rocblas_int ldx,
+               float* ferr,
+               float* berr,
+               float* work,
+               float* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    sporfs_(&uploC, &n, &nrhs, A, &lda, AF, &ldaf, B, &ldb, X, &ldx, ferr, berr, work, iwork, info);
+}
+
+template <>
+void cpu_porfs(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int nrhs,
+               double* A,
+               rocblas_int lda,
+               double* AF,
+               rocblas_int ldaf,
+               double* B,
+               rocblas_int ldb,
+               double* X,
+               rocblas_int ldx,
+               double* ferr,
+               double* berr,
+               double* work,
+               double* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    dporfs_(&uploC, &n, &nrhs, A, &lda, AF, &ldaf, B, &ldb, X, &ldx, ferr, berr, work, iwork, info);
+}
+
+template <>
+void cpu_porfs(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int nrhs,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               rocblas_float_complex* AF,
+               rocblas_int ldaf,
+               rocblas_float_complex* B,
+               rocblas_int ldb,
+               rocblas_float_complex* X,
+               rocblas_int ldx,
+               float* ferr,
+               float* berr,
+               rocblas_float_complex* work,
+               float* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    cporfs_(&uploC, &n, &nrhs, A, &lda, AF, &ldaf, B, &ldb, X, &ldx, ferr, berr, work, rwork, info);
+}
+
+template <>
+void cpu_porfs(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int nrhs,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               rocblas_double_complex* AF,
+               rocblas_int ldaf,
+               rocblas_double_complex* B,
+               rocblas_int ldb,
+               rocblas_double_complex* X,
+               rocblas_int ldx,
+               double* ferr,
+               double* berr,
+               rocblas_double_complex* work,
+               double* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    zporfs_(&uploC, &n, &nrhs, A, &lda, AF, &ldaf, B, &ldb, X, &ldx, ferr, berr, work, rwork, info);
+}
 // potri
 template <>
 void cpu_potri(rocblas_fill uplo, rocblas_int n, float* A, rocblas_int lda, rocblas_int* info)
@@ -5374,6 +6650,71 @@ void cpu_getrs<rocblas_double_complex>(rocblas_operation trans,
     zgetrs_(&transC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
 }
 
+// gecon
+template <>
+void cpu_gecon(rocblas_norm_type norm_type,
+               rocblas_int n,
+               float* A,
+               rocblas_int lda,
+               float anorm,
+               float* rcond,
+               float* work,
+               float* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char normC = rocblas2char_norm_type(norm_type);
+    sgecon_(&normC, &n, A, &lda, &anorm, rcond, work, iwork, info);
+}
+
+template <>
+void cpu_gecon(rocblas_norm_type norm_type,
+               rocblas_int n,
+               double* A,
+               rocblas_int lda,
+               double anorm,
+               double* rcond,
+               double* work,
+               double* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char normC = rocblas2char_norm_type(norm_type);
+    dgecon_(&normC, &n, A, &lda, &anorm, rcond, work, iwork, info);
+}
+
+template <>
+void cpu_gecon(rocblas_norm_type norm_type,
+               rocblas_int n,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               float anorm,
+               float* rcond,
+               rocblas_float_complex* work,
+               float* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char normC = rocblas2char_norm_type(norm_type);
+    cgecon_(&normC, &n, A, &lda, &anorm, rcond, work, rwork, info);
+}
+
+template <>
+void cpu_gecon(rocblas_norm_type norm_type,
+               rocblas_int n,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               double anorm,
+               double* rcond,
+               rocblas_double_complex* work,
+               double* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char normC = rocblas2char_norm_type(norm_type);
+    zgecon_(&normC, &n, A, &lda, &anorm, rcond, work, rwork, info);
+}
+
 // gesv
 template <>
 void cpu_gesv<float>(rocblas_int n,
@@ -5427,6 +6768,107 @@ void cpu_gesv<rocblas_double_complex>(rocblas_int n,
     zgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
 }
 
+// gerfs
+template <>
+void cpu_gerfs(rocblas_operation trans,
+               rocblas_int n,
+               rocblas_int nrhs,
+               float* A,
+               rocblas_int lda,
+               float* AF,
+               rocblas_int ldaf,
+               rocblas_int* ipiv,
+               float* B,
+               rocblas_int ldb,
+               float* X,
+               rocblas_int ldx,
+               float* ferr,
+               float* berr,
+               float* work,
+               float* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char transC = rocblas2char_operation(trans);
+    sgerfs_(&transC, &n, &nrhs, A, &lda, AF, &ldaf, ipiv, B, &ldb, X, &ldx, ferr, berr, work, iwork,
+            info);
+}
+
+template <>
+void cpu_gerfs(rocblas_operation trans,
+               rocblas_int n,
+               rocblas_int nrhs,
+               double* A,
+               rocblas_int lda,
+               double* AF,
+               rocblas_int ldaf,
+               rocblas_int* ipiv,
+               double* B,
+               rocblas_int ldb,
+               double* X,
+               rocblas_int ldx,
+               double* ferr,
+               double* berr,
+               double* work,
+               double* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char transC = rocblas2char_operation(trans);
+    dgerfs_(&transC, &n, &nrhs, A, &lda, AF, &ldaf, ipiv, B, &ldb, X, &ldx, ferr, berr, work, iwork,
+            info);
+}
+
+template <>
+void cpu_gerfs(rocblas_operation trans,
+               rocblas_int n,
+               rocblas_int nrhs,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               rocblas_float_complex* AF,
+               rocblas_int ldaf,
+               rocblas_int* ipiv,
+               rocblas_float_complex* B,
+               rocblas_int ldb,
+               rocblas_float_complex* X,
+               rocblas_int ldx,
+               float* ferr,
+               float* berr,
+               rocblas_float_complex* work,
+               float* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char transC = rocblas2char_operation(trans);
+    cgerfs_(&transC, &n, &nrhs, A, &lda, AF, &ldaf, ipiv, B, &ldb, X, &ldx, ferr, berr, work, rwork,
+            info);
+}
+
+template <>
+void cpu_gerfs(rocblas_operation trans,
+               rocblas_int n,
+               rocblas_int nrhs,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               rocblas_double_complex* AF,
+               rocblas_int ldaf,
+               rocblas_int* ipiv,
+               rocblas_double_complex* B,
+               rocblas_int ldb,
+               rocblas_double_complex* X,
+               rocblas_int ldx,
+               double* ferr,
+               double* berr,
+               rocblas_double_complex* work,
+               double* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char transC = rocblas2char_operation(trans);
+    zgerfs_(&transC, &n, &nrhs, A, &lda, AF, &ldaf, ipiv, B, &ldb, X, &ldx, ferr, berr, work, rwork,
+            info);
+}
+
 // gels
 template <>
 void cpu_gels<float>(rocblas_operation transR,
@@ -5492,8 +6934,446 @@ void cpu_gels<rocblas_double_complex>(rocblas_operation transR,
                                       rocblas_int lwork,
                                       rocblas_int* info)
 {
-    char trans = rocblas2char_operation(transR);
-    zgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+    char trans = rocblas2char_operation(transR);
+    zgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
+}
+
+// gelsy
+template <>
+void cpu_gelsy(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               float* A,
+               rocblas_int lda,
+               float* B,
+               rocblas_int ldb,
+               rocblas_int* jpvt,
+               float rcond,
+               rocblas_int* rank,
+               float* work,
+               rocblas_int lwork,
+               float* rwork)
+{
+    int info;
+    sgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, &info);
+}
+
+template <>
+void cpu_gelsy(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               double* A,
+               rocblas_int lda,
+               double* B,
+               rocblas_int ldb,
+               rocblas_int* jpvt,
+               double rcond,
+               rocblas_int* rank,
+               double* work,
+               rocblas_int lwork,
+               double* rwork)
+{
+    int info;
+    dgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, &info);
+}
+
+template <>
+void cpu_gelsy(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               rocblas_float_complex* B,
+               rocblas_int ldb,
+               rocblas_int* jpvt,
+               float rcond,
+               rocblas_int* rank,
+               rocblas_float_complex* work,
+               rocblas_int lwork,
+               float* rwork)
+{
+    int info;
+    cgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, rwork, &info);
+}
+
+template <>
+void cpu_gelsy(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               rocblas_double_complex* B,
+               rocblas_int ldb,
+               rocblas_int* jpvt,
+               double rcond,
+               rocblas_int* rank,
+               rocblas_double_complex* work,
+               rocblas_int lwork,
+               double* rwork)
+{
+    int info;
+    zgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, rwork, &info);
+}
+
+// gelss
+template <>
+void cpu_gelss(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               float* A,
+               rocblas_int lda,
+               float* B,
+               rocblas_int ldb,
+               float* S,
+               float rcond,
+               rocblas_int* rank,
+               float* work,
+               rocblas_int lwork,
+               float* rwork,
+               rocblas_int* info)
+{
+    sgelss_(&m, &n, &nrhs, A, &lda, B, &ldb, S, &rcond, rank, work, &lwork, info);
+}
+
+template <>
+void cpu_gelss(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               double* A,
+               rocblas_int lda,
+               double* B,
+               rocblas_int ldb,
+               double* S,
+               double rcond,
+               rocblas_int* rank,
+               double* work,
+               rocblas_int lwork,
+               double* rwork,
+               rocblas_int* info)
+{
+    dgelss_(&m, &n, &nrhs, A, &lda, B, &ldb, S, &rcond, rank, work, &lwork, info);
+}
+
+template <>
+void cpu_gelss(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               rocblas_float_complex* B,
+               rocblas_int ldb,
+               float* S,
+               float rcond,
+               rocblas_int* rank,
+               rocblas_float_complex* work,
+               rocblas_int lwork,
+               float* rwork,
+               rocblas_int* info)
+{
+    cgelss_(&m, &n, &nrhs, A, &lda, B, &ldb, S, &rcond, rank, work, &lwork, rwork, info);
+}
+
+template <>
+void cpu_gelss(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               rocblas_double_complex* B,
+               rocblas_int ldb,
+               double* S,
+               double rcond,
+               rocblas_int* rank,
+               rocblas_double_complex* work,
+               rocblas_int lwork,
+               double* rwork,
+               rocblas_int* info)
+{
+    zgelss_(&m, &n, &nrhs, A, &lda, B, &ldb, S, &rcond, rank, work, &lwork, rwork, info);
+}
+
+// ggqrf
+template <>
+void cpu_ggqrf(rocblas_int n,
+               rocblas_int m,
+               rocblas_int p,
+               float* A,
+               rocblas_int lda,
+               float* taua,
+               float* B,
+               rocblas_int ldb,
+               float* taub,
+               float* work,
+               rocblas_int lwork)
+{
+    int info;
+    sggqrf_(&n, &m, &p, A, &lda, taua, B, &ldb, taub, work, &lwork, &info);
+}
+
+template <>
+void cpu_ggqrf(rocblas_int n,
+               rocblas_int m,
+               rocblas_int p,
+               double* A,
+               rocblas_int lda,
+               double* taua,
+               double* B,
+               rocblas_int ldb,
+               double* taub,
+               double* work,
+               rocblas_int lwork)
+{
+    int info;
+    dggqrf_(&n, &m, &p, A, &lda, taua, B, &ldb, taub, work, &lwork, &info);
+}
+
+template <>
+void cpu_ggqrf(rocblas_int n,
+               rocblas_int m,
+               rocblas_int p,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               rocblas_float_complex* taua,
+               rocblas_float_complex* B,
+               rocblas_int ldb,
+               rocblas_float_complex* taub,
+               rocblas_float_complex* work,
+               rocblas_int lwork)
+{
+    int info;
+    cggqrf_(&n, &m, &p, A, &lda, taua, B, &ldb, taub, work, &lwork, &info);
+}
+
+template <>
+void cpu_ggqrf(rocblas_int n,
+               rocblas_int m,
+               rocblas_int p,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               rocblas_double_complex* taua,
+               rocblas_double_complex* B,
+               rocblas_int ldb,
+               rocblas_double_complex* taub,
+               rocblas_double_complex* work,
+               rocblas_int lwork)
+{
+    int info;
+    zggqrf_(&n, &m, &p, A, &lda, taua, B, &ldb, taub, work, &lwork, &info);
+}
+
+// ggrqf
+template <>
+void cpu_ggrqf(rocblas_int m,
+               rocblas_int p,
+               rocblas_int n,
+               float* A,
+               rocblas_int lda,
+               float* taua,
+               float* B,
+               rocblas_int ldb,
+               float* taub,
+               float* work,
+               rocblas_int lwork)
+{
+    int info;
+    sggrqf_(&m, &p, &n, A, &lda, taua, B, &ldb, taub, work, &lwork, &info);
+}
+
+template <>
+void cpu_ggrqf(rocblas_int m,
+               rocblas_int p,
+               rocblas_int n,
+               double* A,
+               rocblas_int lda,
+               double* taua,
+               double* B,
+               rocblas_int ldb,
+               double* taub,
+               double* work,
+               rocblas_int lwork)
+{
+    int info;
+    dggrqf_(&m, &p, &n, A, &lda, taua, B, &ldb, taub, work, &lwork, &info);
+}
+
+template <>
+void cpu_ggrqf(rocblas_int m,
+               rocblas_int p,
+               rocblas_int n,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               rocblas_float_complex* taua,
+               rocblas_float_complex* B,
+               rocblas_int ldb,
+               rocblas_float_complex* taub,
+               rocblas_float_complex* work,
+               rocblas_int lwork)
+{
+    int info;
+    cggrqf_(&m, &p, &n, A, &lda, taua, B, &ldb, taub, work, &lwork, &info);
+}
+
+template <>
+void cpu_ggrqf(rocblas_int m,
+               rocblas_int p,
+               rocblas_int n,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               rocblas_double_complex* taua,
+               rocblas_double_complex* B,
+               rocblas_int ldb,
+               rocblas_double_complex* taub,
+               rocblas_double_complex* work,
+               rocblas_int lwork)
+{
+    int info;
+    zggrqf_(&m, &p, &n, A, &lda, taua, B, &ldb, taub, work, &lwork, &info);
+}
+
+// gglse
+template <>
+void cpu_gglse(rocblas_int m,
+               rocblas_int n,
+               rocblas_int p,
+               float* A,
+               rocblas_int lda,
+               float* B,
+               rocblas_int ldb,
+               float* C,
+               float* D,
+               float* X,
+               float* work,
+               rocblas_int lwork,
+               rocblas_int* info)
+{
+    sgglse_(&m, &n, &p, A, &lda, B, &ldb, C, D, X, work, &lwork, info);
+}
+
+template <>
+void cpu_gglse(rocblas_int m,
+               rocblas_int n,
+               rocblas_int p,
+               double* A,
+               rocblas_int lda,
+               double* B,
+               rocblas_int ldb,
+               double* C,
+               double* D,
+               double* X,
+               double* work,
+               rocblas_int lwork,
+               rocblas_int* info)
+{
+    dgglse_(&m, &n, &p, A, &lda, B, &ldb, C, D, X, work, &lwork, info);
+}
+
+template <>
+void cpu_gglse(rocblas_int m,
+               rocblas_int n,
+               rocblas_int p,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               rocblas_float_complex* B,
+               rocblas_int ldb,
+               rocblas_float_complex* C,
+               rocblas_float_complex* D,
+               rocblas_float_complex* X,
+               rocblas_float_complex* work,
+               rocblas_int lwork,
+               rocblas_int* info)
+{
+    cgglse_(&m, &n, &p, A, &lda, B, &ldb, C, D, X, work, &lwork, info);
+}
+
+template <>
+void cpu_gglse(rocblas_int m,
+               rocblas_int n,
+               rocblas_int p,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               rocblas_double_complex* B,
+               rocblas_int ldb,
+               rocblas_double_complex* C,
+               rocblas_double_complex* D,
+               rocblas_double_complex* X,
+               rocblas_double_complex* work,
+               rocblas_int lwork,
+               rocblas_int* info)
+{
+    zgglse_(&m, &n, &p, A, &lda, B, &ldb, C, D, X, work, &lwork, info);
+}
+
+// ggglm
+template <>
+void cpu_ggglm(rocblas_int n,
+               rocblas_int m,
+               rocblas_int p,
+               float* A,
+               rocblas_int lda,
+               float* B,
+               rocblas_int ldb,
+               float* D,
+               float* X,
+               float* Y,
+               float* work,
+               rocblas_int lwork,
+               rocblas_int* info)
+{
+    sggglm_(&n, &m, &p, A, &lda, B, &ldb, D, X, Y, work, &lwork, info);
+}
+
+template <>
+void cpu_ggglm(rocblas_int n,
+               rocblas_int m,
+               rocblas_int p,
+               double* A,
+               rocblas_int lda,
+               double* B,
+               rocblas_int ldb,
+               double* D,
+               double* X,
+               double* Y,
+               double* work,
+               rocblas_int lwork,
+               rocblas_int* info)
+{
+    dggglm_(&n, &m, &p, A, &lda, B, &ldb, D, X, Y, work, &lwork, info);
+}
+
+template <>
+void cpu_ggglm(rocblas_int n,
+               rocblas_int m,
+               rocblas_int p,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               rocblas_float_complex* B,
+               rocblas_int ldb,
+               rocblas_float_complex* D,
+               rocblas_float_complex* X,
+               rocblas_float_complex* Y,
+               rocblas_float_complex* work,
+               rocblas_int lwork,
+               rocblas_int* info)
+{
+    cggglm_(&n, &m, &p, A, &lda, B, &ldb, D, X, Y, work, &lwork, info);
+}
+
+template <>
+void cpu_ggglm(rocblas_int n,
+               rocblas_int m,
+               rocblas_int p,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               rocblas_double_complex* B,
+               rocblas_int ldb,
+               rocblas_double_complex* D,
+               rocblas_double_complex* X,
+               rocblas_double_complex* Y,
+               rocblas_double_complex* work,
+               rocblas_int lwork,
+               rocblas_int* info)
+{
+    zggglm_(&n, &m, &p, A, &lda, B, &ldb, D, X, Y, work, &lwork, info);
 }
 
 // trtri
@@ -5549,6 +7429,83 @@ void cpu_trtri<rocblas_double_complex>(rocblas_fill uplo,
     ztrtri_(&uploC, &diagC, &n, A, &lda, info);
 }
 
+// trcon
+template <>
+void cpu_trcon(rocblas_norm_type norm_type,
+               rocblas_fill uplo,
+               rocblas_diagonal diag,
+               rocblas_int n,
+               float* A,
+               rocblas_int lda,
+               float* rcond,
+               float* work,
+               float* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char normC = rocblas2char_norm_type(norm_type);
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    strcon_(&normC, &uploC, &diagC, &n, A, &lda, rcond, work, iwork, info);
+}
+
+template <>
+void cpu_trcon(rocblas_norm_type norm_type,
+               rocblas_fill uplo,
+               rocblas_diagonal diag,
+               rocblas_int n,
+               double* A,
+               rocblas_int lda,
+               double* rcond,
+               double* work,
+               double* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char normC = rocblas2char_norm_type(norm_type);
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    dtrcon_(&normC, &uploC, &diagC, &n, A, &lda, rcond, work, iwork, info);
+}
+
+template <>
+void cpu_trcon(rocblas_norm_type norm_type,
+               rocblas_fill uplo,
+               rocblas_diagonal diag,
+               rocblas_int n,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               float* rcond,
+               rocblas_float_complex* work,
+               float* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char normC = rocblas2char_norm_type(norm_type);
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    ctrcon_(&normC, &uploC, &diagC, &n, A, &lda, rcond, work, rwork, info);
+}
+
+template <>
+void cpu_trcon(rocblas_norm_type norm_type,
+               rocblas_fill uplo,
+               rocblas_diagonal diag,
+               rocblas_int n,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               double* rcond,
+               rocblas_double_complex* work,
+               double* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info)
+{
+    char normC = rocblas2char_norm_type(norm_type);
+    char uploC = rocblas2char_fill(uplo);
+    char diagC = rocblas2char_diagonal(diag);
+    ztrcon_(&normC, &uploC, &diagC, &n, A, &lda, rcond, work, rwork, info);
+}
+
 // getri
 template <>
 void cpu_getri<float>(rocblas_int n,
@@ -5651,6 +7608,67 @@ void cpu_geqrf<rocblas_double_complex>(rocblas_int m,
     zgeqrf_(&m, &n, A, &lda, ipiv, work, &lwork, &info);
 }
 
+// geqp3
+template <>
+void cpu_geqp3(rocblas_int m,
+               rocblas_int n,
+               float* A,
+               rocblas_int lda,
+               rocblas_int* jpvt,
+               float* ipiv,
+               float* work,
+               rocblas_int lwork,
+               float* rwork)
+{
+    int info;
+    sgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, &info);
+}
+
+template <>
+void cpu_geqp3(rocblas_int m,
+               rocblas_int n,
+               double* A,
+               rocblas_int lda,
+               rocblas_int* jpvt,
+               double* ipiv,
+               double* work,
+               rocblas_int lwork,
+               double* rwork)
+{
+    int info;
+    dgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, &info);
+}
+
+template <>
+void cpu_geqp3(rocblas_int m,
+               rocblas_int n,
+               rocblas_float_complex* A,
+               rocblas_int lda,
+               rocblas_int* jpvt,
+               rocblas_float_complex* ipiv,
+               rocblas_float_complex* work,
+               rocblas_int lwork,
+               float* rwork)
+{
+    int info;
+    cgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, rwork, &info);
+}
+
+template <>
+void cpu_geqp3(rocblas_int m,
+               rocblas_int n,
+               rocblas_double_complex* A,
+               rocblas_int lda,
+               rocblas_int* jpvt,
+               rocblas_double_complex* ipiv,
+               rocblas_double_complex* work,
+               rocblas_int lwork,
+               double* rwork)
+{
+    int info;
+    zgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, rwork, &info);
+}
+
 // geqr2
 template <>
 void cpu_geqr2<float>(rocblas_int m, rocblas_int n, float* A, rocblas_int lda, float* ipiv, float* work)
@@ -7376,6 +9394,189 @@ void cpu_sytrf<rocblas_double_complex>(rocblas_fill uplo,
     zsytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
 }
 
+// sytrs
+template <>
+void cpu_sytrs<float>(rocblas_fill uplo,
+                      rocblas_int n,
+                      rocblas_int nrhs,
+                      float* A,
+                      rocblas_int lda,
+                      rocblas_int* ipiv,
+                      float* B,
+                      rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    ssytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cpu_sytrs<double>(rocblas_fill uplo,
+                       rocblas_int n,
+                       rocblas_int nrhs,
+                       double* A,
+                       rocblas_int lda,
+                       rocblas_int* ipiv,
+                       double* B,
+                       rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    dsytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cpu_sytrs<rocblas_float_complex>(rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_int* ipiv,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    csytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cpu_sytrs<rocblas_double_complex>(rocblas_fill uplo,
+                                       rocblas_int n,
+                                       rocblas_int nrhs,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_int* ipiv,
+                                       rocblas_double_complex* B,
+                                       rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    zsytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+// sysv
+template <>
+void cpu_sysv<float>(rocblas_fill uplo,
+                     rocblas_int n,
+                     rocblas_int nrhs,
+                     float* A,
+                     rocblas_int lda,
+                     rocblas_int* ipiv,
+                     float* B,
+                     rocblas_int ldb,
+                     float* work,
+                     rocblas_int lwork,
+                     rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    ssysv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cpu_sysv<double>(rocblas_fill uplo,
+                      rocblas_int n,
+                      rocblas_int nrhs,
+                      double* A,
+                      rocblas_int lda,
+                      rocblas_int* ipiv,
+                      double* B,
+                      rocblas_int ldb,
+                      double* work,
+                      rocblas_int lwork,
+                      rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    dsysv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cpu_sysv<rocblas_float_complex>(rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_int* ipiv,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_float_complex* work,
+                                     rocblas_int lwork,
+                                     rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    csysv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+
+template <>
+void cpu_sysv<rocblas_double_complex>(rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_int* ipiv,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_double_complex* work,
+                                      rocblas_int lwork,
+                                      rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    zsysv_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, work, &lwork, info);
+}
+
+// sytri
+template <>
+void cpu_sytri<float>(rocblas_fill uplo,
+                      rocblas_int n,
+                      float* A,
+                      rocblas_int lda,
+                      rocblas_int* ipiv,
+                      float* work,
+                      rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    ssytri_(&uploC, &n, A, &lda, ipiv, work, info);
+}
+
+template <>
+void cpu_sytri<double>(rocblas_fill uplo,
+                       rocblas_int n,
+                       double* A,
+                       rocblas_int lda,
+                       rocblas_int* ipiv,
+                       double* work,
+                       rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    dsytri_(&uploC, &n, A, &lda, ipiv, work, info);
+}
+
+template <>
+void cpu_sytri<rocblas_float_complex>(rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_int* ipiv,
+                                      rocblas_float_complex* work,
+                                      rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    csytri_(&uploC, &n, A, &lda, ipiv, work, info);
+}
+
+template <>
+void cpu_sytri<rocblas_double_complex>(rocblas_fill uplo,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_int* ipiv,
+                                       rocblas_double_complex* work,
+                                       rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    zsytri_(&uploC, &n, A, &lda, ipiv, work, info);
+}
+
 // bdsvdx
 template <>
 void cpu_bdsvdx<float>(rocblas_fill uplo,
@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_bdsdc.hpp>
+
+#define TESTING_BDSDC(...) template void testing_bdsdc<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_BDSDC, FOREACH_REAL_TYPE, APPLY_STAMP)
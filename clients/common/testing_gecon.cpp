@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_gecon.hpp>
+
+#define TESTING_GECON(...) template void testing_gecon<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_GECON, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_gelss.hpp>
+
+#define TESTING_GELSS(...) template void testing_gelss<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_GELSS, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_gelsy.hpp>
+
+#define TESTING_GELSY(...) template void testing_gelsy<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_GELSY, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_geqp3.hpp>
+
+#define TESTING_GEQP3(...) template void testing_geqp3<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_GEQP3, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_geqrfq.hpp>
+
+#define TESTING_GEQRFQ(...) template void testing_geqrfq<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_GEQRFQ, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_gerfs.hpp>
+
+#define TESTING_GERFS(...) template void testing_gerfs<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_GERFS, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
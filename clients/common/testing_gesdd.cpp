@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_gesdd.hpp>
+
+#define TESTING_GESDD(...) template void testing_gesdd<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_GESDD, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_ggglm.hpp>
+
+#define TESTING_GGGLM(...) template void testing_ggglm<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_GGGLM, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_gglse.hpp>
+
+#define TESTING_GGLSE(...) template void testing_gglse<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_GGLSE, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
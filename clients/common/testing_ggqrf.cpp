@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_ggqrf.hpp>
+
+#define TESTING_GGQRF(...) template void testing_ggqrf<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_GGQRF, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
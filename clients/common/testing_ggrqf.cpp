@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_ggrqf.hpp>
+
+#define TESTING_GGRQF(...) template void testing_ggrqf<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_GGRQF, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_orgrx_ungrx.hpp>
+
+#define TESTING_ORGRX_UNGRX(...) template void testing_orgrx_ungrx<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_ORGRX_UNGRX, FOREACH_SCALAR_TYPE, FOREACH_BLOCKED_VARIANT, APPLY_STAMP)
@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_ormrx_unmrx.hpp>
+
+#define TESTING_ORMRX_UNMRX(...) template void testing_ormrx_unmrx<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_ORMRX_UNMRX, FOREACH_SCALAR_TYPE, FOREACH_BLOCKED_VARIANT, APPLY_STAMP)
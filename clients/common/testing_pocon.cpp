@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_pocon.hpp>
+
+#define TESTING_POCON(...) template void testing_pocon<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_POCON, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_porfs.hpp>
+
+#define TESTING_PORFS(...) template void testing_porfs<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_PORFS, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_sysv.hpp>
+
+#define TESTING_SYSV(...) template void testing_sysv<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_SYSV, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
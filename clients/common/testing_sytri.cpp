@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_sytri.hpp>
+
+#define TESTING_SYTRI(...) template void testing_sytri<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_SYTRI, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
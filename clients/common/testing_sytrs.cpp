@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_sytrs.hpp>
+
+#define TESTING_SYTRS(...) template void testing_sytrs<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_SYTRS, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,9 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <testing_trcon.hpp>
+
+#define TESTING_TRCON(...) template void testing_trcon<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(TESTING_TRCON, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -104,6 +104,17 @@ class TestRocsolverBench(unittest.TestCase):
         self.assertNotEqual(err, '')
         self.assertNotEqual(exitcode, 0)
 
+    def test_validate_norm(self):
+        for norm in '1OI':
+            with self.subTest(norm=norm):
+                out, err, exitcode = call_rocsolver_bench(f'-f gecon --norm {norm} -n 10')
+                self.assertEqual(err, '')
+                self.assertEqual(exitcode, 0)
+
+        out, err, exitcode = call_rocsolver_bench('-f gecon --norm 0 -n 10')
+        self.assertNotEqual(err, '')
+        self.assertNotEqual(exitcode, 0)
+
     def test_validate_direct(self):
         for direct in 'FB':
             with self.subTest(direct=direct):
@@ -324,6 +335,17 @@ parameters = [
             'ldc': '1',
         }
     ),
+    (
+        'bdsdc',
+        '-f bdsdc --uplo U -n 15',
+        {
+            'uplo': 'U',
+            'svect': 'N',
+            'n': '15',
+            'ldu': '15',
+            'ldv': '15',
+        }
+    ),
     (
         'steqr',
         '-f steqr -n 15',
@@ -458,6 +480,36 @@ parameters = [
             'batch_c': '1',
         }
     ),
+    (
+        'pocon',
+        '-f pocon -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'lda': '10',
+        }
+    ),
+    (
+        'pocon_batched',
+        '-f pocon_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'lda': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'pocon_strided_batched',
+        '-f pocon_strided_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'lda': '10',
+            'strideA': '100',
+            'batch_c': '1',
+        }
+    ),
     (
         'posv',
         '-f posv -n 10',
@@ -495,6 +547,49 @@ parameters = [
             'batch_c': '1',
         }
     ),
+    (
+        'porfs',
+        '-f porfs -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'ldx': '10',
+        }
+    ),
+    (
+        'porfs_batched',
+        '-f porfs_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'ldx': '10',
+            'strideE': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'porfs_strided_batched',
+        '-f porfs_strided_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'ldx': '10',
+            'strideA': '100',
+            'strideB': '100',
+            'strideX': '100',
+            'strideE': '10',
+            'batch_c': '1',
+        }
+    ),
     (
         'potri',
         '-f potri -n 10',
@@ -724,6 +819,160 @@ parameters = [
             'batch_c': '1',
         }
     ),
+    (
+        'geqp3',
+        '-f geqp3 -n 10 -m 15',
+        {
+            'm': '15',
+            'n': '10',
+            'lda': '15',
+            'tol': '0',
+        }
+    ),
+    (
+        'geqp3_batched',
+        '-f geqp3_batched -n 10 -m 15',
+        {
+            'm': '15',
+            'n': '10',
+            'lda': '15',
+            'strideJ': '10',
+            'strideP': '10',
+            'tol': '0',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'geqp3_strided_batched',
+        '-f geqp3_strided_batched -n 10 -m 15',
+        {
+            'm': '15',
+            'n': '10',
+            'lda': '15',
+            'strideA': '150',
+            'strideJ': '10',
+            'strideP': '10',
+            'tol': '0',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'geqrfq',
+        '-f geqrfq -n 10 -m 15',
+        {
+            'm': '15',
+            'n': '10',
+            'lda': '15',
+            'ldr': '10',
+        }
+    ),
+    (
+        'geqrfq_batched',
+        '-f geqrfq_batched -n 10 -m 15',
+        {
+            'm': '15',
+            'n': '10',
+            'lda': '15',
+            'ldr': '10',
+            'strideR': '100',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'geqrfq_strided_batched',
+        '-f geqrfq_strided_batched -n 10 -m 15',
+        {
+            'm': '15',
+            'n': '10',
+            'lda': '15',
+            'strideA': '150',
+            'ldr': '10',
+            'strideR': '100',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'ggqrf',
+        '-f ggqrf -n 15 -m 10 -p 12',
+        {
+            'n': '15',
+            'm': '10',
+            'p': '12',
+            'lda': '15',
+            'ldb': '15',
+        }
+    ),
+    (
+        'ggqrf_batched',
+        '-f ggqrf_batched -n 15 -m 10 -p 12',
+        {
+            'n': '15',
+            'm': '10',
+            'p': '12',
+            'lda': '15',
+            'ldb': '15',
+            'strideTa': '10',
+            'strideTb': '12',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'ggqrf_strided_batched',
+        '-f ggqrf_strided_batched -n 15 -m 10 -p 12',
+        {
+            'n': '15',
+            'm': '10',
+            'p': '12',
+            'lda': '15',
+            'strideA': '150',
+            'strideTa': '10',
+            'ldb': '15',
+            'strideB': '180',
+            'strideTb': '12',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'ggrqf',
+        '-f ggrqf -m 15 -p 12 -n 10',
+        {
+            'm': '15',
+            'p': '12',
+            'n': '10',
+            'lda': '15',
+            'ldb': '12',
+        }
+    ),
+    (
+        'ggrqf_batched',
+        '-f ggrqf_batched -m 15 -p 12 -n 10',
+        {
+            'm': '15',
+            'p': '12',
+            'n': '10',
+            'lda': '15',
+            'ldb': '12',
+            'strideTa': '10',
+            'strideTb': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'ggrqf_strided_batched',
+        '-f ggrqf_strided_batched -m 15 -p 12 -n 10',
+        {
+            'm': '15',
+            'p': '12',
+            'n': '10',
+            'lda': '15',
+            'strideA': '150',
+            'strideTa': '10',
+            'ldb': '12',
+            'strideB': '120',
+            'strideTb': '10',
+            'batch_c': '1',
+        }
+    ),
     (
         'gerq2',
         '-f gerq2 -m 10',
@@ -955,6 +1204,36 @@ parameters = [
             'batch_c': '1',
         }
     ),
+    (
+        'gecon',
+        '-f gecon -n 10',
+        {
+            'norm': 'O',
+            'n': '10',
+            'lda': '10',
+        }
+    ),
+    (
+        'gecon_batched',
+        '-f gecon_batched -n 10',
+        {
+            'norm': 'O',
+            'n': '10',
+            'lda': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'gecon_strided_batched',
+        '-f gecon_strided_batched -n 10',
+        {
+            'norm': 'O',
+            'n': '10',
+            'lda': '10',
+            'strideA': '100',
+            'batch_c': '1',
+        }
+    ),
     (
         'gesv',
         '-f gesv -n 10',
@@ -991,6 +1270,51 @@ parameters = [
             'batch_c': '1',
         }
     ),
+    (
+        'gerfs',
+        '-f gerfs -n 10',
+        {
+            'trans': 'N',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'ldx': '10',
+        }
+    ),
+    (
+        'gerfs_batched',
+        '-f gerfs_batched -n 10',
+        {
+            'trans': 'N',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'ldx': '10',
+            'strideP': '10',
+            'strideE': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'gerfs_strided_batched',
+        '-f gerfs_strided_batched -n 10',
+        {
+            'trans': 'N',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'ldx': '10',
+            'strideA': '100',
+            'strideP': '10',
+            'strideB': '100',
+            'strideX': '100',
+            'strideE': '10',
+            'batch_c': '1',
+        }
+    ),
     (
         'gesvd',
         '-f gesvd -n 10 -m 15',
@@ -1041,6 +1365,51 @@ parameters = [
             'batch_c': '1',
         }
     ),
+    (
+        'gesdd',
+        '-f gesdd -n 10 -m 15',
+        {
+            'svect': 'N',
+            'm': '15',
+            'n': '10',
+            'lda': '15',
+            'ldu': '15',
+            'ldv': '10',
+        }
+    ),
+    (
+        'gesdd_batched',
+        '-f gesdd_batched -n 10 -m 15',
+        {
+            'svect': 'N',
+            'm': '15',
+            'n': '10',
+            'lda': '15',
+            'strideS': '10',
+            'ldu': '15',
+            'strideU': '225',
+            'ldv': '10',
+            'strideV': '100',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'gesdd_strided_batched',
+        '-f gesdd_strided_batched -n 10 -m 15',
+        {
+            'svect': 'N',
+            'm': '15',
+            'n': '10',
+            'lda': '15',
+            'strideA': '150',
+            'strideS': '10',
+            'ldu': '15',
+            'strideU': '225',
+            'ldv': '10',
+            'strideV': '100',
+            'batch_c': '1',
+        }
+    ),
     (
         'trtri',
         '-f trtri -n 10',
@@ -1074,6 +1443,42 @@ parameters = [
             'batch_c': '1',
         }
     ),
+    (
+        'trcon',
+        '-f trcon -n 10',
+        {
+            'norm': 'O',
+            'uplo': 'U',
+            'diag': 'N',
+            'n': '10',
+            'lda': '10',
+        }
+    ),
+    (
+        'trcon_batched',
+        '-f trcon_batched -n 10',
+        {
+            'norm': 'O',
+            'uplo': 'U',
+            'diag': 'N',
+            'n': '10',
+            'lda': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'trcon_strided_batched',
+        '-f trcon_strided_batched -n 10',
+        {
+            'norm': 'O',
+            'uplo': 'U',
+            'diag': 'N',
+            'n': '10',
+            'lda': '10',
+            'strideA': '100',
+            'batch_c': '1',
+        }
+    ),
     (
         'getri',
         '-f getri -n 10',
@@ -1234,6 +1639,170 @@ parameters = [
             'batch_c': '1',
         }
     ),
+    (
+        'gelsy',
+        '-f gelsy -n 10 -m 15',
+        {
+            'm': '15',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '15',
+            'ldb': '15',
+            'rcond': '0',
+        }
+    ),
+    (
+        'gelsy_batched',
+        '-f gelsy_batched -n 10 -m 15',
+        {
+            'm': '15',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '15',
+            'ldb': '15',
+            'strideJ': '10',
+            'rcond': '0',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'gelsy_strided_batched',
+        '-f gelsy_strided_batched -n 10 -m 15',
+        {
+            'm': '15',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '15',
+            'ldb': '15',
+            'strideA': '150',
+            'strideB': '150',
+            'strideJ': '10',
+            'rcond': '0',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'gelss',
+        '-f gelss -n 10 -m 15',
+        {
+            'm': '15',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '15',
+            'ldb': '15',
+            'rcond': '0',
+        }
+    ),
+    (
+        'gelss_batched',
+        '-f gelss_batched -n 10 -m 15',
+        {
+            'm': '15',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '15',
+            'ldb': '15',
+            'strideS': '10',
+            'rcond': '0',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'gelss_strided_batched',
+        '-f gelss_strided_batched -n 10 -m 15',
+        {
+            'm': '15',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '15',
+            'ldb': '15',
+            'strideA': '150',
+            'strideB': '150',
+            'strideS': '10',
+            'rcond': '0',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'gglse',
+        '-f gglse -m 15 -n 10 -p 5',
+        {
+            'm': '15',
+            'n': '10',
+            'p': '5',
+            'lda': '15',
+            'ldb': '5',
+        }
+    ),
+    (
+        'gglse_batched',
+        '-f gglse_batched -m 15 -n 10 -p 5',
+        {
+            'm': '15',
+            'n': '10',
+            'p': '5',
+            'lda': '15',
+            'ldb': '5',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'gglse_strided_batched',
+        '-f gglse_strided_batched -m 15 -n 10 -p 5',
+        {
+            'm': '15',
+            'n': '10',
+            'p': '5',
+            'lda': '15',
+            'ldb': '5',
+            'strideA': '150',
+            'strideB': '50',
+            'strideC': '15',
+            'strideD': '5',
+            'strideX': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'ggglm',
+        '-f ggglm -n 15 -m 10 -p 12',
+        {
+            'n': '15',
+            'm': '10',
+            'p': '12',
+            'lda': '15',
+            'ldb': '15',
+        }
+    ),
+    (
+        'ggglm_batched',
+        '-f ggglm_batched -n 15 -m 10 -p 12',
+        {
+            'n': '15',
+            'm': '10',
+            'p': '12',
+            'lda': '15',
+            'ldb': '15',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'ggglm_strided_batched',
+        '-f ggglm_strided_batched -n 15 -m 10 -p 12',
+        {
+            'n': '15',
+            'm': '10',
+            'p': '12',
+            'lda': '15',
+            'ldb': '15',
+            'strideA': '150',
+            'strideB': '180',
+            'strideD': '15',
+            'strideX': '10',
+            'strideY': '12',
+            'batch_c': '1',
+        }
+    ),
     (
         'gebd2',
         '-f gebd2 -n 10 -m 15',
@@ -1361,6 +1930,116 @@ parameters = [
             'strideP': '10',
             'batch_c': '1',
         }
+    ),
+    (
+        'sytrs',
+        '-f sytrs -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+        }
+    ),
+    (
+        'sytrs_batched',
+        '-f sytrs_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'strideP': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'sytrs_strided_batched',
+        '-f sytrs_strided_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'strideA': '100',
+            'strideP': '10',
+            'strideB': '100',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'sysv',
+        '-f sysv -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+        }
+    ),
+    (
+        'sysv_batched',
+        '-f sysv_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'strideP': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'sysv_strided_batched',
+        '-f sysv_strided_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'nrhs': '10',
+            'lda': '10',
+            'ldb': '10',
+            'strideA': '100',
+            'strideP': '10',
+            'strideB': '100',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'sytri',
+        '-f sytri -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'lda': '10',
+        }
+    ),
+    (
+        'sytri_batched',
+        '-f sytri_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'lda': '10',
+            'strideP': '10',
+            'batch_c': '1',
+        }
+    ),
+    (
+        'sytri_strided_batched',
+        '-f sytri_strided_batched -n 10',
+        {
+            'uplo': 'U',
+            'n': '10',
+            'lda': '10',
+            'strideA': '100',
+            'strideP': '10',
+            'batch_c': '1',
+        }
     )
 ]
 
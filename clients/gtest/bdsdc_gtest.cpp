@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "testing_bdsdc.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<printable_char, vector<int>> bdsdc_tuple;
+
+// each size_range vector is a {n, ldu, ldv, vect}
+// if ldx = -1 then ldx < limit (invalid size)
+// if ldx = 0 then ldx = limit
+// if ldx = 1 then ldx > limit
+// if vect = 0, then don't find singular vectors
+// if vect = 1, then find singular vectors
+
+// Note: all tests are prepared with diagonally dominant matrices that have random diagonal
+// elements in [-20, -11] U [11, 20], and off-diagonal elements in [-0.4, 0.5]. For
+// sufficiently large matrices, some diagonal elements are set to zero to produce zero
+// singular values.
+
+// case when n == 0 and vect = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<printable_char> uplo_range = {'U', 'L'};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // quick return
+    {0, 0, 0, 0},
+    // invalid
+    {-1, 0, 0, 0},
+    {10, -1, 0, 1},
+    {10, 0, -1, 1},
+    // normal (valid) samples
+    {1, 0, 0, 1},
+    {15, 1, 0, 0},
+    {16, 0, 1, 1},
+    {20, 0, 0, 1},
+    {40, 1, 1, 1},
+    {64, 0, 0, 0},
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_size_range
+    = {{120, 0, 0, 1}, {256, 1, 0, 0}, {350, 0, 1, 1}, {512, 0, 0, 0}, {1024, 0, 0, 1}};
+
+Arguments bdsdc_setup_arguments(bdsdc_tuple tup)
+{
+    Arguments arg;
+
+    char uplo = std::get<0>(tup);
+    vector<int> size = std::get<1>(tup);
+
+    arg.set<char>("uplo", uplo);
+
+    rocblas_int n = size[0];
+    arg.set<rocblas_int>("n", n);
+    arg.set<char>("svect", (size[3] == 0 ? 'N' : 'S'));
+
+    // leading dimensions (only the limit is relevant when vectors are computed)
+    if(size[3] == 0)
+    {
+        arg.set<rocblas_int>("ldu", 1 + size[1] * 10);
+        arg.set<rocblas_int>("ldv", 1 + size[2] * 10);
+    }
+    else
+    {
+        arg.set<rocblas_int>("ldu", n + size[1] * 10);
+        arg.set<rocblas_int>("ldv", n + size[2] * 10);
+    }
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class BDSDC : public ::TestWithParam<bdsdc_tuple>
+{
+protected:
+    BDSDC() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = bdsdc_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<char>("svect") == 'N')
+            testing_bdsdc_bad_arg<T>();
+
+        testing_bdsdc<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(BDSDC, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(BDSDC, __double)
+{
+    run_tests<double>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         BDSDC,
+                         Combine(ValuesIn(uplo_range), ValuesIn(large_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, BDSDC, Combine(ValuesIn(uplo_range), ValuesIn(size_range)));
@@ -42,6 +42,10 @@ const vector<vector<int>> size_range = {
     {30, 50, 0, 0},
     {50, 60, 20, 0},
     {70, 0, 0, 0},
+    // accumulated rotations
+    {40, 70, 0, 80},
+    {64, 64, 100, 0},
+    {90, 0, 96, 64},
 };
 
 const vector<vector<int>> opt_range = {
@@ -0,0 +1,159 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gecon.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, printable_char> gecon_tuple;
+
+// each matrix_size_range vector is a {n, lda}
+
+// each norm_range is {norm_type}
+// if norm_type = 'O' then the 1-norm is used
+// if norm_type = 'I' then the infinity-norm is used
+
+// case when n = 0 and norm_type = 'O' will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<printable_char> norm_range = {'O', 'I'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {1, 1},
+    {20, 32},
+    {40, 40},
+    {65, 80},
+    {100, 150}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range
+    = {{192, 192}, {500, 600}, {640, 640}, {1000, 1024}, {1200, 1230}};
+
+Arguments gecon_setup_arguments(gecon_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char norm_type = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    arg.set<char>("norm", norm_type);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GECON : public ::TestWithParam<gecon_tuple>
+{
+protected:
+    GECON() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gecon_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<char>("norm") == 'O')
+            testing_gecon_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_gecon<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GECON, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GECON, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GECON, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GECON, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GECON, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GECON, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GECON, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GECON, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GECON, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GECON, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GECON, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GECON, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GECON,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(norm_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GECON,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(norm_range)));
@@ -40,6 +40,12 @@ const vector<gels_params_A> matrix_sizeA_range = {
     {20, 30, 30, 40, 0},
     {40, 20, 40, 40, 1},
     {20, 40, 40, 40, 1},
+    // small overdetermined samples (single kernel)
+    {32, 4, 32, 32, 0},
+    {100, 16, 120, 100, 1},
+    // tall-skinny samples (Cholesky QR in gels_outofplace)
+    {400, 20, 400, 400, 0},
+    {200, 20, 200, 200, 1},
 };
 const vector<gels_params_B> matrix_sizeB_range = {
     // quick return
@@ -60,7 +66,7 @@ const vector<gels_params_B> matrix_sizeB_range = {
 // for daily_lapack tests
 const vector<gels_params_A> large_matrix_sizeA_range = {
     {75, 25, 75, 75, 1},    {25, 75, 75, 75, 1},    {150, 150, 150, 150, 1},
-    {500, 50, 600, 600, 0}, {50, 500, 600, 600, 0},
+    {500, 50, 600, 600, 0}, {50, 500, 600, 600, 0}, {1025, 60, 1025, 1025, 0},
 };
 const vector<gels_params_B> large_matrix_sizeB_range = {
     {100, 'N'},
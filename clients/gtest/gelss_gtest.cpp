@@ -0,0 +1,184 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gelss.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int, double> gelss_tuple;
+
+// each matrix_size_range is a {m, n, lda, ldb}
+
+// each nrhs_range is the number of right-hand sides
+
+// each rcond_range is the relative tolerance used to determine the effective rank
+// if rcond > 0 the test matrix is made rank deficient
+
+// case when m = n = nrhs = 0 and rcond = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<double> rcond_range = {0, 1e-3};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0, 1, 1},
+    // invalid
+    {-1, 1, 1, 1},
+    {1, -1, 1, 1},
+    {10, 10, 1, 10},
+    {10, 20, 10, 10},
+    // normal (valid) samples
+    {20, 20, 20, 20},
+    {30, 20, 40, 30},
+    {20, 30, 30, 40},
+    {40, 20, 40, 40},
+    {20, 40, 40, 40},
+};
+
+const vector<int> nrhs_range = {
+    // quick return
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    1, 10, 30};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {75, 25, 75, 75},
+    {25, 75, 75, 75},
+    {150, 150, 150, 150},
+    {500, 50, 600, 600},
+    {50, 500, 600, 600},
+};
+
+const vector<int> large_nrhs_range = {100, 200};
+
+Arguments gelss_setup_arguments(gelss_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int nrhs = std::get<1>(tup);
+    double rcond = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("n", matrix_size[1]);
+    arg.set<rocblas_int>("lda", matrix_size[2]);
+    arg.set<rocblas_int>("ldb", matrix_size[3]);
+    arg.set<rocblas_int>("nrhs", nrhs);
+
+    arg.set<double>("rcond", rcond);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GELSS : public ::TestWithParam<gelss_tuple>
+{
+protected:
+    GELSS() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gelss_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0
+           && arg.peek<rocblas_int>("nrhs") == 0 && arg.peek<double>("rcond") == 0)
+            testing_gelss_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_gelss<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GELSS, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GELSS, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GELSS, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GELSS, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GELSS, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GELSS, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GELSS, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GELSS, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GELSS, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GELSS, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GELSS, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GELSS, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GELSS,
+                         Combine(ValuesIn(large_matrix_size_range),
+                                 ValuesIn(large_nrhs_range),
+                                 ValuesIn(rcond_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELSS,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(nrhs_range),
+                                 ValuesIn(rcond_range)));
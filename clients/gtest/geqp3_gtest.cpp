@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_geqp3.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int, double> geqp3_tuple;
+
+// each matrix_size_range is a {m, lda}
+
+// each tol_range is the relative tolerance used to determine the rank
+// if tol = 0 the complete factorization is computed
+// if tol > 0 the test matrix is made rank deficient and the factorization is truncated
+
+// case when m = n = 0 and tol = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<double> tol_range = {0, 1e-3};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {50, 50},
+    {70, 100},
+    {130, 130},
+    {150, 200}};
+
+const vector<int> n_size_range = {
+    // quick return
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    16, 20, 130, 150};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {152, 152},
+    {640, 640},
+    {1000, 1024},
+};
+
+const vector<int> large_n_size_range = {64, 98, 130, 220, 400};
+
+Arguments geqp3_setup_arguments(geqp3_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int n_size = std::get<1>(tup);
+    double tol = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("n", n_size);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    arg.set<double>("tol", tol);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GEQP3 : public ::TestWithParam<geqp3_tuple>
+{
+protected:
+    GEQP3() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = geqp3_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0
+           && arg.peek<double>("tol") == 0)
+            testing_geqp3_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_geqp3<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GEQP3, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEQP3, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEQP3, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEQP3, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GEQP3, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GEQP3, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GEQP3, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GEQP3, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GEQP3, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEQP3, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEQP3, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEQP3, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GEQP3,
+                         Combine(ValuesIn(large_matrix_size_range),
+                                 ValuesIn(large_n_size_range),
+                                 ValuesIn(tol_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQP3,
+                         Combine(ValuesIn(matrix_size_range),
+                                 ValuesIn(n_size_range),
+                                 ValuesIn(tol_range)));
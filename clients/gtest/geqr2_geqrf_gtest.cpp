@@ -37,16 +37,19 @@ const vector<int> n_size_range = {
     // invalid
     -1,
     // normal (valid) samples
-    16, 20, 130, 150};
+    16, 20, 64, 65, 130, 150};
 
 // for daily_lapack tests
 const vector<vector<int>> large_matrix_size_range = {
     {152, 152},
     {640, 640},
     {1000, 1024},
+    // on both sides of GEQR2_SMALL_MAX_ROWS
+    {1024, 1024},
+    {1025, 1025},
 };
 
-const vector<int> large_n_size_range = {64, 98, 130, 220, 400};
+const vector<int> large_n_size_range = {64, 65, 98, 130, 220, 400};
 
 Arguments geqrf_setup_arguments(geqrf_tuple tup)
 {
@@ -0,0 +1,167 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_geqrfq.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> geqrfq_tuple;
+
+// each matrix_size_range is a {m, lda}
+// each n_size_range is a {n, ldr}
+
+// case when m = n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {50, 50},
+    {70, 100},
+    {130, 130},
+    {150, 200}};
+
+const vector<vector<int>> n_size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {16, 16},
+    {20, 30},
+    {50, 50},
+    {130, 150}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {152, 152},
+    {640, 640},
+    {1000, 1024},
+};
+
+const vector<vector<int>> large_n_size_range = {{64, 64}, {98, 98}, {130, 140}, {150, 150}};
+
+Arguments geqrfq_setup_arguments(geqrfq_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> n_size = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+    arg.set<rocblas_int>("n", n_size[0]);
+    arg.set<rocblas_int>("ldr", n_size[1]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GEQRFQ : public ::TestWithParam<geqrfq_tuple>
+{
+protected:
+    GEQRFQ() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = geqrfq_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_geqrfq_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_geqrfq<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GEQRFQ, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEQRFQ, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEQRFQ, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEQRFQ, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GEQRFQ, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GEQRFQ, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GEQRFQ, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GEQRFQ, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched cases
+
+TEST_P(GEQRFQ, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEQRFQ, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEQRFQ, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEQRFQ, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GEQRFQ,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRFQ,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
@@ -0,0 +1,161 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_ggglm.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef vector<int> ggglm_tuple;
+
+// each matrix_size_range vector is a {n, m, p, lda, ldb, singular}
+// if singular = 1, then the used matrices for the tests are rank deficient
+
+// case when n = m = p = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0, 0, 1, 1, 0},
+    {0, 0, 20, 1, 1, 0},
+    // invalid
+    {-1, 1, 1, 1, 1, 0},
+    {1, -1, 1, 1, 1, 0},
+    {1, 1, -1, 1, 1, 0},
+    {10, 20, 20, 10, 10, 0},
+    {40, 10, 20, 40, 40, 0},
+    {20, 10, 15, 10, 20, 0},
+    {20, 10, 15, 20, 10, 0},
+    // normal (valid) samples
+    {20, 10, 20, 20, 20, 1},
+    {30, 30, 0, 40, 30, 1},
+    {30, 20, 15, 30, 30, 1},
+    {30, 10, 20, 30, 40, 0},
+    {50, 30, 60, 60, 50, 1},
+    {40, 0, 40, 40, 40, 0}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range
+    = {{200, 150, 100, 200, 200, 1},
+       {500, 300, 300, 500, 520, 0},
+       {600, 300, 400, 600, 600, 1},
+       {1000, 800, 300, 1024, 1000, 0}};
+
+Arguments ggglm_setup_arguments(ggglm_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", tup[0]);
+    arg.set<rocblas_int>("m", tup[1]);
+    arg.set<rocblas_int>("p", tup[2]);
+    arg.set<rocblas_int>("lda", tup[3]);
+    arg.set<rocblas_int>("ldb", tup[4]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = tup[5];
+
+    return arg;
+}
+
+class GGGLM : public ::TestWithParam<ggglm_tuple>
+{
+protected:
+    GGGLM() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = ggglm_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0
+           && arg.peek<rocblas_int>("p") == 0)
+            testing_ggglm_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_ggglm<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_ggglm<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GGGLM, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GGGLM, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GGGLM, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GGGLM, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GGGLM, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GGGLM, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GGGLM, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GGGLM, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GGGLM, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GGGLM, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GGGLM, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GGGLM, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GGGLM, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GGGLM, ValuesIn(matrix_size_range));
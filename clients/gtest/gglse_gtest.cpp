@@ -0,0 +1,161 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gglse.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef vector<int> gglse_tuple;
+
+// each matrix_size_range vector is a {m, n, p, lda, ldb, singular}
+// if singular = 1, then the used matrices for the tests are rank deficient
+
+// case when m = n = p = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0, 0, 1, 1, 0},
+    {20, 0, 0, 20, 1, 0},
+    // invalid
+    {-1, 1, 1, 1, 1, 0},
+    {1, -1, 1, 1, 1, 0},
+    {1, 1, -1, 1, 1, 0},
+    {20, 10, 20, 20, 20, 0},
+    {10, 40, 20, 10, 20, 0},
+    {20, 10, 5, 10, 5, 0},
+    {20, 10, 5, 20, 1, 0},
+    // normal (valid) samples
+    {20, 20, 10, 20, 10, 1},
+    {30, 20, 0, 40, 1, 0},
+    {20, 30, 15, 20, 20, 1},
+    {10, 30, 20, 10, 20, 0},
+    {50, 30, 30, 60, 40, 1},
+    {40, 20, 5, 40, 10, 0}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range
+    = {{200, 150, 100, 200, 100, 1},
+       {500, 300, 100, 500, 120, 0},
+       {300, 600, 400, 300, 400, 1},
+       {1000, 800, 300, 1024, 300, 0}};
+
+Arguments gglse_setup_arguments(gglse_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", tup[0]);
+    arg.set<rocblas_int>("n", tup[1]);
+    arg.set<rocblas_int>("p", tup[2]);
+    arg.set<rocblas_int>("lda", tup[3]);
+    arg.set<rocblas_int>("ldb", tup[4]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = tup[5];
+
+    return arg;
+}
+
+class GGLSE : public ::TestWithParam<gglse_tuple>
+{
+protected:
+    GGLSE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gglse_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0
+           && arg.peek<rocblas_int>("p") == 0)
+            testing_gglse_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_gglse<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_gglse<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GGLSE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GGLSE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GGLSE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GGLSE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GGLSE, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GGLSE, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GGLSE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GGLSE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GGLSE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GGLSE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GGLSE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GGLSE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GGLSE, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GGLSE, ValuesIn(matrix_size_range));
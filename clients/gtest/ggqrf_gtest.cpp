@@ -0,0 +1,153 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_ggqrf.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef vector<int> ggqrf_tuple;
+
+// each matrix_size_range vector is a {n, m, p, lda, ldb}
+
+// case when n = m = p = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0, 0, 1, 1},
+    {20, 0, 0, 20, 20},
+    // invalid
+    {-1, 1, 1, 1, 1},
+    {1, -1, 1, 1, 1},
+    {1, 1, -1, 1, 1},
+    {20, 10, 10, 5, 20},
+    {20, 10, 10, 20, 5},
+    // normal (valid) samples
+    {20, 20, 20, 20, 20},
+    {30, 20, 40, 40, 30},
+    {20, 30, 10, 20, 30},
+    {40, 10, 0, 50, 40},
+    {40, 0, 10, 40, 40},
+    {50, 70, 60, 60, 50}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range
+    = {{152, 100, 200, 152, 160},
+       {300, 300, 300, 320, 300},
+       {640, 320, 900, 640, 640},
+       {1000, 1200, 800, 1024, 1000}};
+
+Arguments ggqrf_setup_arguments(ggqrf_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", tup[0]);
+    arg.set<rocblas_int>("m", tup[1]);
+    arg.set<rocblas_int>("p", tup[2]);
+    arg.set<rocblas_int>("lda", tup[3]);
+    arg.set<rocblas_int>("ldb", tup[4]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GGQRF : public ::TestWithParam<ggqrf_tuple>
+{
+protected:
+    GGQRF() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = ggqrf_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0
+           && arg.peek<rocblas_int>("p") == 0)
+            testing_ggqrf_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_ggqrf<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GGQRF, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GGQRF, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GGQRF, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GGQRF, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(GGQRF, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GGQRF, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GGQRF, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GGQRF, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GGQRF, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GGQRF, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GGQRF, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GGQRF, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GGQRF, ValuesIn(large_matrix_size_range));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GGQRF, ValuesIn(matrix_size_range));
@@ -11,11 +11,16 @@ using ::testing::Values;
 using ::testing::ValuesIn;
 using namespace std;
 
-typedef std::tuple<int, int> larfg_tuple;
+typedef std::tuple<int, int, int> larfg_tuple;
 
-// case when n = 0 and incx = 0 also execute the bad arguments test
+// case when n = 0, incx = 0 and scale = 0 also execute the bad arguments test
 // (null handle, null pointers and invalid values)
 
+// if scale = 0, the entries of alpha and x are O(1)
+// if scale = 1, the entries are tiny (beta needs to be rescaled)
+// if scale = 2, the entries are huge (their squares overflow)
+const vector<int> scale_range = {0, 1, 2};
+
 const vector<int> incx_range = {
     // invalid
     -1,
@@ -41,22 +46,20 @@ const vector<int> n_size_range = {
 };
 
 // for daily_lapack tests
-const vector<int> large_n_size_range = {
-    192,
-    640,
-    1024,
-    2547,
-};
+// (sizes above LARFG_SMALL_MAX_N use the general path)
+const vector<int> large_n_size_range = {192, 640, 1024, 2547, 4096, 4097, 6000};
 
 Arguments larfg_setup_arguments(larfg_tuple tup)
 {
     int n_size = std::get<0>(tup);
     int inc = std::get<1>(tup);
+    int scale = std::get<2>(tup);
 
     Arguments arg;
 
     arg.set<rocblas_int>("n", n_size);
     arg.set<rocblas_int>("incx", inc);
+    arg.set<rocblas_int>("scale", scale);
 
     arg.timing = 0;
 
@@ -75,7 +78,8 @@ protected:
     {
         Arguments arg = larfg_setup_arguments(GetParam());
 
-        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("incx") == 0)
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("incx") == 0
+           && arg.peek<rocblas_int>("scale") == 0)
             testing_larfg_bad_arg<T>();
 
         testing_larfg<T>(arg);
@@ -106,6 +110,12 @@ TEST_P(LARFG, __double_complex)
 
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          LARFG,
-                         Combine(ValuesIn(large_n_size_range), ValuesIn(incx_range)));
+                         Combine(ValuesIn(large_n_size_range),
+                                 ValuesIn(incx_range),
+                                 ValuesIn(scale_range)));
 
-INSTANTIATE_TEST_SUITE_P(checkin_lapack, LARFG, Combine(ValuesIn(n_size_range), ValuesIn(incx_range)));
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         LARFG,
+                         Combine(ValuesIn(n_size_range),
+                                 ValuesIn(incx_range),
+                                 ValuesIn(scale_range)));
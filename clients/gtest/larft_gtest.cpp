@@ -47,11 +47,15 @@ const vector<vector<int>> reflector_size_range = {
     {15, 15, 0}};
 
 // for daily_lapack tests
+// (including both sides of LARFT_SMALL_MAX_N and LARFT_SMALL_MAX_K, and k = 130,
+// whose halves are split again by the recursion)
 const vector<vector<int>> large_order_size_range
-    = {{192, 192, 0}, {640, 75, 1}, {1024, 1200, 0}, {2048, 100, 1}};
+    = {{192, 192, 0}, {512, 512, 0}, {513, 513, 1}, {640, 75, 1}, {1024, 1200, 0}, {2048, 100, 1}};
 
-const vector<vector<int>> large_reflector_size_range
-    = {{15, 15, 0}, {25, 40, 1}, {45, 45, 0}, {60, 70, 1}, {75, 75, 0}};
+const vector<vector<int>> large_reflector_size_range = {
+    {15, 15, 0}, {25, 40, 1}, {45, 45, 0}, {60, 70, 1}, {64, 64, 0},
+    {65, 65, 1}, {75, 75, 0}, {130, 140, 1}, {130, 130, 0},
+};
 
 Arguments larft_setup_arguments(larft_tuple tup)
 {
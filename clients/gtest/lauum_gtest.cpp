@@ -28,8 +28,10 @@ const vector<vector<int>> size_range = {
     {20, 20},
     {30, 30},
     {10, 20},
-    {20, 30}};
-const vector<vector<int>> large_size_range = {{100, 100}, {200, 200}};
+    {20, 30},
+    {33, 40},
+    {70, 70}};
+const vector<vector<int>> large_size_range = {{100, 100}, {200, 200}, {700, 720}};
 const vector<printable_char> uplo_range = {'L', 'U'};
 
 Arguments lauum_setup_arguments(lauum_tuple tup)
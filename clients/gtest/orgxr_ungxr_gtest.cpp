@@ -45,13 +45,19 @@ const vector<vector<int>> n_size_range = {
     // normal (valid) samples
     {10, 0},
     {20, 20},
-    {35, 25}};
+    {35, 25},
+    // on both sides of GEQR2_SMALL_MAX_COLS
+    {64, 60},
+    {65, 65},
+    // more than one block of LARFT_SMALL_MAX_K reflectors
+    {100, 90}};
 
 // for daily_lapack tests
-const vector<vector<int>> large_m_size_range = {{400, 410}, {640, 640}, {1000, 1024}, {2000, 2000}};
+const vector<vector<int>> large_m_size_range
+    = {{400, 410}, {640, 640}, {1000, 1024}, {1024, 1024}, {1025, 1030}, {2000, 2000}};
 
 const vector<vector<int>> large_n_size_range
-    = {{164, 162}, {198, 140}, {130, 130}, {220, 220}, {400, 200}};
+    = {{64, 64}, {164, 162}, {198, 140}, {130, 129}, {130, 130}, {220, 220}, {400, 200}};
 
 Arguments orgqr_setup_arguments(orgqr_tuple tup)
 {
@@ -65,7 +65,9 @@ const vector<vector<int>> size_range = {
 
 // for daily_lapack tests
 const vector<vector<int>> large_size_range
-    = {{100, 100, 100}, {150, 100, 80}, {300, 400, 300}, {1024, 1000, 950}, {1500, 1500, 1000}};
+    = {{100, 100, 100}, {150, 100, 80}, {300, 400, 300}, {1024, 1000, 950},
+       {1025, 100, 60},  {1100, 70, 70}, {70, 1100, 70},  {1200, 150, 129},
+       {1500, 1500, 1000}};
 
 Arguments ormqr_setup_arguments(ormqr_tuple tup)
 {
@@ -0,0 +1,157 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_pocon.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, printable_char> pocon_tuple;
+
+// each matrix_size_range vector is a {n, lda}
+
+// each uplo_range is {uplo}
+
+// case when n = 0 and uplo = 'L' will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<printable_char> uplo_range = {'L', 'U'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {1, 1},
+    {20, 32},
+    {40, 40},
+    {65, 80},
+    {100, 150}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range
+    = {{192, 192}, {500, 600}, {640, 640}, {1000, 1024}, {1200, 1230}};
+
+Arguments pocon_setup_arguments(pocon_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char uplo = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    arg.set<char>("uplo", uplo);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class POCON : public ::TestWithParam<pocon_tuple>
+{
+protected:
+    POCON() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = pocon_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<char>("uplo") == 'L')
+            testing_pocon_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_pocon<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(POCON, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POCON, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POCON, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POCON, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(POCON, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(POCON, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(POCON, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(POCON, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(POCON, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POCON, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POCON, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POCON, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POCON,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POCON,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
@@ -38,7 +38,8 @@ const vector<vector<int>> matrix_size_range = {
 
 // for daily_lapack tests
 const vector<vector<int>> large_matrix_size_range
-    = {{192, 192, 1}, {500, 600, 1}, {640, 640, 0}, {1000, 1024, 0}, {1200, 1230, 0}};
+    = {{192, 192, 1},   {500, 600, 1},   {640, 640, 0},
+       {1000, 1024, 0}, {1100, 1100, 1}, {1200, 1230, 0}};
 
 Arguments potri_setup_arguments(potri_tuple tup)
 {
@@ -31,6 +31,7 @@ const vector<vector<int>> size_range = {
     {10, 5},
     // normal (valid) samples
     {1, 1},
+    {3, 3},
     {12, 12},
     {20, 30},
     {36, 36},
@@ -43,7 +43,8 @@ const vector<vector<int>> size_range = {
 // for daily_lapack tests
 const vector<vector<int>> large_size_range = {{192, 192, 192, 5, 15, 100, 170},
                                               {256, 270, 256, -10, 10, 1, 256},
-                                              {300, 300, 330, -15, -5, 200, 300}};
+                                              {300, 300, 330, -15, -5, 200, 300},
+                                              {1040, 1040, 1040, -5, 5, 1, 60}};
 
 template <typename T>
 Arguments syevdx_heevdx_setup_arguments(syevdx_heevdx_tuple tup, bool inplace)
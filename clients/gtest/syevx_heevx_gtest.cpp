@@ -35,6 +35,7 @@ const vector<vector<int>> size_range = {
     {10, 10, 10, 10, 0, 10, 1},
     // normal (valid) samples
     {1, 1, 1, 0, 10, 1, 1},
+    {4, 4, 4, -20, 20, 2, 3},
     {12, 12, 15, -20, 20, 10, 12},
     {20, 30, 30, 5, 15, 1, 20},
     {35, 35, 35, -10, 10, 1, 15},
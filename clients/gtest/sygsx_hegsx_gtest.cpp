@@ -41,6 +41,7 @@ const vector<vector<int>> large_matrix_size_range = {
     {152, 152, 152},
     {640, 640, 640},
     {1000, 1024, 1024},
+    {2100, 2110, 2100},
 };
 
 Arguments sygst_setup_arguments(sygst_tuple tup)
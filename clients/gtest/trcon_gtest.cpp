@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_trcon.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<printable_char>> trcon_tuple;
+
+// each matrix_size_range vector is a {n, lda, diag}
+// if diag = 0, then the used matrix for the tests is triangular unit
+// otherwise, the used matrix is triangular non-unit
+
+// each opt_range is {norm_type, uplo}
+// if norm_type = 'O' then the 1-norm is used
+// if norm_type = 'I' then the infinity-norm is used
+
+// case when n = 0, norm_type = 'O' and uplo = 'L' will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<vector<printable_char>> opt_range = {{'O', 'L'}, {'O', 'U'}, {'I', 'L'}, {'I', 'U'}};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {20, 5, 0},
+    // normal (valid) samples
+    {1, 1, 1},
+    {20, 32, 0},
+    {40, 40, 1},
+    {65, 80, 0},
+    {100, 150, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range
+    = {{192, 192, 1}, {500, 600, 0}, {640, 640, 1}, {1000, 1024, 0}, {1200, 1230, 1}};
+
+Arguments trcon_setup_arguments(trcon_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<printable_char> opt = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    arg.set<char>("norm", opt[0]);
+    arg.set<char>("uplo", opt[1]);
+
+    if(matrix_size[2] == 0)
+        arg.set<char>("diag", 'U');
+    else
+        arg.set<char>("diag", 'N');
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class TRCON : public ::TestWithParam<trcon_tuple>
+{
+protected:
+    TRCON() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = trcon_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<char>("norm") == 'O'
+           && arg.peek<char>("uplo") == 'L')
+            testing_trcon_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_trcon<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(TRCON, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(TRCON, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(TRCON, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(TRCON, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(TRCON, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(TRCON, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(TRCON, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(TRCON, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(TRCON, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(TRCON, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(TRCON, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(TRCON, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         TRCON,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(opt_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         TRCON,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(opt_range)));
@@ -158,6 +158,18 @@ void cpu_potrs(rocblas_fill uplo,
                T* B,
                rocblas_int ldb);
 
+template <typename T, typename S>
+void cpu_pocon(rocblas_fill uplo,
+               rocblas_int n,
+               T* A,
+               rocblas_int lda,
+               S anorm,
+               S* rcond,
+               T* work,
+               S* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info);
+
 template <typename T>
 void cpu_posv(rocblas_fill uplo,
               rocblas_int n,
@@ -168,6 +180,25 @@ void cpu_posv(rocblas_fill uplo,
               rocblas_int ldb,
               rocblas_int* info);
 
+template <typename T, typename S>
+void cpu_porfs(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int nrhs,
+               T* A,
+               rocblas_int lda,
+               T* AF,
+               rocblas_int ldaf,
+               T* B,
+               rocblas_int ldb,
+               T* X,
+               rocblas_int ldx,
+               S* ferr,
+               S* berr,
+               T* work,
+               S* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info);
+
 template <typename T>
 void cpu_potri(rocblas_fill uplo, rocblas_int n, T* A, rocblas_int lda, rocblas_int* info);
 
@@ -187,6 +218,18 @@ void cpu_getrs(rocblas_operation trans,
                T* B,
                rocblas_int ldb);
 
+template <typename T, typename S>
+void cpu_gecon(rocblas_norm_type norm_type,
+               rocblas_int n,
+               T* A,
+               rocblas_int lda,
+               S anorm,
+               S* rcond,
+               T* work,
+               S* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info);
+
 template <typename T>
 void cpu_gesv(rocblas_int n,
               rocblas_int nrhs,
@@ -197,6 +240,26 @@ void cpu_gesv(rocblas_int n,
               rocblas_int ldb,
               rocblas_int* info);
 
+template <typename T, typename S>
+void cpu_gerfs(rocblas_operation trans,
+               rocblas_int n,
+               rocblas_int nrhs,
+               T* A,
+               rocblas_int lda,
+               T* AF,
+               rocblas_int ldaf,
+               rocblas_int* ipiv,
+               T* B,
+               rocblas_int ldb,
+               T* X,
+               rocblas_int ldx,
+               S* ferr,
+               S* berr,
+               T* work,
+               S* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info);
+
 template <typename T>
 void cpu_gels(rocblas_operation transR,
               rocblas_int m,
@@ -210,6 +273,93 @@ void cpu_gels(rocblas_operation transR,
               rocblas_int lwork,
               rocblas_int* info);
 
+template <typename T, typename S>
+void cpu_gelsy(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               T* A,
+               rocblas_int lda,
+               T* B,
+               rocblas_int ldb,
+               rocblas_int* jpvt,
+               S rcond,
+               rocblas_int* rank,
+               T* work,
+               rocblas_int lwork,
+               S* rwork);
+
+template <typename T, typename W>
+void cpu_gelss(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               T* A,
+               rocblas_int lda,
+               T* B,
+               rocblas_int ldb,
+               W* S,
+               W rcond,
+               rocblas_int* rank,
+               T* work,
+               rocblas_int lwork,
+               W* rwork,
+               rocblas_int* info);
+
+template <typename T>
+void cpu_ggqrf(rocblas_int n,
+               rocblas_int m,
+               rocblas_int p,
+               T* A,
+               rocblas_int lda,
+               T* taua,
+               T* B,
+               rocblas_int ldb,
+               T* taub,
+               T* work,
+               rocblas_int lwork);
+
+template <typename T>
+void cpu_ggrqf(rocblas_int m,
+               rocblas_int p,
+               rocblas_int n,
+               T* A,
+               rocblas_int lda,
+               T* taua,
+               T* B,
+               rocblas_int ldb,
+               T* taub,
+               T* work,
+               rocblas_int lwork);
+
+template <typename T>
+void cpu_gglse(rocblas_int m,
+               rocblas_int n,
+               rocblas_int p,
+               T* A,
+               rocblas_int lda,
+               T* B,
+               rocblas_int ldb,
+               T* C,
+               T* D,
+               T* X,
+               T* work,
+               rocblas_int lwork,
+               rocblas_int* info);
+
+template <typename T>
+void cpu_ggglm(rocblas_int n,
+               rocblas_int m,
+               rocblas_int p,
+               T* A,
+               rocblas_int lda,
+               T* B,
+               rocblas_int ldb,
+               T* D,
+               T* X,
+               T* Y,
+               T* work,
+               rocblas_int lwork,
+               rocblas_int* info);
+
 template <typename T>
 void cpu_getri(rocblas_int n,
                T* A,
@@ -227,6 +377,19 @@ void cpu_trtri(rocblas_fill uplo,
                rocblas_int lda,
                rocblas_int* info);
 
+template <typename T, typename S>
+void cpu_trcon(rocblas_norm_type norm_type,
+               rocblas_fill uplo,
+               rocblas_diagonal diag,
+               rocblas_int n,
+               T* A,
+               rocblas_int lda,
+               S* rcond,
+               T* work,
+               S* rwork,
+               rocblas_int* iwork,
+               rocblas_int* info);
+
 template <typename T>
 void cpu_larfg(rocblas_int n, T* alpha, T* x, rocblas_int incx, T* tau);
 
@@ -318,6 +481,17 @@ void cpu_geqr2(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T*
 template <typename T>
 void cpu_geqrf(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T* work, rocblas_int sizeW);
 
+template <typename T, typename S>
+void cpu_geqp3(rocblas_int m,
+               rocblas_int n,
+               T* A,
+               rocblas_int lda,
+               rocblas_int* jpvt,
+               T* ipiv,
+               T* work,
+               rocblas_int lwork,
+               S* rwork);
+
 template <typename T>
 void cpu_gerq2(rocblas_int m, rocblas_int n, T* A, rocblas_int lda, T* ipiv, T* work);
 
@@ -383,6 +557,19 @@ void cpu_orglq_unglq(rocblas_int m,
                      T* work,
                      rocblas_int sizeW);
 
+template <typename T>
+void cpu_orgr2_ungr2(rocblas_int m, rocblas_int n, rocblas_int k, T* A, rocblas_int lda, T* Ipiv, T* work);
+
+template <typename T>
+void cpu_orgrq_ungrq(rocblas_int m,
+                     rocblas_int n,
+                     rocblas_int k,
+                     T* A,
+                     rocblas_int lda,
+                     T* Ipiv,
+                     T* work,
+                     rocblas_int sizeW);
+
 template <typename T>
 void cpu_org2l_ung2l(rocblas_int m, rocblas_int n, rocblas_int k, T* A, rocblas_int lda, T* Ipiv, T* work);
 
@@ -470,6 +657,33 @@ void cpu_ormlq_unmlq(rocblas_side side,
                      T* work,
                      rocblas_int sizeW);
 
+template <typename T>
+void cpu_ormr2_unmr2(rocblas_side side,
+                     rocblas_operation trans,
+                     rocblas_int m,
+                     rocblas_int n,
+                     rocblas_int k,
+                     T* A,
+                     rocblas_int lda,
+                     T* Ipiv,
+                     T* C,
+                     rocblas_int ldc,
+                     T* work);
+
+template <typename T>
+void cpu_ormrq_unmrq(rocblas_side side,
+                     rocblas_operation trans,
+                     rocblas_int m,
+                     rocblas_int n,
+                     rocblas_int k,
+                     T* A,
+                     rocblas_int lda,
+                     T* Ipiv,
+                     T* C,
+                     rocblas_int ldc,
+                     T* work,
+                     rocblas_int sizeW);
+
 template <typename T>
 void cpu_lauum(rocblas_fill uploR, rocblas_int n, T* A, rocblas_int lda);
 
@@ -796,6 +1010,38 @@ void cpu_sytrf(rocblas_fill uplo,
                rocblas_int lwork,
                rocblas_int* info);
 
+template <typename T>
+void cpu_sytrs(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int nrhs,
+               T* A,
+               rocblas_int lda,
+               rocblas_int* ipiv,
+               T* B,
+               rocblas_int ldb);
+
+template <typename T>
+void cpu_sysv(rocblas_fill uplo,
+              rocblas_int n,
+              rocblas_int nrhs,
+              T* A,
+              rocblas_int lda,
+              rocblas_int* ipiv,
+              T* B,
+              rocblas_int ldb,
+              T* work,
+              rocblas_int lwork,
+              rocblas_int* info);
+
+template <typename T>
+void cpu_sytri(rocblas_fill uplo,
+               rocblas_int n,
+               T* A,
+               rocblas_int lda,
+               rocblas_int* ipiv,
+               T* work,
+               rocblas_int* info);
+
 template <typename T>
 void cpu_bdsvdx(rocblas_fill uplo,
                 rocblas_svect svect,
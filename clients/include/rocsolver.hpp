@@ -1112,6 +1112,60 @@ inline rocblas_status rocsolver_orglx_unglx(bool GLQ,
 }
 /***************************************************************/
 
+/******************** ORGRx_UNGRx ********************/
+inline rocblas_status rocsolver_orgrx_ungrx(bool GRQ,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            float* A,
+                                            rocblas_int lda,
+                                            float* Ipiv)
+{
+    return GRQ ? rocsolver_sorgrq(handle, m, n, k, A, lda, Ipiv)
+               : rocsolver_sorgr2(handle, m, n, k, A, lda, Ipiv);
+}
+
+inline rocblas_status rocsolver_orgrx_ungrx(bool GRQ,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            double* A,
+                                            rocblas_int lda,
+                                            double* Ipiv)
+{
+    return GRQ ? rocsolver_dorgrq(handle, m, n, k, A, lda, Ipiv)
+               : rocsolver_dorgr2(handle, m, n, k, A, lda, Ipiv);
+}
+
+inline rocblas_status rocsolver_orgrx_ungrx(bool GRQ,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_float_complex* Ipiv)
+{
+    return GRQ ? rocsolver_cungrq(handle, m, n, k, A, lda, Ipiv)
+               : rocsolver_cungr2(handle, m, n, k, A, lda, Ipiv);
+}
+
+inline rocblas_status rocsolver_orgrx_ungrx(bool GRQ,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_double_complex* Ipiv)
+{
+    return GRQ ? rocsolver_zungrq(handle, m, n, k, A, lda, Ipiv)
+               : rocsolver_zungr2(handle, m, n, k, A, lda, Ipiv);
+}
+/***************************************************************/
+
 /******************** ORGxL_UNGxL ********************/
 inline rocblas_status rocsolver_orgxl_ungxl(bool GQL,
                                             rocblas_handle handle,
@@ -1398,6 +1452,76 @@ inline rocblas_status rocsolver_ormlx_unmlx(bool MLQ,
 }
 /***************************************************************/
 
+/******************** ORMRx_UNMRx ********************/
+inline rocblas_status rocsolver_ormrx_unmrx(bool MRQ,
+                                            rocblas_handle handle,
+                                            rocblas_side side,
+                                            rocblas_operation trans,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            float* A,
+                                            rocblas_int lda,
+                                            float* Ipiv,
+                                            float* C,
+                                            rocblas_int ldc)
+{
+    return MRQ ? rocsolver_sormrq(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc)
+               : rocsolver_sormr2(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc);
+}
+
+inline rocblas_status rocsolver_ormrx_unmrx(bool MRQ,
+                                            rocblas_handle handle,
+                                            rocblas_side side,
+                                            rocblas_operation trans,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            double* A,
+                                            rocblas_int lda,
+                                            double* Ipiv,
+                                            double* C,
+                                            rocblas_int ldc)
+{
+    return MRQ ? rocsolver_dormrq(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc)
+               : rocsolver_dormr2(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc);
+}
+
+inline rocblas_status rocsolver_ormrx_unmrx(bool MRQ,
+                                            rocblas_handle handle,
+                                            rocblas_side side,
+                                            rocblas_operation trans,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_float_complex* Ipiv,
+                                            rocblas_float_complex* C,
+                                            rocblas_int ldc)
+{
+    return MRQ ? rocsolver_cunmrq(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc)
+               : rocsolver_cunmr2(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc);
+}
+
+inline rocblas_status rocsolver_ormrx_unmrx(bool MRQ,
+                                            rocblas_handle handle,
+                                            rocblas_side side,
+                                            rocblas_operation trans,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_int k,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_double_complex* Ipiv,
+                                            rocblas_double_complex* C,
+                                            rocblas_int ldc)
+{
+    return MRQ ? rocsolver_zunmrq(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc)
+               : rocsolver_zunmr2(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc);
+}
+/***************************************************************/
+
 /******************** ORMxL_UNMxL ********************/
 inline rocblas_status rocsolver_ormxl_unmxl(bool MQL,
                                             rocblas_handle handle,
@@ -1922,6 +2046,38 @@ inline rocblas_status rocsolver_bdsvdx(rocblas_handle handle,
 }
 /********************************************************/
 
+/******************** BDSDC ********************/
+inline rocblas_status rocsolver_bdsdc(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_svect svect,
+                                      rocblas_int n,
+                                      float* D,
+                                      float* E,
+                                      float* U,
+                                      rocblas_int ldu,
+                                      float* V,
+                                      rocblas_int ldv,
+                                      rocblas_int* info)
+{
+    return rocsolver_sbdsdc(handle, uplo, svect, n, D, E, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_bdsdc(rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_svect svect,
+                                      rocblas_int n,
+                                      double* D,
+                                      double* E,
+                                      double* U,
+                                      rocblas_int ldu,
+                                      double* V,
+                                      rocblas_int ldv,
+                                      rocblas_int* info)
+{
+    return rocsolver_dbdsdc(handle, uplo, svect, n, D, E, U, ldu, V, ldv, info);
+}
+/********************************************************/
+
 /******************** POTF2_POTRF ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
@@ -2214,6 +2370,134 @@ inline rocblas_status rocsolver_potrs(bool STRIDED,
 }
 /********************************************************/
 
+/******************** POCON ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_spocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond, bc);
+    else
+        return rocsolver_spocon(handle, uplo, n, A, lda, anorm, rcond);
+}
+
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dpocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond, bc);
+    else
+        return rocsolver_dpocon(handle, uplo, n, A, lda, anorm, rcond);
+}
+
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cpocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond, bc);
+    else
+        return rocsolver_cpocon(handle, uplo, n, A, lda, anorm, rcond);
+}
+
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zpocon_strided_batched(handle, uplo, n, A, lda, stA, anorm, rcond, bc);
+    else
+        return rocsolver_zpocon(handle, uplo, n, A, lda, anorm, rcond);
+}
+
+// batched
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_spocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
+}
+
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_dpocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
+}
+
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_cpocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
+}
+
+inline rocblas_status rocsolver_pocon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_zpocon_batched(handle, uplo, n, A, lda, anorm, rcond, bc);
+}
+/********************************************************/
+
 /******************** POSV ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_posv(bool STRIDED,
@@ -2370,57 +2654,285 @@ inline rocblas_status rocsolver_posv(bool STRIDED,
 }
 /********************************************************/
 
-/******************** POTRI ********************/
+/******************** PORFS ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_potri(bool STRIDED,
+inline rocblas_status rocsolver_porfs(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_fill uplo,
                                       rocblas_int n,
+                                      rocblas_int nrhs,
                                       float* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* info,
-                                      rocblas_int batch_count)
+                                      float* AF,
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* X,
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      float* ferr,
+                                      float* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return rocsolver_spotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+        return rocsolver_sporfs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, AF, ldaf, stAF,
+                                                B, ldb, stB, X, ldx, stX, ferr, berr, stE, bc);
     else
-        return rocsolver_spotri(handle, uplo, n, A, lda, info);
+        return rocsolver_sporfs(handle, uplo, n, nrhs, A, lda, AF, ldaf, B, ldb, X, ldx, ferr,
+                                berr);
 }
 
-inline rocblas_status rocsolver_potri(bool STRIDED,
+inline rocblas_status rocsolver_porfs(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_fill uplo,
                                       rocblas_int n,
+                                      rocblas_int nrhs,
                                       double* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* info,
-                                      rocblas_int batch_count)
+                                      double* AF,
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* X,
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      double* ferr,
+                                      double* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return rocsolver_dpotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+        return rocsolver_dporfs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, AF, ldaf, stAF,
+                                                B, ldb, stB, X, ldx, stX, ferr, berr, stE, bc);
     else
-        return rocsolver_dpotri(handle, uplo, n, A, lda, info);
+        return rocsolver_dporfs(handle, uplo, n, nrhs, A, lda, AF, ldaf, B, ldb, X, ldx, ferr,
+                                berr);
 }
 
-inline rocblas_status rocsolver_potri(bool STRIDED,
+inline rocblas_status rocsolver_porfs(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_fill uplo,
                                       rocblas_int n,
+                                      rocblas_int nrhs,
                                       rocblas_float_complex* A,
                                       rocblas_int lda,
                                       rocblas_stride stA,
-                                      rocblas_int* info,
-                                      rocblas_int batch_count)
+                                      rocblas_float_complex* AF,
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_float_complex* X,
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      float* ferr,
+                                      float* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return rocsolver_cpotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+        return rocsolver_cporfs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, AF, ldaf, stAF,
+                                                B, ldb, stB, X, ldx, stX, ferr, berr, stE, bc);
     else
-        return rocsolver_cpotri(handle, uplo, n, A, lda, info);
+        return rocsolver_cporfs(handle, uplo, n, nrhs, A, lda, AF, ldaf, B, ldb, X, ldx, ferr,
+                                berr);
 }
 
-inline rocblas_status rocsolver_potri(bool STRIDED,
+inline rocblas_status rocsolver_porfs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* AF,
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_double_complex* X,
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      double* ferr,
+                                      double* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zporfs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, AF, ldaf, stAF,
+                                                B, ldb, stB, X, ldx, stX, ferr, berr, stE, bc);
+    else
+        return rocsolver_zporfs(handle, uplo, n, nrhs, A, lda, AF, ldaf, B, ldb, X, ldx, ferr,
+                                berr);
+}
+
+// batched
+inline rocblas_status rocsolver_porfs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const AF[],
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* const X[],
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      float* ferr,
+                                      float* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
+{
+    return rocsolver_sporfs_batched(handle, uplo, n, nrhs, A, lda, AF, ldaf, B, ldb, X, ldx, ferr,
+                                    berr, stE, bc);
+}
+
+inline rocblas_status rocsolver_porfs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const AF[],
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* const X[],
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      double* ferr,
+                                      double* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
+{
+    return rocsolver_dporfs_batched(handle, uplo, n, nrhs, A, lda, AF, ldaf, B, ldb, X, ldx, ferr,
+                                    berr, stE, bc);
+}
+
+inline rocblas_status rocsolver_porfs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const AF[],
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_float_complex* const X[],
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      float* ferr,
+                                      float* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
+{
+    return rocsolver_cporfs_batched(handle, uplo, n, nrhs, A, lda, AF, ldaf, B, ldb, X, ldx, ferr,
+                                    berr, stE, bc);
+}
+
+inline rocblas_status rocsolver_porfs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const AF[],
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_double_complex* const X[],
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      double* ferr,
+                                      double* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
+{
+    return rocsolver_zporfs_batched(handle, uplo, n, nrhs, A, lda, AF, ldaf, B, ldb, X, ldx, ferr,
+                                    berr, stE, bc);
+}
+/********************************************************/
+
+/******************** POTRI ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
+{
+    if(STRIDED)
+        return rocsolver_spotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+    else
+        return rocsolver_spotri(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
+{
+    if(STRIDED)
+        return rocsolver_dpotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+    else
+        return rocsolver_dpotri(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_potri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int batch_count)
+{
+    if(STRIDED)
+        return rocsolver_cpotri_strided_batched(handle, uplo, n, A, lda, stA, info, batch_count);
+    else
+        return rocsolver_cpotri(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_potri(bool STRIDED,
                                       rocblas_handle handle,
                                       rocblas_fill uplo,
                                       rocblas_int n,
@@ -3018,100 +3530,296 @@ inline rocblas_status rocsolver_gesvd(bool STRIDED,
 }
 /********************************************************/
 
-/******************** GESVDJ ********************/
+/******************** GESDD ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       float* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float abstol,
-                                       float* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       float* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       float* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      float* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                       abstol, residual, max_sweeps, n_sweeps, S,
-                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
-                   : rocsolver_sgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    return STRIDED
+        ? rocsolver_sgesdd_strided_batched(handle, svect, m, n, A, lda, stA, S, stS, U, ldu, stU, V,
+                                           ldv, stV, info, bc)
+        : rocsolver_sgesdd(handle, svect, m, n, A, lda, S, U, ldu, V, ldv, info);
 }
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       double* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       double abstol,
-                                       double* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       double* S,
-                                       rocblas_stride stS,
-                                       double* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       double* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      double* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                       abstol, residual, max_sweeps, n_sweeps, S,
-                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
-                   : rocsolver_dgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+    return STRIDED
+        ? rocsolver_dgesdd_strided_batched(handle, svect, m, n, A, lda, stA, S, stS, U, ldu, stU, V,
+                                           ldv, stV, info, bc)
+        : rocsolver_dgesdd(handle, svect, m, n, A, lda, S, U, ldu, V, ldv, info);
 }
 
-inline rocblas_status rocsolver_gesvdj(bool STRIDED,
-                                       rocblas_handle handle,
-                                       rocblas_svect leftv,
-                                       rocblas_svect rightv,
-                                       rocblas_int m,
-                                       rocblas_int n,
-                                       rocblas_float_complex* A,
-                                       rocblas_int lda,
-                                       rocblas_stride stA,
-                                       float abstol,
-                                       float* residual,
-                                       rocblas_int max_sweeps,
-                                       rocblas_int* n_sweeps,
-                                       float* S,
-                                       rocblas_stride stS,
-                                       rocblas_float_complex* U,
-                                       rocblas_int ldu,
-                                       rocblas_stride stU,
-                                       rocblas_float_complex* V,
-                                       rocblas_int ldv,
-                                       rocblas_stride stV,
-                                       rocblas_int* info,
-                                       rocblas_int bc)
-{
-    return STRIDED ? rocsolver_cgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
-                                                       abstol, residual, max_sweeps, n_sweeps, S,
-                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
-                   : rocsolver_cgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
-                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
-}
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      rocblas_float_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_float_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cgesdd_strided_batched(handle, svect, m, n, A, lda, stA, S, stS, U, ldu, stU, V,
+                                           ldv, stV, info, bc)
+        : rocsolver_cgesdd(handle, svect, m, n, A, lda, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      rocblas_double_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_double_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zgesdd_strided_batched(handle, svect, m, n, A, lda, stA, S, stS, U, ldu, stU, V,
+                                           ldv, stV, info, bc)
+        : rocsolver_zgesdd(handle, svect, m, n, A, lda, S, U, ldu, V, ldv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      float* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgesdd_batched(handle, svect, m, n, A, lda, S, stS, U, ldu, stU, V, ldv, stV,
+                                    info, bc);
+}
+
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      double* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgesdd_batched(handle, svect, m, n, A, lda, S, stS, U, ldu, stU, V, ldv, stV,
+                                    info, bc);
+}
+
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      rocblas_float_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_float_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgesdd_batched(handle, svect, m, n, A, lda, S, stS, U, ldu, stU, V, ldv, stV,
+                                    info, bc);
+}
+
+inline rocblas_status rocsolver_gesdd(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_svect svect,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      rocblas_double_complex* U,
+                                      rocblas_int ldu,
+                                      rocblas_stride stU,
+                                      rocblas_double_complex* V,
+                                      rocblas_int ldv,
+                                      rocblas_stride stV,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgesdd_batched(handle, svect, m, n, A, lda, S, stS, U, ldu, stU, V, ldv, stV,
+                                    info, bc);
+}
+/********************************************************/
+
+/******************** GESVDJ ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       float* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       float* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_sgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double abstol,
+                                       double* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       double* S,
+                                       rocblas_stride stS,
+                                       double* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       double* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_dgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
+
+inline rocblas_status rocsolver_gesvdj(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_svect leftv,
+                                       rocblas_svect rightv,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float abstol,
+                                       float* residual,
+                                       rocblas_int max_sweeps,
+                                       rocblas_int* n_sweeps,
+                                       float* S,
+                                       rocblas_stride stS,
+                                       rocblas_float_complex* U,
+                                       rocblas_int ldu,
+                                       rocblas_stride stU,
+                                       rocblas_float_complex* V,
+                                       rocblas_int ldv,
+                                       rocblas_stride stV,
+                                       rocblas_int* info,
+                                       rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgesvdj_strided_batched(handle, leftv, rightv, m, n, A, lda, stA,
+                                                       abstol, residual, max_sweeps, n_sweeps, S,
+                                                       stS, U, ldu, stU, V, ldv, stV, info, bc)
+                   : rocsolver_cgesvdj(handle, leftv, rightv, m, n, A, lda, abstol, residual,
+                                       max_sweeps, n_sweeps, S, U, ldu, V, ldv, info);
+}
 
 inline rocblas_status rocsolver_gesvdj(bool STRIDED,
                                        rocblas_handle handle,
@@ -3934,42 +4642,174 @@ inline rocblas_status rocsolver_getrs(bool STRIDED,
 }
 /********************************************************/
 
-/******************** GESV ********************/
+/******************** GECON ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     float* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
-                                                     ldb, stB, info, bc)
-                   : rocsolver_sgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+    if(STRIDED)
+        return rocsolver_sgecon_strided_batched(handle, norm_type, n, A, lda, stA, anorm, rcond,
+                                                bc);
+    else
+        return rocsolver_sgecon(handle, norm_type, n, A, lda, anorm, rcond);
 }
 
-inline rocblas_status rocsolver_gesv(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_int* ipiv,
-                                     rocblas_stride stP,
-                                     double* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgecon_strided_batched(handle, norm_type, n, A, lda, stA, anorm, rcond,
+                                                bc);
+    else
+        return rocsolver_dgecon(handle, norm_type, n, A, lda, anorm, rcond);
+}
+
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgecon_strided_batched(handle, norm_type, n, A, lda, stA, anorm, rcond,
+                                                bc);
+    else
+        return rocsolver_cgecon(handle, norm_type, n, A, lda, anorm, rcond);
+}
+
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgecon_strided_batched(handle, norm_type, n, A, lda, stA, anorm, rcond,
+                                                bc);
+    else
+        return rocsolver_zgecon(handle, norm_type, n, A, lda, anorm, rcond);
+}
+
+// batched
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgecon_batched(handle, norm_type, n, A, lda, anorm, rcond, bc);
+}
+
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgecon_batched(handle, norm_type, n, A, lda, anorm, rcond, bc);
+}
+
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* anorm,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgecon_batched(handle, norm_type, n, A, lda, anorm, rcond, bc);
+}
+
+inline rocblas_status rocsolver_gecon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* anorm,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgecon_batched(handle, norm_type, n, A, lda, anorm, rcond, bc);
+}
+/********************************************************/
+
+/******************** GESV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                     ldb, stB, info, bc)
+                   : rocsolver_sgesv(handle, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gesv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
     return STRIDED ? rocsolver_dgesv_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B,
                                                      ldb, stB, info, bc)
@@ -4090,96 +4930,344 @@ inline rocblas_status rocsolver_gesv(bool STRIDED,
 }
 /********************************************************/
 
-/******************** GESV_OUTOFPLACE ********************/
+/******************** GERFS ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                float* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                float* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                float* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gerfs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* AF,
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* X,
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      float* ferr,
+                                      float* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_sgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
-        : rocsolver_sgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+    if(STRIDED)
+        return rocsolver_sgerfs_strided_batched(handle, trans, n, nrhs, A, lda, stA, AF, ldaf, stAF,
+                                                ipiv, stP, B, ldb, stB, X, ldx, stX, ferr, berr,
+                                                stE, bc);
+    else
+        return rocsolver_sgerfs(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx,
+                                ferr, berr);
 }
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                double* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                double* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                double* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gerfs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* AF,
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* X,
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      double* ferr,
+                                      double* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_dgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
-        : rocsolver_dgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+    if(STRIDED)
+        return rocsolver_dgerfs_strided_batched(handle, trans, n, nrhs, A, lda, stA, AF, ldaf, stAF,
+                                                ipiv, stP, B, ldb, stB, X, ldx, stX, ferr, berr,
+                                                stE, bc);
+    else
+        return rocsolver_dgerfs(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx,
+                                ferr, berr);
 }
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_float_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                rocblas_float_complex* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_float_complex* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gerfs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* AF,
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_float_complex* X,
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      float* ferr,
+                                      float* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_cgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
-        : rocsolver_cgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+    if(STRIDED)
+        return rocsolver_cgerfs_strided_batched(handle, trans, n, nrhs, A, lda, stA, AF, ldaf, stAF,
+                                                ipiv, stP, B, ldb, stB, X, ldx, stX, ferr, berr,
+                                                stE, bc);
+    else
+        return rocsolver_cgerfs(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx,
+                                ferr, berr);
 }
 
-inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_double_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_int* ipiv,
-                                                rocblas_stride stP,
-                                                rocblas_double_complex* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_double_complex* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_gerfs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* AF,
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_double_complex* X,
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      double* ferr,
+                                      double* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
 {
-    return STRIDED
+    if(STRIDED)
+        return rocsolver_zgerfs_strided_batched(handle, trans, n, nrhs, A, lda, stA, AF, ldaf, stAF,
+                                                ipiv, stP, B, ldb, stB, X, ldx, stX, ferr, berr,
+                                                stE, bc);
+    else
+        return rocsolver_zgerfs(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, B, ldb, X, ldx,
+                                ferr, berr);
+}
+
+// batched
+inline rocblas_status rocsolver_gerfs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const AF[],
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* const X[],
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      float* ferr,
+                                      float* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgerfs_batched(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, stP, B, ldb, X,
+                                    ldx, ferr, berr, stE, bc);
+}
+
+inline rocblas_status rocsolver_gerfs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const AF[],
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* const X[],
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      double* ferr,
+                                      double* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgerfs_batched(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, stP, B, ldb, X,
+                                    ldx, ferr, berr, stE, bc);
+}
+
+inline rocblas_status rocsolver_gerfs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const AF[],
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_float_complex* const X[],
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      float* ferr,
+                                      float* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgerfs_batched(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, stP, B, ldb, X,
+                                    ldx, ferr, berr, stE, bc);
+}
+
+inline rocblas_status rocsolver_gerfs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const AF[],
+                                      rocblas_int ldaf,
+                                      rocblas_stride stAF,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_double_complex* const X[],
+                                      rocblas_int ldx,
+                                      rocblas_stride stX,
+                                      double* ferr,
+                                      double* berr,
+                                      rocblas_stride stE,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgerfs_batched(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv, stP, B, ldb, X,
+                                    ldx, ferr, berr, stE, bc);
+}
+/********************************************************/
+
+/******************** GESV_OUTOFPLACE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                float* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                float* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                float* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocblas_status_not_implemented // rocsolver_sgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
+        : rocsolver_sgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+}
+
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                double* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                double* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                double* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocblas_status_not_implemented // rocsolver_dgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
+        : rocsolver_dgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+}
+
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                rocblas_float_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                rocblas_float_complex* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_float_complex* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
+        ? rocblas_status_not_implemented // rocsolver_cgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
+        : rocsolver_cgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+}
+
+inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                rocblas_double_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_int* ipiv,
+                                                rocblas_stride stP,
+                                                rocblas_double_complex* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_double_complex* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return STRIDED
         ? rocblas_status_not_implemented // rocsolver_zgesv_outofplace_strided_batched(handle, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, X, ldx, stX, info, bc)
         : rocsolver_zgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
 }
@@ -4894,86 +5982,226 @@ inline rocblas_status rocsolver_trtri(bool STRIDED,
 }
 /********************************************************/
 
-/******************** GEQR2_GEQRF ********************/
+/******************** TRCON ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GEQRF ? rocsolver_sgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_strcon_strided_batched(handle, norm_type, uplo, diag, n, A, lda, stA,
+                                                rcond, bc);
     else
-        return GEQRF ? rocsolver_sgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgeqr2(handle, m, n, A, lda, ipiv);
+        return rocsolver_strcon(handle, norm_type, uplo, diag, n, A, lda, rcond);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* rcond,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GEQRF ? rocsolver_dgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_dgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_dtrcon_strided_batched(handle, norm_type, uplo, diag, n, A, lda, stA,
+                                                rcond, bc);
     else
-        return GEQRF ? rocsolver_dgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_dgeqr2(handle, m, n, A, lda, ipiv);
+        return rocsolver_dtrcon(handle, norm_type, uplo, diag, n, A, lda, rcond);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* rcond,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GEQRF ? rocsolver_cgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_ctrcon_strided_batched(handle, norm_type, uplo, diag, n, A, lda, stA,
+                                                rcond, bc);
     else
-        return GEQRF ? rocsolver_cgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgeqr2(handle, m, n, A, lda, ipiv);
+        return rocsolver_ctrcon(handle, norm_type, uplo, diag, n, A, lda, rcond);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
-{
-    if(STRIDED)
-        return GEQRF ? rocsolver_zgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
-    else
-        return GEQRF ? rocsolver_zgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgeqr2(handle, m, n, A, lda, ipiv);
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_ztrcon_strided_batched(handle, norm_type, uplo, diag, n, A, lda, stA,
+                                                rcond, bc);
+    else
+        return rocsolver_ztrcon(handle, norm_type, uplo, diag, n, A, lda, rcond);
+}
+
+// batched
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_strcon_batched(handle, norm_type, uplo, diag, n, A, lda, rcond, bc);
+}
+
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_dtrcon_batched(handle, norm_type, uplo, diag, n, A, lda, rcond, bc);
+}
+
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_ctrcon_batched(handle, norm_type, uplo, diag, n, A, lda, rcond, bc);
+}
+
+inline rocblas_status rocsolver_trcon(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_norm_type norm_type,
+                                      rocblas_fill uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* rcond,
+                                      rocblas_int bc)
+{
+    return rocsolver_ztrcon_batched(handle, norm_type, uplo, diag, n, A, lda, rcond, bc);
+}
+/********************************************************/
+
+/******************** GEQR2_GEQRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_sgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_sgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_dgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_dgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_dgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_dgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_cgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_cgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_zgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_zgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgeqr2(handle, m, n, A, lda, ipiv);
 }
 
 // batched
@@ -5107,158 +6335,310 @@ inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
 }
 /********************************************************/
 
-/******************** GERQ2_GERQF ********************/
+/******************** GEQP3 ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
-                                            bool GERQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float* ipiv,
+                                      rocblas_stride stP,
+                                      float tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GERQF ? rocsolver_sgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_sgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                tol, rank, bc);
     else
-        return GERQF ? rocsolver_sgerqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgerq2(handle, m, n, A, lda, ipiv);
+        return rocsolver_sgeqp3(handle, m, n, A, lda, jpvt, ipiv, tol, rank);
 }
 
-inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
-                                            bool GERQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double* ipiv,
+                                      rocblas_stride stP,
+                                      double tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GERQF ? rocsolver_dgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_dgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_dgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                tol, rank, bc);
     else
-        return GERQF ? rocsolver_dgerqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_dgerq2(handle, m, n, A, lda, ipiv);
+        return rocsolver_dgeqp3(handle, m, n, A, lda, jpvt, ipiv, tol, rank);
 }
 
-inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
-                                            bool GERQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
+                                      float tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GERQF ? rocsolver_cgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_cgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                tol, rank, bc);
     else
-        return GERQF ? rocsolver_cgerqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgerq2(handle, m, n, A, lda, ipiv);
+        return rocsolver_cgeqp3(handle, m, n, A, lda, jpvt, ipiv, tol, rank);
 }
 
-inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
-                                            bool GERQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
+                                      double tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GERQF ? rocsolver_zgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_zgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ, ipiv, stP,
+                                                tol, rank, bc);
     else
-        return GERQF ? rocsolver_zgerqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgerq2(handle, m, n, A, lda, ipiv);
+        return rocsolver_zgeqp3(handle, m, n, A, lda, jpvt, ipiv, tol, rank);
 }
 
 // batched
-inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
-                                            bool GERQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float* ipiv,
+                                      rocblas_stride stP,
+                                      float tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return GERQF ? rocsolver_sgerqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_sgerq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return rocsolver_sgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, tol, rank, bc);
 }
 
-inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
-                                            bool GERQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double* ipiv,
+                                      rocblas_stride stP,
+                                      double tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return GERQF ? rocsolver_dgerqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_dgerq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return rocsolver_dgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, tol, rank, bc);
 }
 
-inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
-                                            bool GERQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
+                                      float tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return GERQF ? rocsolver_cgerqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_cgerq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return rocsolver_cgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, tol, rank, bc);
 }
 
-inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
-                                            bool GERQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
+                                      double tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return GERQF ? rocsolver_zgerqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_zgerq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return rocsolver_zgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, tol, rank, bc);
 }
 /********************************************************/
 
-/******************** GEQL2_GEQLF ********************/
+/******************** GEQRFQ ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_geqrfq(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgeqrfq_strided_batched(handle, m, n, A, lda, stA, R, ldr, stR, bc);
+    else
+        return rocsolver_sgeqrfq(handle, m, n, A, lda, R, ldr);
+}
+
+inline rocblas_status rocsolver_geqrfq(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgeqrfq_strided_batched(handle, m, n, A, lda, stA, R, ldr, stR, bc);
+    else
+        return rocsolver_dgeqrfq(handle, m, n, A, lda, R, ldr);
+}
+
+inline rocblas_status rocsolver_geqrfq(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_float_complex* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgeqrfq_strided_batched(handle, m, n, A, lda, stA, R, ldr, stR, bc);
+    else
+        return rocsolver_cgeqrfq(handle, m, n, A, lda, R, ldr);
+}
+
+inline rocblas_status rocsolver_geqrfq(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_double_complex* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgeqrfq_strided_batched(handle, m, n, A, lda, stA, R, ldr, stR, bc);
+    else
+        return rocsolver_zgeqrfq(handle, m, n, A, lda, R, ldr);
+}
+
+// batched
+inline rocblas_status rocsolver_geqrfq(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       float* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       float* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int bc)
+{
+    return rocsolver_sgeqrfq_batched(handle, m, n, A, lda, R, ldr, stR, bc);
+}
+
+inline rocblas_status rocsolver_geqrfq(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       double* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       double* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int bc)
+{
+    return rocsolver_dgeqrfq_batched(handle, m, n, A, lda, R, ldr, stR, bc);
+}
+
+inline rocblas_status rocsolver_geqrfq(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_float_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_float_complex* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int bc)
+{
+    return rocsolver_cgeqrfq_batched(handle, m, n, A, lda, R, ldr, stR, bc);
+}
+
+inline rocblas_status rocsolver_geqrfq(bool STRIDED,
+                                       rocblas_handle handle,
+                                       rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_double_complex* const A[],
+                                       rocblas_int lda,
+                                       rocblas_stride stA,
+                                       rocblas_double_complex* R,
+                                       rocblas_int ldr,
+                                       rocblas_stride stR,
+                                       rocblas_int bc)
+{
+    return rocsolver_zgeqrfq_batched(handle, m, n, A, lda, R, ldr, stR, bc);
+}
+/********************************************************/
+
+/******************** GERQ2_GERQF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
+                                            bool GERQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
@@ -5270,15 +6650,15 @@ inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQLF ? rocsolver_sgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return GERQF ? rocsolver_sgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return GEQLF ? rocsolver_sgeqlf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgeql2(handle, m, n, A, lda, ipiv);
+        return GERQF ? rocsolver_sgerqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgerq2(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
+                                            bool GERQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
@@ -5290,15 +6670,15 @@ inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQLF ? rocsolver_dgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_dgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return GERQF ? rocsolver_dgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_dgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return GEQLF ? rocsolver_dgeqlf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_dgeql2(handle, m, n, A, lda, ipiv);
+        return GERQF ? rocsolver_dgerqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_dgerq2(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
+                                            bool GERQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
@@ -5310,15 +6690,15 @@ inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQLF ? rocsolver_cgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return GERQF ? rocsolver_cgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return GEQLF ? rocsolver_cgeqlf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgeql2(handle, m, n, A, lda, ipiv);
+        return GERQF ? rocsolver_cgerqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgerq2(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
+                                            bool GERQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
@@ -5330,16 +6710,16 @@ inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQLF ? rocsolver_zgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return GERQF ? rocsolver_zgerqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgerq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return GEQLF ? rocsolver_zgeqlf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgeql2(handle, m, n, A, lda, ipiv);
+        return GERQF ? rocsolver_zgerqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgerq2(handle, m, n, A, lda, ipiv);
 }
 
 // batched
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
+                                            bool GERQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
@@ -5350,12 +6730,12 @@ inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEQLF ? rocsolver_sgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_sgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return GERQF ? rocsolver_sgerqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_sgerq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
+                                            bool GERQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
@@ -5366,12 +6746,12 @@ inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEQLF ? rocsolver_dgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_dgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return GERQF ? rocsolver_dgerqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_dgerq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
+                                            bool GERQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
@@ -5382,12 +6762,12 @@ inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEQLF ? rocsolver_cgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_cgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return GERQF ? rocsolver_cgerqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_cgerq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
-                                            bool GEQLF,
+inline rocblas_status rocsolver_gerq2_gerqf(bool STRIDED,
+                                            bool GERQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
@@ -5398,1571 +6778,2859 @@ inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEQLF ? rocsolver_zgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_zgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return GERQF ? rocsolver_zgerqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_zgerq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 /********************************************************/
 
-/******************** GELQ2_GELQF ********************/
+/******************** GGQRF ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggqrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* taua,
+                                      rocblas_stride stTa,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GELQF ? rocsolver_sgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_sgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_sggqrf_strided_batched(handle, n, m, p, A, lda, stA, taua, stTa, B, ldb,
+                                                stB, taub, stTb, bc);
     else
-        return GELQF ? rocsolver_sgelqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_sgelq2(handle, m, n, A, lda, ipiv);
+        return rocsolver_sggqrf(handle, n, m, p, A, lda, taua, B, ldb, taub);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggqrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* taua,
+                                      rocblas_stride stTa,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GELQF ? rocsolver_dgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_dgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_dggqrf_strided_batched(handle, n, m, p, A, lda, stA, taua, stTa, B, ldb,
+                                                stB, taub, stTb, bc);
     else
-        return GELQF ? rocsolver_dgelqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_dgelq2(handle, m, n, A, lda, ipiv);
+        return rocsolver_dggqrf(handle, n, m, p, A, lda, taua, B, ldb, taub);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggqrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* taua,
+                                      rocblas_stride stTa,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_float_complex* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GELQF ? rocsolver_cgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_cggqrf_strided_batched(handle, n, m, p, A, lda, stA, taua, stTa, B, ldb,
+                                                stB, taub, stTb, bc);
     else
-        return GELQF ? rocsolver_cgelqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgelq2(handle, m, n, A, lda, ipiv);
+        return rocsolver_cggqrf(handle, n, m, p, A, lda, taua, B, ldb, taub);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggqrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* taua,
+                                      rocblas_stride stTa,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_double_complex* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return GELQF ? rocsolver_zgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_zggqrf_strided_batched(handle, n, m, p, A, lda, stA, taua, stTa, B, ldb,
+                                                stB, taub, stTb, bc);
     else
-        return GELQF ? rocsolver_zgelqf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgelq2(handle, m, n, A, lda, ipiv);
+        return rocsolver_zggqrf(handle, n, m, p, A, lda, taua, B, ldb, taub);
 }
 
 // batched
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggqrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* taua,
+                                      rocblas_stride stTa,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
-    return GELQF ? rocsolver_sgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_sgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return rocsolver_sggqrf_batched(handle, n, m, p, A, lda, taua, stTa, B, ldb, taub, stTb, bc);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggqrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* taua,
+                                      rocblas_stride stTa,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
-    return GELQF ? rocsolver_dgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_dgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return rocsolver_dggqrf_batched(handle, n, m, p, A, lda, taua, stTa, B, ldb, taub, stTb, bc);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggqrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* taua,
+                                      rocblas_stride stTa,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_float_complex* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
-    return GELQF ? rocsolver_cgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_cgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return rocsolver_cggqrf_batched(handle, n, m, p, A, lda, taua, stTa, B, ldb, taub, stTb, bc);
 }
 
-inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
-                                            bool GELQF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggqrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* taua,
+                                      rocblas_stride stTa,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_double_complex* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
-    return GELQF ? rocsolver_zgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
-                 : rocsolver_zgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
+    return rocsolver_zggqrf_batched(handle, n, m, p, A, lda, taua, stTa, B, ldb, taub, stTb, bc);
 }
 /********************************************************/
 
-/******************** GELS ********************/
+/******************** GGRQF ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     float* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_ggrqf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* taua,
+                                      rocblas_stride stTa,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return rocsolver_sgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
+        return rocsolver_sggrqf_strided_batched(handle, m, p, n, A, lda, stA, taua, stTa, B, ldb,
+                                                stB, taub, stTb, bc);
     else
-        return rocsolver_sgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+        return rocsolver_sggrqf(handle, m, p, n, A, lda, taua, B, ldb, taub);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     double* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_ggrqf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* taua,
+                                      rocblas_stride stTa,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return rocsolver_dgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
+        return rocsolver_dggrqf_strided_batched(handle, m, p, n, A, lda, stA, taua, stTa, B, ldb,
+                                                stB, taub, stTb, bc);
     else
-        return rocsolver_dgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+        return rocsolver_dggrqf(handle, m, p, n, A, lda, taua, B, ldb, taub);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_float_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_ggrqf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* taua,
+                                      rocblas_stride stTa,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_float_complex* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return rocsolver_cgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
+        return rocsolver_cggrqf_strided_batched(handle, m, p, n, A, lda, stA, taua, stTa, B, ldb,
+                                                stB, taub, stTb, bc);
     else
-        return rocsolver_cgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+        return rocsolver_cggrqf(handle, m, p, n, A, lda, taua, B, ldb, taub);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* A,
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_double_complex* B,
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_ggrqf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* taua,
+                                      rocblas_stride stTa,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_double_complex* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return rocsolver_zgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
-                                               info, bc);
+        return rocsolver_zggrqf_strided_batched(handle, m, p, n, A, lda, stA, taua, stTa, B, ldb,
+                                                stB, taub, stTb, bc);
     else
-        return rocsolver_zgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+        return rocsolver_zggrqf(handle, m, p, n, A, lda, taua, B, ldb, taub);
 }
 
 // batched
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     float* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     float* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_ggrqf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* taua,
+                                      rocblas_stride stTa,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
-    return rocsolver_sgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_sggrqf_batched(handle, m, p, n, A, lda, taua, stTa, B, ldb, taub, stTb, bc);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     double* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     double* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_ggrqf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* taua,
+                                      rocblas_stride stTa,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
-    return rocsolver_dgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_dggrqf_batched(handle, m, p, n, A, lda, taua, stTa, B, ldb, taub, stTb, bc);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_float_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_ggrqf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* taua,
+                                      rocblas_stride stTa,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_float_complex* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
-    return rocsolver_cgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_cggrqf_batched(handle, m, p, n, A, lda, taua, stTa, B, ldb, taub, stTb, bc);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_double_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_ggrqf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* taua,
+                                      rocblas_stride stTa,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_double_complex* taub,
+                                      rocblas_stride stTb,
+                                      rocblas_int bc)
 {
-    return rocsolver_zgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_zggrqf_batched(handle, m, p, n, A, lda, taua, stTa, B, ldb, taub, stTb, bc);
 }
 /********************************************************/
 
-/******************** GELS_OUTOFPLACE ********************/
+/******************** GEQL2_GEQLF ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_operation trans,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                float* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                float* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                float* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
     if(STRIDED)
-        return rocblas_status_not_implemented; // rocsolver_sgels_outofplace_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB, X, ldx, stX, info, bc);
+        return GEQLF ? rocsolver_sgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return rocsolver_sgels_outofplace(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info);
+        return GEQLF ? rocsolver_sgeqlf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgeql2(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_operation trans,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                double* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                double* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                double* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
     if(STRIDED)
-        return rocblas_status_not_implemented; // rocsolver_dgels_outofplace_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB, X, ldx, stX, info, bc);
+        return GEQLF ? rocsolver_dgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_dgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return rocsolver_dgels_outofplace(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info);
+        return GEQLF ? rocsolver_dgeqlf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_dgeql2(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_operation trans,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_float_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_float_complex* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_float_complex* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
     if(STRIDED)
-        return rocblas_status_not_implemented; // rocsolver_cgels_outofplace_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB, X, ldx, stX, info, bc);
+        return GEQLF ? rocsolver_cgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return rocsolver_cgels_outofplace(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info);
+        return GEQLF ? rocsolver_cgeqlf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgeql2(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_operation trans,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_double_complex* A,
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_double_complex* B,
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_double_complex* X,
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
     if(STRIDED)
-        return rocblas_status_not_implemented; // rocsolver_zgels_outofplace_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB, X, ldx, stX, info, bc);
+        return GEQLF ? rocsolver_zgeqlf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgeql2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return rocsolver_zgels_outofplace(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info);
+        return GEQLF ? rocsolver_zgeqlf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgeql2(handle, m, n, A, lda, ipiv);
 }
 
 // batched
-inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_operation trans,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                float* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                float* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                float* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_sgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+    return GEQLF ? rocsolver_sgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_sgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_operation trans,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                double* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                double* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                double* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_dgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+    return GEQLF ? rocsolver_dgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_dgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_operation trans,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_float_complex* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_float_complex* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_float_complex* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_cgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+    return GEQLF ? rocsolver_cgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_cgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
-                                                rocblas_handle handle,
-                                                rocblas_operation trans,
-                                                rocblas_int m,
-                                                rocblas_int n,
-                                                rocblas_int nrhs,
-                                                rocblas_double_complex* const A[],
-                                                rocblas_int lda,
-                                                rocblas_stride stA,
-                                                rocblas_double_complex* const B[],
-                                                rocblas_int ldb,
-                                                rocblas_stride stB,
-                                                rocblas_double_complex* const X[],
-                                                rocblas_int ldx,
-                                                rocblas_stride stX,
-                                                rocblas_int* info,
-                                                rocblas_int bc)
+inline rocblas_status rocsolver_geql2_geqlf(bool STRIDED,
+                                            bool GEQLF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_zgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+    return GEQLF ? rocsolver_zgeqlf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_zgeql2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 /********************************************************/
 
-/******************** GEBD2_GEBRD ********************/
+/******************** GELQ2_GELQF ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             float* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            float* tauq,
-                                            rocblas_stride stQ,
-                                            float* taup,
+                                            float* ipiv,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEBRD ? rocsolver_sgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_sgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
+        return GELQF ? rocsolver_sgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_sgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return GEBRD ? rocsolver_sgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_sgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+        return GELQF ? rocsolver_sgelqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_sgelq2(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            double* tauq,
-                                            rocblas_stride stQ,
-                                            double* taup,
+                                            double* ipiv,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEBRD ? rocsolver_dgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_dgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
+        return GELQF ? rocsolver_dgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_dgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return GEBRD ? rocsolver_dgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_dgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+        return GELQF ? rocsolver_dgelqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_dgelq2(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_float_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_float_complex* taup,
+                                            rocblas_float_complex* ipiv,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEBRD ? rocsolver_cgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_cgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
+        return GELQF ? rocsolver_cgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return GEBRD ? rocsolver_cgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_cgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+        return GELQF ? rocsolver_cgelqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgelq2(handle, m, n, A, lda, ipiv);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_double_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_double_complex* taup,
+                                            rocblas_double_complex* ipiv,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEBRD ? rocsolver_zgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc)
-                     : rocsolver_zgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
-                                                        tauq, stQ, taup, stP, bc);
+        return GELQF ? rocsolver_zgelqf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgelq2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return GEBRD ? rocsolver_zgebrd(handle, m, n, A, lda, D, E, tauq, taup)
-                     : rocsolver_zgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+        return GELQF ? rocsolver_zgelqf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgelq2(handle, m, n, A, lda, ipiv);
 }
 
 // batched
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             float* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            float* tauq,
-                                            rocblas_stride stQ,
-                                            float* taup,
+                                            float* ipiv,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_sgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_sgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return GELQF ? rocsolver_sgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_sgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             double* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            double* tauq,
-                                            rocblas_stride stQ,
-                                            double* taup,
+                                            double* ipiv,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_dgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_dgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return GELQF ? rocsolver_dgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_dgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
-                                            rocblas_handle handle,
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
+                                            rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_float_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_float_complex* taup,
+                                            rocblas_float_complex* ipiv,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_cgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_cgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return GELQF ? rocsolver_cgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_cgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
-                                            bool GEBRD,
+inline rocblas_status rocsolver_gelq2_gelqf(bool STRIDED,
+                                            bool GELQF,
                                             rocblas_handle handle,
                                             rocblas_int m,
                                             rocblas_int n,
                                             rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_double_complex* tauq,
-                                            rocblas_stride stQ,
-                                            rocblas_double_complex* taup,
+                                            rocblas_double_complex* ipiv,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEBRD
-        ? rocsolver_zgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
-        : rocsolver_zgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+    return GELQF ? rocsolver_zgelqf_batched(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocsolver_zgelq2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 /********************************************************/
 
-/******************** SYTD2/SYTRD_HETD2/HETRD ********************/
+/******************** GELS ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            float* tau,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
     if(STRIDED)
-        return SYTRD ? rocsolver_ssytrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc)
-                     : rocsolver_ssytd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc);
+        return rocsolver_sgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
     else
-        return SYTRD ? rocsolver_ssytrd(handle, uplo, n, A, lda, D, E, tau)
-                     : rocsolver_ssytd2(handle, uplo, n, A, lda, D, E, tau);
+        return rocsolver_sgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            double* tau,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
     if(STRIDED)
-        return SYTRD ? rocsolver_dsytrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc)
-                     : rocsolver_dsytd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc);
+        return rocsolver_dgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
     else
-        return SYTRD ? rocsolver_dsytrd(handle, uplo, n, A, lda, D, E, tau)
-                     : rocsolver_dsytd2(handle, uplo, n, A, lda, D, E, tau);
+        return rocsolver_dgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_float_complex* tau,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
     if(STRIDED)
-        return SYTRD ? rocsolver_chetrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc)
-                     : rocsolver_chetd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc);
+        return rocsolver_cgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
     else
-        return SYTRD ? rocsolver_chetrd(handle, uplo, n, A, lda, D, E, tau)
-                     : rocsolver_chetd2(handle, uplo, n, A, lda, D, E, tau);
+        return rocsolver_cgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_double_complex* tau,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
     if(STRIDED)
-        return SYTRD ? rocsolver_zhetrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc)
-                     : rocsolver_zhetd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
-                                                        stE, tau, stP, bc);
+        return rocsolver_zgels_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
     else
-        return SYTRD ? rocsolver_zhetrd(handle, uplo, n, A, lda, D, E, tau)
-                     : rocsolver_zhetd2(handle, uplo, n, A, lda, D, E, tau);
+        return rocsolver_zgels(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
 }
 
 // batched
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            float* tau,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return SYTRD ? rocsolver_ssytrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
-                 : rocsolver_ssytd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+    return rocsolver_sgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            double* tau,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return SYTRD ? rocsolver_dsytrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
-                 : rocsolver_dsytd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+    return rocsolver_dgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_float_complex* tau,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return SYTRD ? rocsolver_chetrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
-                 : rocsolver_chetd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+    return rocsolver_cgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
-                                            bool SYTRD,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_double_complex* tau,
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return SYTRD ? rocsolver_zhetrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
-                 : rocsolver_zhetd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+    return rocsolver_zgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
 }
 /********************************************************/
 
-/******************** SYGS2/SYGST_HEGS2/HEGST ********************/
+/******************** GELSY ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
-                                            rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return SYGST
-            ? rocsolver_ssygst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
-            : rocsolver_ssygs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+        return rocsolver_sgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
     else
-        return SYGST ? rocsolver_ssygst(handle, itype, uplo, n, A, lda, B, ldb)
-                     : rocsolver_ssygs2(handle, itype, uplo, n, A, lda, B, ldb);
+        return rocsolver_sgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
-                                            rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return SYGST
-            ? rocsolver_dsygst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
-            : rocsolver_dsygs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+        return rocsolver_dgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
     else
-        return SYGST ? rocsolver_dsygst(handle, itype, uplo, n, A, lda, B, ldb)
-                     : rocsolver_dsygs2(handle, itype, uplo, n, A, lda, B, ldb);
+        return rocsolver_dgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
-                                            rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return SYGST
-            ? rocsolver_chegst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
-            : rocsolver_chegs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+        return rocsolver_cgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
     else
-        return SYGST ? rocsolver_chegst(handle, itype, uplo, n, A, lda, B, ldb)
-                     : rocsolver_chegs2(handle, itype, uplo, n, A, lda, B, ldb);
+        return rocsolver_cgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
-                                            rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return SYGST
-            ? rocsolver_zhegst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
-            : rocsolver_zhegs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+        return rocsolver_zgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
     else
-        return SYGST ? rocsolver_zhegst(handle, itype, uplo, n, A, lda, B, ldb)
-                     : rocsolver_zhegs2(handle, itype, uplo, n, A, lda, B, ldb);
+        return rocsolver_zgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
 }
 
 // batched
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
-                                            rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return SYGST ? rocsolver_ssygst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
-                 : rocsolver_ssygs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+    return rocsolver_sgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
-                                            rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return SYGST ? rocsolver_dsygst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
-                 : rocsolver_dsygs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+    return rocsolver_dgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
-                                            rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_float_complex* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return SYGST ? rocsolver_chegst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
-                 : rocsolver_chegs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+    return rocsolver_cgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 
-inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
-                                            bool SYGST,
-                                            rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return SYGST ? rocsolver_zhegst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
-                 : rocsolver_zhegs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+    return rocsolver_zgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 /********************************************************/
 
-/******************** SYEV/HEEV ********************/
+/******************** GELSS ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          float* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_gelss(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_ssyev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
-                                                     stE, info, bc)
-                   : rocsolver_ssyev(handle, evect, uplo, n, A, lda, D, E, info);
+    if(STRIDED)
+        return rocsolver_sgelss_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, S,
+                                                stS, rcond, rank, info, bc);
+    else
+        return rocsolver_sgelss(handle, m, n, nrhs, A, lda, B, ldb, S, rcond, rank, info);
 }
 
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          double* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_gelss(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dsyev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
-                                                     stE, info, bc)
-                   : rocsolver_dsyev(handle, evect, uplo, n, A, lda, D, E, info);
+    if(STRIDED)
+        return rocsolver_dgelss_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, S,
+                                                stS, rcond, rank, info, bc);
+    else
+        return rocsolver_dgelss(handle, m, n, nrhs, A, lda, B, ldb, S, rcond, rank, info);
 }
 
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_float_complex* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_gelss(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cheev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
-                                                     stE, info, bc)
-                   : rocsolver_cheev(handle, evect, uplo, n, A, lda, D, E, info);
+    if(STRIDED)
+        return rocsolver_cgelss_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, S,
+                                                stS, rcond, rank, info, bc);
+    else
+        return rocsolver_cgelss(handle, m, n, nrhs, A, lda, B, ldb, S, rcond, rank, info);
 }
 
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_double_complex* A,
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_gelss(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zheev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
-                                                     stE, info, bc)
-                   : rocsolver_zheev(handle, evect, uplo, n, A, lda, D, E, info);
+    if(STRIDED)
+        return rocsolver_zgelss_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, S,
+                                                stS, rcond, rank, info, bc);
+    else
+        return rocsolver_zgelss(handle, m, n, nrhs, A, lda, B, ldb, S, rcond, rank, info);
 }
 
 // batched
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          float* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_gelss(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_ssyev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+    return rocsolver_sgelss_batched(handle, m, n, nrhs, A, lda, B, ldb, S, stS, rcond, rank, info,
+                                    bc);
 }
 
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          double* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_gelss(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_dsyev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+    return rocsolver_dgelss_batched(handle, m, n, nrhs, A, lda, B, ldb, S, stS, rcond, rank, info,
+                                    bc);
 }
 
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_float_complex* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          float* D,
-                                          rocblas_stride stD,
-                                          float* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_gelss(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* S,
+                                      rocblas_stride stS,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_cheev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+    return rocsolver_cgelss_batched(handle, m, n, nrhs, A, lda, B, ldb, S, stS, rcond, rank, info,
+                                    bc);
 }
 
-inline rocblas_status rocsolver_syev_heev(bool STRIDED,
-                                          rocblas_handle handle,
-                                          rocblas_evect evect,
-                                          rocblas_fill uplo,
-                                          rocblas_int n,
-                                          rocblas_double_complex* const A[],
-                                          rocblas_int lda,
-                                          rocblas_stride stA,
-                                          double* D,
-                                          rocblas_stride stD,
-                                          double* E,
-                                          rocblas_stride stE,
-                                          rocblas_int* info,
-                                          rocblas_int bc)
+inline rocblas_status rocsolver_gelss(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* S,
+                                      rocblas_stride stS,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_zheev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+    return rocsolver_zgelss_batched(handle, m, n, nrhs, A, lda, B, ldb, S, stS, rcond, rank, info,
+                                    bc);
 }
 /********************************************************/
 
-/******************** SYEVD/HEEVD ********************/
+/******************** GGLSE ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gglse(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int p,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* C,
+                                      rocblas_stride stC,
+                                      float* D,
+                                      rocblas_stride stD,
+                                      float* X,
+                                      rocblas_stride stX,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_ssyevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
-                                                      E, stE, info, bc)
-                   : rocsolver_ssyevd(handle, evect, uplo, n, A, lda, D, E, info);
+    if(STRIDED)
+        return rocsolver_sgglse_strided_batched(handle, m, n, p, A, lda, stA, B, ldb, stB, C, stC,
+                                                D, stD, X, stX, info, bc);
+    else
+        return rocsolver_sgglse(handle, m, n, p, A, lda, B, ldb, C, D, X, info);
 }
 
-inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gglse(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int p,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* C,
+                                      rocblas_stride stC,
+                                      double* D,
+                                      rocblas_stride stD,
+                                      double* X,
+                                      rocblas_stride stX,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dsyevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
-                                                      E, stE, info, bc)
-                   : rocsolver_dsyevd(handle, evect, uplo, n, A, lda, D, E, info);
+    if(STRIDED)
+        return rocsolver_dgglse_strided_batched(handle, m, n, p, A, lda, stA, B, ldb, stB, C, stC,
+                                                D, stD, X, stX, info, bc);
+    else
+        return rocsolver_dgglse(handle, m, n, p, A, lda, B, ldb, C, D, X, info);
 }
 
-inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gglse(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int p,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_float_complex* C,
+                                      rocblas_stride stC,
+                                      rocblas_float_complex* D,
+                                      rocblas_stride stD,
+                                      rocblas_float_complex* X,
+                                      rocblas_stride stX,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_cheevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
-                                                      E, stE, info, bc)
-                   : rocsolver_cheevd(handle, evect, uplo, n, A, lda, D, E, info);
+    if(STRIDED)
+        return rocsolver_cgglse_strided_batched(handle, m, n, p, A, lda, stA, B, ldb, stB, C, stC,
+                                                D, stD, X, stX, info, bc);
+    else
+        return rocsolver_cgglse(handle, m, n, p, A, lda, B, ldb, C, D, X, info);
 }
 
-inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gglse(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int p,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_double_complex* C,
+                                      rocblas_stride stC,
+                                      rocblas_double_complex* D,
+                                      rocblas_stride stD,
+                                      rocblas_double_complex* X,
+                                      rocblas_stride stX,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zheevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
-                                                      E, stE, info, bc)
-                   : rocsolver_zheevd(handle, evect, uplo, n, A, lda, D, E, info);
+    if(STRIDED)
+        return rocsolver_zgglse_strided_batched(handle, m, n, p, A, lda, stA, B, ldb, stB, C, stC,
+                                                D, stD, X, stX, info, bc);
+    else
+        return rocsolver_zgglse(handle, m, n, p, A, lda, B, ldb, C, D, X, info);
 }
 
 // batched
-inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gglse(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int p,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* const C[],
+                                      rocblas_stride stC,
+                                      float* const D[],
+                                      rocblas_stride stD,
+                                      float* const X[],
+                                      rocblas_stride stX,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_ssyevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+    return rocsolver_sgglse_batched(handle, m, n, p, A, lda, B, ldb, C, D, X, info, bc);
 }
 
-inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gglse(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int p,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* const C[],
+                                      rocblas_stride stC,
+                                      double* const D[],
+                                      rocblas_stride stD,
+                                      double* const X[],
+                                      rocblas_stride stX,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_dsyevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+    return rocsolver_dgglse_batched(handle, m, n, p, A, lda, B, ldb, C, D, X, info, bc);
 }
 
-inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gglse(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int p,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_float_complex* const C[],
+                                      rocblas_stride stC,
+                                      rocblas_float_complex* const D[],
+                                      rocblas_stride stD,
+                                      rocblas_float_complex* const X[],
+                                      rocblas_stride stX,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_cheevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+    return rocsolver_cgglse_batched(handle, m, n, p, A, lda, B, ldb, C, D, X, info, bc);
 }
 
-inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_gglse(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int p,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_double_complex* const C[],
+                                      rocblas_stride stC,
+                                      rocblas_double_complex* const D[],
+                                      rocblas_stride stD,
+                                      rocblas_double_complex* const X[],
+                                      rocblas_stride stX,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_zheevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+    return rocsolver_zgglse_batched(handle, m, n, p, A, lda, B, ldb, C, D, X, info, bc);
 }
 /********************************************************/
 
-/******************** SYEVJ/HEEVJ ********************/
+/******************** GGGLM ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_esort esort,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float abstol,
-                                            float* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
-                                            float* W,
-                                            rocblas_stride stW,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggglm(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* D,
+                                      rocblas_stride stD,
+                                      float* X,
+                                      rocblas_stride stX,
+                                      float* Y,
+                                      rocblas_stride stY,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_ssyevj_strided_batched(handle, esort, evect, uplo, n, A, lda, stA, abstol,
-                                           residual, max_sweeps, n_sweeps, W, stW, info, bc)
-        : rocsolver_ssyevj(handle, esort, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
-                           n_sweeps, W, info);
+    if(STRIDED)
+        return rocsolver_sggglm_strided_batched(handle, n, m, p, A, lda, stA, B, ldb, stB, D, stD,
+                                                X, stX, Y, stY, info, bc);
+    else
+        return rocsolver_sggglm(handle, n, m, p, A, lda, B, ldb, D, X, Y, info);
 }
 
-inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_esort esort,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double abstol,
-                                            double* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
-                                            double* W,
-                                            rocblas_stride stW,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggglm(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* D,
+                                      rocblas_stride stD,
+                                      double* X,
+                                      rocblas_stride stX,
+                                      double* Y,
+                                      rocblas_stride stY,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_dsyevj_strided_batched(handle, esort, evect, uplo, n, A, lda, stA, abstol,
-                                           residual, max_sweeps, n_sweeps, W, stW, info, bc)
-        : rocsolver_dsyevj(handle, esort, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
-                           n_sweeps, W, info);
+    if(STRIDED)
+        return rocsolver_dggglm_strided_batched(handle, n, m, p, A, lda, stA, B, ldb, stB, D, stD,
+                                                X, stX, Y, stY, info, bc);
+    else
+        return rocsolver_dggglm(handle, n, m, p, A, lda, B, ldb, D, X, Y, info);
 }
 
-inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_esort esort,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float abstol,
-                                            float* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
-                                            float* W,
-                                            rocblas_stride stW,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggglm(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_float_complex* D,
+                                      rocblas_stride stD,
+                                      rocblas_float_complex* X,
+                                      rocblas_stride stX,
+                                      rocblas_float_complex* Y,
+                                      rocblas_stride stY,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_cheevj_strided_batched(handle, esort, evect, uplo, n, A, lda, stA, abstol,
-                                           residual, max_sweeps, n_sweeps, W, stW, info, bc)
-        : rocsolver_cheevj(handle, esort, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
-                           n_sweeps, W, info);
+    if(STRIDED)
+        return rocsolver_cggglm_strided_batched(handle, n, m, p, A, lda, stA, B, ldb, stB, D, stD,
+                                                X, stX, Y, stY, info, bc);
+    else
+        return rocsolver_cggglm(handle, n, m, p, A, lda, B, ldb, D, X, Y, info);
 }
 
-inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_esort esort,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double abstol,
-                                            double* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
-                                            double* W,
-                                            rocblas_stride stW,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggglm(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_double_complex* D,
+                                      rocblas_stride stD,
+                                      rocblas_double_complex* X,
+                                      rocblas_stride stX,
+                                      rocblas_double_complex* Y,
+                                      rocblas_stride stY,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocsolver_zheevj_strided_batched(handle, esort, evect, uplo, n, A, lda, stA, abstol,
-                                           residual, max_sweeps, n_sweeps, W, stW, info, bc)
-        : rocsolver_zheevj(handle, esort, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
-                           n_sweeps, W, info);
+    if(STRIDED)
+        return rocsolver_zggglm_strided_batched(handle, n, m, p, A, lda, stA, B, ldb, stB, D, stD,
+                                                X, stX, Y, stY, info, bc);
+    else
+        return rocsolver_zggglm(handle, n, m, p, A, lda, B, ldb, D, X, Y, info);
 }
 
 // batched
-inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_esort esort,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float abstol,
-                                            float* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
-                                            float* W,
-                                            rocblas_stride stW,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggglm(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      float* const D[],
+                                      rocblas_stride stD,
+                                      float* const X[],
+                                      rocblas_stride stX,
+                                      float* const Y[],
+                                      rocblas_stride stY,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_ssyevj_batched(handle, esort, evect, uplo, n, A, lda, abstol, residual,
-                                    max_sweeps, n_sweeps, W, stW, info, bc);
+    return rocsolver_sggglm_batched(handle, n, m, p, A, lda, B, ldb, D, X, Y, info, bc);
 }
 
-inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_esort esort,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double abstol,
-                                            double* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
-                                            double* W,
-                                            rocblas_stride stW,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggglm(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      double* const D[],
+                                      rocblas_stride stD,
+                                      double* const X[],
+                                      rocblas_stride stX,
+                                      double* const Y[],
+                                      rocblas_stride stY,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_dsyevj_batched(handle, esort, evect, uplo, n, A, lda, abstol, residual,
-                                    max_sweeps, n_sweeps, W, stW, info, bc);
+    return rocsolver_dggglm_batched(handle, n, m, p, A, lda, B, ldb, D, X, Y, info, bc);
 }
 
-inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_esort esort,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float abstol,
-                                            float* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
-                                            float* W,
-                                            rocblas_stride stW,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_ggglm(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_float_complex* const D[],
+                                      rocblas_stride stD,
+                                      rocblas_float_complex* const X[],
+                                      rocblas_stride stX,
+                                      rocblas_float_complex* const Y[],
+                                      rocblas_stride stY,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return rocsolver_cheevj_batched(handle, esort, evect, uplo, n, A, lda, abstol, residual,
-                                    max_sweeps, n_sweeps, W, stW, info, bc);
+    return rocsolver_cggglm_batched(handle, n, m, p, A, lda, B, ldb, D, X, Y, info, bc);
 }
 
-inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_esort esort,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            double abstol,
-                                            double* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
-                                            double* W,
-                                            rocblas_stride stW,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
-{
-    return rocsolver_zheevj_batched(handle, esort, evect, uplo, n, A, lda, abstol, residual,
+inline rocblas_status rocsolver_ggglm(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int m,
+                                      rocblas_int p,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_double_complex* const D[],
+                                      rocblas_stride stD,
+                                      rocblas_double_complex* const X[],
+                                      rocblas_stride stX,
+                                      rocblas_double_complex* const Y[],
+                                      rocblas_stride stY,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_zggglm_batched(handle, n, m, p, A, lda, B, ldb, D, X, Y, info, bc);
+}
+/********************************************************/
+
+/******************** GELS_OUTOFPLACE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                float* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                float* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    if(STRIDED)
+        return rocblas_status_not_implemented; // rocsolver_sgels_outofplace_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB, X, ldx, stX, info, bc);
+    else
+        return rocsolver_sgels_outofplace(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info);
+}
+
+inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                double* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                double* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    if(STRIDED)
+        return rocblas_status_not_implemented; // rocsolver_dgels_outofplace_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB, X, ldx, stX, info, bc);
+    else
+        return rocsolver_dgels_outofplace(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info);
+}
+
+inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                rocblas_float_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_float_complex* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_float_complex* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    if(STRIDED)
+        return rocblas_status_not_implemented; // rocsolver_cgels_outofplace_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB, X, ldx, stX, info, bc);
+    else
+        return rocsolver_cgels_outofplace(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info);
+}
+
+inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                rocblas_double_complex* A,
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_double_complex* B,
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_double_complex* X,
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    if(STRIDED)
+        return rocblas_status_not_implemented; // rocsolver_zgels_outofplace_strided_batched(handle, trans, m, n, nrhs, A, lda, stA, B, ldb, stB, X, ldx, stX, info, bc);
+    else
+        return rocsolver_zgels_outofplace(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                float* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                float* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                float* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_sgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                double* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                double* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                double* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_dgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                rocblas_float_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_float_complex* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_float_complex* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_cgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+}
+
+inline rocblas_status rocsolver_gels_outofplace(bool STRIDED,
+                                                rocblas_handle handle,
+                                                rocblas_operation trans,
+                                                rocblas_int m,
+                                                rocblas_int n,
+                                                rocblas_int nrhs,
+                                                rocblas_double_complex* const A[],
+                                                rocblas_int lda,
+                                                rocblas_stride stA,
+                                                rocblas_double_complex* const B[],
+                                                rocblas_int ldb,
+                                                rocblas_stride stB,
+                                                rocblas_double_complex* const X[],
+                                                rocblas_int ldx,
+                                                rocblas_stride stX,
+                                                rocblas_int* info,
+                                                rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_zgels_outofplace_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, X, ldx, info, bc);
+}
+/********************************************************/
+
+/******************** GEBD2_GEBRD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tauq,
+                                            rocblas_stride stQ,
+                                            float* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEBRD ? rocsolver_sgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_sgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
+    else
+        return GEBRD ? rocsolver_sgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_sgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tauq,
+                                            rocblas_stride stQ,
+                                            double* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEBRD ? rocsolver_dgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_dgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
+    else
+        return GEBRD ? rocsolver_dgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_dgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_float_complex* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEBRD ? rocsolver_cgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_cgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
+    else
+        return GEBRD ? rocsolver_cgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_cgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_double_complex* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEBRD ? rocsolver_zgebrd_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc)
+                     : rocsolver_zgebd2_strided_batched(handle, m, n, A, lda, stA, D, stD, E, stE,
+                                                        tauq, stQ, taup, stP, bc);
+    else
+        return GEBRD ? rocsolver_zgebrd(handle, m, n, A, lda, D, E, tauq, taup)
+                     : rocsolver_zgebd2(handle, m, n, A, lda, D, E, tauq, taup);
+}
+
+// batched
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tauq,
+                                            rocblas_stride stQ,
+                                            float* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEBRD
+        ? rocsolver_sgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_sgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tauq,
+                                            rocblas_stride stQ,
+                                            double* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEBRD
+        ? rocsolver_dgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_dgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_float_complex* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEBRD
+        ? rocsolver_cgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_cgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+}
+
+inline rocblas_status rocsolver_gebd2_gebrd(bool STRIDED,
+                                            bool GEBRD,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tauq,
+                                            rocblas_stride stQ,
+                                            rocblas_double_complex* taup,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEBRD
+        ? rocsolver_zgebrd_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc)
+        : rocsolver_zgebd2_batched(handle, m, n, A, lda, D, stD, E, stE, tauq, stQ, taup, stP, bc);
+}
+/********************************************************/
+
+/******************** SYTD2/SYTRD_HETD2/HETRD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYTRD ? rocsolver_ssytrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc)
+                     : rocsolver_ssytd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc);
+    else
+        return SYTRD ? rocsolver_ssytrd(handle, uplo, n, A, lda, D, E, tau)
+                     : rocsolver_ssytd2(handle, uplo, n, A, lda, D, E, tau);
+}
+
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYTRD ? rocsolver_dsytrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc)
+                     : rocsolver_dsytd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc);
+    else
+        return SYTRD ? rocsolver_dsytrd(handle, uplo, n, A, lda, D, E, tau)
+                     : rocsolver_dsytd2(handle, uplo, n, A, lda, D, E, tau);
+}
+
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYTRD ? rocsolver_chetrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc)
+                     : rocsolver_chetd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc);
+    else
+        return SYTRD ? rocsolver_chetrd(handle, uplo, n, A, lda, D, E, tau)
+                     : rocsolver_chetd2(handle, uplo, n, A, lda, D, E, tau);
+}
+
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYTRD ? rocsolver_zhetrd_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc)
+                     : rocsolver_zhetd2_strided_batched(handle, uplo, n, A, lda, stA, D, stD, E,
+                                                        stE, tau, stP, bc);
+    else
+        return SYTRD ? rocsolver_zhetrd(handle, uplo, n, A, lda, D, E, tau)
+                     : rocsolver_zhetd2(handle, uplo, n, A, lda, D, E, tau);
+}
+
+// batched
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            float* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return SYTRD ? rocsolver_ssytrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
+                 : rocsolver_ssytd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+}
+
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            double* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return SYTRD ? rocsolver_dsytrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
+                 : rocsolver_dsytd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+}
+
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_float_complex* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return SYTRD ? rocsolver_chetrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
+                 : rocsolver_chetd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+}
+
+inline rocblas_status rocsolver_sytxx_hetxx(bool STRIDED,
+                                            bool SYTRD,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_double_complex* tau,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return SYTRD ? rocsolver_zhetrd_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc)
+                 : rocsolver_zhetd2_batched(handle, uplo, n, A, lda, D, stD, E, stE, tau, stP, bc);
+}
+/********************************************************/
+
+/******************** SYGS2/SYGST_HEGS2/HEGST ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYGST
+            ? rocsolver_ssygst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
+            : rocsolver_ssygs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+    else
+        return SYGST ? rocsolver_ssygst(handle, itype, uplo, n, A, lda, B, ldb)
+                     : rocsolver_ssygs2(handle, itype, uplo, n, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYGST
+            ? rocsolver_dsygst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
+            : rocsolver_dsygs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+    else
+        return SYGST ? rocsolver_dsygst(handle, itype, uplo, n, A, lda, B, ldb)
+                     : rocsolver_dsygs2(handle, itype, uplo, n, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYGST
+            ? rocsolver_chegst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
+            : rocsolver_chegs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+    else
+        return SYGST ? rocsolver_chegst(handle, itype, uplo, n, A, lda, B, ldb)
+                     : rocsolver_chegs2(handle, itype, uplo, n, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return SYGST
+            ? rocsolver_zhegst_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc)
+            : rocsolver_zhegs2_strided_batched(handle, itype, uplo, n, A, lda, stA, B, ldb, stB, bc);
+    else
+        return SYGST ? rocsolver_zhegst(handle, itype, uplo, n, A, lda, B, ldb)
+                     : rocsolver_zhegs2(handle, itype, uplo, n, A, lda, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    return SYGST ? rocsolver_ssygst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
+                 : rocsolver_ssygs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    return SYGST ? rocsolver_dsygst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
+                 : rocsolver_dsygs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    return SYGST ? rocsolver_chegst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
+                 : rocsolver_chegs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sygsx_hegsx(bool STRIDED,
+                                            bool SYGST,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            rocblas_int bc)
+{
+    return SYGST ? rocsolver_zhegst_batched(handle, itype, uplo, n, A, lda, B, ldb, bc)
+                 : rocsolver_zhegs2_batched(handle, itype, uplo, n, A, lda, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** SYEV/HEEV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          float* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ssyev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
+                                                     stE, info, bc)
+                   : rocsolver_ssyev(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          double* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dsyev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
+                                                     stE, info, bc)
+                   : rocsolver_dsyev(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_float_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cheev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
+                                                     stE, info, bc)
+                   : rocsolver_cheev(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_double_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zheev_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD, E,
+                                                     stE, info, bc)
+                   : rocsolver_zheev(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+// batched
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          float* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_ssyev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          double* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_dsyev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_float_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* D,
+                                          rocblas_stride stD,
+                                          float* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_cheev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_syev_heev(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_evect evect,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_double_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* D,
+                                          rocblas_stride stD,
+                                          double* E,
+                                          rocblas_stride stE,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_zheev_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+/********************************************************/
+
+/******************** SYEVD/HEEVD ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_ssyevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
+                                                      E, stE, info, bc)
+                   : rocsolver_ssyevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dsyevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
+                                                      E, stE, info, bc)
+                   : rocsolver_dsyevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cheevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
+                                                      E, stE, info, bc)
+                   : rocsolver_cheevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zheevd_strided_batched(handle, evect, uplo, n, A, lda, stA, D, stD,
+                                                      E, stE, info, bc)
+                   : rocsolver_zheevd(handle, evect, uplo, n, A, lda, D, E, info);
+}
+
+// batched
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_ssyevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_dsyevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_cheevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_syevd_heevd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_zheevd_batched(handle, evect, uplo, n, A, lda, D, stD, E, stE, info, bc);
+}
+/********************************************************/
+
+/******************** SYEVJ/HEEVJ ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_esort esort,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_ssyevj_strided_batched(handle, esort, evect, uplo, n, A, lda, stA, abstol,
+                                           residual, max_sweeps, n_sweeps, W, stW, info, bc)
+        : rocsolver_ssyevj(handle, esort, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                           n_sweeps, W, info);
+}
+
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_esort esort,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_dsyevj_strided_batched(handle, esort, evect, uplo, n, A, lda, stA, abstol,
+                                           residual, max_sweeps, n_sweeps, W, stW, info, bc)
+        : rocsolver_dsyevj(handle, esort, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                           n_sweeps, W, info);
+}
+
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_esort esort,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_cheevj_strided_batched(handle, esort, evect, uplo, n, A, lda, stA, abstol,
+                                           residual, max_sweeps, n_sweeps, W, stW, info, bc)
+        : rocsolver_cheevj(handle, esort, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                           n_sweeps, W, info);
+}
+
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_esort esort,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return STRIDED
+        ? rocsolver_zheevj_strided_batched(handle, esort, evect, uplo, n, A, lda, stA, abstol,
+                                           residual, max_sweeps, n_sweeps, W, stW, info, bc)
+        : rocsolver_zheevj(handle, esort, evect, uplo, n, A, lda, abstol, residual, max_sweeps,
+                           n_sweeps, W, info);
+}
+
+// batched
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_esort esort,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_ssyevj_batched(handle, esort, evect, uplo, n, A, lda, abstol, residual,
+                                    max_sweeps, n_sweeps, W, stW, info, bc);
+}
+
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_esort esort,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_dsyevj_batched(handle, esort, evect, uplo, n, A, lda, abstol, residual,
+                                    max_sweeps, n_sweeps, W, stW, info, bc);
+}
+
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_esort esort,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_cheevj_batched(handle, esort, evect, uplo, n, A, lda, abstol, residual,
+                                    max_sweeps, n_sweeps, W, stW, info, bc);
+}
+
+inline rocblas_status rocsolver_syevj_heevj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_esort esort,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_zheevj_batched(handle, esort, evect, uplo, n, A, lda, abstol, residual,
                                     max_sweeps, n_sweeps, W, stW, info, bc);
 }
 /********************************************************/
@@ -7663,13 +10331,221 @@ inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return rocsolver_dsygvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                                stB, D, stD, E, stE, info, bc);
+        return rocsolver_dsygvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                                stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_dsygvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_chegvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                                stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_chegvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zhegvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                                stB, D, stD, E, stE, info, bc);
+    else
+        return rocsolver_zhegvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+}
+
+// batched
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_ssygvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                    info, bc);
+}
+
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_dsygvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                    info, bc);
+}
+
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float* D,
+                                            rocblas_stride stD,
+                                            float* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_chegvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                    info, bc);
+}
+
+inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double* D,
+                                            rocblas_stride stD,
+                                            double* E,
+                                            rocblas_stride stE,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_zhegvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
+                                    info, bc);
+}
+/********************************************************/
+
+/******************** SYGVJ_HEGVJ ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_ssygvj_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                                stB, abstol, residual, max_sweeps, n_sweeps, W, stW,
+                                                info, bc);
+    else
+        return rocsolver_ssygvj(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
+                                max_sweeps, n_sweeps, W, info);
+}
+
+inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            double* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            double* B,
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dsygvj_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                                stB, abstol, residual, max_sweeps, n_sweeps, W, stW,
+                                                info, bc);
     else
-        return rocsolver_dsygvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+        return rocsolver_dsygvj(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
+                                max_sweeps, n_sweeps, W, info);
 }
 
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
                                             rocblas_evect evect,
@@ -7681,21 +10557,25 @@ inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_float_complex* B,
                                             rocblas_int ldb,
                                             rocblas_stride stB,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return rocsolver_chegvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                                stB, D, stD, E, stE, info, bc);
+        return rocsolver_chegvj_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                                stB, abstol, residual, max_sweeps, n_sweeps, W, stW,
+                                                info, bc);
     else
-        return rocsolver_chegvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+        return rocsolver_chegvj(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
+                                max_sweeps, n_sweeps, W, info);
 }
 
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
                                             rocblas_evect evect,
@@ -7707,22 +10587,26 @@ inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_double_complex* B,
                                             rocblas_int ldb,
                                             rocblas_stride stB,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return rocsolver_zhegvd_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                                stB, D, stD, E, stE, info, bc);
+        return rocsolver_zhegvj_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
+                                                stB, abstol, residual, max_sweeps, n_sweeps, W, stW,
+                                                info, bc);
     else
-        return rocsolver_zhegvd(handle, itype, evect, uplo, n, A, lda, B, ldb, D, E, info);
+        return rocsolver_zhegvj(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
+                                max_sweeps, n_sweeps, W, info);
 }
 
 // batched
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
                                             rocblas_evect evect,
@@ -7734,18 +10618,20 @@ inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             float* const B[],
                                             rocblas_int ldb,
                                             rocblas_stride stB,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_ssygvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
-                                    info, bc);
+    return rocsolver_ssygvj_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
+                                    max_sweeps, n_sweeps, W, stW, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
                                             rocblas_evect evect,
@@ -7757,18 +10643,20 @@ inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             double* const B[],
                                             rocblas_int ldb,
                                             rocblas_stride stB,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_dsygvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
-                                    info, bc);
+    return rocsolver_dsygvj_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
+                                    max_sweeps, n_sweeps, W, stW, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
                                             rocblas_evect evect,
@@ -7780,18 +10668,20 @@ inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_float_complex* const B[],
                                             rocblas_int ldb,
                                             rocblas_stride stB,
-                                            float* D,
-                                            rocblas_stride stD,
-                                            float* E,
-                                            rocblas_stride stE,
+                                            float abstol,
+                                            float* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            float* W,
+                                            rocblas_stride stW,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_chegvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
-                                    info, bc);
+    return rocsolver_chegvj_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
+                                    max_sweeps, n_sweeps, W, stW, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
+inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
                                             rocblas_evect evect,
@@ -7803,24 +10693,27 @@ inline rocblas_status rocsolver_sygvd_hegvd(bool STRIDED,
                                             rocblas_double_complex* const B[],
                                             rocblas_int ldb,
                                             rocblas_stride stB,
-                                            double* D,
-                                            rocblas_stride stD,
-                                            double* E,
-                                            rocblas_stride stE,
+                                            double abstol,
+                                            double* residual,
+                                            rocblas_int max_sweeps,
+                                            rocblas_int* n_sweeps,
+                                            double* W,
+                                            rocblas_stride stW,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_zhegvd_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, D, stD, E, stE,
-                                    info, bc);
+    return rocsolver_zhegvj_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
+                                    max_sweeps, n_sweeps, W, stW, info, bc);
 }
 /********************************************************/
 
-/******************** SYGVJ_HEGVJ ********************/
+/******************** SYGVX/HEGVX ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
                                             rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             float* A,
@@ -7829,28 +10722,34 @@ inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
                                             float* B,
                                             rocblas_int ldb,
                                             rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
                                             float abstol,
-                                            float* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
+                                            rocblas_int* nev,
                                             float* W,
                                             rocblas_stride stW,
+                                            float* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_ssygvj_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                                stB, abstol, residual, max_sweeps, n_sweeps, W, stW,
-                                                info, bc);
-    else
-        return rocsolver_ssygvj(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
-                                max_sweeps, n_sweeps, W, info);
+    return STRIDED ? rocsolver_ssygvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
+                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
+                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
+                   : rocsolver_ssygvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
 }
 
-inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
                                             rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             double* A,
@@ -7859,28 +10758,34 @@ inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
                                             double* B,
                                             rocblas_int ldb,
                                             rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
                                             double abstol,
-                                            double* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
+                                            rocblas_int* nev,
                                             double* W,
                                             rocblas_stride stW,
+                                            double* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_dsygvj_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                                stB, abstol, residual, max_sweeps, n_sweeps, W, stW,
-                                                info, bc);
-    else
-        return rocsolver_dsygvj(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
-                                max_sweeps, n_sweeps, W, info);
+    return STRIDED ? rocsolver_dsygvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
+                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
+                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
+                   : rocsolver_dsygvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
 }
 
-inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
                                             rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
@@ -7889,28 +10794,34 @@ inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
                                             rocblas_float_complex* B,
                                             rocblas_int ldb,
                                             rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
                                             float abstol,
-                                            float* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
+                                            rocblas_int* nev,
                                             float* W,
                                             rocblas_stride stW,
+                                            rocblas_float_complex* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_chegvj_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                                stB, abstol, residual, max_sweeps, n_sweeps, W, stW,
-                                                info, bc);
-    else
-        return rocsolver_chegvj(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
-                                max_sweeps, n_sweeps, W, info);
+    return STRIDED ? rocsolver_chegvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
+                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
+                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
+                   : rocsolver_chegvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
 }
 
-inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
                                             rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
@@ -7919,795 +10830,1024 @@ inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
                                             rocblas_double_complex* B,
                                             rocblas_int ldb,
                                             rocblas_stride stB,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
                                             double abstol,
-                                            double* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
+                                            rocblas_int* nev,
                                             double* W,
                                             rocblas_stride stW,
+                                            rocblas_double_complex* Z,
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    if(STRIDED)
-        return rocsolver_zhegvj_strided_batched(handle, itype, evect, uplo, n, A, lda, stA, B, ldb,
-                                                stB, abstol, residual, max_sweeps, n_sweeps, W, stW,
-                                                info, bc);
-    else
-        return rocsolver_zhegvj(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
-                                max_sweeps, n_sweeps, W, info);
+    return STRIDED ? rocsolver_zhegvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
+                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
+                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
+                   : rocsolver_zhegvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+}
+
+// batched
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+                                            rocblas_handle handle,
+                                            rocblas_eform itype,
+                                            rocblas_evect evect,
+                                            rocblas_erange erange,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            float* const B[],
+                                            rocblas_int ldb,
+                                            rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            float abstol,
+                                            rocblas_int* nev,
+                                            float* W,
+                                            rocblas_stride stW,
+                                            float* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
+                                            rocblas_int* info,
+                                            rocblas_int bc)
+{
+    return rocsolver_ssygvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-// batched
-inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
                                             rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
-                                            float* const A[],
+                                            double* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* const B[],
+                                            double* const B[],
                                             rocblas_int ldb,
                                             rocblas_stride stB,
-                                            float abstol,
-                                            float* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
-                                            float* W,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
                                             rocblas_stride stW,
+                                            double* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_ssygvj_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
-                                    max_sweeps, n_sweeps, W, stW, info, bc);
+    return rocsolver_dsygvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
                                             rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
-                                            double* const A[],
+                                            rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* const B[],
+                                            rocblas_float_complex* const B[],
                                             rocblas_int ldb,
                                             rocblas_stride stB,
+                                            float vl,
+                                            float vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
                                             double abstol,
-                                            double* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
-                                            double* W,
+                                            rocblas_int* nev,
+                                            float* W,
                                             rocblas_stride stW,
+                                            rocblas_float_complex* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_dsygvj_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
-                                    max_sweeps, n_sweeps, W, stW, info, bc);
+    return rocsolver_chegvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
+inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
                                             rocblas_handle handle,
                                             rocblas_eform itype,
                                             rocblas_evect evect,
+                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
-                                            rocblas_float_complex* const A[],
+                                            rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* const B[],
+                                            rocblas_double_complex* const B[],
                                             rocblas_int ldb,
                                             rocblas_stride stB,
-                                            float abstol,
-                                            float* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
-                                            float* W,
+                                            double vl,
+                                            double vu,
+                                            rocblas_int il,
+                                            rocblas_int iu,
+                                            double abstol,
+                                            rocblas_int* nev,
+                                            double* W,
                                             rocblas_stride stW,
+                                            rocblas_double_complex* const Z[],
+                                            rocblas_int ldz,
+                                            rocblas_stride stZ,
+                                            rocblas_int* ifail,
+                                            rocblas_stride stF,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_chegvj_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
-                                    max_sweeps, n_sweeps, W, stW, info, bc);
+    return rocsolver_zhegvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
+}
+/********************************************************/
+
+/******************** SYGVX/HEGVX_INPLACE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_eform itype,
+                                                      rocblas_evect evect,
+                                                      rocblas_erange erange,
+                                                      rocblas_fill uplo,
+                                                      rocblas_int n,
+                                                      float* A,
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      float* B,
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      float vl,
+                                                      float vu,
+                                                      rocblas_int il,
+                                                      rocblas_int iu,
+                                                      float abstol,
+                                                      rocblas_int* nev,
+                                                      float* W,
+                                                      rocblas_stride stW,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocblas_status_not_implemented // rocsolver_ssygvdx_inplace_strided_batched(handle, itype, evect, erange, uplo, n, A, lda, stA, B, ldb, stB, vl, vu, il, iu, abstol, nev, W, stW, info, bc)
+        : rocsolver_ssygvdx_inplace(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, info);
+}
+
+inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_eform itype,
+                                                      rocblas_evect evect,
+                                                      rocblas_erange erange,
+                                                      rocblas_fill uplo,
+                                                      rocblas_int n,
+                                                      double* A,
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      double* B,
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      double vl,
+                                                      double vu,
+                                                      rocblas_int il,
+                                                      rocblas_int iu,
+                                                      double abstol,
+                                                      rocblas_int* nev,
+                                                      double* W,
+                                                      rocblas_stride stW,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocblas_status_not_implemented // rocsolver_dsygvdx_inplace_strided_batched(handle, itype, evect, erange, uplo, n, A, lda, stA, B, ldb, stB, vl, vu, il, iu, abstol, nev, W, stW, info, bc)
+        : rocsolver_dsygvdx_inplace(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, info);
+}
+
+inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_eform itype,
+                                                      rocblas_evect evect,
+                                                      rocblas_erange erange,
+                                                      rocblas_fill uplo,
+                                                      rocblas_int n,
+                                                      rocblas_float_complex* A,
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      rocblas_float_complex* B,
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      float vl,
+                                                      float vu,
+                                                      rocblas_int il,
+                                                      rocblas_int iu,
+                                                      float abstol,
+                                                      rocblas_int* nev,
+                                                      float* W,
+                                                      rocblas_stride stW,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocblas_status_not_implemented // rocsolver_chegvdx_inplace_strided_batched(handle, itype, evect, erange, uplo, n, A, lda, stA, B, ldb, stB, vl, vu, il, iu, abstol, nev, W, stW, info, bc)
+        : rocsolver_chegvdx_inplace(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, info);
+}
+
+inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_eform itype,
+                                                      rocblas_evect evect,
+                                                      rocblas_erange erange,
+                                                      rocblas_fill uplo,
+                                                      rocblas_int n,
+                                                      rocblas_double_complex* A,
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      rocblas_double_complex* B,
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      double vl,
+                                                      double vu,
+                                                      rocblas_int il,
+                                                      rocblas_int iu,
+                                                      double abstol,
+                                                      rocblas_int* nev,
+                                                      double* W,
+                                                      rocblas_stride stW,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return STRIDED
+        ? rocblas_status_not_implemented // rocsolver_zhegvdx_inplace_strided_batched(handle, itype, evect, erange, uplo, n, A, lda, stA, B, ldb, stB, vl, vu, il, iu, abstol, nev, W, stW, info, bc)
+        : rocsolver_zhegvdx_inplace(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
+                                    il, iu, abstol, nev, W, info);
+}
+
+// batched
+inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_eform itype,
+                                                      rocblas_evect evect,
+                                                      rocblas_erange erange,
+                                                      rocblas_fill uplo,
+                                                      rocblas_int n,
+                                                      float* const A[],
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      float* const B[],
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      float vl,
+                                                      float vu,
+                                                      rocblas_int il,
+                                                      rocblas_int iu,
+                                                      float abstol,
+                                                      rocblas_int* nev,
+                                                      float* W,
+                                                      rocblas_stride stW,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_ssygvdx_inplace_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, nev, W, stW, info, bc);
+}
+
+inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_eform itype,
+                                                      rocblas_evect evect,
+                                                      rocblas_erange erange,
+                                                      rocblas_fill uplo,
+                                                      rocblas_int n,
+                                                      double* const A[],
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      double* const B[],
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      double vl,
+                                                      double vu,
+                                                      rocblas_int il,
+                                                      rocblas_int iu,
+                                                      double abstol,
+                                                      rocblas_int* nev,
+                                                      double* W,
+                                                      rocblas_stride stW,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_dsygvdx_inplace_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, nev, W, stW, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvj_hegvj(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_evect evect,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            double abstol,
-                                            double* residual,
-                                            rocblas_int max_sweeps,
-                                            rocblas_int* n_sweeps,
-                                            double* W,
-                                            rocblas_stride stW,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_eform itype,
+                                                      rocblas_evect evect,
+                                                      rocblas_erange erange,
+                                                      rocblas_fill uplo,
+                                                      rocblas_int n,
+                                                      rocblas_float_complex* const A[],
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      rocblas_float_complex* const B[],
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      float vl,
+                                                      float vu,
+                                                      rocblas_int il,
+                                                      rocblas_int iu,
+                                                      double abstol,
+                                                      rocblas_int* nev,
+                                                      float* W,
+                                                      rocblas_stride stW,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
 {
-    return rocsolver_zhegvj_batched(handle, itype, evect, uplo, n, A, lda, B, ldb, abstol, residual,
-                                    max_sweeps, n_sweeps, W, stW, info, bc);
+    return rocblas_status_not_implemented; // rocsolver_chegvdx_inplace_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, nev, W, stW, info, bc);
+}
+
+inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
+                                                      rocblas_handle handle,
+                                                      rocblas_eform itype,
+                                                      rocblas_evect evect,
+                                                      rocblas_erange erange,
+                                                      rocblas_fill uplo,
+                                                      rocblas_int n,
+                                                      rocblas_double_complex* const A[],
+                                                      rocblas_int lda,
+                                                      rocblas_stride stA,
+                                                      rocblas_double_complex* const B[],
+                                                      rocblas_int ldb,
+                                                      rocblas_stride stB,
+                                                      double vl,
+                                                      double vu,
+                                                      rocblas_int il,
+                                                      rocblas_int iu,
+                                                      double abstol,
+                                                      rocblas_int* nev,
+                                                      double* W,
+                                                      rocblas_stride stW,
+                                                      rocblas_int* info,
+                                                      rocblas_int bc)
+{
+    return rocblas_status_not_implemented; // rocsolver_zhegvdx_inplace_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, nev, W, stW, info, bc);
 }
 /********************************************************/
 
-/******************** SYGVX/HEGVX ********************/
+/******************** SYTF2_SYTRF ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             float* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            float* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            float vl,
-                                            float vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            float abstol,
-                                            rocblas_int* nev,
-                                            float* W,
-                                            rocblas_stride stW,
-                                            float* Z,
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return STRIDED ? rocsolver_ssygvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
-                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
-                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
-                   : rocsolver_ssygvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+    if(STRIDED)
+        return SYTRF
+            ? rocsolver_ssytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_ssytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return SYTRF ? rocsolver_ssytrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_ssytf2(handle, uplo, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             double* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            double vl,
-                                            double vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            double abstol,
-                                            rocblas_int* nev,
-                                            double* W,
-                                            rocblas_stride stW,
-                                            double* Z,
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dsygvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
-                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
-                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
-                   : rocsolver_dsygvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+    if(STRIDED)
+        return SYTRF
+            ? rocsolver_dsytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_dsytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return SYTRF ? rocsolver_dsytrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_dsytf2(handle, uplo, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            float vl,
-                                            float vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            float abstol,
-                                            rocblas_int* nev,
-                                            float* W,
-                                            rocblas_stride stW,
-                                            rocblas_float_complex* Z,
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return STRIDED ? rocsolver_chegvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
-                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
-                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
-                   : rocsolver_chegvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+    if(STRIDED)
+        return SYTRF
+            ? rocsolver_csytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_csytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return SYTRF ? rocsolver_csytrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_csytf2(handle, uplo, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* A,
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* B,
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            double vl,
-                                            double vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            double abstol,
-                                            rocblas_int* nev,
-                                            double* W,
-                                            rocblas_stride stW,
-                                            rocblas_double_complex* Z,
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return STRIDED ? rocsolver_zhegvx_strided_batched(handle, itype, evect, erange, uplo, n, A, lda,
-                                                      stA, B, ldb, stB, vl, vu, il, iu, abstol, nev,
-                                                      W, stW, Z, ldz, stZ, ifail, stF, info, bc)
-                   : rocsolver_zhegvx(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                      il, iu, abstol, nev, W, Z, ldz, ifail, info);
+    if(STRIDED)
+        return SYTRF
+            ? rocsolver_zsytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
+            : rocsolver_zsytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+    else
+        return SYTRF ? rocsolver_zsytrf(handle, uplo, n, A, lda, ipiv, info)
+                     : rocsolver_zsytf2(handle, uplo, n, A, lda, ipiv, info);
 }
 
-// batched
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
-                                            rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            float* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            float vl,
-                                            float vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            float abstol,
-                                            rocblas_int* nev,
-                                            float* W,
-                                            rocblas_stride stW,
-                                            float* const Z[],
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
+// batched
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            rocblas_int n,
+                                            float* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_ssygvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
+    return SYTRF ? rocsolver_ssytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_ssytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             double* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            double* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            double vl,
-                                            double vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            double abstol,
-                                            rocblas_int* nev,
-                                            double* W,
-                                            rocblas_stride stW,
-                                            double* const Z[],
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_dsygvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
+    return SYTRF ? rocsolver_dsytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_dsytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_float_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_float_complex* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            float vl,
-                                            float vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            double abstol,
-                                            rocblas_int* nev,
-                                            float* W,
-                                            rocblas_stride stW,
-                                            rocblas_float_complex* const Z[],
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_chegvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
+    return SYTRF ? rocsolver_csytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_csytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvx_hegvx(bool STRIDED,
+inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
+                                            bool SYTRF,
                                             rocblas_handle handle,
-                                            rocblas_eform itype,
-                                            rocblas_evect evect,
-                                            rocblas_erange erange,
                                             rocblas_fill uplo,
                                             rocblas_int n,
                                             rocblas_double_complex* const A[],
                                             rocblas_int lda,
                                             rocblas_stride stA,
-                                            rocblas_double_complex* const B[],
-                                            rocblas_int ldb,
-                                            rocblas_stride stB,
-                                            double vl,
-                                            double vu,
-                                            rocblas_int il,
-                                            rocblas_int iu,
-                                            double abstol,
-                                            rocblas_int* nev,
-                                            double* W,
-                                            rocblas_stride stW,
-                                            rocblas_double_complex* const Z[],
-                                            rocblas_int ldz,
-                                            rocblas_stride stZ,
-                                            rocblas_int* ifail,
-                                            rocblas_stride stF,
+                                            rocblas_int* ipiv,
+                                            rocblas_stride stP,
                                             rocblas_int* info,
                                             rocblas_int bc)
 {
-    return rocsolver_zhegvx_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                    il, iu, abstol, nev, W, stW, Z, ldz, ifail, stF, info, bc);
+    return SYTRF ? rocsolver_zsytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
+                 : rocsolver_zsytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
 /********************************************************/
 
-/******************** SYGVX/HEGVX_INPLACE ********************/
+/******************** SYTRS ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_eform itype,
-                                                      rocblas_evect evect,
-                                                      rocblas_erange erange,
-                                                      rocblas_fill uplo,
-                                                      rocblas_int n,
-                                                      float* A,
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      float* B,
-                                                      rocblas_int ldb,
-                                                      rocblas_stride stB,
-                                                      float vl,
-                                                      float vu,
-                                                      rocblas_int il,
-                                                      rocblas_int iu,
-                                                      float abstol,
-                                                      rocblas_int* nev,
-                                                      float* W,
-                                                      rocblas_stride stW,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_ssytrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                ldb, stB, bc);
+    else
+        return rocsolver_ssytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dsytrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                ldb, stB, bc);
+    else
+        return rocsolver_dsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_csytrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                ldb, stB, bc);
+    else
+        return rocsolver_csytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zsytrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                                ldb, stB, bc);
+    else
+        return rocsolver_zsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_ssytrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_dsytrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_csytrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_sytrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_ssygvdx_inplace_strided_batched(handle, itype, evect, erange, uplo, n, A, lda, stA, B, ldb, stB, vl, vu, il, iu, abstol, nev, W, stW, info, bc)
-        : rocsolver_ssygvdx_inplace(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                    il, iu, abstol, nev, W, info);
+    return rocsolver_zsytrs_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, bc);
 }
+/********************************************************/
 
-inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_eform itype,
-                                                      rocblas_evect evect,
-                                                      rocblas_erange erange,
-                                                      rocblas_fill uplo,
-                                                      rocblas_int n,
-                                                      double* A,
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      double* B,
-                                                      rocblas_int ldb,
-                                                      rocblas_stride stB,
-                                                      double vl,
-                                                      double vu,
-                                                      rocblas_int il,
-                                                      rocblas_int iu,
-                                                      double abstol,
-                                                      rocblas_int* nev,
-                                                      double* W,
-                                                      rocblas_stride stW,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+/******************** SYSV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_dsygvdx_inplace_strided_batched(handle, itype, evect, erange, uplo, n, A, lda, stA, B, ldb, stB, vl, vu, il, iu, abstol, nev, W, stW, info, bc)
-        : rocsolver_dsygvdx_inplace(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                    il, iu, abstol, nev, W, info);
+    if(STRIDED)
+        return rocsolver_ssysv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                               ldb, stB, info, bc);
+    else
+        return rocsolver_ssysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_eform itype,
-                                                      rocblas_evect evect,
-                                                      rocblas_erange erange,
-                                                      rocblas_fill uplo,
-                                                      rocblas_int n,
-                                                      rocblas_float_complex* A,
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      rocblas_float_complex* B,
-                                                      rocblas_int ldb,
-                                                      rocblas_stride stB,
-                                                      float vl,
-                                                      float vu,
-                                                      rocblas_int il,
-                                                      rocblas_int iu,
-                                                      float abstol,
-                                                      rocblas_int* nev,
-                                                      float* W,
-                                                      rocblas_stride stW,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_chegvdx_inplace_strided_batched(handle, itype, evect, erange, uplo, n, A, lda, stA, B, ldb, stB, vl, vu, il, iu, abstol, nev, W, stW, info, bc)
-        : rocsolver_chegvdx_inplace(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                    il, iu, abstol, nev, W, info);
+    if(STRIDED)
+        return rocsolver_dsysv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                               ldb, stB, info, bc);
+    else
+        return rocsolver_dsysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
 }
 
-inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_eform itype,
-                                                      rocblas_evect evect,
-                                                      rocblas_erange erange,
-                                                      rocblas_fill uplo,
-                                                      rocblas_int n,
-                                                      rocblas_double_complex* A,
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      rocblas_double_complex* B,
-                                                      rocblas_int ldb,
-                                                      rocblas_stride stB,
-                                                      double vl,
-                                                      double vu,
-                                                      rocblas_int il,
-                                                      rocblas_int iu,
-                                                      double abstol,
-                                                      rocblas_int* nev,
-                                                      double* W,
-                                                      rocblas_stride stW,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return STRIDED
-        ? rocblas_status_not_implemented // rocsolver_zhegvdx_inplace_strided_batched(handle, itype, evect, erange, uplo, n, A, lda, stA, B, ldb, stB, vl, vu, il, iu, abstol, nev, W, stW, info, bc)
-        : rocsolver_zhegvdx_inplace(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu,
-                                    il, iu, abstol, nev, W, info);
+    if(STRIDED)
+        return rocsolver_csysv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                               ldb, stB, info, bc);
+    else
+        return rocsolver_csysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zsysv_strided_batched(handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B,
+                                               ldb, stB, info, bc);
+    else
+        return rocsolver_zsysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, info);
 }
 
 // batched
-inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_eform itype,
-                                                      rocblas_evect evect,
-                                                      rocblas_erange erange,
-                                                      rocblas_fill uplo,
-                                                      rocblas_int n,
-                                                      float* const A[],
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      float* const B[],
-                                                      rocblas_int ldb,
-                                                      rocblas_stride stB,
-                                                      float vl,
-                                                      float vu,
-                                                      rocblas_int il,
-                                                      rocblas_int iu,
-                                                      float abstol,
-                                                      rocblas_int* nev,
-                                                      float* W,
-                                                      rocblas_stride stW,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_ssygvdx_inplace_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, nev, W, stW, info, bc);
+    return rocsolver_ssysv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_eform itype,
-                                                      rocblas_evect evect,
-                                                      rocblas_erange erange,
-                                                      rocblas_fill uplo,
-                                                      rocblas_int n,
-                                                      double* const A[],
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      double* const B[],
-                                                      rocblas_int ldb,
-                                                      rocblas_stride stB,
-                                                      double vl,
-                                                      double vu,
-                                                      rocblas_int il,
-                                                      rocblas_int iu,
-                                                      double abstol,
-                                                      rocblas_int* nev,
-                                                      double* W,
-                                                      rocblas_stride stW,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_dsygvdx_inplace_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, nev, W, stW, info, bc);
+    return rocsolver_dsysv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_eform itype,
-                                                      rocblas_evect evect,
-                                                      rocblas_erange erange,
-                                                      rocblas_fill uplo,
-                                                      rocblas_int n,
-                                                      rocblas_float_complex* const A[],
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      rocblas_float_complex* const B[],
-                                                      rocblas_int ldb,
-                                                      rocblas_stride stB,
-                                                      float vl,
-                                                      float vu,
-                                                      rocblas_int il,
-                                                      rocblas_int iu,
-                                                      double abstol,
-                                                      rocblas_int* nev,
-                                                      float* W,
-                                                      rocblas_stride stW,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_chegvdx_inplace_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, nev, W, stW, info, bc);
+    return rocsolver_csysv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 
-inline rocblas_status rocsolver_sygvdx_hegvdx_inplace(bool STRIDED,
-                                                      rocblas_handle handle,
-                                                      rocblas_eform itype,
-                                                      rocblas_evect evect,
-                                                      rocblas_erange erange,
-                                                      rocblas_fill uplo,
-                                                      rocblas_int n,
-                                                      rocblas_double_complex* const A[],
-                                                      rocblas_int lda,
-                                                      rocblas_stride stA,
-                                                      rocblas_double_complex* const B[],
-                                                      rocblas_int ldb,
-                                                      rocblas_stride stB,
-                                                      double vl,
-                                                      double vu,
-                                                      rocblas_int il,
-                                                      rocblas_int iu,
-                                                      double abstol,
-                                                      rocblas_int* nev,
-                                                      double* W,
-                                                      rocblas_stride stW,
-                                                      rocblas_int* info,
-                                                      rocblas_int bc)
+inline rocblas_status rocsolver_sysv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
 {
-    return rocblas_status_not_implemented; // rocsolver_zhegvdx_inplace_batched(handle, itype, evect, erange, uplo, n, A, lda, B, ldb, vl, vu, il, iu, abstol, nev, W, stW, info, bc);
+    return rocsolver_zsysv_batched(handle, uplo, n, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
 }
 /********************************************************/
 
-/******************** SYTF2_SYTRF ********************/
+/******************** SYTRI ********************/
 // normal and strided_batched
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_sytri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return SYTRF
-            ? rocsolver_ssytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_ssytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+        return rocsolver_ssytri_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return SYTRF ? rocsolver_ssytrf(handle, uplo, n, A, lda, ipiv, info)
-                     : rocsolver_ssytf2(handle, uplo, n, A, lda, ipiv, info);
+        return rocsolver_ssytri(handle, uplo, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            double* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_sytri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return SYTRF
-            ? rocsolver_dsytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_dsytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+        return rocsolver_dsytri_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return SYTRF ? rocsolver_dsytrf(handle, uplo, n, A, lda, ipiv, info)
-                     : rocsolver_dsytf2(handle, uplo, n, A, lda, ipiv, info);
+        return rocsolver_dsytri(handle, uplo, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_float_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_sytri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return SYTRF
-            ? rocsolver_csytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_csytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+        return rocsolver_csytri_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return SYTRF ? rocsolver_csytrf(handle, uplo, n, A, lda, ipiv, info)
-                     : rocsolver_csytf2(handle, uplo, n, A, lda, ipiv, info);
+        return rocsolver_csytri(handle, uplo, n, A, lda, ipiv, info);
 }
 
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* A,
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_sytri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
     if(STRIDED)
-        return SYTRF
-            ? rocsolver_zsytrf_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc)
-            : rocsolver_zsytf2_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
+        return rocsolver_zsytri_strided_batched(handle, uplo, n, A, lda, stA, ipiv, stP, info, bc);
     else
-        return SYTRF ? rocsolver_zsytrf(handle, uplo, n, A, lda, ipiv, info)
-                     : rocsolver_zsytf2(handle, uplo, n, A, lda, ipiv, info);
+        return rocsolver_zsytri(handle, uplo, n, A, lda, ipiv, info);
 }
 
 // batched
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            float* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_sytri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return SYTRF ? rocsolver_ssytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_ssytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_ssytri_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            double* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_sytri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return SYTRF ? rocsolver_dsytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_dsytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_dsytri_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_float_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_sytri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return SYTRF ? rocsolver_csytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_csytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_csytri_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
 
-inline rocblas_status rocsolver_sytf2_sytrf(bool STRIDED,
-                                            bool SYTRF,
-                                            rocblas_handle handle,
-                                            rocblas_fill uplo,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_int* ipiv,
-                                            rocblas_stride stP,
-                                            rocblas_int* info,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_sytri(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
 {
-    return SYTRF ? rocsolver_zsytrf_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc)
-                 : rocsolver_zsytf2_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
+    return rocsolver_zsytri_batched(handle, uplo, n, A, lda, ipiv, stP, info, bc);
 }
 /********************************************************/
 
@@ -258,6 +258,17 @@ public:
             throw std::invalid_argument("Invalid value for " + name);
     }
 
+    void validate_norm_type(const std::string name) const
+    {
+        auto val = find(name);
+        if(val == end())
+            return;
+
+        char norm = val->second.as<char>();
+        if(norm != '1' && norm != 'O' && norm != 'I')
+            throw std::invalid_argument("Invalid value for " + name);
+    }
+
     void validate_itype(const std::string name) const
     {
         auto val = find(name);
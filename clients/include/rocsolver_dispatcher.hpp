@@ -9,16 +9,24 @@
 #include <map>
 #include <string>
 
+#include "testing_bdsdc.hpp"
 #include "testing_bdsqr.hpp"
 #include "testing_bdsvdx.hpp"
 #include "testing_gebd2_gebrd.hpp"
 #include "testing_geblttrf_npvt.hpp"
 #include "testing_geblttrs_npvt.hpp"
+#include "testing_gecon.hpp"
 #include "testing_gelq2_gelqf.hpp"
 #include "testing_gels.hpp"
+#include "testing_gelss.hpp"
+#include "testing_gelsy.hpp"
+#include "testing_gerfs.hpp"
 #include "testing_geql2_geqlf.hpp"
+#include "testing_geqp3.hpp"
 #include "testing_geqr2_geqrf.hpp"
+#include "testing_geqrfq.hpp"
 #include "testing_gerq2_gerqf.hpp"
+#include "testing_gesdd.hpp"
 #include "testing_gesv.hpp"
 #include "testing_gesvd.hpp"
 #include "testing_gesvdj.hpp"
@@ -30,6 +38,10 @@
 #include "testing_getri_npvt_outofplace.hpp"
 #include "testing_getri_outofplace.hpp"
 #include "testing_getrs.hpp"
+#include "testing_ggglm.hpp"
+#include "testing_gglse.hpp"
+#include "testing_ggqrf.hpp"
+#include "testing_ggrqf.hpp"
 #include "testing_labrd.hpp"
 #include "testing_lacgv.hpp"
 #include "testing_larf.hpp"
@@ -42,14 +54,18 @@
 #include "testing_lauum.hpp"
 #include "testing_orgbr_ungbr.hpp"
 #include "testing_orglx_unglx.hpp"
+#include "testing_orgrx_ungrx.hpp"
 #include "testing_orgtr_ungtr.hpp"
 #include "testing_orgxl_ungxl.hpp"
 #include "testing_orgxr_ungxr.hpp"
 #include "testing_ormbr_unmbr.hpp"
 #include "testing_ormlx_unmlx.hpp"
+#include "testing_ormrx_unmrx.hpp"
 #include "testing_ormtr_unmtr.hpp"
 #include "testing_ormxl_unmxl.hpp"
 #include "testing_ormxr_unmxr.hpp"
+#include "testing_pocon.hpp"
+#include "testing_porfs.hpp"
 #include "testing_posv.hpp"
 #include "testing_potf2_potrf.hpp"
 #include "testing_potri.hpp"
@@ -68,8 +84,12 @@
 #include "testing_sygvd_hegvd.hpp"
 #include "testing_sygvj_hegvj.hpp"
 #include "testing_sygvx_hegvx.hpp"
+#include "testing_sysv.hpp"
 #include "testing_sytf2_sytrf.hpp"
+#include "testing_sytri.hpp"
+#include "testing_sytrs.hpp"
 #include "testing_sytxx_hetxx.hpp"
+#include "testing_trcon.hpp"
 #include "testing_trtri.hpp"
 
 struct str_less
@@ -115,10 +135,18 @@ class rocsolver_dispatcher
             {"potrs", testing_potrs<false, false, T>},
             {"potrs_batched", testing_potrs<true, true, T>},
             {"potrs_strided_batched", testing_potrs<false, true, T>},
+            // pocon
+            {"pocon", testing_pocon<false, false, T>},
+            {"pocon_batched", testing_pocon<true, true, T>},
+            {"pocon_strided_batched", testing_pocon<false, true, T>},
             // posv
             {"posv", testing_posv<false, false, T>},
             {"posv_batched", testing_posv<true, true, T>},
             {"posv_strided_batched", testing_posv<false, true, T>},
+            // porfs
+            {"porfs", testing_porfs<false, false, T>},
+            {"porfs_batched", testing_porfs<true, true, T>},
+            {"porfs_strided_batched", testing_porfs<false, true, T>},
             // potri
             {"potri", testing_potri<false, false, T>},
             {"potri_batched", testing_potri<true, true, T>},
@@ -145,6 +173,14 @@ class rocsolver_dispatcher
             {"geqrf_batched", testing_geqr2_geqrf<true, true, 1, T>},
             {"geqrf_strided_batched", testing_geqr2_geqrf<false, true, 1, T>},
             {"geqrf_ptr_batched", testing_geqr2_geqrf<true, false, 1, T>},
+            // geqp3
+            {"geqp3", testing_geqp3<false, false, T>},
+            {"geqp3_batched", testing_geqp3<true, true, T>},
+            {"geqp3_strided_batched", testing_geqp3<false, true, T>},
+            // geqrfq
+            {"geqrfq", testing_geqrfq<false, false, T>},
+            {"geqrfq_batched", testing_geqrfq<true, true, T>},
+            {"geqrfq_strided_batched", testing_geqrfq<false, true, T>},
             // gerqf
             {"gerq2", testing_gerq2_gerqf<false, false, 0, T>},
             {"gerq2_batched", testing_gerq2_gerqf<true, true, 0, T>},
@@ -152,6 +188,14 @@ class rocsolver_dispatcher
             {"gerqf", testing_gerq2_gerqf<false, false, 1, T>},
             {"gerqf_batched", testing_gerq2_gerqf<true, true, 1, T>},
             {"gerqf_strided_batched", testing_gerq2_gerqf<false, true, 1, T>},
+            // ggqrf
+            {"ggqrf", testing_ggqrf<false, false, T>},
+            {"ggqrf_batched", testing_ggqrf<true, true, T>},
+            {"ggqrf_strided_batched", testing_ggqrf<false, true, T>},
+            // ggrqf
+            {"ggrqf", testing_ggrqf<false, false, T>},
+            {"ggrqf_batched", testing_ggrqf<true, true, T>},
+            {"ggrqf_strided_batched", testing_ggrqf<false, true, T>},
             // geqlf
             {"geql2", testing_geql2_geqlf<false, false, 0, T>},
             {"geql2_batched", testing_geql2_geqlf<true, true, 0, T>},
@@ -170,14 +214,26 @@ class rocsolver_dispatcher
             {"getrs", testing_getrs<false, false, T>},
             {"getrs_batched", testing_getrs<true, true, T>},
             {"getrs_strided_batched", testing_getrs<false, true, T>},
+            // gecon
+            {"gecon", testing_gecon<false, false, T>},
+            {"gecon_batched", testing_gecon<true, true, T>},
+            {"gecon_strided_batched", testing_gecon<false, true, T>},
             // gesv
             {"gesv", testing_gesv<false, false, T>},
             {"gesv_batched", testing_gesv<true, true, T>},
             {"gesv_strided_batched", testing_gesv<false, true, T>},
+            // gerfs
+            {"gerfs", testing_gerfs<false, false, T>},
+            {"gerfs_batched", testing_gerfs<true, true, T>},
+            {"gerfs_strided_batched", testing_gerfs<false, true, T>},
             // gesvd
             {"gesvd", testing_gesvd<false, false, T>},
             {"gesvd_batched", testing_gesvd<true, true, T>},
             {"gesvd_strided_batched", testing_gesvd<false, true, T>},
+            // gesdd
+            {"gesdd", testing_gesdd<false, false, T>},
+            {"gesdd_batched", testing_gesdd<true, true, T>},
+            {"gesdd_strided_batched", testing_gesdd<false, true, T>},
             // gesvdj
             {"gesvdj", testing_gesvdj<false, false, T>},
             {"gesvdj_batched", testing_gesvdj<true, true, T>},
@@ -190,6 +246,10 @@ class rocsolver_dispatcher
             {"trtri", testing_trtri<false, false, T>},
             {"trtri_batched", testing_trtri<true, true, T>},
             {"trtri_strided_batched", testing_trtri<false, true, T>},
+            // trcon
+            {"trcon", testing_trcon<false, false, T>},
+            {"trcon_batched", testing_trcon<true, true, T>},
+            {"trcon_strided_batched", testing_trcon<false, true, T>},
             // getri
             {"getri", testing_getri<false, false, T>},
             {"getri_batched", testing_getri<true, true, T>},
@@ -210,6 +270,22 @@ class rocsolver_dispatcher
             {"gels", testing_gels<false, false, T>},
             {"gels_batched", testing_gels<true, true, T>},
             {"gels_strided_batched", testing_gels<false, true, T>},
+            // gelsy
+            {"gelsy", testing_gelsy<false, false, T>},
+            {"gelsy_batched", testing_gelsy<true, true, T>},
+            {"gelsy_strided_batched", testing_gelsy<false, true, T>},
+            // gelss
+            {"gelss", testing_gelss<false, false, T>},
+            {"gelss_batched", testing_gelss<true, true, T>},
+            {"gelss_strided_batched", testing_gelss<false, true, T>},
+            // gglse
+            {"gglse", testing_gglse<false, false, T>},
+            {"gglse_batched", testing_gglse<true, true, T>},
+            {"gglse_strided_batched", testing_gglse<false, true, T>},
+            // ggglm
+            {"ggglm", testing_ggglm<false, false, T>},
+            {"ggglm_batched", testing_ggglm<true, true, T>},
+            {"ggglm_strided_batched", testing_ggglm<false, true, T>},
             // gebrd
             {"gebd2", testing_gebd2_gebrd<false, false, 0, T>},
             {"gebd2_batched", testing_gebd2_gebrd<true, true, 0, T>},
@@ -224,6 +300,18 @@ class rocsolver_dispatcher
             {"sytrf", testing_sytf2_sytrf<false, false, 1, T>},
             {"sytrf_batched", testing_sytf2_sytrf<true, true, 1, T>},
             {"sytrf_strided_batched", testing_sytf2_sytrf<false, true, 1, T>},
+            // sytrs
+            {"sytrs", testing_sytrs<false, false, T>},
+            {"sytrs_batched", testing_sytrs<true, true, T>},
+            {"sytrs_strided_batched", testing_sytrs<false, true, T>},
+            // sysv
+            {"sysv", testing_sysv<false, false, T>},
+            {"sysv_batched", testing_sysv<true, true, T>},
+            {"sysv_strided_batched", testing_sysv<false, true, T>},
+            // sytri
+            {"sytri", testing_sytri<false, false, T>},
+            {"sytri_batched", testing_sytri<true, true, T>},
+            {"sytri_strided_batched", testing_sytri<false, true, T>},
             // geblttrf_npvt
             {"geblttrf_npvt", testing_geblttrf_npvt<false, false, T>},
             {"geblttrf_npvt_batched", testing_geblttrf_npvt<true, true, T>},
@@ -253,6 +341,7 @@ class rocsolver_dispatcher
             {"sterf", testing_sterf<T>},
             {"stebz", testing_stebz<T>},
             {"bdsvdx", testing_bdsvdx<T>},
+            {"bdsdc", testing_bdsdc<T>},
             // orgxx
             {"org2r", testing_orgxr_ungxr<T, 0>},
             {"orgqr", testing_orgxr_ungxr<T, 1>},
@@ -260,6 +349,8 @@ class rocsolver_dispatcher
             {"orgql", testing_orgxl_ungxl<T, 1>},
             {"orgl2", testing_orglx_unglx<T, 0>},
             {"orglq", testing_orglx_unglx<T, 1>},
+            {"orgr2", testing_orgrx_ungrx<T, 0>},
+            {"orgrq", testing_orgrx_ungrx<T, 1>},
             {"orgbr", testing_orgbr_ungbr<T>},
             {"orgtr", testing_orgtr_ungtr<T>},
             // ormxx
@@ -269,6 +360,8 @@ class rocsolver_dispatcher
             {"ormql", testing_ormxl_unmxl<T, 1>},
             {"orml2", testing_ormlx_unmlx<T, 0>},
             {"ormlq", testing_ormlx_unmlx<T, 1>},
+            {"ormr2", testing_ormrx_unmrx<T, 0>},
+            {"ormrq", testing_ormrx_unmrx<T, 1>},
             {"ormbr", testing_ormbr_unmbr<T>},
             {"ormtr", testing_ormtr_unmtr<T>},
             // sytrd
@@ -343,6 +436,8 @@ class rocsolver_dispatcher
             {"ungql", testing_orgxl_ungxl<T, 1>},
             {"ungl2", testing_orglx_unglx<T, 0>},
             {"unglq", testing_orglx_unglx<T, 1>},
+            {"ungr2", testing_orgrx_ungrx<T, 0>},
+            {"ungrq", testing_orgrx_ungrx<T, 1>},
             {"ungbr", testing_orgbr_ungbr<T>},
             {"ungtr", testing_orgtr_ungtr<T>},
             // unmxx
@@ -352,6 +447,8 @@ class rocsolver_dispatcher
             {"unmql", testing_ormxl_unmxl<T, 1>},
             {"unml2", testing_ormlx_unmlx<T, 0>},
             {"unmlq", testing_ormlx_unmlx<T, 1>},
+            {"unmr2", testing_ormrx_unmrx<T, 0>},
+            {"unmrq", testing_ormrx_unmrx<T, 1>},
             {"unmbr", testing_ormbr_unmbr<T>},
             {"unmtr", testing_ormtr_unmtr<T>},
             // hetrd
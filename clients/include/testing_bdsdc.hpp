@@ -0,0 +1,485 @@
+/* ************************************************************************
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "client_util.hpp"
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <typename T>
+void bdsdc_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_fill uplo,
+                        const rocblas_svect svect,
+                        const rocblas_int n,
+                        T dD,
+                        T dE,
+                        T dU,
+                        const rocblas_int ldu,
+                        T dV,
+                        const rocblas_int ldv,
+                        rocblas_int* dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(nullptr, uplo, svect, n, dD, dE, dU, ldu, dV, ldv, dInfo),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(handle, rocblas_fill_full, svect, n, dD, dE, dU, ldu, dV,
+                                          ldv, dInfo),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(handle, uplo, rocblas_svect_all, n, dD, dE, dU, ldu, dV,
+                                          ldv, dInfo),
+                          rocblas_status_invalid_value);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_bdsdc(handle, uplo, svect, n, (T) nullptr, dE, dU, ldu, dV, ldv, dInfo),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_bdsdc(handle, uplo, svect, n, dD, (T) nullptr, dU, ldu, dV, ldv, dInfo),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_bdsdc(handle, uplo, svect, n, dD, dE, (T) nullptr, ldu, dV, ldv, dInfo),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_bdsdc(handle, uplo, svect, n, dD, dE, dU, ldu, (T) nullptr, ldv, dInfo),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_bdsdc(handle, uplo, svect, n, dD, dE, dU, ldu, dV, ldv, (rocblas_int*)nullptr),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(handle, uplo, svect, 0, (T) nullptr, (T) nullptr,
+                                          (T) nullptr, ldu, (T) nullptr, ldv, dInfo),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_bdsdc_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 2;
+    rocblas_int ldu = 2;
+    rocblas_int ldv = 2;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_svect svect = rocblas_svect_singular;
+
+    // memory allocations
+    device_strided_batch_vector<T> dD(1, 1, 1, 1);
+    device_strided_batch_vector<T> dE(1, 1, 1, 1);
+    device_strided_batch_vector<T> dU(1, 1, 1, 1);
+    device_strided_batch_vector<T> dV(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dE.memcheck());
+    CHECK_HIP_ERROR(dU.memcheck());
+    CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    bdsdc_checkBadArgs(handle, uplo, svect, n, dD.data(), dE.data(), dU.data(), ldu, dV.data(), ldv,
+                       dInfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void bdsdc_initData(const rocblas_handle handle, const rocblas_int n, Td& dD, Td& dE, Th& hD, Th& hE)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hD, true);
+        rocblas_init<T>(hE, true);
+
+        // scale matrix and add fixed splits in the matrix to test split handling
+        // (scaling ensures that all singular values are in [0, 20])
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            hD[0][i] += 10;
+            hE[0][i] = (hE[0][i] - 5) / 10;
+            if(i == n / 4 || i == n / 2 || i == n - 1)
+                hE[0][i] = 0;
+            if(i == n / 7 || i == n / 5 || i == n / 3)
+                hD[0][i] *= -1;
+        }
+
+        // add zero diagonal elements (and thus zero singular values) for
+        // sufficiently large matrices
+        if(n > 8)
+        {
+            hD[0][n / 6] = 0;
+            hD[0][n - 2] = 0;
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+        CHECK_HIP_ERROR(dE.transfer_from(hE));
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void bdsdc_getError(const rocblas_handle handle,
+                    const rocblas_fill uplo,
+                    const rocblas_svect svect,
+                    const rocblas_int n,
+                    Td& dD,
+                    Td& dE,
+                    Td& dU,
+                    const rocblas_int ldu,
+                    Td& dV,
+                    const rocblas_int ldv,
+                    Ud& dInfo,
+                    Th& hD,
+                    Th& hE,
+                    Th& hDRes,
+                    Th& hURes,
+                    Th& hVRes,
+                    Uh& hInfo,
+                    Uh& hInfoRes,
+                    double* max_err)
+{
+    std::vector<T> work(4 * n);
+    std::vector<T> S(n);
+    std::vector<T> E(n);
+
+    // input data initialization
+    bdsdc_initData<true, true, T>(handle, n, dD, dE, hD, hE);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_bdsdc(handle, uplo, svect, n, dD.data(), dE.data(), dU.data(),
+                                        ldu, dV.data(), ldv, dInfo.data()));
+    CHECK_HIP_ERROR(hDRes.transfer_from(dD));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+    if(svect != rocblas_svect_none)
+    {
+        CHECK_HIP_ERROR(hURes.transfer_from(dU));
+        CHECK_HIP_ERROR(hVRes.transfer_from(dV));
+    }
+
+    // CPU lapack
+    // (the singular values are computed with bdsqr)
+    for(rocblas_int i = 0; i < n; i++)
+    {
+        S[i] = hD[0][i];
+        E[i] = hE[0][i];
+    }
+    cpu_bdsqr(uplo, n, 0, 0, 0, S.data(), E.data(), (T*)nullptr, 1, (T*)nullptr, 1, (T*)nullptr, 1,
+              work.data(), hInfo[0]);
+
+    // check info
+    EXPECT_EQ(hInfo[0][0], hInfoRes[0][0]);
+    if(hInfo[0][0] != hInfoRes[0][0])
+        *max_err = 1;
+    else
+        *max_err = 0;
+
+    // if finding singular values succeeded, check values
+    double err;
+    if(hInfoRes[0][0] == 0)
+    {
+        // error is ||S - hDRes|| / ||S||
+        // using frobenius norm
+        err = norm_error('F', 1, n, 1, S.data(), hDRes[0]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // Check the singular vectors if required
+        if(svect != rocblas_svect_none)
+        {
+            // form bidiagonal matrix B
+            std::vector<T> B(n * n);
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        B[i + j * n] = hD[0][i];
+                    else if(i + 1 == j && uplo == rocblas_fill_upper)
+                        B[i + j * n] = hE[0][i];
+                    else if(i == j + 1 && uplo == rocblas_fill_lower)
+                        B[i + j * n] = hE[0][j];
+                    else
+                        B[i + j * n] = 0;
+                }
+            }
+
+            // check orthogonality of the singular vectors (U'U = I and VV' = I)
+            std::vector<T> I(n * n);
+            for(rocblas_int i = 0; i < n; i++)
+                for(rocblas_int j = 0; j < n; j++)
+                    I[i + j * n] = (i == j) ? T(1) : T(0);
+            cpu_gemm(rocblas_operation_transpose, rocblas_operation_none, n, n, n, T(1), hURes[0],
+                     ldu, hURes[0], ldu, T(-1), I.data(), n);
+            err = double(snorm('F', n, n, I.data(), n)) / n;
+            *max_err = err > *max_err ? err : *max_err;
+
+            for(rocblas_int i = 0; i < n; i++)
+                for(rocblas_int j = 0; j < n; j++)
+                    I[i + j * n] = (i == j) ? T(1) : T(0);
+            cpu_gemm(rocblas_operation_none, rocblas_operation_transpose, n, n, n, T(1), hVRes[0],
+                     ldv, hVRes[0], ldv, T(-1), I.data(), n);
+            err = double(snorm('F', n, n, I.data(), n)) / n;
+            *max_err = err > *max_err ? err : *max_err;
+
+            // check singular vectors implicitly (B*v_k = s_k*u_k)
+            for(rocblas_int k = 0; k < n; ++k)
+            {
+                cpu_gemv(rocblas_operation_none, n, n, T(1), B.data(), n, hVRes[0] + k, ldv,
+                         -hDRes[0][k], hURes[0] + k * ldu, 1);
+            }
+            err = double(snorm('F', n, n, hURes[0], ldu)) / double(snorm('F', n, n, B.data(), n));
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void bdsdc_getPerfData(const rocblas_handle handle,
+                       const rocblas_fill uplo,
+                       const rocblas_svect svect,
+                       const rocblas_int n,
+                       Td& dD,
+                       Td& dE,
+                       Td& dU,
+                       const rocblas_int ldu,
+                       Td& dV,
+                       const rocblas_int ldv,
+                       Ud& dInfo,
+                       Th& hD,
+                       Th& hE,
+                       Uh& hInfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    if(!perf)
+    {
+        std::vector<T> work(4 * n);
+
+        bdsdc_initData<true, false, T>(handle, n, dD, dE, hD, hE);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (the singular values are computed with bdsqr)
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_bdsqr(uplo, n, 0, 0, 0, hD[0], hE[0], (T*)nullptr, 1, (T*)nullptr, 1, (T*)nullptr, 1,
+                  work.data(), hInfo[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    bdsdc_initData<true, false, T>(handle, n, dD, dE, hD, hE);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        bdsdc_initData<false, true, T>(handle, n, dD, dE, hD, hE);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_bdsdc(handle, uplo, svect, n, dD.data(), dE.data(), dU.data(),
+                                            ldu, dV.data(), ldv, dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        bdsdc_initData<false, true, T>(handle, n, dD, dE, hD, hE);
+
+        start = get_time_us_sync(stream);
+        rocsolver_bdsdc(handle, uplo, svect, n, dD.data(), dE.data(), dU.data(), ldu, dV.data(),
+                        ldv, dInfo.data());
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_bdsdc(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    char uploC = argus.get<char>("uplo");
+    char svectC = argus.get<char>("svect");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int ldu = argus.get<rocblas_int>("ldu", n);
+    rocblas_int ldv = argus.get<rocblas_int>("ldv", n);
+
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_svect svect = char2rocblas_svect(svectC);
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if((uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+       || (svect != rocblas_svect_none && svect != rocblas_svect_singular))
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(handle, uplo, svect, n, (T*)nullptr, (T*)nullptr,
+                                              (T*)nullptr, ldu, (T*)nullptr, ldv,
+                                              (rocblas_int*)nullptr),
+                              rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_D = n;
+    size_t size_E = n;
+    size_t size_U = (svect != rocblas_svect_none) ? size_t(ldu) * n : 1;
+    size_t size_V = (svect != rocblas_svect_none) ? size_t(ldv) * n : 1;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_DRes = (argus.unit_check || argus.norm_check) ? size_D : 0;
+    size_t size_URes = (argus.unit_check || argus.norm_check) ? size_U : 0;
+    size_t size_VRes = (argus.unit_check || argus.norm_check) ? size_V : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0) || (ldu < 1) || (ldv < 1)
+        || (svect != rocblas_svect_none && (ldu < n || ldv < n));
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(handle, uplo, svect, n, (T*)nullptr, (T*)nullptr,
+                                              (T*)nullptr, ldu, (T*)nullptr, ldv,
+                                              (rocblas_int*)nullptr),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_bdsdc(handle, uplo, svect, n, (T*)nullptr, (T*)nullptr,
+                                          (T*)nullptr, ldu, (T*)nullptr, ldv,
+                                          (rocblas_int*)nullptr));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    // host
+    host_strided_batch_vector<T> hD(size_D, 1, size_D, 1);
+    host_strided_batch_vector<T> hE(size_E, 1, size_E, 1);
+    host_strided_batch_vector<T> hDRes(size_DRes, 1, size_DRes, 1);
+    host_strided_batch_vector<T> hURes(size_URes, 1, size_URes, 1);
+    host_strided_batch_vector<T> hVRes(size_VRes, 1, size_VRes, 1);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, 1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, 1);
+    // device
+    device_strided_batch_vector<T> dD(size_D, 1, size_D, 1);
+    device_strided_batch_vector<T> dE(size_E, 1, size_E, 1);
+    device_strided_batch_vector<T> dU(size_U, 1, size_U, 1);
+    device_strided_batch_vector<T> dV(size_V, 1, size_V, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+
+    if(size_D)
+        CHECK_HIP_ERROR(dD.memcheck());
+    if(size_E)
+        CHECK_HIP_ERROR(dE.memcheck());
+    if(size_U)
+        CHECK_HIP_ERROR(dU.memcheck());
+    if(size_V)
+        CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(n == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_bdsdc(handle, uplo, svect, n, dD.data(), dE.data(),
+                                              dU.data(), ldu, dV.data(), ldv, dInfo.data()),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        bdsdc_getError<T>(handle, uplo, svect, n, dD, dE, dU, ldu, dV, ldv, dInfo, hD, hE, hDRes,
+                          hURes, hVRes, hInfo, hInfoRes, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        bdsdc_getPerfData<T>(handle, uplo, svect, n, dD, dE, dU, ldu, dV, ldv, dInfo, hD, hE, hInfo,
+                             &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                             argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using 2 * n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, 2 * n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("uplo", "svect", "n", "ldu", "ldv");
+            rocsolver_bench_output(uploC, svectC, n, ldu, ldv);
+
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_BDSDC(...) extern template void testing_bdsdc<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_BDSDC, FOREACH_REAL_TYPE, APPLY_STAMP)
@@ -0,0 +1,503 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "client_util.hpp"
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S>
+void gecon_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_norm_type norm_type,
+                        const rocblas_int n,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        S dAnorm,
+                        S dRcond,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gecon(STRIDED, nullptr, norm_type, n, dA, lda, stA, dAnorm, dRcond, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gecon(STRIDED, handle, rocblas_norm_type(0), n, dA, lda, stA, dAnorm, dRcond, bc),
+        rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_gecon(STRIDED, handle, norm_type, n, dA, lda, stA, dAnorm, dRcond, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gecon(STRIDED, handle, norm_type, n, (T) nullptr, lda, stA, dAnorm, dRcond, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gecon(STRIDED, handle, norm_type, n, dA, lda, stA, (S) nullptr, dRcond, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gecon(STRIDED, handle, norm_type, n, dA, lda, stA, dAnorm, (S) nullptr, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gecon(STRIDED, handle, norm_type, 0, (T) nullptr, lda, stA, dAnorm, dRcond, bc),
+        rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gecon(STRIDED, handle, norm_type, n, dA, lda, stA,
+                                              (S) nullptr, (S) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gecon_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_norm_type norm_type = rocblas_norm_one;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<S> dAnorm(1, 1, 1, 1);
+        device_strided_batch_vector<S> dRcond(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dAnorm.memcheck());
+        CHECK_HIP_ERROR(dRcond.memcheck());
+
+        // check bad arguments
+        gecon_checkBadArgs<STRIDED>(handle, norm_type, n, dA.data(), lda, stA, dAnorm.data(),
+                                    dRcond.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<S> dAnorm(1, 1, 1, 1);
+        device_strided_batch_vector<S> dRcond(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dAnorm.memcheck());
+        CHECK_HIP_ERROR(dRcond.memcheck());
+
+        // check bad arguments
+        gecon_checkBadArgs<STRIDED>(handle, norm_type, n, dA.data(), lda, stA, dAnorm.data(),
+                                    dRcond.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Sd, typename Th, typename Sh>
+void gecon_initData(const rocblas_handle handle,
+                    const rocblas_norm_type norm_type,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Sd& dAnorm,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Sh& hAnorm)
+{
+    if(CPU)
+    {
+        using S = decltype(std::real(T{}));
+        rocblas_init<T>(hA, true);
+
+        rocblas_int nn = n;
+        rocblas_int ldd = lda;
+        char normC = rocblas2char_norm_type(norm_type);
+        std::vector<S> work(n);
+        std::vector<rocblas_int> ipiv(n);
+        int info;
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // compute the norm of the original matrix A
+            hAnorm[b][0] = xlange(&normC, &nn, &nn, hA[b], &ldd, work.data());
+
+            // do the LU decomposition of matrix A w/ the reference LAPACK routine
+            cpu_getrf(n, n, hA[b], lda, ipiv.data(), &info);
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dAnorm.transfer_from(hAnorm));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Sd, typename Th, typename Sh>
+void gecon_getError(const rocblas_handle handle,
+                    const rocblas_norm_type norm_type,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Sd& dAnorm,
+                    Sd& dRcond,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Sh& hAnorm,
+                    Sh& hRcond,
+                    Sh& hRcondRes,
+                    double* max_err)
+{
+    using S = decltype(std::real(T{}));
+
+    std::vector<T> work(4 * n);
+    std::vector<S> rwork(2 * n);
+    std::vector<rocblas_int> iwork(n);
+    rocblas_int info;
+
+    // input data initialization
+    gecon_initData<true, true, T>(handle, norm_type, n, dA, lda, stA, dAnorm, bc, hA, hAnorm);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gecon(STRIDED, handle, norm_type, n, dA.data(), lda, stA,
+                                        dAnorm.data(), dRcond.data(), bc));
+    CHECK_HIP_ERROR(hRcondRes.transfer_from(dRcond));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cpu_gecon(norm_type, n, hA[b], lda, hAnorm[b][0], hRcond[b], work.data(), rwork.data(),
+                  iwork.data(), &info);
+    }
+
+    // error is |hRcond - hRcondRes| / |hRcond|
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = std::abs(double(hRcond[b][0]) - double(hRcondRes[b][0]));
+        if(hRcond[b][0] != 0)
+            err /= std::abs(double(hRcond[b][0]));
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Sd, typename Th, typename Sh>
+void gecon_getPerfData(const rocblas_handle handle,
+                       const rocblas_norm_type norm_type,
+                       const rocblas_int n,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Sd& dAnorm,
+                       Sd& dRcond,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Sh& hAnorm,
+                       Sh& hRcond,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    using S = decltype(std::real(T{}));
+
+    std::vector<T> work(4 * n);
+    std::vector<S> rwork(2 * n);
+    std::vector<rocblas_int> iwork(n);
+    rocblas_int info;
+
+    if(!perf)
+    {
+        gecon_initData<true, false, T>(handle, norm_type, n, dA, lda, stA, dAnorm, bc, hA, hAnorm);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_gecon(norm_type, n, hA[b], lda, hAnorm[b][0], hRcond[b], work.data(), rwork.data(),
+                      iwork.data(), &info);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gecon_initData<true, false, T>(handle, norm_type, n, dA, lda, stA, dAnorm, bc, hA, hAnorm);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gecon_initData<false, true, T>(handle, norm_type, n, dA, lda, stA, dAnorm, bc, hA, hAnorm);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gecon(STRIDED, handle, norm_type, n, dA.data(), lda, stA,
+                                            dAnorm.data(), dRcond.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gecon_initData<false, true, T>(handle, norm_type, n, dA, lda, stA, dAnorm, bc, hA, hAnorm);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gecon(STRIDED, handle, norm_type, n, dA.data(), lda, stA, dAnorm.data(),
+                        dRcond.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gecon(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char normC = argus.get<char>("norm");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+
+    rocblas_norm_type norm_type = char2rocblas_norm_type(normC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(norm_type != rocblas_norm_one && norm_type != rocblas_norm_inf)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gecon(STRIDED, handle, norm_type, n, (T* const*)nullptr,
+                                                  lda, stA, (S*)nullptr, (S*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gecon(STRIDED, handle, norm_type, n, (T*)nullptr, lda,
+                                                  stA, (S*)nullptr, (S*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gecon(STRIDED, handle, norm_type, n, (T* const*)nullptr,
+                                                  lda, stA, (S*)nullptr, (S*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gecon(STRIDED, handle, norm_type, n, (T*)nullptr, lda,
+                                                  stA, (S*)nullptr, (S*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_gecon(STRIDED, handle, norm_type, n, (T* const*)nullptr,
+                                              lda, stA, (S*)nullptr, (S*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_gecon(STRIDED, handle, norm_type, n, (T*)nullptr, lda, stA,
+                                              (S*)nullptr, (S*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // rcond and anorm
+    host_strided_batch_vector<S> hAnorm(1, 1, 1, bc);
+    host_strided_batch_vector<S> hRcond(1, 1, 1, bc);
+    host_strided_batch_vector<S> hRcondRes(1, 1, 1, bc);
+    device_strided_batch_vector<S> dAnorm(1, 1, 1, bc);
+    device_strided_batch_vector<S> dRcond(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dAnorm.memcheck());
+    CHECK_HIP_ERROR(dRcond.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gecon(STRIDED, handle, norm_type, n, dA.data(), lda,
+                                                  stA, dAnorm.data(), dRcond.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gecon_getError<STRIDED, T>(handle, norm_type, n, dA, lda, stA, dAnorm, dRcond, bc, hA,
+                                       hAnorm, hRcond, hRcondRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gecon_getPerfData<STRIDED, T>(handle, norm_type, n, dA, lda, stA, dAnorm, dRcond, bc,
+                                          hA, hAnorm, hRcond, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.profile, argus.profile_kernels,
+                                          argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gecon(STRIDED, handle, norm_type, n, dA.data(), lda,
+                                                  stA, dAnorm.data(), dRcond.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gecon_getError<STRIDED, T>(handle, norm_type, n, dA, lda, stA, dAnorm, dRcond, bc, hA,
+                                       hAnorm, hRcond, hRcondRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gecon_getPerfData<STRIDED, T>(handle, norm_type, n, dA, lda, stA, dAnorm, dRcond, bc,
+                                          hA, hAnorm, hRcond, &gpu_time_used, &cpu_time_used,
+                                          hot_calls, argus.profile, argus.profile_kernels,
+                                          argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("norm", "n", "lda", "batch_c");
+                rocsolver_bench_output(normC, n, lda, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("norm", "n", "lda", "strideA", "batch_c");
+                rocsolver_bench_output(normC, n, lda, stA, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("norm", "n", "lda");
+                rocsolver_bench_output(normC, n, lda);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GECON(...) extern template void testing_gecon<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GECON, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
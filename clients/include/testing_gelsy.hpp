@@ -0,0 +1,606 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "client_util.hpp"
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool BATCHED, bool STRIDED, typename S, typename U>
+void gelsy_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        U dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        U dB,
+                        const rocblas_int ldb,
+                        const rocblas_stride stB,
+                        rocblas_int* dJpvt,
+                        const rocblas_stride stJ,
+                        const S rcond,
+                        rocblas_int* dRank,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, nullptr, m, n, nrhs, dA, lda, stA, dB, ldb, stB,
+                                          dJpvt, stJ, rcond, dRank, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb,
+                                              stB, dJpvt, stJ, rcond, dRank, -1),
+                              rocblas_status_invalid_size)
+            << "Must report error when batch size is negative";
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, (U) nullptr, lda, stA, dB,
+                                          ldb, stB, dJpvt, stJ, rcond, dRank, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when A is null";
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA, lda, stA, (U) nullptr,
+                                          ldb, stB, dJpvt, stJ, rcond, dRank, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when B is null";
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB,
+                                          (rocblas_int*)nullptr, stJ, rcond, dRank, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when jpvt is null";
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB,
+                                          dJpvt, stJ, rcond, (rocblas_int*)nullptr, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when rank is null";
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, 0, n, nrhs, (U) nullptr, lda, stA, dB,
+                                          ldb, stB, dJpvt, stJ, rcond, dRank, bc),
+                          rocblas_status_success)
+        << "Matrix A may be null when m is 0 (empty matrix)";
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, 0, nrhs, (U) nullptr, lda, stA, dB,
+                                          ldb, stB, (rocblas_int*)nullptr, stJ, rcond, dRank, bc),
+                          rocblas_status_success)
+        << "Matrix A and jpvt may be null when n is 0 (empty matrix)";
+    EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, 0, dA, lda, stA, (U) nullptr, ldb,
+                                          stB, dJpvt, stJ, rcond, dRank, bc),
+                          rocblas_status_success)
+        << "Matrix B may be null when nhrs is 0 (empty matrix)";
+    if(BATCHED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb,
+                                              stB, dJpvt, stJ, rcond, (rocblas_int*)nullptr, 0),
+                              rocblas_status_success)
+            << "Rank may be null when batch size is 0";
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA, lda, stA, dB, ldb,
+                                              stB, dJpvt, stJ, rcond, dRank, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gelsy_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stB = 1;
+    rocblas_stride stJ = 1;
+    S rcond = 0;
+    rocblas_int bc = 1;
+
+    // memory allocations (all cases)
+    device_strided_batch_vector<rocblas_int> dJpvt(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dRank(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dJpvt.memcheck());
+    CHECK_HIP_ERROR(dRank.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dB(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+
+        // check bad arguments
+        gelsy_checkBadArgs<BATCHED, STRIDED>(handle, m, n, nrhs, dA.data(), lda, stA, dB.data(),
+                                             ldb, stB, dJpvt.data(), stJ, rcond, dRank.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dB(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+
+        // check bad arguments
+        gelsy_checkBadArgs<BATCHED, STRIDED>(handle, m, n, nrhs, dA.data(), lda, stA, dB.data(),
+                                             ldb, stB, dJpvt.data(), stJ, rcond, dRank.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gelsy_initData(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    const rocblas_int nrhs,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_stride stB,
+                    const double rcond,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hB)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // when rcond > 0, make A numerically rank deficient
+            // by replacing its last columns with linear combinations of the first ones
+            if(rcond > 0)
+            {
+                rocblas_int r = (min(m, n) + 1) / 2;
+                for(rocblas_int j = r; j < n; j++)
+                {
+                    for(rocblas_int i = 0; i < m; i++)
+                        hA[b][i + j * lda] = T(0.5) * hA[b][i + (j % r) * lda]
+                            + T(0.25) * hA[b][i + ((j + 1) % r) * lda];
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <bool STRIDED,
+          typename T,
+          typename S,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
+void gelsy_getError(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    const rocblas_int nrhs,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_stride stB,
+                    Ud& dJpvt,
+                    const rocblas_stride stJ,
+                    const S rcond,
+                    Ud& dRank,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hB,
+                    Th& hBRes,
+                    Uh& hJpvt,
+                    Uh& hRank,
+                    Uh& hRankRes,
+                    double* max_err)
+{
+    rocblas_int lwork = 2 * min(m, n) + 2 * n + 64 * (n + 1 + nrhs);
+    std::vector<T> hW(lwork);
+    std::vector<S> hRW(2 * n);
+
+    // input data initialization
+    gelsy_initData<true, true, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, rcond, bc, hA,
+                                  hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA,
+                                        dB.data(), ldb, stB, dJpvt.data(), stJ, rcond,
+                                        dRank.data(), bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hRankRes.transfer_from(dRank));
+
+    // CPU lapack
+    // (all columns are free columns for the reference implementation)
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        for(rocblas_int j = 0; j < n; ++j)
+            hJpvt[b][j] = 0;
+        cpu_gelsy(m, n, nrhs, hA[b], lda, hB[b], ldb, hJpvt[b], rcond, hRank[b], hW.data(), lwork,
+                  hRW.data());
+    }
+
+    // (the minimum-norm solution is unique, even if the pivoting strategy differs)
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('I', n, nrhs, ldb, hB[b], hBRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check the effective rank
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hRank[b][0], hRankRes[b][0]) << "where b = " << b;
+        if(hRank[b][0] != hRankRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool STRIDED,
+          typename T,
+          typename S,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
+void gelsy_getPerfData(const rocblas_handle handle,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       const rocblas_int nrhs,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Td& dB,
+                       const rocblas_int ldb,
+                       const rocblas_stride stB,
+                       Ud& dJpvt,
+                       const rocblas_stride stJ,
+                       const S rcond,
+                       Ud& dRank,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Th& hB,
+                       Uh& hJpvt,
+                       Uh& hRank,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    rocblas_int lwork = 2 * min(m, n) + 2 * n + 64 * (n + 1 + nrhs);
+    std::vector<T> hW(lwork);
+    std::vector<S> hRW(2 * n);
+
+    if(!perf)
+    {
+        gelsy_initData<true, false, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, rcond, bc,
+                                       hA, hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (all columns are free columns for the reference implementation)
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int j = 0; j < n; ++j)
+                hJpvt[b][j] = 0;
+        }
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_gelsy(m, n, nrhs, hA[b], lda, hB[b], ldb, hJpvt[b], rcond, hRank[b], hW.data(),
+                      lwork, hRW.data());
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gelsy_initData<true, false, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, rcond, bc, hA,
+                                   hB);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gelsy_initData<false, true, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, rcond, bc,
+                                       hA, hB);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA,
+                                            dB.data(), ldb, stB, dJpvt.data(), stJ, rcond,
+                                            dRank.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gelsy_initData<false, true, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, rcond, bc,
+                                       hA, hB);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA, dB.data(), ldb, stB,
+                        dJpvt.data(), stJ, rcond, dRank.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gelsy(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", max(m, n));
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * nrhs);
+    rocblas_stride stJ = argus.get<rocblas_stride>("strideJ", n);
+    S rcond = S(argus.get<double>("rcond"));
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stBRes = (argus.unit_check || argus.norm_check) ? stB : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    size_t size_J = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, (T* const*)nullptr,
+                                                  lda, stA, (T* const*)nullptr, ldb, stB,
+                                                  (rocblas_int*)nullptr, stJ, rcond,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, (T*)nullptr, lda,
+                                                  stA, (T*)nullptr, ldb, stB, (rocblas_int*)nullptr,
+                                                  stJ, rcond, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, (T* const*)nullptr, lda,
+                                              stA, (T* const*)nullptr, ldb, stB,
+                                              (rocblas_int*)nullptr, stJ, rcond,
+                                              (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, (T*)nullptr, lda, stA,
+                                              (T*)nullptr, ldb, stB, (rocblas_int*)nullptr, stJ,
+                                              rcond, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // jpvt and rank
+    host_strided_batch_vector<rocblas_int> hJpvt(size_J, 1, stJ, bc);
+    host_strided_batch_vector<rocblas_int> hRank(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hRankRes(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dJpvt(size_J, 1, stJ, bc);
+    device_strided_batch_vector<rocblas_int> dRank(1, 1, 1, bc);
+    if(size_J)
+        CHECK_HIP_ERROR(dJpvt.memcheck());
+    if(bc)
+        CHECK_HIP_ERROR(dRank.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hB(size_B, 1, bc);
+        host_batch_vector<T> hBRes(size_BRes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dB(size_B, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || nrhs == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA,
+                                                  dB.data(), ldb, stB, dJpvt.data(), stJ, rcond,
+                                                  dRank.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gelsy_getError<STRIDED, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, dJpvt, stJ,
+                                       rcond, dRank, bc, hA, hB, hBRes, hJpvt, hRank, hRankRes,
+                                       &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gelsy_getPerfData<STRIDED, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, dJpvt,
+                                          stJ, rcond, dRank, bc, hA, hB, hJpvt, hRank,
+                                          &gpu_time_used, &cpu_time_used, hot_calls,
+                                          argus.profile, argus.profile_kernels, argus.perf);
+    }
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+        host_strided_batch_vector<T> hBRes(size_BRes, 1, stBRes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || nrhs == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gelsy(STRIDED, handle, m, n, nrhs, dA.data(), lda, stA,
+                                                  dB.data(), ldb, stB, dJpvt.data(), stJ, rcond,
+                                                  dRank.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gelsy_getError<STRIDED, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, dJpvt, stJ,
+                                       rcond, dRank, bc, hA, hB, hBRes, hJpvt, hRank, hRankRes,
+                                       &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gelsy_getPerfData<STRIDED, T>(handle, m, n, nrhs, dA, lda, stA, dB, ldb, stB, dJpvt,
+                                          stJ, rcond, dRank, bc, hA, hB, hJpvt, hRank,
+                                          &gpu_time_used, &cpu_time_used, hot_calls,
+                                          argus.profile, argus.profile_kernels, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, max(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "nrhs", "lda", "ldb", "strideJ", "rcond",
+                                       "batch_c");
+                rocsolver_bench_output(m, n, nrhs, lda, ldb, stJ, rcond, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "nrhs", "lda", "ldb", "strideA", "strideB",
+                                       "strideJ", "rcond", "batch_c");
+                rocsolver_bench_output(m, n, nrhs, lda, ldb, stA, stB, stJ, rcond, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "nrhs", "lda", "ldb", "rcond");
+                rocsolver_bench_output(m, n, nrhs, lda, ldb, rcond);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GELSY(...) extern template void testing_gelsy<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GELSY, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
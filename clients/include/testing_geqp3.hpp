@@ -0,0 +1,596 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "client_util.hpp"
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S, typename U>
+void geqp3_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        rocblas_int* dJpvt,
+                        const rocblas_stride stJ,
+                        U dIpiv,
+                        const rocblas_stride stP,
+                        const S tol,
+                        rocblas_int* dRank,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, nullptr, m, n, dA, lda, stA, dJpvt, stJ, dIpiv,
+                                          stP, tol, dRank, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, dA, lda, stA, dJpvt, stJ,
+                                              dIpiv, stP, tol, dRank, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, (T) nullptr, lda, stA, dJpvt, stJ,
+                                          dIpiv, stP, tol, dRank, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, dA, lda, stA,
+                                          (rocblas_int*)nullptr, stJ, dIpiv, stP, tol, dRank, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, dA, lda, stA, dJpvt, stJ,
+                                          (U) nullptr, stP, tol, dRank, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv,
+                                          stP, tol, (rocblas_int*)nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, 0, n, (T) nullptr, lda, stA, dJpvt, stJ,
+                                          (U) nullptr, stP, tol, dRank, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, 0, (T) nullptr, lda, stA,
+                                          (rocblas_int*)nullptr, stJ, (U) nullptr, stP, tol, dRank,
+                                          bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, dA, lda, stA, dJpvt, stJ,
+                                              dIpiv, stP, tol, (rocblas_int*)nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geqp3_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stJ = 1;
+    rocblas_stride stP = 1;
+    S tol = 0;
+    rocblas_int bc = 1;
+
+    // memory allocations (all cases)
+    device_strided_batch_vector<rocblas_int> dJpvt(1, 1, 1, 1);
+    device_strided_batch_vector<T> dIpiv(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dRank(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dJpvt.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dRank.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        geqp3_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, dJpvt.data(), stJ,
+                                    dIpiv.data(), stP, tol, dRank.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        // check bad arguments
+        geqp3_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, dJpvt.data(), stJ,
+                                    dIpiv.data(), stP, tol, dRank.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void geqp3_initData(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    const double tol,
+                    const rocblas_int bc,
+                    Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // when testing the truncated factorization, make A numerically rank deficient
+            // by replacing its last columns with linear combinations of the first ones
+            if(tol > 0)
+            {
+                rocblas_int r = (min(m, n) + 1) / 2;
+                for(rocblas_int j = r; j < n; j++)
+                {
+                    for(rocblas_int i = 0; i < m; i++)
+                        hA[b][i + j * lda] = T(0.5) * hA[b][i + (j % r) * lda]
+                            + T(0.25) * hA[b][i + ((j + 1) % r) * lda];
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED,
+          typename T,
+          typename S,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh,
+          typename Vh>
+void geqp3_getError(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Ud& dJpvt,
+                    const rocblas_stride stJ,
+                    Vd& dIpiv,
+                    const rocblas_stride stP,
+                    const S tol,
+                    Ud& dRank,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hARes,
+                    Uh& hJpvt,
+                    Vh& hIpiv,
+                    Uh& hRank,
+                    double* max_err)
+{
+    rocblas_int dim = min(m, n);
+    std::vector<T> hW(n);
+    std::vector<T> hAP(size_t(lda) * n);
+    std::vector<T> hQR(size_t(lda) * n);
+
+    // input data initialization
+    geqp3_initData<true, true, T>(handle, m, n, dA, lda, stA, tol, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA, dJpvt.data(),
+                                        stJ, dIpiv.data(), stP, tol, dRank.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hJpvt.transfer_from(dJpvt));
+    CHECK_HIP_ERROR(hIpiv.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hRank.transfer_from(dRank));
+
+    // (pivot selection may differ from the reference LAPACK implementation when column norms
+    // are tied, so results are validated through the factorization residual instead)
+    // error is ||A P - Q R|| / ||A P||
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // check that jpvt is a valid permutation (count the number of incorrect entries)
+        err = 0;
+        std::vector<bool> used(n, false);
+        for(rocblas_int j = 0; j < n; ++j)
+        {
+            rocblas_int p = hJpvt[b][j];
+            EXPECT_TRUE(p >= 1 && p <= n && !used[p - 1]) << "where b = " << b << ", j = " << j;
+            if(p < 1 || p > n || used[p - 1])
+                err++;
+            else
+                used[p - 1] = true;
+        }
+        *max_err = err > *max_err ? err : *max_err;
+        if(err > 0)
+            continue;
+
+        // the number of Householder reflectors actually applied
+        rocblas_int k = dim;
+        if(tol > 0)
+        {
+            while(k > 0 && hIpiv[b][k - 1] == T(0))
+                k--;
+        }
+
+        // compute A P and Q R
+        for(rocblas_int j = 0; j < n; ++j)
+        {
+            for(rocblas_int i = 0; i < m; ++i)
+            {
+                hAP[i + j * lda] = hA[b][i + (hJpvt[b][j] - 1) * lda];
+                hQR[i + j * lda] = (i > j && j < k) ? T(0) : hARes[b][i + j * lda];
+            }
+        }
+        cpu_orm2r_unm2r(rocblas_side_left, rocblas_operation_none, m, n, k, hARes[b], lda,
+                        hIpiv[b], hQR.data(), lda, hW.data());
+
+        err = norm_error('F', m, n, lda, hAP.data(), hQR.data());
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check that the diagonal of R has non-increasing magnitude
+        S r00 = std::abs(hARes[b][0]);
+        for(rocblas_int i = 1; i < min(k, hRank[b][0]); ++i)
+        {
+            err = std::abs(hARes[b][i + i * lda]) - std::abs(hARes[b][(i - 1) + (i - 1) * lda]);
+            err = err > 0 && r00 > 0 ? err / r00 : 0;
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+
+    // also check the numerical rank
+    // (by construction, A is full rank, or has rank (min(m,n)+1)/2 when tol > 0)
+    rocblas_int rank = tol > 0 ? (dim + 1) / 2 : dim;
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hRank[b][0], rank) << "where b = " << b;
+        if(hRank[b][0] != rank)
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool STRIDED,
+          typename T,
+          typename S,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh,
+          typename Vh>
+void geqp3_getPerfData(const rocblas_handle handle,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Ud& dJpvt,
+                       const rocblas_stride stJ,
+                       Vd& dIpiv,
+                       const rocblas_stride stP,
+                       const S tol,
+                       Ud& dRank,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Uh& hJpvt,
+                       Vh& hIpiv,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    rocblas_int lwork = 2 * n + (n + 1) * 64;
+    std::vector<T> hW(lwork);
+    std::vector<S> hRW(2 * n);
+
+    if(!perf)
+    {
+        geqp3_initData<true, false, T>(handle, m, n, dA, lda, stA, tol, bc, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (all columns are free columns for the reference implementation)
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int j = 0; j < n; ++j)
+                hJpvt[b][j] = 0;
+        }
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_geqp3(m, n, hA[b], lda, hJpvt[b], hIpiv[b], hW.data(), lwork, hRW.data());
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    geqp3_initData<true, false, T>(handle, m, n, dA, lda, stA, tol, bc, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geqp3_initData<false, true, T>(handle, m, n, dA, lda, stA, tol, bc, hA);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                            dJpvt.data(), stJ, dIpiv.data(), stP, tol,
+                                            dRank.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        geqp3_initData<false, true, T>(handle, m, n, dA, lda, stA, tol, bc, hA);
+
+        start = get_time_us_sync(stream);
+        rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA, dJpvt.data(), stJ, dIpiv.data(),
+                        stP, tol, dRank.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geqp3(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stJ = argus.get<rocblas_stride>("strideJ", n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", min(m, n));
+    S tol = S(argus.get<double>("tol"));
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_J = size_t(n);
+    size_t size_P = size_t(min(m, n));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, (T* const*)nullptr, lda,
+                                                  stA, (rocblas_int*)nullptr, stJ, (T*)nullptr, stP,
+                                                  tol, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, (T*)nullptr, lda, stA,
+                                                  (rocblas_int*)nullptr, stJ, (T*)nullptr, stP, tol,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_geqp3(STRIDED, handle, m, n, (T* const*)nullptr, lda, stA,
+                                              (rocblas_int*)nullptr, stJ, (T*)nullptr, stP, tol,
+                                              (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_geqp3(STRIDED, handle, m, n, (T*)nullptr, lda, stA,
+                                              (rocblas_int*)nullptr, stJ, (T*)nullptr, stP, tol,
+                                              (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // jpvt, ipiv and rank
+    host_strided_batch_vector<rocblas_int> hJpvt(size_J, 1, stJ, bc);
+    host_strided_batch_vector<T> hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hRank(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dJpvt(size_J, 1, stJ, bc);
+    device_strided_batch_vector<T> dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dRank(1, 1, 1, bc);
+    if(size_J)
+        CHECK_HIP_ERROR(dJpvt.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dRank.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                                  dJpvt.data(), stJ, dIpiv.data(), stP, tol,
+                                                  dRank.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqp3_getError<STRIDED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, tol,
+                                       dRank, bc, hA, hARes, hJpvt, hIpiv, hRank, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geqp3_getPerfData<STRIDED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, tol,
+                                          dRank, bc, hA, hJpvt, hIpiv, &gpu_time_used,
+                                          &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                                  dJpvt.data(), stJ, dIpiv.data(), stP, tol,
+                                                  dRank.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqp3_getError<STRIDED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, tol,
+                                       dRank, bc, hA, hARes, hJpvt, hIpiv, hRank, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geqp3_getPerfData<STRIDED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, tol,
+                                          dRank, bc, hA, hJpvt, hIpiv, &gpu_time_used,
+                                          &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "strideJ", "strideP", "tol", "batch_c");
+                rocsolver_bench_output(m, n, lda, stJ, stP, tol, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "strideA", "strideJ", "strideP", "tol",
+                                       "batch_c");
+                rocsolver_bench_output(m, n, lda, stA, stJ, stP, tol, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "lda", "tol");
+                rocsolver_bench_output(m, n, lda, tol);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GEQP3(...) extern template void testing_geqp3<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GEQP3, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
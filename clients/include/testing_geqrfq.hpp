@@ -0,0 +1,463 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "client_util.hpp"
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U>
+void geqrfq_checkBadArgs(const rocblas_handle handle,
+                         const rocblas_int m,
+                         const rocblas_int n,
+                         T dA,
+                         const rocblas_int lda,
+                         const rocblas_stride stA,
+                         U dR,
+                         const rocblas_int ldr,
+                         const rocblas_stride stR,
+                         const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrfq(STRIDED, nullptr, m, n, dA, lda, stA, dR, ldr, stR, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_geqrfq(STRIDED, handle, m, n, dA, lda, stA, dR, ldr, stR, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqrfq(STRIDED, handle, m, n, (T) nullptr, lda, stA, dR, ldr, stR, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqrfq(STRIDED, handle, m, n, dA, lda, stA, (U) nullptr, ldr, stR, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqrfq(STRIDED, handle, 0, 0, (T) nullptr, lda, stA, (U) nullptr, ldr, stR, bc),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_geqrfq(STRIDED, handle, m, 0, (T) nullptr, lda, stA, (U) nullptr, ldr, stR, bc),
+        rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqrfq(STRIDED, handle, m, n, dA, lda, stA, dR, ldr, stR, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geqrfq_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldr = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stR = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<T> dR(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dR.memcheck());
+
+        // check bad arguments
+        geqrfq_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, dR.data(), ldr, stR, bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dR(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dR.memcheck());
+
+        // check bad arguments
+        geqrfq_checkBadArgs<STRIDED>(handle, m, n, dA.data(), lda, stA, dR.data(), ldr, stR, bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void geqrfq_initData(const rocblas_handle handle,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     Td& dA,
+                     const rocblas_int lda,
+                     const rocblas_stride stA,
+                     const rocblas_int bc,
+                     Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void geqrfq_getError(const rocblas_handle handle,
+                     const rocblas_int m,
+                     const rocblas_int n,
+                     Td& dA,
+                     const rocblas_int lda,
+                     const rocblas_stride stA,
+                     Ud& dR,
+                     const rocblas_int ldr,
+                     const rocblas_stride stR,
+                     const rocblas_int bc,
+                     Th& hA,
+                     Th& hARes,
+                     Uh& hR,
+                     Uh& hRRes,
+                     double* max_err)
+{
+    std::vector<T> hIpiv(n);
+    std::vector<T> hW(n * n);
+
+    // input data initialization
+    geqrfq_initData<true, true, T>(handle, m, n, dA, lda, stA, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_geqrfq(STRIDED, handle, m, n, dA.data(), lda, stA, dR.data(), ldr,
+                                         stR, bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hRRes.transfer_from(dR));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cpu_geqrf(m, n, hA[b], lda, hIpiv.data(), hW.data(), n * n);
+
+        for(rocblas_int i = 0; i < n; i++)
+            for(rocblas_int j = 0; j < n; j++)
+                hR[b][i + j * ldr] = (i <= j ? hA[b][i + j * lda] : T(0));
+
+        cpu_orgqr_ungqr(m, n, n, hA[b], lda, hIpiv.data(), hW.data(), n * n);
+    }
+
+    // error is max(||hQ - hQRes|| / ||hQ||, ||hR - hRRes|| / ||hR||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('F', m, n, lda, hA[b], hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+        err = norm_error('F', n, n, ldr, hR[b], hRRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th>
+void geqrfq_getPerfData(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        Td& dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        Ud& dR,
+                        const rocblas_int ldr,
+                        const rocblas_stride stR,
+                        const rocblas_int bc,
+                        Th& hA,
+                        double* gpu_time_used,
+                        double* cpu_time_used,
+                        const rocblas_int hot_calls,
+                        const int profile,
+                        const bool profile_kernels,
+                        const bool perf)
+{
+    std::vector<T> hIpiv(n);
+    std::vector<T> hW(n * n);
+
+    if(!perf)
+    {
+        geqrfq_initData<true, false, T>(handle, m, n, dA, lda, stA, bc, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_geqrf(m, n, hA[b], lda, hIpiv.data(), hW.data(), n * n);
+            cpu_orgqr_ungqr(m, n, n, hA[b], lda, hIpiv.data(), hW.data(), n * n);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    geqrfq_initData<true, false, T>(handle, m, n, dA, lda, stA, bc, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geqrfq_initData<false, true, T>(handle, m, n, dA, lda, stA, bc, hA);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_geqrfq(STRIDED, handle, m, n, dA.data(), lda, stA, dR.data(),
+                                             ldr, stR, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        geqrfq_initData<false, true, T>(handle, m, n, dA, lda, stA, bc, hA);
+
+        start = get_time_us_sync(stream);
+        rocsolver_geqrfq(STRIDED, handle, m, n, dA.data(), lda, stA, dR.data(), ldr, stR, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geqrfq(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldr = argus.get<rocblas_int>("ldr", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stR = argus.get<rocblas_stride>("strideR", ldr * n);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+    rocblas_stride stRRes = (argus.unit_check || argus.norm_check) ? stR : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_R = size_t(ldr) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_RRes = (argus.unit_check || argus.norm_check) ? size_R : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || n > m || lda < m || ldr < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrfq(STRIDED, handle, m, n, (T* const*)nullptr, lda,
+                                                   stA, (T*)nullptr, ldr, stR, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrfq(STRIDED, handle, m, n, (T*)nullptr, lda, stA,
+                                                   (T*)nullptr, ldr, stR, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_geqrfq(STRIDED, handle, m, n, (T* const*)nullptr, lda, stA,
+                                               (T*)nullptr, ldr, stR, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_geqrfq(STRIDED, handle, m, n, (T*)nullptr, lda, stA,
+                                               (T*)nullptr, ldr, stR, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    host_strided_batch_vector<T> hR(size_R, 1, stR, bc);
+    host_strided_batch_vector<T> hRRes(size_RRes, 1, stRRes, bc);
+    device_strided_batch_vector<T> dR(size_R, 1, stR, bc);
+    if(size_R)
+        CHECK_HIP_ERROR(dR.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrfq(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                                   dR.data(), ldr, stR, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqrfq_getError<STRIDED, T>(handle, m, n, dA, lda, stA, dR, ldr, stR, bc, hA, hARes, hR,
+                                        hRRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geqrfq_getPerfData<STRIDED, T>(handle, m, n, dA, lda, stA, dR, ldr, stR, bc, hA,
+                                           &gpu_time_used, &cpu_time_used, hot_calls,
+                                           argus.profile, argus.profile_kernels, argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqrfq(STRIDED, handle, m, n, dA.data(), lda, stA,
+                                                   dR.data(), ldr, stR, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqrfq_getError<STRIDED, T>(handle, m, n, dA, lda, stA, dR, ldr, stR, bc, hA, hARes, hR,
+                                        hRRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            geqrfq_getPerfData<STRIDED, T>(handle, m, n, dA, lda, stA, dR, ldr, stR, bc, hA,
+                                           &gpu_time_used, &cpu_time_used, hot_calls,
+                                           argus.profile, argus.profile_kernels, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "ldr", "strideR", "batch_c");
+                rocsolver_bench_output(m, n, lda, ldr, stR, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "strideA", "ldr", "strideR", "batch_c");
+                rocsolver_bench_output(m, n, lda, stA, ldr, stR, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "lda", "ldr");
+                rocsolver_bench_output(m, n, lda, ldr);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GEQRFQ(...) extern template void testing_geqrfq<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GEQRFQ, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,713 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "client_util.hpp"
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U, typename S>
+void gerfs_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_operation trans,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        T dAF,
+                        U dIpiv,
+                        const rocblas_stride stP,
+                        T dB,
+                        const rocblas_int ldb,
+                        const rocblas_stride stB,
+                        T dX,
+                        const rocblas_int ldx,
+                        const rocblas_stride stX,
+                        S dFerr,
+                        S dBerr,
+                        const rocblas_stride stE,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gerfs(STRIDED, nullptr, trans, n, nrhs, dA, lda, stA, dAF, lda, stA, dIpiv, stP,
+                        dB, ldb, stB, dX, ldx, stX, dFerr, dBerr, stE, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gerfs(STRIDED, handle, rocblas_operation(0), n, nrhs, dA, lda, stA, dAF, lda, stA,
+                        dIpiv, stP, dB, ldb, stB, dX, ldx, stX, dFerr, dBerr, stE, bc),
+        rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, lda, stA, dIpiv,
+                            stP, dB, ldb, stB, dX, ldx, stX, dFerr, dBerr, stE, -1),
+            rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, (T) nullptr, lda, stA, dAF, lda, stA,
+                        dIpiv, stP, dB, ldb, stB, dX, ldx, stX, dFerr, dBerr, stE, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, dA, lda, stA, (T) nullptr, lda, stA, dIpiv,
+                        stP, dB, ldb, stB, dX, ldx, stX, dFerr, dBerr, stE, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, lda, stA, (U) nullptr,
+                        stP, dB, ldb, stB, dX, ldx, stX, dFerr, dBerr, stE, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, lda, stA, dIpiv, stP,
+                        (T) nullptr, ldb, stB, dX, ldx, stX, dFerr, dBerr, stE, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, lda, stA, dIpiv, stP,
+                        dB, ldb, stB, (T) nullptr, ldx, stX, dFerr, dBerr, stE, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, lda, stA, dIpiv, stP,
+                        dB, ldb, stB, dX, ldx, stX, (S) nullptr, dBerr, stE, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, lda, stA, dIpiv, stP,
+                        dB, ldb, stB, dX, ldx, stX, dFerr, (S) nullptr, stE, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gerfs(STRIDED, handle, trans, 0, nrhs, (T) nullptr, lda, stA, (T) nullptr, lda,
+                        stA, (U) nullptr, stP, (T) nullptr, ldb, stB, (T) nullptr, ldx, stX, dFerr,
+                        dBerr, stE, bc),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_gerfs(STRIDED, handle, trans, n, 0, dA, lda, stA, dAF, lda, stA, dIpiv, stP,
+                        (T) nullptr, ldb, stB, (T) nullptr, ldx, stX, (S) nullptr, (S) nullptr, stE,
+                        bc),
+        rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, dA, lda, stA, dAF, lda, stA, dIpiv,
+                            stP, dB, ldb, stB, dX, ldx, stX, (S) nullptr, (S) nullptr, stE, 0),
+            rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gerfs_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_int ldx = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stP = 1;
+    rocblas_stride stB = 1;
+    rocblas_stride stX = 1;
+    rocblas_stride stE = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dAF(1, 1, 1);
+        device_batch_vector<T> dB(1, 1, 1);
+        device_batch_vector<T> dX(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<S> dFerr(1, 1, 1, 1);
+        device_strided_batch_vector<S> dBerr(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dAF.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dFerr.memcheck());
+        CHECK_HIP_ERROR(dBerr.memcheck());
+
+        // check bad arguments
+        gerfs_checkBadArgs<STRIDED>(handle, trans, n, nrhs, dA.data(), lda, stA, dAF.data(),
+                                    dIpiv.data(), stP, dB.data(), ldb, stB, dX.data(), ldx, stX,
+                                    dFerr.data(), dBerr.data(), stE, bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dAF(1, 1, 1, 1);
+        device_strided_batch_vector<T> dB(1, 1, 1, 1);
+        device_strided_batch_vector<T> dX(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<S> dFerr(1, 1, 1, 1);
+        device_strided_batch_vector<S> dBerr(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dAF.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dFerr.memcheck());
+        CHECK_HIP_ERROR(dBerr.memcheck());
+
+        // check bad arguments
+        gerfs_checkBadArgs<STRIDED>(handle, trans, n, nrhs, dA.data(), lda, stA, dAF.data(),
+                                    dIpiv.data(), stP, dB.data(), ldb, stB, dX.data(), ldx, stX,
+                                    dFerr.data(), dBerr.data(), stE, bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gerfs_initData(const rocblas_handle handle,
+                    const rocblas_operation trans,
+                    const rocblas_int n,
+                    const rocblas_int nrhs,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Td& dAF,
+                    Ud& dIpiv,
+                    const rocblas_stride stP,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_stride stB,
+                    Td& dX,
+                    const rocblas_int ldx,
+                    const rocblas_stride stX,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hAF,
+                    Uh& hIpiv,
+                    Th& hB,
+                    Th& hX)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+        int info;
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // do the LU decomposition of a copy of matrix A, and solve the system,
+            // w/ the reference LAPACK routines
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                    hAF[b][i + j * lda] = hA[b][i + j * lda];
+            }
+            cpu_getrf(n, n, hAF[b], lda, hIpiv[b], &info);
+
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < nrhs; j++)
+                    hX[b][i + j * ldx] = hB[b][i + j * ldb];
+            }
+            cpu_getrs(trans, n, nrhs, hAF[b], lda, hIpiv[b], hX[b], ldx);
+
+            // perturb the solution so that it needs to be refined
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < nrhs; j++)
+                    hX[b][i + j * ldx] *= T(1.001);
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy pivoting indices and matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dAF.transfer_from(hAF));
+        CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dX.transfer_from(hX));
+    }
+}
+
+template <bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Sd,
+          typename Th,
+          typename Uh,
+          typename Sh>
+void gerfs_getError(const rocblas_handle handle,
+                    const rocblas_operation trans,
+                    const rocblas_int n,
+                    const rocblas_int nrhs,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Td& dAF,
+                    Ud& dIpiv,
+                    const rocblas_stride stP,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_stride stB,
+                    Td& dX,
+                    const rocblas_int ldx,
+                    const rocblas_stride stX,
+                    Sd& dFerr,
+                    Sd& dBerr,
+                    const rocblas_stride stE,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hAF,
+                    Uh& hIpiv,
+                    Th& hB,
+                    Th& hX,
+                    Th& hXRes,
+                    Sh& hFerr,
+                    Sh& hBerr,
+                    Sh& hBerrRes,
+                    double* max_err)
+{
+    using S = decltype(std::real(T{}));
+
+    std::vector<T> work(3 * n);
+    std::vector<S> rwork(n);
+    std::vector<rocblas_int> iwork(n);
+    rocblas_int info;
+
+    // input data initialization
+    gerfs_initData<true, true, T>(handle, trans, n, nrhs, dA, lda, stA, dAF, dIpiv, stP, dB, ldb,
+                                  stB, dX, ldx, stX, bc, hA, hAF, hIpiv, hB, hX);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, dA.data(), lda, stA, dAF.data(), lda, stA,
+                        dIpiv.data(), stP, dB.data(), ldb, stB, dX.data(), ldx, stX, dFerr.data(),
+                        dBerr.data(), stE, bc));
+    CHECK_HIP_ERROR(hXRes.transfer_from(dX));
+    CHECK_HIP_ERROR(hBerrRes.transfer_from(dBerr));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cpu_gerfs(trans, n, nrhs, hA[b], lda, hAF[b], lda, hIpiv[b], hB[b], ldb, hX[b], ldx,
+                  hFerr[b], hBerr[b], work.data(), rwork.data(), iwork.data(), &info);
+    }
+
+    // error is ||hX - hXRes|| / ||hX||, combined with the backward errors computed on the GPU
+    // (the forward error bounds are estimates, and are not compared)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        err = norm_error('I', n, nrhs, ldx, hX[b], hXRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        for(rocblas_int j = 0; j < nrhs; j++)
+        {
+            err = double(hBerrRes[b][j]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool STRIDED,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Sd,
+          typename Th,
+          typename Uh,
+          typename Sh>
+void gerfs_getPerfData(const rocblas_handle handle,
+                       const rocblas_operation trans,
+                       const rocblas_int n,
+                       const rocblas_int nrhs,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Td& dAF,
+                       Ud& dIpiv,
+                       const rocblas_stride stP,
+                       Td& dB,
+                       const rocblas_int ldb,
+                       const rocblas_stride stB,
+                       Td& dX,
+                       const rocblas_int ldx,
+                       const rocblas_stride stX,
+                       Sd& dFerr,
+                       Sd& dBerr,
+                       const rocblas_stride stE,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Th& hAF,
+                       Uh& hIpiv,
+                       Th& hB,
+                       Th& hX,
+                       Sh& hFerr,
+                       Sh& hBerr,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    using S = decltype(std::real(T{}));
+
+    std::vector<T> work(3 * n);
+    std::vector<S> rwork(n);
+    std::vector<rocblas_int> iwork(n);
+    rocblas_int info;
+
+    if(!perf)
+    {
+        gerfs_initData<true, false, T>(handle, trans, n, nrhs, dA, lda, stA, dAF, dIpiv, stP, dB,
+                                       ldb, stB, dX, ldx, stX, bc, hA, hAF, hIpiv, hB, hX);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_gerfs(trans, n, nrhs, hA[b], lda, hAF[b], lda, hIpiv[b], hB[b], ldb, hX[b], ldx,
+                      hFerr[b], hBerr[b], work.data(), rwork.data(), iwork.data(), &info);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gerfs_initData<true, false, T>(handle, trans, n, nrhs, dA, lda, stA, dAF, dIpiv, stP, dB, ldb,
+                                   stB, dX, ldx, stX, bc, hA, hAF, hIpiv, hB, hX);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gerfs_initData<false, true, T>(handle, trans, n, nrhs, dA, lda, stA, dAF, dIpiv, stP, dB,
+                                       ldb, stB, dX, ldx, stX, bc, hA, hAF, hIpiv, hB, hX);
+
+        CHECK_ROCBLAS_ERROR(
+            rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, dA.data(), lda, stA, dAF.data(), lda,
+                            stA, dIpiv.data(), stP, dB.data(), ldb, stB, dX.data(), ldx, stX,
+                            dFerr.data(), dBerr.data(), stE, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gerfs_initData<false, true, T>(handle, trans, n, nrhs, dA, lda, stA, dAF, dIpiv, stP, dB,
+                                       ldb, stB, dX, ldx, stX, bc, hA, hAF, hIpiv, hB, hX);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, dA.data(), lda, stA, dAF.data(), lda, stA,
+                        dIpiv.data(), stP, dB.data(), ldb, stB, dX.data(), ldx, stX, dFerr.data(),
+                        dBerr.data(), stE, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gerfs(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char transC = argus.get<char>("trans");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+    rocblas_int ldx = argus.get<rocblas_int>("ldx", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", n);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * nrhs);
+    rocblas_stride stX = argus.get<rocblas_stride>("strideX", ldx * nrhs);
+    rocblas_stride stE = argus.get<rocblas_stride>("strideE", nrhs);
+
+    rocblas_operation trans = char2rocblas_operation(transC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stXRes = (argus.unit_check || argus.norm_check) ? stX : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    // (matrices A and AF share the same leading dimension and stride)
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    size_t size_X = size_t(ldx) * nrhs;
+    size_t size_P = size_t(n);
+    size_t size_E = size_t(nrhs);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_XRes = (argus.unit_check || argus.norm_check) ? size_X : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n || ldx < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, (T* const*)nullptr, lda, stA,
+                                (T* const*)nullptr, lda, stA, (rocblas_int*)nullptr, stP,
+                                (T* const*)nullptr, ldb, stB, (T* const*)nullptr, ldx, stX,
+                                (S*)nullptr, (S*)nullptr, stE, bc),
+                rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, (T*)nullptr, lda, stA, (T*)nullptr,
+                                lda, stA, (rocblas_int*)nullptr, stP, (T*)nullptr, ldb, stB,
+                                (T*)nullptr, ldx, stX, (S*)nullptr, (S*)nullptr, stE, bc),
+                rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(
+                rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, (T* const*)nullptr, lda, stA,
+                                (T* const*)nullptr, lda, stA, (rocblas_int*)nullptr, stP,
+                                (T* const*)nullptr, ldb, stB, (T* const*)nullptr, ldx, stX,
+                                (S*)nullptr, (S*)nullptr, stE, bc));
+        else
+            CHECK_ALLOC_QUERY(
+                rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, (T*)nullptr, lda, stA, (T*)nullptr,
+                                lda, stA, (rocblas_int*)nullptr, stP, (T*)nullptr, ldb, stB,
+                                (T*)nullptr, ldx, stX, (S*)nullptr, (S*)nullptr, stE, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // pivots and error bounds
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<S> hFerr(size_E, 1, stE, bc);
+    host_strided_batch_vector<S> hBerr(size_E, 1, stE, bc);
+    host_strided_batch_vector<S> hBerrRes(size_E, 1, stE, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<S> dFerr(size_E, 1, stE, bc);
+    device_strided_batch_vector<S> dBerr(size_E, 1, stE, bc);
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    if(size_E)
+    {
+        CHECK_HIP_ERROR(dFerr.memcheck());
+        CHECK_HIP_ERROR(dBerr.memcheck());
+    }
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hAF(size_A, 1, bc);
+        host_batch_vector<T> hB(size_B, 1, bc);
+        host_batch_vector<T> hX(size_X, 1, bc);
+        host_batch_vector<T> hXRes(size_XRes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dAF(size_A, 1, bc);
+        device_batch_vector<T> dB(size_B, 1, bc);
+        device_batch_vector<T> dX(size_X, 1, bc);
+        if(size_A)
+        {
+            CHECK_HIP_ERROR(dA.memcheck());
+            CHECK_HIP_ERROR(dAF.memcheck());
+        }
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+
+        // check quick return
+        if(n == 0 || nrhs == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, dA.data(), lda, stA, dAF.data(),
+                                lda, stA, dIpiv.data(), stP, dB.data(), ldb, stB, dX.data(), ldx,
+                                stX, dFerr.data(), dBerr.data(), stE, bc),
+                rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gerfs_getError<STRIDED, T>(handle, trans, n, nrhs, dA, lda, stA, dAF, dIpiv, stP, dB,
+                                       ldb, stB, dX, ldx, stX, dFerr, dBerr, stE, bc, hA, hAF,
+                                       hIpiv, hB, hX, hXRes, hFerr, hBerr, hBerrRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gerfs_getPerfData<STRIDED, T>(handle, trans, n, nrhs, dA, lda, stA, dAF, dIpiv, stP, dB,
+                                          ldb, stB, dX, ldx, stX, dFerr, dBerr, stE, bc, hA, hAF,
+                                          hIpiv, hB, hX, hFerr, hBerr, &gpu_time_used,
+                                          &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hAF(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+        host_strided_batch_vector<T> hX(size_X, 1, stX, bc);
+        host_strided_batch_vector<T> hXRes(size_XRes, 1, stXRes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dAF(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+        device_strided_batch_vector<T> dX(size_X, 1, stX, bc);
+        if(size_A)
+        {
+            CHECK_HIP_ERROR(dA.memcheck());
+            CHECK_HIP_ERROR(dAF.memcheck());
+        }
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+
+        // check quick return
+        if(n == 0 || nrhs == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(
+                rocsolver_gerfs(STRIDED, handle, trans, n, nrhs, dA.data(), lda, stA, dAF.data(),
+                                lda, stA, dIpiv.data(), stP, dB.data(), ldb, stB, dX.data(), ldx,
+                                stX, dFerr.data(), dBerr.data(), stE, bc),
+                rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gerfs_getError<STRIDED, T>(handle, trans, n, nrhs, dA, lda, stA, dAF, dIpiv, stP, dB,
+                                       ldb, stB, dX, ldx, stX, dFerr, dBerr, stE, bc, hA, hAF,
+                                       hIpiv, hB, hX, hXRes, hFerr, hBerr, hBerrRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            gerfs_getPerfData<STRIDED, T>(handle, trans, n, nrhs, dA, lda, stA, dAF, dIpiv, stP, dB,
+                                          ldb, stB, dX, ldx, stX, dFerr, dBerr, stE, bc, hA, hAF,
+                                          hIpiv, hB, hX, hFerr, hBerr, &gpu_time_used,
+                                          &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("trans", "n", "nrhs", "lda", "ldb", "ldx", "strideP",
+                                       "strideE", "batch_c");
+                rocsolver_bench_output(transC, n, nrhs, lda, ldb, ldx, stP, stE, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("trans", "n", "nrhs", "lda", "ldb", "ldx", "strideA",
+                                       "strideP", "strideB", "strideX", "strideE", "batch_c");
+                rocsolver_bench_output(transC, n, nrhs, lda, ldb, ldx, stA, stP, stB, stX, stE, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("trans", "n", "nrhs", "lda", "ldb", "ldx");
+                rocsolver_bench_output(transC, n, nrhs, lda, ldb, ldx);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GERFS(...) extern template void testing_gerfs<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GERFS, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,642 @@
+/* ************************************************************************
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "client_util.hpp"
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename TT, typename W, typename U>
+void gesdd_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_svect svect,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        W dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        TT dS,
+                        const rocblas_stride stS,
+                        T dU,
+                        const rocblas_int ldu,
+                        const rocblas_stride stU,
+                        T dV,
+                        const rocblas_int ldv,
+                        const rocblas_stride stV,
+                        U dinfo,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, nullptr, svect, m, n, dA, lda, stA, dS, stS, dU,
+                                          ldu, stU, dV, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, rocblas_svect(0), m, n, dA, lda, stA,
+                                          dS, stS, dU, ldu, stU, dV, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, rocblas_svect_overwrite, m, n, dA, lda,
+                                          stA, dS, stS, dU, ldu, stU, dV, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, n, dA, lda, stA, dS, stS,
+                                              dU, ldu, stU, dV, ldv, stV, dinfo, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, n, (W) nullptr, lda, stA, dS,
+                                          stS, dU, ldu, stU, dV, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, n, dA, lda, stA, (TT) nullptr,
+                                          stS, dU, ldu, stU, dV, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, n, dA, lda, stA, dS, stS,
+                                          (T) nullptr, ldu, stU, dV, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, n, dA, lda, stA, dS, stS, dU,
+                                          ldu, stU, (T) nullptr, ldv, stV, dinfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, n, dA, lda, stA, dS, stS, dU,
+                                          ldu, stU, dV, ldv, stV, (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, 0, n, (W) nullptr, lda, stA,
+                                          (TT) nullptr, stS, (T) nullptr, ldu, stU, dV, ldv, stV,
+                                          dinfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, 0, (W) nullptr, lda, stA,
+                                          (TT) nullptr, stS, dU, ldu, stU, (T) nullptr, ldv, stV,
+                                          dinfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, n, dA, lda, stA, dS, stS,
+                                              dU, ldu, stU, dV, ldv, stV, (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gesdd_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_svect svect = rocblas_svect_all;
+    rocblas_int m = 2;
+    rocblas_int n = 2;
+    rocblas_int lda = 2;
+    rocblas_int ldu = 2;
+    rocblas_int ldv = 2;
+    rocblas_stride stA = 2;
+    rocblas_stride stS = 2;
+    rocblas_stride stU = 2;
+    rocblas_stride stV = 2;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<S> dS(1, 1, 1, 1);
+        device_strided_batch_vector<T> dU(1, 1, 1, 1);
+        device_strided_batch_vector<T> dV(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dS.memcheck());
+        CHECK_HIP_ERROR(dU.memcheck());
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        gesdd_checkBadArgs<STRIDED>(handle, svect, m, n, dA.data(), lda, stA, dS.data(), stS,
+                                    dU.data(), ldu, stU, dV.data(), ldv, stV, dinfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<S> dS(1, 1, 1, 1);
+        device_strided_batch_vector<T> dU(1, 1, 1, 1);
+        device_strided_batch_vector<T> dV(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dS.memcheck());
+        CHECK_HIP_ERROR(dU.memcheck());
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        // check bad arguments
+        gesdd_checkBadArgs<STRIDED>(handle, svect, m, n, dA.data(), lda, stA, dS.data(), stS,
+                                    dU.data(), ldu, stU, dV.data(), ldv, stV, dinfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gesdd_initData(const rocblas_handle handle,
+                    const rocblas_svect svect,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_int bc,
+                    Th& hA,
+                    std::vector<T>& A,
+                    bool test = true)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // make copy of original data to test vectors if required
+            if(test && svect != rocblas_svect_none)
+            {
+                for(rocblas_int i = 0; i < m; i++)
+                {
+                    for(rocblas_int j = 0; j < n; j++)
+                        A[b * lda * n + i + j * lda] = hA[b][i + j * lda];
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED, typename T, typename Wd, typename Td, typename Ud, typename Id, typename Wh, typename Th, typename Uh, typename Ih>
+void gesdd_getError(const rocblas_handle handle,
+                    const rocblas_svect svect,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Wd& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Td& dS,
+                    const rocblas_stride stS,
+                    Ud& dU,
+                    const rocblas_int ldu,
+                    const rocblas_stride stU,
+                    Ud& dV,
+                    const rocblas_int ldv,
+                    const rocblas_stride stV,
+                    Id& dinfo,
+                    const rocblas_int bc,
+                    Wh& hA,
+                    Th& hS,
+                    Th& hSres,
+                    Uh& hU,
+                    Uh& Ures,
+                    Uh& hV,
+                    Uh& Vres,
+                    Ih& hinfo,
+                    Ih& hinfoRes,
+                    double* max_err,
+                    double* max_errv)
+{
+    using W = decltype(std::real(T{}));
+
+    rocblas_int lwork = 5 * max(m, n);
+    rocblas_int lrwork = (rocblas_is_complex<T> ? 5 * min(m, n) : 0);
+    std::vector<T> work(lwork);
+    std::vector<W> rwork(lrwork);
+    std::vector<T> A(lda * n * bc);
+
+    // input data initialization
+    gesdd_initData<true, true, T>(handle, svect, m, n, dA, lda, bc, hA, A);
+
+    // execute computations
+    // CPU lapack
+    // (the singular values are computed with gesvd)
+    for(rocblas_int b = 0; b < bc; ++b)
+        cpu_gesvd(rocblas_svect_none, rocblas_svect_none, m, n, hA[b], lda, hS[b], hU[b], ldu,
+                  hV[b], ldv, work.data(), lwork, rwork.data(), hinfo[b]);
+
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gesdd(STRIDED, handle, svect, m, n, dA.data(), lda, stA,
+                                        dS.data(), stS, dU.data(), ldu, stU, dV.data(), ldv, stV,
+                                        dinfo.data(), bc));
+
+    CHECK_HIP_ERROR(hSres.transfer_from(dS));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+    if(svect != rocblas_svect_none)
+    {
+        CHECK_HIP_ERROR(Ures.transfer_from(dU));
+        CHECK_HIP_ERROR(Vres.transfer_from(dV));
+    }
+
+    // Check info for non-convergence
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hinfo[b][0], hinfoRes[b][0]) << "where b = " << b;
+        if(hinfo[b][0] != hinfoRes[b][0])
+            *max_err += 1;
+    }
+
+    double err;
+    *max_errv = 0;
+
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // error is ||hS - hSres||
+        err = norm_error('F', 1, min(m, n), 1, hS[b], hSres[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // Check the singular vectors if required
+        if(hinfo[b][0] == 0 && svect != rocblas_svect_none)
+        {
+            err = 0;
+            // check singular vectors implicitly (A*v_k = s_k*u_k)
+            for(rocblas_int k = 0; k < min(m, n); ++k)
+            {
+                for(rocblas_int i = 0; i < m; ++i)
+                {
+                    T tmp = 0;
+                    for(rocblas_int j = 0; j < n; ++j)
+                        tmp += A[b * lda * n + i + j * lda] * sconj(Vres[b][k + j * ldv]);
+                    tmp -= hSres[b][k] * Ures[b][i + k * ldu];
+                    err += std::abs(tmp) * std::abs(tmp);
+                }
+            }
+            err = std::sqrt(err) / double(snorm('F', m, n, A.data() + b * lda * n, lda));
+            *max_errv = err > *max_errv ? err : *max_errv;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename Wd, typename Td, typename Ud, typename Id, typename Wh, typename Th, typename Uh, typename Ih>
+void gesdd_getPerfData(const rocblas_handle handle,
+                       const rocblas_svect svect,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       Wd& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Td& dS,
+                       const rocblas_stride stS,
+                       Ud& dU,
+                       const rocblas_int ldu,
+                       const rocblas_stride stU,
+                       Ud& dV,
+                       const rocblas_int ldv,
+                       const rocblas_stride stV,
+                       Id& dinfo,
+                       const rocblas_int bc,
+                       Wh& hA,
+                       Th& hS,
+                       Uh& hU,
+                       Uh& hV,
+                       Ih& hinfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    using W = decltype(std::real(T{}));
+
+    rocblas_int lwork = 5 * max(m, n);
+    rocblas_int lrwork = (rocblas_is_complex<T> ? 5 * min(m, n) : 0);
+    std::vector<T> work(lwork);
+    std::vector<W> rwork(lrwork);
+    std::vector<T> A;
+
+    if(!perf)
+    {
+        gesdd_initData<true, false, T>(handle, svect, m, n, dA, lda, bc, hA, A, 0);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (the SVD is computed with gesvd)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+            cpu_gesvd(svect, svect, m, n, hA[b], lda, hS[b], hU[b], ldu, hV[b], ldv, work.data(),
+                      lwork, rwork.data(), hinfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gesdd_initData<true, false, T>(handle, svect, m, n, dA, lda, bc, hA, A, 0);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gesdd_initData<false, true, T>(handle, svect, m, n, dA, lda, bc, hA, A, 0);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gesdd(STRIDED, handle, svect, m, n, dA.data(), lda, stA,
+                                            dS.data(), stS, dU.data(), ldu, stU, dV.data(), ldv,
+                                            stV, dinfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gesdd_initData<false, true, T>(handle, svect, m, n, dA, lda, bc, hA, A, 0);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gesdd(STRIDED, handle, svect, m, n, dA.data(), lda, stA, dS.data(), stS,
+                        dU.data(), ldu, stU, dV.data(), ldv, stV, dinfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gesdd(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    char svectC = argus.get<char>("svect");
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldu = argus.get<rocblas_int>("ldu", m);
+    rocblas_int ldv = argus.get<rocblas_int>("ldv", (svectC == 'A' ? n : min(m, n)));
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stS = argus.get<rocblas_stride>("strideS", min(m, n));
+    rocblas_stride stU = argus.get<rocblas_stride>("strideU", ldu * m);
+    rocblas_stride stV = argus.get<rocblas_stride>("strideV", ldv * n);
+
+    rocblas_svect svect = char2rocblas_svect(svectC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(svect == rocblas_svect_overwrite)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, n, (T* const*)nullptr,
+                                                  lda, stA, (S*)nullptr, stS, (T*)nullptr, ldu, stU,
+                                                  (T*)nullptr, ldv, stV, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, n, (T*)nullptr, lda,
+                                                  stA, (S*)nullptr, stS, (T*)nullptr, ldu, stU,
+                                                  (T*)nullptr, ldv, stV, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    bool svects = (svect != rocblas_svect_none);
+    size_t size_A = size_t(lda) * n;
+    size_t size_S = size_t(min(m, n));
+    size_t size_V = size_t(ldv) * n;
+    size_t size_U = size_t(ldu) * m;
+    size_t size_Sres = (argus.unit_check || argus.norm_check) ? size_S : 0;
+    size_t size_Ures = (argus.unit_check || argus.norm_check) && svects ? size_U : 0;
+    size_t size_Vres = (argus.unit_check || argus.norm_check) && svects ? size_V : 0;
+
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0, max_errorv = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || m < 0 || lda < m || ldu < 1 || ldv < 1 || bc < 0)
+        || (svects && ldu < m) || (svect == rocblas_svect_all && ldv < n)
+        || (svect == rocblas_svect_singular && ldv < min(m, n));
+
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, n, (T* const*)nullptr,
+                                                  lda, stA, (S*)nullptr, stS, (T*)nullptr, ldu, stU,
+                                                  (T*)nullptr, ldv, stV, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, n, (T*)nullptr, lda,
+                                                  stA, (S*)nullptr, stS, (T*)nullptr, ldu, stU,
+                                                  (T*)nullptr, ldv, stV, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_gesdd(STRIDED, handle, svect, m, n, (T* const*)nullptr, lda,
+                                              stA, (S*)nullptr, stS, (T*)nullptr, ldu, stU,
+                                              (T*)nullptr, ldv, stV, (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_gesdd(STRIDED, handle, svect, m, n, (T*)nullptr, lda, stA,
+                                              (S*)nullptr, stS, (T*)nullptr, ldu, stU, (T*)nullptr,
+                                              ldv, stV, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<S> hS(size_S, 1, stS, bc);
+    host_strided_batch_vector<T> hV(size_V, 1, stV, bc);
+    host_strided_batch_vector<T> hU(size_U, 1, stU, bc);
+    host_strided_batch_vector<rocblas_int> hinfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hinfoRes(1, 1, 1, bc);
+    host_strided_batch_vector<S> hSres(size_Sres, 1, stS, bc);
+    host_strided_batch_vector<T> Vres(size_Vres, 1, stV, bc);
+    host_strided_batch_vector<T> Ures(size_Ures, 1, stU, bc);
+    // device
+    device_strided_batch_vector<S> dS(size_S, 1, stS, bc);
+    device_strided_batch_vector<T> dV(size_V, 1, stV, bc);
+    device_strided_batch_vector<T> dU(size_U, 1, stU, bc);
+    device_strided_batch_vector<rocblas_int> dinfo(1, 1, 1, bc);
+    if(size_S)
+        CHECK_HIP_ERROR(dS.memcheck());
+    if(size_V)
+        CHECK_HIP_ERROR(dV.memcheck());
+    if(size_U)
+        CHECK_HIP_ERROR(dU.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || m == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, n, dA.data(), lda, stA,
+                                                  dS.data(), stS, dU.data(), ldu, stU, dV.data(),
+                                                  ldv, stV, dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gesdd_getError<STRIDED, T>(handle, svect, m, n, dA, lda, stA, dS, stS, dU, ldu, stU, dV,
+                                       ldv, stV, dinfo, bc, hA, hS, hSres, hU, Ures, hV, Vres,
+                                       hinfo, hinfoRes, &max_error, &max_errorv);
+
+        // collect performance data
+        if(argus.timing)
+            gesdd_getPerfData<STRIDED, T>(handle, svect, m, n, dA, lda, stA, dS, stS, dU, ldu, stU,
+                                          dV, ldv, stV, dinfo, bc, hA, hS, hU, hV, hinfo,
+                                          &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || m == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gesdd(STRIDED, handle, svect, m, n, dA.data(), lda, stA,
+                                                  dS.data(), stS, dU.data(), ldu, stU, dV.data(),
+                                                  ldv, stV, dinfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gesdd_getError<STRIDED, T>(handle, svect, m, n, dA, lda, stA, dS, stS, dU, ldu, stU, dV,
+                                       ldv, stV, dinfo, bc, hA, hS, hSres, hU, Ures, hV, Vres,
+                                       hinfo, hinfoRes, &max_error, &max_errorv);
+
+        // collect performance data
+        if(argus.timing)
+            gesdd_getPerfData<STRIDED, T>(handle, svect, m, n, dA, lda, stA, dS, stS, dU, ldu, stU,
+                                          dV, ldv, stV, dinfo, bc, hA, hS, hU, hV, hinfo,
+                                          &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using 2 * min(m, n) * machine_precision as tolerance
+    if(argus.unit_check)
+    {
+        ROCSOLVER_TEST_CHECK(T, max_error, 2 * min(m, n));
+        if(svects)
+            ROCSOLVER_TEST_CHECK(T, max_errorv, 2 * min(m, n));
+    }
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(svects)
+            max_error = (max_error >= max_errorv) ? max_error : max_errorv;
+
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("svect", "m", "n", "lda", "strideS", "ldu", "strideU", "ldv",
+                                       "strideV", "batch_c");
+                rocsolver_bench_output(svectC, m, n, lda, stS, ldu, stU, ldv, stV, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("svect", "m", "n", "lda", "strideA", "strideS", "ldu",
+                                       "strideU", "ldv", "strideV", "batch_c");
+                rocsolver_bench_output(svectC, m, n, lda, stA, stS, ldu, stU, ldv, stV, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("svect", "m", "n", "lda", "ldu", "ldv");
+                rocsolver_bench_output(svectC, m, n, lda, ldu, ldv);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GESDD(...) extern template void testing_gesdd<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GESDD, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
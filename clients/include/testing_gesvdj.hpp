@@ -390,6 +390,53 @@ void gesvdj_getError(const rocblas_handle handle,
             }
             err = std::sqrt(err) / double(snorm('F', m, n, A.data() + b * lda * n, lda));
             *max_errv = err > *max_errv ? err : *max_errv;
+
+            // check the residual against the off-diagonal norm of Vk'A'AVk (resp. Uk'AA'Uk),
+            // where Vk (resp. Uk) holds the computed right (resp. left) singular vectors
+            rocblas_int kk = min(m, n);
+            rocblas_int rows = max(m, n);
+            std::vector<T> W(rows * kk);
+            for(rocblas_int l = 0; l < kk; ++l)
+            {
+                if(m >= n)
+                {
+                    for(rocblas_int i = 0; i < m; ++i)
+                    {
+                        T tmp = 0;
+                        for(rocblas_int j = 0; j < n; ++j)
+                            tmp += A[b * lda * n + i + j * lda] * sconj(Vres[b][l + j * ldvres]);
+                        W[i + l * rows] = tmp;
+                    }
+                }
+                else
+                {
+                    for(rocblas_int j = 0; j < n; ++j)
+                    {
+                        T tmp = 0;
+                        for(rocblas_int i = 0; i < m; ++i)
+                            tmp += sconj(A[b * lda * n + i + j * lda]) * Ures[b][i + l * ldures];
+                        W[j + l * rows] = tmp;
+                    }
+                }
+            }
+
+            double off = 0, nrm = 0;
+            for(rocblas_int l = 0; l < kk; ++l)
+            {
+                nrm += std::pow(double(hS[b][l]), 4);
+                for(rocblas_int p = 0; p < kk; ++p)
+                {
+                    if(p == l)
+                        continue;
+                    T tmp = 0;
+                    for(rocblas_int i = 0; i < rows; ++i)
+                        tmp += sconj(W[i + l * rows]) * W[i + p * rows];
+                    off += double(std::abs(tmp)) * double(std::abs(tmp));
+                }
+            }
+            err = std::abs(double(hResidualRes[b][0]) - std::sqrt(off))
+                / (rows * std::sqrt(nrm));
+            *max_err = err > *max_err ? err : *max_err;
         }
     }
 }
@@ -0,0 +1,673 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "client_util.hpp"
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool BATCHED, bool STRIDED, typename U>
+void ggglm_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int n,
+                        const rocblas_int m,
+                        const rocblas_int p,
+                        U dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        U dB,
+                        const rocblas_int ldb,
+                        const rocblas_stride stB,
+                        U dD,
+                        const rocblas_stride stD,
+                        U dX,
+                        const rocblas_stride stX,
+                        U dY,
+                        const rocblas_stride stY,
+                        rocblas_int* info,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, nullptr, n, m, p, dA, lda, stA, dB, ldb, stB,
+                                          dD, stD, dX, stX, dY, stY, info, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, m, p, dA, lda, stA, dB, ldb, stB,
+                                              dD, stD, dX, stX, dY, stY, info, -1),
+                              rocblas_status_invalid_size)
+            << "Must report error when batch size is negative";
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, m, p, (U) nullptr, lda, stA, dB, ldb,
+                                          stB, dD, stD, dX, stX, dY, stY, info, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when A is null";
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, m, p, dA, lda, stA, (U) nullptr, ldb,
+                                          stB, dD, stD, dX, stX, dY, stY, info, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when B is null";
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, m, p, dA, lda, stA, dB, ldb, stB,
+                                          (U) nullptr, stD, dX, stX, dY, stY, info, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when D is null";
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, m, p, dA, lda, stA, dB, ldb, stB,
+                                          dD, stD, (U) nullptr, stX, dY, stY, info, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when X is null";
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, m, p, dA, lda, stA, dB, ldb, stB,
+                                          dD, stD, dX, stX, (U) nullptr, stY, info, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when Y is null";
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, m, p, dA, lda, stA, dB, ldb, stB,
+                                          dD, stD, dX, stX, dY, stY, nullptr, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when info is null";
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, 0, 0, p, (U) nullptr, lda, stA,
+                                          (U) nullptr, ldb, stB, (U) nullptr, stD, (U) nullptr, stX,
+                                          dY, stY, info, bc),
+                          rocblas_status_success)
+        << "Matrices A and B may be null when n is 0 (empty matrix)";
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, 0, p, (U) nullptr, lda, stA, dB, ldb,
+                                          stB, dD, stD, (U) nullptr, stX, dY, stY, info, bc),
+                          rocblas_status_success)
+        << "Matrix A and vector X may be null when m is 0 (empty matrix)";
+    if(BATCHED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, m, p, dA, lda, stA, dB, ldb, stB,
+                                              dD, stD, dX, stX, dY, stY, nullptr, 0),
+                              rocblas_status_success)
+            << "Info may be null when batch size is 0";
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, m, p, dA, lda, stA, dB, ldb, stB,
+                                              dD, stD, dX, stX, dY, stY, info, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_ggglm_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int p = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stB = 1;
+    rocblas_stride stD = 1;
+    rocblas_stride stX = 1;
+    rocblas_stride stY = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dB(1, 1, 1);
+        device_batch_vector<T> dD(1, 1, 1);
+        device_batch_vector<T> dX(1, 1, 1);
+        device_batch_vector<T> dY(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dY.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        ggglm_checkBadArgs<BATCHED, STRIDED>(handle, n, m, p, dA.data(), lda, stA, dB.data(), ldb,
+                                             stB, dD.data(), stD, dX.data(), stX, dY.data(), stY,
+                                             dInfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dB(1, 1, 1, 1);
+        device_strided_batch_vector<T> dD(1, 1, 1, 1);
+        device_strided_batch_vector<T> dX(1, 1, 1, 1);
+        device_strided_batch_vector<T> dY(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dY.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        ggglm_checkBadArgs<BATCHED, STRIDED>(handle, n, m, p, dA.data(), lda, stA, dB.data(), ldb,
+                                             stB, dD.data(), stD, dX.data(), stX, dY.data(), stY,
+                                             dInfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void ggglm_initData(const rocblas_handle handle,
+                    const rocblas_int n,
+                    const rocblas_int m,
+                    const rocblas_int p,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_stride stB,
+                    Td& dD,
+                    const rocblas_stride stD,
+                    Ud& dInfo,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hB,
+                    Th& hD,
+                    Uh& hInfo,
+                    const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+        rocblas_init<T>(hD, true);
+
+        const rocblas_int max_index = std::max(0, m - 1);
+        std::uniform_int_distribution<int> sample_index(0, max_index);
+        std::bernoulli_distribution coinflip(0.5);
+
+        // scale A and B to avoid singularities
+        // (A is made diagonally dominant in its first m rows, and B in its last n-m rows)
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < m; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+                for(rocblas_int j = 0; j < p; j++)
+                {
+                    if(j == i + p - n)
+                        hB[b][i + j * ldb] += 400;
+                    else
+                        hB[b][i + j * ldb] -= 4;
+                }
+            }
+
+            // add some singularities
+            // always the same elements for debugging purposes
+            if(singular && m > 0 && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                do
+                {
+                    // zero random col of A
+                    rocblas_int j = sample_index(rocblas_rng);
+                    for(rocblas_int i = 0; i < n; i++)
+                        hA[b][i + j * lda] = 0;
+                } while(coinflip(rocblas_rng));
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy matrices and vectors to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void ggglm_getError(const rocblas_handle handle,
+                    const rocblas_int n,
+                    const rocblas_int m,
+                    const rocblas_int p,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_stride stB,
+                    Td& dD,
+                    const rocblas_stride stD,
+                    Td& dX,
+                    const rocblas_stride stX,
+                    Td& dY,
+                    const rocblas_stride stY,
+                    Ud& dInfo,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hB,
+                    Th& hD,
+                    Th& hX,
+                    Th& hXRes,
+                    Th& hY,
+                    Th& hYRes,
+                    Uh& hInfo,
+                    Uh& hInfoRes,
+                    double* max_err,
+                    const bool singular)
+{
+    rocblas_int lwork = 64 * max(1, m + n + p);
+    std::vector<T> hW(lwork);
+
+    // input data initialization
+    ggglm_initData<true, true, T>(handle, n, m, p, dA, lda, stA, dB, ldb, stB, dD, stD, dInfo, bc,
+                                  hA, hB, hD, hInfo, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_ggglm(STRIDED, handle, n, m, p, dA.data(), lda, stA, dB.data(),
+                                        ldb, stB, dD.data(), stD, dX.data(), stX, dY.data(), stY,
+                                        dInfo.data(), bc));
+    CHECK_HIP_ERROR(hXRes.transfer_from(dX));
+    CHECK_HIP_ERROR(hYRes.transfer_from(dY));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cpu_ggglm(n, m, p, hA[b], lda, hB[b], ldb, hD[b], hX[b], hY[b], hW.data(), lwork,
+                  hInfo[b]);
+    }
+
+    // error is max(||hX - hXRes|| / ||hX||, ||hY - hYRes|| / ||hY||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hInfo[b][0] == 0)
+        {
+            if(m > 0)
+            {
+                err = norm_error('I', m, 1, m, hX[b], hXRes[b]);
+                *max_err = err > *max_err ? err : *max_err;
+            }
+            if(p > 0)
+            {
+                err = norm_error('I', p, 1, p, hY[b], hYRes[b]);
+                *max_err = err > *max_err ? err : *max_err;
+            }
+        }
+    }
+
+    // also check info for singularities
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void ggglm_getPerfData(const rocblas_handle handle,
+                       const rocblas_int n,
+                       const rocblas_int m,
+                       const rocblas_int p,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Td& dB,
+                       const rocblas_int ldb,
+                       const rocblas_stride stB,
+                       Td& dD,
+                       const rocblas_stride stD,
+                       Td& dX,
+                       const rocblas_stride stX,
+                       Td& dY,
+                       const rocblas_stride stY,
+                       Ud& dInfo,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Th& hB,
+                       Th& hD,
+                       Th& hX,
+                       Th& hY,
+                       Uh& hInfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf,
+                       const bool singular)
+{
+    rocblas_int lwork = 64 * max(1, m + n + p);
+    std::vector<T> hW(lwork);
+
+    if(!perf)
+    {
+        ggglm_initData<true, false, T>(handle, n, m, p, dA, lda, stA, dB, ldb, stB, dD, stD, dInfo,
+                                       bc, hA, hB, hD, hInfo, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_ggglm(n, m, p, hA[b], lda, hB[b], ldb, hD[b], hX[b], hY[b], hW.data(), lwork,
+                      hInfo[b]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    ggglm_initData<true, false, T>(handle, n, m, p, dA, lda, stA, dB, ldb, stB, dD, stD, dInfo, bc,
+                                   hA, hB, hD, hInfo, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        ggglm_initData<false, true, T>(handle, n, m, p, dA, lda, stA, dB, ldb, stB, dD, stD, dInfo,
+                                       bc, hA, hB, hD, hInfo, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_ggglm(STRIDED, handle, n, m, p, dA.data(), lda, stA,
+                                            dB.data(), ldb, stB, dD.data(), stD, dX.data(), stX,
+                                            dY.data(), stY, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        ggglm_initData<false, true, T>(handle, n, m, p, dA, lda, stA, dB, ldb, stB, dD, stD, dInfo,
+                                       bc, hA, hB, hD, hInfo, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_ggglm(STRIDED, handle, n, m, p, dA.data(), lda, stA, dB.data(), ldb, stB,
+                        dD.data(), stD, dX.data(), stX, dY.data(), stY, dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_ggglm(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int m = argus.get<rocblas_int>("m", n);
+    rocblas_int p = argus.get<rocblas_int>("p", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * m);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * p);
+    rocblas_stride stD = argus.get<rocblas_stride>("strideD", n);
+    rocblas_stride stX = argus.get<rocblas_stride>("strideX", m);
+    rocblas_stride stY = argus.get<rocblas_stride>("strideY", p);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stXRes = (argus.unit_check || argus.norm_check) ? stX : 0;
+    rocblas_stride stYRes = (argus.unit_check || argus.norm_check) ? stY : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * m;
+    size_t size_B = size_t(ldb) * p;
+    size_t size_D = size_t(n);
+    size_t size_X = size_t(m);
+    size_t size_Y = size_t(p);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_XRes = (argus.unit_check || argus.norm_check) ? size_X : 0;
+    size_t size_YRes = (argus.unit_check || argus.norm_check) ? size_Y : 0;
+
+    // check invalid sizes
+    bool invalid_size
+        = (n < 0 || m < 0 || p < 0 || m > n || n > m + p || lda < n || ldb < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, m, p, (T* const*)nullptr, lda,
+                                                  stA, (T* const*)nullptr, ldb, stB,
+                                                  (T* const*)nullptr, stD, (T* const*)nullptr, stX,
+                                                  (T* const*)nullptr, stY, (rocblas_int*)nullptr,
+                                                  bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, m, p, (T*)nullptr, lda, stA,
+                                                  (T*)nullptr, ldb, stB, (T*)nullptr, stD,
+                                                  (T*)nullptr, stX, (T*)nullptr, stY,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_ggglm(STRIDED, handle, n, m, p, (T* const*)nullptr, lda,
+                                              stA, (T* const*)nullptr, ldb, stB, (T* const*)nullptr,
+                                              stD, (T* const*)nullptr, stX, (T* const*)nullptr, stY,
+                                              (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_ggglm(STRIDED, handle, n, m, p, (T*)nullptr, lda, stA,
+                                              (T*)nullptr, ldb, stB, (T*)nullptr, stD, (T*)nullptr,
+                                              stX, (T*)nullptr, stY, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(bc)
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hB(size_B, 1, bc);
+        host_batch_vector<T> hD(size_D, 1, bc);
+        host_batch_vector<T> hX(size_X, 1, bc);
+        host_batch_vector<T> hY(size_Y, 1, bc);
+        host_batch_vector<T> hXRes(size_XRes, 1, bc);
+        host_batch_vector<T> hYRes(size_YRes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dB(size_B, 1, bc);
+        device_batch_vector<T> dD(size_D, 1, bc);
+        device_batch_vector<T> dX(size_X, 1, bc);
+        device_batch_vector<T> dY(size_Y, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_D)
+            CHECK_HIP_ERROR(dD.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+        if(size_Y)
+            CHECK_HIP_ERROR(dY.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, m, p, dA.data(), lda, stA,
+                                                  dB.data(), ldb, stB, dD.data(), stD, dX.data(),
+                                                  stX, dY.data(), stY, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            ggglm_getError<STRIDED, T>(handle, n, m, p, dA, lda, stA, dB, ldb, stB, dD, stD, dX,
+                                       stX, dY, stY, dInfo, bc, hA, hB, hD, hX, hXRes, hY, hYRes,
+                                       hInfo, hInfoRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            ggglm_getPerfData<STRIDED, T>(handle, n, m, p, dA, lda, stA, dB, ldb, stB, dD, stD, dX,
+                                          stX, dY, stY, dInfo, bc, hA, hB, hD, hX, hY, hInfo,
+                                          &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf, argus.singular);
+    }
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+        host_strided_batch_vector<T> hD(size_D, 1, stD, bc);
+        host_strided_batch_vector<T> hX(size_X, 1, stX, bc);
+        host_strided_batch_vector<T> hY(size_Y, 1, stY, bc);
+        host_strided_batch_vector<T> hXRes(size_XRes, 1, stXRes, bc);
+        host_strided_batch_vector<T> hYRes(size_YRes, 1, stYRes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+        device_strided_batch_vector<T> dD(size_D, 1, stD, bc);
+        device_strided_batch_vector<T> dX(size_X, 1, stX, bc);
+        device_strided_batch_vector<T> dY(size_Y, 1, stY, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_D)
+            CHECK_HIP_ERROR(dD.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+        if(size_Y)
+            CHECK_HIP_ERROR(dY.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_ggglm(STRIDED, handle, n, m, p, dA.data(), lda, stA,
+                                                  dB.data(), ldb, stB, dD.data(), stD, dX.data(),
+                                                  stX, dY.data(), stY, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            ggglm_getError<STRIDED, T>(handle, n, m, p, dA, lda, stA, dB, ldb, stB, dD, stD, dX,
+                                       stX, dY, stY, dInfo, bc, hA, hB, hD, hX, hXRes, hY, hYRes,
+                                       hInfo, hInfoRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            ggglm_getPerfData<STRIDED, T>(handle, n, m, p, dA, lda, stA, dB, ldb, stB, dD, stD, dX,
+                                          stX, dY, stY, dInfo, bc, hA, hB, hD, hX, hY, hInfo,
+                                          &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("n", "m", "p", "lda", "ldb", "batch_c");
+                rocsolver_bench_output(n, m, p, lda, ldb, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("n", "m", "p", "lda", "ldb", "strideA", "strideB",
+                                       "strideD", "strideX", "strideY", "batch_c");
+                rocsolver_bench_output(n, m, p, lda, ldb, stA, stB, stD, stX, stY, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "m", "p", "lda", "ldb");
+                rocsolver_bench_output(n, m, p, lda, ldb);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GGGLM(...) extern template void testing_ggglm<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GGGLM, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
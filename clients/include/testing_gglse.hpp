@@ -0,0 +1,664 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "client_util.hpp"
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool BATCHED, bool STRIDED, typename U>
+void gglse_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        const rocblas_int p,
+                        U dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        U dB,
+                        const rocblas_int ldb,
+                        const rocblas_stride stB,
+                        U dC,
+                        const rocblas_stride stC,
+                        U dD,
+                        const rocblas_stride stD,
+                        U dX,
+                        const rocblas_stride stX,
+                        rocblas_int* info,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, nullptr, m, n, p, dA, lda, stA, dB, ldb, stB,
+                                          dC, stC, dD, stD, dX, stX, info, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, n, p, dA, lda, stA, dB, ldb, stB,
+                                              dC, stC, dD, stD, dX, stX, info, -1),
+                              rocblas_status_invalid_size)
+            << "Must report error when batch size is negative";
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, n, p, (U) nullptr, lda, stA, dB, ldb,
+                                          stB, dC, stC, dD, stD, dX, stX, info, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when A is null";
+    EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, n, p, dA, lda, stA, (U) nullptr, ldb,
+                                          stB, dC, stC, dD, stD, dX, stX, info, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when B is null";
+    EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, n, p, dA, lda, stA, dB, ldb, stB,
+                                          (U) nullptr, stC, dD, stD, dX, stX, info, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when C is null";
+    EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, n, p, dA, lda, stA, dB, ldb, stB,
+                                          dC, stC, (U) nullptr, stD, dX, stX, info, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when D is null";
+    EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, n, p, dA, lda, stA, dB, ldb, stB,
+                                          dC, stC, dD, stD, (U) nullptr, stX, info, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when X is null";
+    EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, n, p, dA, lda, stA, dB, ldb, stB,
+                                          dC, stC, dD, stD, dX, stX, nullptr, bc),
+                          rocblas_status_invalid_pointer)
+        << "Should normally report error when info is null";
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, 0, 0, (U) nullptr, lda, stA,
+                                          (U) nullptr, ldb, stB, dC, stC, (U) nullptr, stD,
+                                          (U) nullptr, stX, info, bc),
+                          rocblas_status_success)
+        << "Matrices A and B may be null when n is 0 (empty matrix)";
+    EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, 0, n, n, (U) nullptr, lda, stA, dB, ldb,
+                                          stB, (U) nullptr, stC, dD, stD, dX, stX, info, bc),
+                          rocblas_status_success)
+        << "Matrix A and vector C may be null when m is 0 (empty matrix)";
+    if(BATCHED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, n, p, dA, lda, stA, dB, ldb, stB,
+                                              dC, stC, dD, stD, dX, stX, nullptr, 0),
+                              rocblas_status_success)
+            << "Info may be null when batch size is 0";
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, n, p, dA, lda, stA, dB, ldb, stB,
+                                              dC, stC, dD, stD, dX, stX, info, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gglse_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int p = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stB = 1;
+    rocblas_stride stC = 1;
+    rocblas_stride stD = 1;
+    rocblas_stride stX = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dB(1, 1, 1);
+        device_batch_vector<T> dC(1, 1, 1);
+        device_batch_vector<T> dD(1, 1, 1);
+        device_batch_vector<T> dX(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        gglse_checkBadArgs<BATCHED, STRIDED>(handle, m, n, p, dA.data(), lda, stA, dB.data(), ldb,
+                                             stB, dC.data(), stC, dD.data(), stD, dX.data(), stX,
+                                             dInfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dB(1, 1, 1, 1);
+        device_strided_batch_vector<T> dC(1, 1, 1, 1);
+        device_strided_batch_vector<T> dD(1, 1, 1, 1);
+        device_strided_batch_vector<T> dX(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        gglse_checkBadArgs<BATCHED, STRIDED>(handle, m, n, p, dA.data(), lda, stA, dB.data(), ldb,
+                                             stB, dC.data(), stC, dD.data(), stD, dX.data(), stX,
+                                             dInfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gglse_initData(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    const rocblas_int p,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_stride stB,
+                    Td& dC,
+                    const rocblas_stride stC,
+                    Td& dD,
+                    const rocblas_stride stD,
+                    Ud& dInfo,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hB,
+                    Th& hC,
+                    Th& hD,
+                    Uh& hInfo,
+                    const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+        rocblas_init<T>(hC, true);
+        rocblas_init<T>(hD, true);
+
+        const rocblas_int max_index = std::max(0, p - 1);
+        std::uniform_int_distribution<int> sample_index(0, max_index);
+        std::bernoulli_distribution coinflip(0.5);
+
+        // scale A and B to avoid singularities
+        // (B is made diagonally dominant in its last p columns, and A in its first n-p columns)
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                for(rocblas_int i = 0; i < m; i++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+                for(rocblas_int i = 0; i < p; i++)
+                {
+                    if(i + n - p == j)
+                        hB[b][i + j * ldb] += 400;
+                    else
+                        hB[b][i + j * ldb] -= 4;
+                }
+            }
+
+            // add some singularities
+            // always the same elements for debugging purposes
+            if(singular && p > 0 && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                do
+                {
+                    // zero random row of B
+                    rocblas_int i = sample_index(rocblas_rng);
+                    for(rocblas_int j = 0; j < n; j++)
+                        hB[b][i + j * ldb] = 0;
+                } while(coinflip(rocblas_rng));
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy matrices and vectors to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gglse_getError(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    const rocblas_int p,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_stride stB,
+                    Td& dC,
+                    const rocblas_stride stC,
+                    Td& dD,
+                    const rocblas_stride stD,
+                    Td& dX,
+                    const rocblas_stride stX,
+                    Ud& dInfo,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hB,
+                    Th& hC,
+                    Th& hD,
+                    Th& hX,
+                    Th& hXRes,
+                    Uh& hInfo,
+                    Uh& hInfoRes,
+                    double* max_err,
+                    const bool singular)
+{
+    rocblas_int lwork = 64 * max(1, m + n + p);
+    std::vector<T> hW(lwork);
+
+    // input data initialization
+    gglse_initData<true, true, T>(handle, m, n, p, dA, lda, stA, dB, ldb, stB, dC, stC, dD, stD,
+                                  dInfo, bc, hA, hB, hC, hD, hInfo, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gglse(STRIDED, handle, m, n, p, dA.data(), lda, stA, dB.data(),
+                                        ldb, stB, dC.data(), stC, dD.data(), stD, dX.data(), stX,
+                                        dInfo.data(), bc));
+    CHECK_HIP_ERROR(hXRes.transfer_from(dX));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cpu_gglse(m, n, p, hA[b], lda, hB[b], ldb, hC[b], hD[b], hX[b], hW.data(), lwork,
+                  hInfo[b]);
+    }
+
+    // error is ||hX - hXRes|| / ||hX||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hInfo[b][0] == 0)
+        {
+            err = norm_error('I', n, 1, n, hX[b], hXRes[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+
+    // also check info for singularities
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gglse_getPerfData(const rocblas_handle handle,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       const rocblas_int p,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Td& dB,
+                       const rocblas_int ldb,
+                       const rocblas_stride stB,
+                       Td& dC,
+                       const rocblas_stride stC,
+                       Td& dD,
+                       const rocblas_stride stD,
+                       Td& dX,
+                       const rocblas_stride stX,
+                       Ud& dInfo,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Th& hB,
+                       Th& hC,
+                       Th& hD,
+                       Th& hX,
+                       Uh& hInfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf,
+                       const bool singular)
+{
+    rocblas_int lwork = 64 * max(1, m + n + p);
+    std::vector<T> hW(lwork);
+
+    if(!perf)
+    {
+        gglse_initData<true, false, T>(handle, m, n, p, dA, lda, stA, dB, ldb, stB, dC, stC, dD,
+                                       stD, dInfo, bc, hA, hB, hC, hD, hInfo, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_gglse(m, n, p, hA[b], lda, hB[b], ldb, hC[b], hD[b], hX[b], hW.data(), lwork,
+                      hInfo[b]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gglse_initData<true, false, T>(handle, m, n, p, dA, lda, stA, dB, ldb, stB, dC, stC, dD, stD,
+                                   dInfo, bc, hA, hB, hC, hD, hInfo, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gglse_initData<false, true, T>(handle, m, n, p, dA, lda, stA, dB, ldb, stB, dC, stC, dD,
+                                       stD, dInfo, bc, hA, hB, hC, hD, hInfo, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gglse(STRIDED, handle, m, n, p, dA.data(), lda, stA,
+                                            dB.data(), ldb, stB, dC.data(), stC, dD.data(), stD,
+                                            dX.data(), stX, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gglse_initData<false, true, T>(handle, m, n, p, dA, lda, stA, dB, ldb, stB, dC, stC, dD,
+                                       stD, dInfo, bc, hA, hB, hC, hD, hInfo, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gglse(STRIDED, handle, m, n, p, dA.data(), lda, stA, dB.data(), ldb, stB,
+                        dC.data(), stC, dD.data(), stD, dX.data(), stX, dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_gglse(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int p = argus.get<rocblas_int>("p", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", p);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * n);
+    rocblas_stride stC = argus.get<rocblas_stride>("strideC", m);
+    rocblas_stride stD = argus.get<rocblas_stride>("strideD", p);
+    rocblas_stride stX = argus.get<rocblas_stride>("strideX", n);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stXRes = (argus.unit_check || argus.norm_check) ? stX : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * n;
+    size_t size_C = size_t(m);
+    size_t size_D = size_t(p);
+    size_t size_X = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_XRes = (argus.unit_check || argus.norm_check) ? size_X : 0;
+
+    // check invalid sizes
+    bool invalid_size
+        = (m < 0 || n < 0 || p < 0 || p > n || n > m + p || lda < m || ldb < p || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, n, p, (T* const*)nullptr, lda,
+                                                  stA, (T* const*)nullptr, ldb, stB,
+                                                  (T* const*)nullptr, stC, (T* const*)nullptr, stD,
+                                                  (T* const*)nullptr, stX, (rocblas_int*)nullptr,
+                                                  bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, n, p, (T*)nullptr, lda, stA,
+                                                  (T*)nullptr, ldb, stB, (T*)nullptr, stC,
+                                                  (T*)nullptr, stD, (T*)nullptr, stX,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_gglse(STRIDED, handle, m, n, p, (T* const*)nullptr, lda,
+                                              stA, (T* const*)nullptr, ldb, stB, (T* const*)nullptr,
+                                              stC, (T* const*)nullptr, stD, (T* const*)nullptr, stX,
+                                              (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_gglse(STRIDED, handle, m, n, p, (T*)nullptr, lda, stA,
+                                              (T*)nullptr, ldb, stB, (T*)nullptr, stC, (T*)nullptr,
+                                              stD, (T*)nullptr, stX, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(bc)
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hB(size_B, 1, bc);
+        host_batch_vector<T> hC(size_C, 1, bc);
+        host_batch_vector<T> hD(size_D, 1, bc);
+        host_batch_vector<T> hX(size_X, 1, bc);
+        host_batch_vector<T> hXRes(size_XRes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dB(size_B, 1, bc);
+        device_batch_vector<T> dC(size_C, 1, bc);
+        device_batch_vector<T> dD(size_D, 1, bc);
+        device_batch_vector<T> dX(size_X, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+        if(size_D)
+            CHECK_HIP_ERROR(dD.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, n, p, dA.data(), lda, stA,
+                                                  dB.data(), ldb, stB, dC.data(), stC, dD.data(),
+                                                  stD, dX.data(), stX, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gglse_getError<STRIDED, T>(handle, m, n, p, dA, lda, stA, dB, ldb, stB, dC, stC, dD,
+                                       stD, dX, stX, dInfo, bc, hA, hB, hC, hD, hX, hXRes, hInfo,
+                                       hInfoRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            gglse_getPerfData<STRIDED, T>(handle, m, n, p, dA, lda, stA, dB, ldb, stB, dC, stC, dD,
+                                          stD, dX, stX, dInfo, bc, hA, hB, hC, hD, hX, hInfo,
+                                          &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf, argus.singular);
+    }
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+        host_strided_batch_vector<T> hC(size_C, 1, stC, bc);
+        host_strided_batch_vector<T> hD(size_D, 1, stD, bc);
+        host_strided_batch_vector<T> hX(size_X, 1, stX, bc);
+        host_strided_batch_vector<T> hXRes(size_XRes, 1, stXRes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+        device_strided_batch_vector<T> dC(size_C, 1, stC, bc);
+        device_strided_batch_vector<T> dD(size_D, 1, stD, bc);
+        device_strided_batch_vector<T> dX(size_X, 1, stX, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+        if(size_D)
+            CHECK_HIP_ERROR(dD.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_gglse(STRIDED, handle, m, n, p, dA.data(), lda, stA,
+                                                  dB.data(), ldb, stB, dC.data(), stC, dD.data(),
+                                                  stD, dX.data(), stX, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            gglse_getError<STRIDED, T>(handle, m, n, p, dA, lda, stA, dB, ldb, stB, dC, stC, dD,
+                                       stD, dX, stX, dInfo, bc, hA, hB, hC, hD, hX, hXRes, hInfo,
+                                       hInfoRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            gglse_getPerfData<STRIDED, T>(handle, m, n, p, dA, lda, stA, dB, ldb, stB, dC, stC, dD,
+                                          stD, dX, stX, dInfo, bc, hA, hB, hC, hD, hX, hInfo,
+                                          &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, max(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "p", "lda", "ldb", "batch_c");
+                rocsolver_bench_output(m, n, p, lda, ldb, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "p", "lda", "ldb", "strideA", "strideB",
+                                       "strideC", "strideD", "strideX", "batch_c");
+                rocsolver_bench_output(m, n, p, lda, ldb, stA, stB, stC, stD, stX, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "p", "lda", "ldb");
+                rocsolver_bench_output(m, n, p, lda, ldb);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GGLSE(...) extern template void testing_gglse<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GGLSE, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
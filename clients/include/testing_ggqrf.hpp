@@ -0,0 +1,563 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "client_util.hpp"
+#include "clientcommon.hpp"
+#include "lapack_host_reference.hpp"
+#include "norm.hpp"
+#include "rocsolver.hpp"
+#include "rocsolver_arguments.hpp"
+#include "rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename U>
+void ggqrf_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int n,
+                        const rocblas_int m,
+                        const rocblas_int p,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        U dTa,
+                        const rocblas_stride stTa,
+                        T dB,
+                        const rocblas_int ldb,
+                        const rocblas_stride stB,
+                        U dTb,
+                        const rocblas_stride stTb,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, nullptr, n, m, p, dA, lda, stA, dTa, stTa, dB,
+                                          ldb, stB, dTb, stTb, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, handle, n, m, p, dA, lda, stA, dTa, stTa,
+                                              dB, ldb, stB, dTb, stTb, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, handle, n, m, p, (T) nullptr, lda, stA, dTa,
+                                          stTa, dB, ldb, stB, dTb, stTb, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, handle, n, m, p, dA, lda, stA, (U) nullptr,
+                                          stTa, dB, ldb, stB, dTb, stTb, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, handle, n, m, p, dA, lda, stA, dTa, stTa,
+                                          (T) nullptr, ldb, stB, dTb, stTb, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, handle, n, m, p, dA, lda, stA, dTa, stTa, dB,
+                                          ldb, stB, (U) nullptr, stTb, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, handle, 0, m, p, (T) nullptr, lda, stA,
+                                          (U) nullptr, stTa, (T) nullptr, ldb, stB, (U) nullptr,
+                                          stTb, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, handle, n, 0, p, (T) nullptr, lda, stA,
+                                          (U) nullptr, stTa, dB, ldb, stB, dTb, stTb, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, handle, n, m, 0, dA, lda, stA, dTa, stTa,
+                                          (T) nullptr, ldb, stB, (U) nullptr, stTb, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, handle, n, m, p, dA, lda, stA, dTa, stTa,
+                                              dB, ldb, stB, dTb, stTb, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_ggqrf_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int m = 1;
+    rocblas_int p = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stB = 1;
+    rocblas_stride stTa = 1;
+    rocblas_stride stTb = 1;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dB(1, 1, 1);
+        device_strided_batch_vector<T> dTa(1, 1, 1, 1);
+        device_strided_batch_vector<T> dTb(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dTa.memcheck());
+        CHECK_HIP_ERROR(dTb.memcheck());
+
+        // check bad arguments
+        ggqrf_checkBadArgs<STRIDED>(handle, n, m, p, dA.data(), lda, stA, dTa.data(), stTa,
+                                    dB.data(), ldb, stB, dTb.data(), stTb, bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dB(1, 1, 1, 1);
+        device_strided_batch_vector<T> dTa(1, 1, 1, 1);
+        device_strided_batch_vector<T> dTb(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dTa.memcheck());
+        CHECK_HIP_ERROR(dTb.memcheck());
+
+        // check bad arguments
+        ggqrf_checkBadArgs<STRIDED>(handle, n, m, p, dA.data(), lda, stA, dTa.data(), stTa,
+                                    dB.data(), ldb, stB, dTb.data(), stTb, bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void ggqrf_initData(const rocblas_handle handle,
+                    const rocblas_int n,
+                    const rocblas_int m,
+                    const rocblas_int p,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Ud& dTa,
+                    const rocblas_stride stTa,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_stride stB,
+                    Ud& dTb,
+                    const rocblas_stride stTb,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Uh& hTa,
+                    Th& hB,
+                    Uh& hTb)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        // scale A and B to avoid singularities
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < m; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+                for(rocblas_int j = 0; j < p; j++)
+                {
+                    if(i == j)
+                        hB[b][i + j * ldb] += 400;
+                    else
+                        hB[b][i + j * ldb] -= 4;
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void ggqrf_getError(const rocblas_handle handle,
+                    const rocblas_int n,
+                    const rocblas_int m,
+                    const rocblas_int p,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Ud& dTa,
+                    const rocblas_stride stTa,
+                    Td& dB,
+                    const rocblas_int ldb,
+                    const rocblas_stride stB,
+                    Ud& dTb,
+                    const rocblas_stride stTb,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hARes,
+                    Uh& hTa,
+                    Th& hB,
+                    Th& hBRes,
+                    Uh& hTb,
+                    double* max_err)
+{
+    rocblas_int lwork = 64 * max(1, max(n, max(m, p)));
+    std::vector<T> hW(lwork);
+
+    // input data initialization
+    ggqrf_initData<true, true, T>(handle, n, m, p, dA, lda, stA, dTa, stTa, dB, ldb, stB, dTb,
+                                  stTb, bc, hA, hTa, hB, hTb);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_ggqrf(STRIDED, handle, n, m, p, dA.data(), lda, stA, dTa.data(),
+                                        stTa, dB.data(), ldb, stB, dTb.data(), stTb, bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cpu_ggqrf(n, m, p, hA[b], lda, hTa[b], hB[b], ldb, hTb[b], hW.data(), lwork);
+    }
+
+    // error is max(||hA - hARes|| / ||hA||, ||hB - hBRes|| / ||hB||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(m > 0)
+        {
+            err = norm_error('F', n, m, lda, hA[b], hARes[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+        if(p > 0)
+        {
+            err = norm_error('F', n, p, ldb, hB[b], hBRes[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void ggqrf_getPerfData(const rocblas_handle handle,
+                       const rocblas_int n,
+                       const rocblas_int m,
+                       const rocblas_int p,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Ud& dTa,
+                       const rocblas_stride stTa,
+                       Td& dB,
+                       const rocblas_int ldb,
+                       const rocblas_stride stB,
+                       Ud& dTb,
+                       const rocblas_stride stTb,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Uh& hTa,
+                       Th& hB,
+                       Uh& hTb,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf)
+{
+    rocblas_int lwork = 64 * max(1, max(n, max(m, p)));
+    std::vector<T> hW(lwork);
+
+    if(!perf)
+    {
+        ggqrf_initData<true, false, T>(handle, n, m, p, dA, lda, stA, dTa, stTa, dB, ldb, stB, dTb,
+                                       stTb, bc, hA, hTa, hB, hTb);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_ggqrf(n, m, p, hA[b], lda, hTa[b], hB[b], ldb, hTb[b], hW.data(), lwork);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    ggqrf_initData<true, false, T>(handle, n, m, p, dA, lda, stA, dTa, stTa, dB, ldb, stB, dTb,
+                                   stTb, bc, hA, hTa, hB, hTb);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        ggqrf_initData<false, true, T>(handle, n, m, p, dA, lda, stA, dTa, stTa, dB, ldb, stB, dTb,
+                                       stTb, bc, hA, hTa, hB, hTb);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_ggqrf(STRIDED, handle, n, m, p, dA.data(), lda, stA,
+                                            dTa.data(), stTa, dB.data(), ldb, stB, dTb.data(),
+                                            stTb, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        ggqrf_initData<false, true, T>(handle, n, m, p, dA, lda, stA, dTa, stTa, dB, ldb, stB, dTb,
+                                       stTb, bc, hA, hTa, hB, hTb);
+
+        start = get_time_us_sync(stream);
+        rocsolver_ggqrf(STRIDED, handle, n, m, p, dA.data(), lda, stA, dTa.data(), stTa, dB.data(),
+                        ldb, stB, dTb.data(), stTb, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_ggqrf(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int m = argus.get<rocblas_int>("m", n);
+    rocblas_int p = argus.get<rocblas_int>("p", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * m);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * p);
+    rocblas_stride stTa = argus.get<rocblas_stride>("strideTa", min(n, m));
+    rocblas_stride stTb = argus.get<rocblas_stride>("strideTb", min(n, p));
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+    rocblas_stride stBRes = (argus.unit_check || argus.norm_check) ? stB : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * m;
+    size_t size_B = size_t(ldb) * p;
+    size_t size_Ta = size_t(min(n, m));
+    size_t size_Tb = size_t(min(n, p));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || m < 0 || p < 0 || lda < n || ldb < n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, handle, n, m, p, (T* const*)nullptr, lda,
+                                                  stA, (T*)nullptr, stTa, (T* const*)nullptr, ldb,
+                                                  stB, (T*)nullptr, stTb, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, handle, n, m, p, (T*)nullptr, lda, stA,
+                                                  (T*)nullptr, stTa, (T*)nullptr, ldb, stB,
+                                                  (T*)nullptr, stTb, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_ggqrf(STRIDED, handle, n, m, p, (T* const*)nullptr, lda,
+                                              stA, (T*)nullptr, stTa, (T* const*)nullptr, ldb, stB,
+                                              (T*)nullptr, stTb, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_ggqrf(STRIDED, handle, n, m, p, (T*)nullptr, lda, stA,
+                                              (T*)nullptr, stTa, (T*)nullptr, ldb, stB,
+                                              (T*)nullptr, stTb, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<T> hTa(size_Ta, 1, stTa, bc);
+    host_strided_batch_vector<T> hTb(size_Tb, 1, stTb, bc);
+    // device
+    device_strided_batch_vector<T> dTa(size_Ta, 1, stTa, bc);
+    device_strided_batch_vector<T> dTb(size_Tb, 1, stTb, bc);
+    if(size_Ta)
+        CHECK_HIP_ERROR(dTa.memcheck());
+    if(size_Tb)
+        CHECK_HIP_ERROR(dTb.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        host_batch_vector<T> hB(size_B, 1, bc);
+        host_batch_vector<T> hBRes(size_BRes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dB(size_B, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+
+        // check quick return
+        if(n == 0 || (m == 0 && p == 0) || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, handle, n, m, p, dA.data(), lda, stA,
+                                                  dTa.data(), stTa, dB.data(), ldb, stB,
+                                                  dTb.data(), stTb, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            ggqrf_getError<STRIDED, T>(handle, n, m, p, dA, lda, stA, dTa, stTa, dB, ldb, stB, dTb,
+                                       stTb, bc, hA, hARes, hTa, hB, hBRes, hTb, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            ggqrf_getPerfData<STRIDED, T>(handle, n, m, p, dA, lda, stA, dTa, stTa, dB, ldb, stB,
+                                          dTb, stTb, bc, hA, hTa, hB, hTb, &gpu_time_used,
+                                          &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf);
+    }
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+        host_strided_batch_vector<T> hBRes(size_BRes, 1, stBRes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+
+        // check quick return
+        if(n == 0 || (m == 0 && p == 0) || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_ggqrf(STRIDED, handle, n, m, p, dA.data(), lda, stA,
+                                                  dTa.data(), stTa, dB.data(), ldb, stB,
+                                                  dTb.data(), stTb, bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            ggqrf_getError<STRIDED, T>(handle, n, m, p, dA, lda, stA, dTa, stTa, dB, ldb, stB, dTb,
+                                       stTb, bc, hA, hARes, hTa, hB, hBRes, hTb, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            ggqrf_getPerfData<STRIDED, T>(handle, n, m, p, dA, lda, stA, dTa, stTa, dB, ldb, stB,
+                                          dTb, stTb, bc, hA, hTa, hB, hTb, &gpu_time_used,
+                                          &cpu_time_used, hot_calls, argus.profile,
+                                          argus.profile_kernels, argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("n", "m", "p", "lda", "strideTa", "ldb", "strideTb",
+                                       "batch_c");
+                rocsolver_bench_output(n, m, p, lda, stTa, ldb, stTb, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("n", "m", "p", "lda", "strideA", "strideTa", "ldb",
+                                       "strideB", "strideTb", "batch_c");
+                rocsolver_bench_output(n, m, p, lda, stA, stTa, ldb, stB, stTb, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "m", "p", "lda", "ldb");
+                rocsolver_bench_output(n, m, p, lda, ldb);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GGQRF(...) extern template void testing_ggqrf<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GGQRF, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -69,12 +69,25 @@ void larfg_initData(const rocblas_handle handle,
                     Td& dt,
                     Th& ha,
                     Th& hx,
-                    Th& ht)
+                    Th& ht,
+                    const rocblas_int scale = 0)
 {
     if(CPU)
     {
         rocblas_init<T>(ha, true);
         rocblas_init<T>(hx, true);
+
+        // if scale = 1, make alpha and x tiny so that beta has to be rescaled;
+        // if scale = 2, make them so large that the squares of x would overflow
+        if(scale == 1 || scale == 2)
+        {
+            using S = decltype(std::real(T{}));
+            S f = (scale == 1 ? std::numeric_limits<S>::min()
+                              : std::numeric_limits<S>::max() / (16 * n));
+            ha[0][0] = ha[0][0] * T(f);
+            for(rocblas_int i = 0; i < n - 1; i++)
+                hx[0][i * inc] = hx[0][i * inc] * T(f);
+        }
     }
 
     if(GPU)
@@ -96,10 +109,11 @@ void larfg_getError(const rocblas_handle handle,
                     Th& hx,
                     Th& hxr,
                     Th& ht,
+                    const rocblas_int scale,
                     double* max_err)
 {
     // initialize data
-    larfg_initData<true, true, T>(handle, n, da, dx, inc, dt, ha, hx, ht);
+    larfg_initData<true, true, T>(handle, n, da, dx, inc, dt, ha, hx, ht, scale);
 
     // execute computations
     // GPU lapack
@@ -186,6 +200,7 @@ void testing_larfg(Arguments& argus)
     rocblas_local_handle handle;
     rocblas_int n = argus.get<rocblas_int>("n");
     rocblas_int inc = argus.get<rocblas_int>("incx");
+    rocblas_int scale = argus.get<rocblas_int>("scale", 0);
 
     rocblas_int hot_calls = argus.iters;
 
@@ -260,7 +275,7 @@ void testing_larfg(Arguments& argus)
 
     // check computations
     if(argus.unit_check || argus.norm_check)
-        larfg_getError<T>(handle, n, da, dx, inc, dt, ha, hx, hxr, ht, &max_error);
+        larfg_getError<T>(handle, n, da, dx, inc, dt, ha, hx, hxr, ht, scale, &max_error);
 
     // collect performance data
     if(argus.timing)
@@ -180,6 +180,16 @@ constexpr auto rocblas2char_esort(rocblas_esort value)
     return '\0';
 }
 
+constexpr auto rocblas2char_norm_type(rocblas_norm_type value)
+{
+    switch(value)
+    {
+    case rocblas_norm_one: return 'O';
+    case rocblas_norm_inf: return 'I';
+    }
+    return '\0';
+}
+
 // return precision string for rocblas_datatype
 constexpr auto rocblas2string_datatype(rocblas_datatype type)
 {
@@ -378,6 +388,17 @@ constexpr rocblas_esort char2rocblas_esort(char value)
     }
 }
 
+constexpr rocblas_norm_type char2rocblas_norm_type(char value)
+{
+    switch(value)
+    {
+    case '1':
+    case 'O': return rocblas_norm_one;
+    case 'I': return rocblas_norm_inf;
+    default: return static_cast<rocblas_norm_type>(0);
+    }
+}
+
 // clang-format off
 inline rocblas_initialization string2rocblas_initialization(const std::string& value)
 {
@@ -121,4 +121,12 @@ typedef enum rocblas_srange_
     rocblas_srange_index = 263, /**< The \f$il\f$-th through \f$iu\f$-th singular values will be found.*/
 } rocblas_srange;
 
+/*! \brief Used to specify the matrix norm in which the condition number is estimated
+ ********************************************************************************/
+typedef enum rocblas_norm_type_
+{
+    rocblas_norm_one = 271, /**< The 1-norm (maximum absolute column sum) will be used. */
+    rocblas_norm_inf = 272, /**< The infinity-norm (maximum absolute row sum) will be used. */
+} rocblas_norm_type;
+
 #endif /* ROCSOLVER_EXTRA_TYPES_H */
@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "rocauxiliary_bdsdc.hpp"
+
+template <typename T>
+rocblas_status rocsolver_bdsdc_impl(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_svect svect,
+                                    const rocblas_int n,
+                                    T* D,
+                                    T* E,
+                                    T* U,
+                                    const rocblas_int ldu,
+                                    T* V,
+                                    const rocblas_int ldv,
+                                    rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("bdsdc", "--uplo", uplo, "--svect", svect, "-n", n, "--ldu", ldu, "--ldv",
+                        ldv);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_bdsdc_argCheck(handle, uplo, svect, n, D, E, U, ldu, V, ldv, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftU = 0;
+    rocblas_int shiftV = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideD = 0;
+    rocblas_stride strideE = 0;
+    rocblas_stride strideU = 0;
+    rocblas_stride strideV = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for stedc workspace
+    size_t size_work_stack;
+    // size for temporary computations
+    size_t size_tempvect, size_tempgemm;
+    // size for temporary diagonal and z vectors
+    size_t size_tmpz;
+    // size for vector with positions of split blocks
+    size_t size_splits;
+    // size for the TGK matrix and its eigenvectors
+    size_t size_tgk, size_Z;
+    rocsolver_bdsdc_getMemorySize<T, T>(svect, n, batch_count, &size_work_stack, &size_tempvect,
+                                        &size_tempgemm, &size_tmpz, &size_splits, &size_tgk,
+                                        &size_Z);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work_stack, size_tempvect,
+                                                      size_tempgemm, size_tmpz, size_splits,
+                                                      size_tgk, size_Z);
+
+    // memory workspace allocation
+    void *work_stack, *tempvect, *tempgemm, *tmpz, *splits, *tgk, *Z;
+    rocblas_device_malloc mem(handle, size_work_stack, size_tempvect, size_tempgemm, size_tmpz,
+                              size_splits, size_tgk, size_Z);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work_stack = mem[0];
+    tempvect = mem[1];
+    tempgemm = mem[2];
+    tmpz = mem[3];
+    splits = mem[4];
+    tgk = mem[5];
+    Z = mem[6];
+
+    // execution
+    return rocsolver_bdsdc_template<T>(handle, uplo, svect, n, D, strideD, E, strideE, U, shiftU,
+                                       ldu, strideU, V, shiftV, ldv, strideV, info, batch_count,
+                                       work_stack, (T*)tempvect, (T*)tempgemm, (T*)tmpz,
+                                       (rocblas_int*)splits, (T*)tgk, (T*)Z);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sbdsdc(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_svect svect,
+                                const rocblas_int n,
+                                float* D,
+                                float* E,
+                                float* U,
+                                const rocblas_int ldu,
+                                float* V,
+                                const rocblas_int ldv,
+                                rocblas_int* info)
+{
+    return rocsolver_bdsdc_impl<float>(handle, uplo, svect, n, D, E, U, ldu, V, ldv, info);
+}
+
+rocblas_status rocsolver_dbdsdc(rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                const rocblas_svect svect,
+                                const rocblas_int n,
+                                double* D,
+                                double* E,
+                                double* U,
+                                const rocblas_int ldu,
+                                double* V,
+                                const rocblas_int ldv,
+                                rocblas_int* info)
+{
+    return rocsolver_bdsdc_impl<double>(handle, uplo, svect, n, D, E, U, ldu, V, ldv, info);
+}
+
+} // extern C
@@ -0,0 +1,449 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.10.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocauxiliary_stedc.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** BDSDC_EXTRACT takes the n largest eigenpairs of the 2n-by-2n Golub-Kahan (TGK) matrix
+    and extracts the singular values and the singular vectors of the bidiagonal matrix.
+    Each half of an eigenvector is normalized independently, so that a mixing of the
+    eigenvectors associated with +s and -s does not affect the result.
+    Call this kernel with batch_count groups in y, and n groups in x. Groups are of size BS1. **/
+template <typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) bdsdc_extract(const rocblas_fill uplo,
+                                                           const rocblas_int n,
+                                                           S* DD,
+                                                           const rocblas_stride strideD,
+                                                           S* DtgkA,
+                                                           S* ZZ,
+                                                           S* UVA,
+                                                           rocblas_int* info)
+{
+    rocblas_int j = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    if(info[bid] != 0)
+        return;
+
+    // select batch instance to work with
+    rocblas_int nn = 2 * n;
+    rocblas_int col = nn - 1 - j;
+    S* D = DD + (bid * strideD);
+    S* Dtgk = DtgkA + (bid * nn);
+
+    // eigenvalues are in increasing order; singular values are returned in decreasing order
+    if(tid == 0)
+        D[j] = (Dtgk[col] > 0 ? Dtgk[col] : S(0));
+
+    if(!ZZ)
+        return;
+
+    S* z = ZZ + (bid * nn * nn) + col * nn;
+    S* UB = UVA + (bid * 2 * n * n) + j * n;
+    S* VB = UB + n * n;
+
+    // for upper bidiagonal matrices, the even entries of the eigenvector correspond to the
+    // right singular vector and the odd entries to the left one (and vice versa if lower)
+    rocblas_int ou = (uplo == rocblas_fill_upper) ? 1 : 0;
+    rocblas_int ov = 1 - ou;
+
+    __shared__ S su[BS1];
+    __shared__ S sv[BS1];
+    S tu = 0, tv = 0;
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        tu += z[2 * i + ou] * z[2 * i + ou];
+        tv += z[2 * i + ov] * z[2 * i + ov];
+    }
+    su[tid] = tu;
+    sv[tid] = tv;
+    __syncthreads();
+
+    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+        {
+            su[tid] += su[tid + r];
+            sv[tid] += sv[tid + r];
+        }
+        __syncthreads();
+    }
+
+    // (a half with zero norm is left as zero and completed later by bdsdc_reorth)
+    tu = (su[0] > 0 ? S(1) / sqrt(su[0]) : S(0));
+    tv = (sv[0] > 0 ? S(1) / sqrt(sv[0]) : S(0));
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        UB[i] = z[2 * i + ou] * tu;
+        VB[i] = z[2 * i + ov] * tv;
+    }
+}
+
+/** BDSDC_REORTH re-orthonormalizes the singular vectors associated with singular values that
+    are negligible with respect to the largest one. For these, the eigenvectors of the TGK
+    matrix associated with +s and -s may be arbitrarily mixed, and the halves extracted from
+    them are not necessarily orthogonal. Each vector is orthogonalized against the previous ones
+    with classical Gram-Schmidt applied twice; if nothing is left, it is replaced by the canonical
+    vector with the smallest projection onto the previous ones.
+    Call this kernel with batch_count groups in x. Groups are of size BS1. **/
+template <typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) bdsdc_reorth(const rocblas_int n,
+                                                          S* DD,
+                                                          const rocblas_stride strideD,
+                                                          S* UVA,
+                                                          S* workA,
+                                                          rocblas_int* info,
+                                                          const S tol)
+{
+    rocblas_int bid = hipBlockIdx_x;
+    rocblas_int tid = hipThreadIdx_x;
+
+    if(info[bid] != 0)
+        return;
+
+    // select batch instance to work with
+    S* D = DD + (bid * strideD);
+    S* work = workA + (bid * n);
+
+    __shared__ S sval[BS1];
+    __shared__ rocblas_int sidx[BS1];
+    __shared__ rocblas_int j0;
+
+    // find the first negligible singular value
+    if(tid == 0)
+    {
+        S thresh = tol * D[0];
+        j0 = n;
+        while(j0 > 0 && D[j0 - 1] <= thresh)
+            j0--;
+    }
+    __syncthreads();
+
+    for(rocblas_int side = 0; side < 2; side++)
+    {
+        S* X = UVA + (bid * 2 * n * n) + side * n * n;
+
+        for(rocblas_int j = j0; j < n; j++)
+        {
+            S* x = X + j * n;
+            bool completed = false;
+
+            for(rocblas_int pass = 0; pass < 4; pass++)
+            {
+                // work = X(:,0:j-1)' * x
+                for(rocblas_int l = tid; l < j; l += BS1)
+                {
+                    S c = 0;
+                    for(rocblas_int i = 0; i < n; i++)
+                        c += X[i + l * n] * x[i];
+                    work[l] = c;
+                }
+                __syncthreads();
+
+                // x = x - X(:,0:j-1) * work, and compute its norm
+                S t = 0;
+                for(rocblas_int i = tid; i < n; i += BS1)
+                {
+                    S xi = x[i];
+                    for(rocblas_int l = 0; l < j; l++)
+                        xi -= X[i + l * n] * work[l];
+                    x[i] = xi;
+                    t += xi * xi;
+                }
+                sval[tid] = t;
+                __syncthreads();
+
+                for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+                {
+                    if(tid < r)
+                        sval[tid] += sval[tid + r];
+                    __syncthreads();
+                }
+                S nrm = sqrt(sval[0]);
+                __syncthreads();
+
+                // the vector is accepted after two passes if it kept at least half of its length
+                if(pass % 2 == 1 && (nrm > S(0.5) || completed))
+                {
+                    for(rocblas_int i = tid; i < n; i += BS1)
+                        x[i] /= nrm;
+                    __syncthreads();
+                    break;
+                }
+
+                if(pass % 2 == 1)
+                {
+                    // otherwise, use the canonical vector with the smallest projection
+                    S vmin = 2;
+                    rocblas_int imin = 0;
+                    for(rocblas_int i = tid; i < n; i += BS1)
+                    {
+                        S p = 0;
+                        for(rocblas_int l = 0; l < j; l++)
+                            p += X[i + l * n] * X[i + l * n];
+                        if(p < vmin)
+                        {
+                            vmin = p;
+                            imin = i;
+                        }
+                    }
+                    sval[tid] = vmin;
+                    sidx[tid] = imin;
+                    __syncthreads();
+
+                    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+                    {
+                        if(tid < r && sval[tid + r] < sval[tid])
+                        {
+                            sval[tid] = sval[tid + r];
+                            sidx[tid] = sidx[tid + r];
+                        }
+                        __syncthreads();
+                    }
+
+                    imin = sidx[0];
+                    for(rocblas_int i = tid; i < n; i += BS1)
+                        x[i] = (i == imin ? S(1) : S(0));
+                    completed = true;
+                    __syncthreads();
+                }
+            }
+        }
+    }
+}
+
+/** BDSDC_SET_VECTORS copies the left singular vectors to U, and the right singular vectors to
+    the rows of V.
+    Call this kernel with batch_count groups in z, and enough groups in x and y to cover
+    an n-by-n matrix. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void bdsdc_set_vectors(const rocblas_int n,
+                                        S* UVA,
+                                        T* UU,
+                                        const rocblas_int shiftU,
+                                        const rocblas_int ldu,
+                                        const rocblas_stride strideU,
+                                        T* VV,
+                                        const rocblas_int shiftV,
+                                        const rocblas_int ldv,
+                                        const rocblas_stride strideV,
+                                        rocblas_int* info)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    if(i < n && j < n && info[bid] == 0)
+    {
+        S* UB = UVA + (bid * 2 * n * n);
+        S* VB = UB + n * n;
+        T* U = UU + shiftU + (bid * strideU);
+        T* V = VV + shiftV + (bid * strideV);
+
+        U[i + j * ldu] = T(UB[i + j * n]);
+        V[j + i * ldv] = T(VB[i + j * n]);
+    }
+}
+
+/** Helper to calculate workspace sizes **/
+template <typename T, typename S>
+void rocsolver_bdsdc_getMemorySize(const rocblas_svect svect,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work_stack,
+                                   size_t* size_tempvect,
+                                   size_t* size_tempgemm,
+                                   size_t* size_tmpz,
+                                   size_t* size_splits,
+                                   size_t* size_tgk,
+                                   size_t* size_Z)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work_stack = 0;
+        *size_tempvect = 0;
+        *size_tempgemm = 0;
+        *size_tmpz = 0;
+        *size_splits = 0;
+        *size_tgk = 0;
+        *size_Z = 0;
+        return;
+    }
+
+    rocblas_evect evect
+        = (svect == rocblas_svect_none ? rocblas_evect_none : rocblas_evect_tridiagonal);
+    size_t unused;
+
+    // requirements for the eigenproblem of the TGK matrix (stedc)
+    rocsolver_stedc_getMemorySize<false, S, S>(evect, 2 * n, batch_count, size_work_stack,
+                                               size_tempvect, size_tempgemm, size_tmpz, size_splits,
+                                               &unused);
+
+    // size of the diagonal and off-diagonal of the TGK matrix
+    *size_tgk = sizeof(S) * 4 * n * batch_count;
+
+    if(svect == rocblas_svect_none)
+        *size_Z = 0;
+    else
+    {
+        // size of the eigenvectors of the TGK matrix
+        *size_Z = sizeof(S) * 4 * n * n * batch_count;
+
+        // the singular vectors and the coefficients for the re-orthogonalization re-use the
+        // workspace of stedc
+        *size_tempgemm = std::max(*size_tempgemm, sizeof(S) * 2 * n * n * batch_count);
+        *size_tmpz = std::max(*size_tmpz, sizeof(S) * n * batch_count);
+    }
+}
+
+/** Argument checking **/
+template <typename T, typename S>
+rocblas_status rocsolver_bdsdc_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_svect svect,
+                                        const rocblas_int n,
+                                        S* D,
+                                        S* E,
+                                        T* U,
+                                        const rocblas_int ldu,
+                                        T* V,
+                                        const rocblas_int ldv,
+                                        rocblas_int* info)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(svect != rocblas_svect_none && svect != rocblas_svect_singular)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || ldu < 1 || ldv < 1)
+        return rocblas_status_invalid_size;
+    if(svect != rocblas_svect_none && (ldu < n || ldv < n))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !D) || (n > 1 && !E) || !info)
+        return rocblas_status_invalid_pointer;
+    if(svect != rocblas_svect_none && n && (!U || !V))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** BDSDC templated function.
+    The singular value decomposition of the bidiagonal matrix B is obtained from the
+    eigendecomposition of the associated 2n-by-2n Golub-Kahan (TGK) tridiagonal matrix,
+    which is computed with the divide-and-conquer method of STEDC. **/
+template <typename T, typename S>
+rocblas_status rocsolver_bdsdc_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_svect svect,
+                                        const rocblas_int n,
+                                        S* D,
+                                        const rocblas_stride strideD,
+                                        S* E,
+                                        const rocblas_stride strideE,
+                                        T* U,
+                                        const rocblas_int shiftU,
+                                        const rocblas_int ldu,
+                                        const rocblas_stride strideU,
+                                        T* V,
+                                        const rocblas_int shiftV,
+                                        const rocblas_int ldv,
+                                        const rocblas_stride strideV,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        void* work_stack,
+                                        S* tempvect,
+                                        S* tempgemm,
+                                        S* tmpz,
+                                        rocblas_int* splits,
+                                        S* tgk,
+                                        S* Z)
+{
+    ROCSOLVER_ENTER("bdsdc", "uplo:", uplo, "svect:", svect, "n:", n, "shiftU:", shiftU,
+                    "ldu:", ldu, "shiftV:", shiftV, "ldv:", ldv, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // set info = 0
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocksReset, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                            batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    const rocblas_int ntgk = 2 * n;
+    S* Dtgk = tgk;
+    S* Etgk = tgk + ntgk * batch_count;
+
+    // zero out diagonal of tridiagonal matrix (Dtgk)
+    rocblas_int blocksZero = (ntgk * batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocksZero, 1, 1), dim3(BS1, 1, 1), 0, stream, Dtgk,
+                            ntgk * batch_count, 0);
+
+    // populate off-diagonal of tridiagonal matrix (Etgk) by interleaving entries of D and E
+    rocblas_int blocksCopy = (n - 1) / BS1 + 1;
+    dim3 gridCopy(1, blocksCopy, batch_count);
+    dim3 threadsCopy(1, BS1);
+
+    ROCSOLVER_LAUNCH_KERNEL((copy_mat<S, S*>), gridCopy, threadsCopy, 0, stream, 1, n, D, 0, 1,
+                            strideD, Etgk, 0, 2, ntgk);
+    ROCSOLVER_LAUNCH_KERNEL((copy_mat<S, S*>), gridCopy, threadsCopy, 0, stream, 1, n - 1, E, 0, 1,
+                            strideE, Etgk, 1, 2, ntgk);
+
+    // compute the eigenvalues (and eigenvectors) of the tridiagonal matrix
+    rocblas_evect evect
+        = (svect == rocblas_svect_none ? rocblas_evect_none : rocblas_evect_tridiagonal);
+    rocsolver_stedc_template<false, true, S>(handle, evect, ntgk, Dtgk, 0, ntgk, Etgk, 0, ntgk, Z,
+                                             0, ntgk, ntgk * ntgk, info, batch_count, work_stack,
+                                             tempvect, tempgemm, tmpz, splits, (S**)nullptr);
+
+    // extract singular values (and singular vectors) from the largest eigenpairs
+    S* UV = tempgemm;
+    ROCSOLVER_LAUNCH_KERNEL(bdsdc_extract<S>, dim3(n, batch_count), dim3(BS1), 0, stream, uplo, n,
+                            D, strideD, Dtgk, (svect == rocblas_svect_none ? (S*)nullptr : Z), UV,
+                            info);
+
+    if(svect != rocblas_svect_none)
+    {
+        S tol = sqrt(get_epsilon<S>());
+
+        // fix the vectors associated with negligible singular values
+        ROCSOLVER_LAUNCH_KERNEL(bdsdc_reorth<S>, dim3(batch_count), dim3(BS1), 0, stream, n, D,
+                                strideD, UV, tmpz, info, tol);
+
+        // copy the singular vectors to the output matrices
+        rocblas_int blocks = (n - 1) / BS2 + 1;
+        ROCSOLVER_LAUNCH_KERNEL((bdsdc_set_vectors<T, S>), dim3(blocks, blocks, batch_count),
+                                dim3(BS2, BS2), 0, stream, n, UV, U, shiftU, ldu, strideU, V,
+                                shiftV, ldv, strideV, info);
+    }
+
+    return rocblas_status_success;
+}
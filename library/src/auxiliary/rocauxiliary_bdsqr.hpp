@@ -48,7 +48,8 @@ __device__ T bdsqr_estimate(const rocblas_int n, T* D, T* E, int t2b, T tol, int
 
 /** BDSQR_T2BQRSTEP device function applies implicit QR interation to
     the n-by-n bidiagonal matrix given by D and E, using shift = sh,
-    from top to bottom **/
+    from top to bottom. The rotations are saved in rots (with leading dimension ldr)
+    and, if update = true, applied to the singular vectors **/
 template <typename T, typename S>
 __device__ void bdsqr_t2bQRstep(const rocblas_int tid,
                                 const rocblas_int n,
@@ -64,11 +65,13 @@ __device__ void bdsqr_t2bQRstep(const rocblas_int tid,
                                 T* C,
                                 const rocblas_int ldc,
                                 const S sh,
-                                S* rots)
+                                S* rots,
+                                const rocblas_int ldr,
+                                const bool update)
 {
     S f, g, c, s, r;
     T temp1, temp2;
-    rocblas_int nr = nv ? 2 * n : 0;
+    rocblas_int nr = nv ? 2 * ldr : 0;
 
     if(tid == 0)
     {
@@ -93,7 +96,7 @@ __device__ void bdsqr_t2bQRstep(const rocblas_int tid,
             if(nv)
             {
                 rots[k] = c;
-                rots[k + n] = -s;
+                rots[k + ldr] = -s;
             }
 
             // then apply rotation by rows
@@ -110,7 +113,7 @@ __device__ void bdsqr_t2bQRstep(const rocblas_int tid,
             if(nu || nc)
             {
                 rots[k + nr] = c;
-                rots[k + nr + n] = -s;
+                rots[k + nr + ldr] = -s;
             }
         }
         E[n - 2] = f;
@@ -118,6 +121,10 @@ __device__ void bdsqr_t2bQRstep(const rocblas_int tid,
     __syncthreads();
 
     // update singular vectors
+    // (unless the rotations are accumulated and applied later by blocks)
+    if(!update)
+        return;
+
     if(nv)
     {
         // rotate from the left (forward direction)
@@ -128,7 +135,7 @@ __device__ void bdsqr_t2bQRstep(const rocblas_int tid,
                 temp1 = V[i + j * ldv];
                 temp2 = V[i + 1 + j * ldv];
                 c = rots[i];
-                s = rots[i + n];
+                s = rots[i + ldr];
                 V[i + j * ldv] = c * temp1 + s * temp2;
                 V[i + 1 + j * ldv] = c * temp2 - s * temp1;
             }
@@ -144,7 +151,7 @@ __device__ void bdsqr_t2bQRstep(const rocblas_int tid,
                 temp1 = U[i + j * ldu];
                 temp2 = U[i + (j + 1) * ldu];
                 c = rots[j + nr];
-                s = rots[j + nr + n];
+                s = rots[j + nr + ldr];
                 U[i + j * ldu] = c * temp1 + s * temp2;
                 U[i + (j + 1) * ldu] = c * temp2 - s * temp1;
             }
@@ -160,7 +167,7 @@ __device__ void bdsqr_t2bQRstep(const rocblas_int tid,
                 temp1 = C[i + j * ldc];
                 temp2 = C[i + 1 + j * ldc];
                 c = rots[i + nr];
-                s = rots[i + nr + n];
+                s = rots[i + nr + ldr];
                 C[i + j * ldc] = c * temp1 + s * temp2;
                 C[i + 1 + j * ldc] = c * temp2 - s * temp1;
             }
@@ -170,7 +177,8 @@ __device__ void bdsqr_t2bQRstep(const rocblas_int tid,
 
 /** BDSQR_B2TQRSTEP device function applies implicit QR interation to
     the n-by-n bidiagonal matrix given by D and E, using shift = sh,
-    from bottom to top **/
+    from bottom to top. The rotations are saved in rots (with leading dimension ldr)
+    and, if update = true, applied to the singular vectors **/
 template <typename T, typename S>
 __device__ void bdsqr_b2tQRstep(const rocblas_int tid,
                                 const rocblas_int n,
@@ -186,11 +194,13 @@ __device__ void bdsqr_b2tQRstep(const rocblas_int tid,
                                 T* C,
                                 const rocblas_int ldc,
                                 const S sh,
-                                S* rots)
+                                S* rots,
+                                const rocblas_int ldr,
+                                const bool update)
 {
     S f, g, c, s, r;
     T temp1, temp2;
-    rocblas_int nr = nv ? 2 * n : 0;
+    rocblas_int nr = nv ? 2 * ldr : 0;
 
     if(tid == 0)
     {
@@ -215,7 +225,7 @@ __device__ void bdsqr_b2tQRstep(const rocblas_int tid,
             if(nu || nc)
             {
                 rots[(k - 1) + nr] = c;
-                rots[(k - 1) + nr + n] = s;
+                rots[(k - 1) + nr + ldr] = s;
             }
 
             // then apply rotation by columns
@@ -232,7 +242,7 @@ __device__ void bdsqr_b2tQRstep(const rocblas_int tid,
             if(nv)
             {
                 rots[k - 1] = c;
-                rots[(k - 1) + n] = s;
+                rots[(k - 1) + ldr] = s;
             }
         }
         E[0] = f;
@@ -240,6 +250,10 @@ __device__ void bdsqr_b2tQRstep(const rocblas_int tid,
     __syncthreads();
 
     // update singular vectors
+    // (unless the rotations are accumulated and applied later by blocks)
+    if(!update)
+        return;
+
     if(nv)
     {
         // rotate from the left (backward direction)
@@ -250,7 +264,7 @@ __device__ void bdsqr_b2tQRstep(const rocblas_int tid,
                 temp1 = V[i + j * ldv];
                 temp2 = V[i - 1 + j * ldv];
                 c = rots[i - 1];
-                s = rots[(i - 1) + n];
+                s = rots[(i - 1) + ldr];
                 V[i + j * ldv] = c * temp1 - s * temp2;
                 V[i - 1 + j * ldv] = c * temp2 + s * temp1;
             }
@@ -266,7 +280,7 @@ __device__ void bdsqr_b2tQRstep(const rocblas_int tid,
                 temp1 = U[i + j * ldu];
                 temp2 = U[i + (j - 1) * ldu];
                 c = rots[(j - 1) + nr];
-                s = rots[(j - 1) + nr + n];
+                s = rots[(j - 1) + nr + ldr];
                 U[i + j * ldu] = c * temp1 - s * temp2;
                 U[i + (j - 1) * ldu] = c * temp2 + s * temp1;
             }
@@ -282,7 +296,7 @@ __device__ void bdsqr_b2tQRstep(const rocblas_int tid,
                 temp1 = C[i + j * ldc];
                 temp2 = C[i - 1 + j * ldc];
                 c = rots[(i - 1) + nr];
-                s = rots[(i - 1) + nr + n];
+                s = rots[(i - 1) + nr + ldr];
                 C[i + j * ldc] = c * temp1 - s * temp2;
                 C[i - 1 + j * ldc] = c * temp2 + s * temp1;
             }
@@ -290,8 +304,133 @@ __device__ void bdsqr_b2tQRstep(const rocblas_int tid,
     }
 }
 
+/** BDSQR_APPLY_ROTS_BLOCKED device function applies to the vectors in X the rotations
+    of ns QR sweeps saved in rc (cosines) and rs (sines), with stride incr between sweeps.
+    The rotations are combined into small orthogonal blocks following a wavefront
+    ordering, and the blocks are applied with matrix-matrix products. Element r of
+    vector j is X[r * incx + j * ldx], for r = 0,...,nf-1 and j = 0,...,nx-1.
+    Q is a workspace in shared memory **/
+template <typename T, typename S>
+__device__ void bdsqr_apply_rots_blocked(const rocblas_int tid,
+                                         const rocblas_int nf,
+                                         const rocblas_int ns,
+                                         const int t2b,
+                                         S* rc,
+                                         S* rs,
+                                         const rocblas_int incr,
+                                         T* X,
+                                         const rocblas_int incx,
+                                         const rocblas_int ldx,
+                                         const rocblas_int nx,
+                                         S* Q)
+{
+    constexpr rocblas_int nb = BDSQR_ACC_BLOCK;
+    constexpr rocblas_int ldq = BDSQR_ACC_BLOCK + BDSQR_ACC_SWEEPS;
+    const rocblas_int np = nf - 1;
+
+    // sweeps from bottom to top are applied as sweeps from top to bottom
+    // on the vectors with reversed order of elements
+    T* X0 = t2b ? X : X + np * incx;
+    const rocblas_int inc = t2b ? incx : -incx;
+
+    S c, s, temp1, temp2;
+    S q[ldq];
+    T x[ldq];
+    T temp;
+
+    // block w contains rotations w*nb-l to (w+1)*nb-l-1 of each sweep l,
+    // and only acts on elements r0 to r1 of the vectors
+    for(rocblas_int w = 0; w * nb < np + ns - 1; w++)
+    {
+        rocblas_int r0 = max(0, w * nb - ns + 1);
+        rocblas_int r1 = min(np, (w + 1) * nb);
+        rocblas_int mw = r1 - r0 + 1;
+
+        // accumulate the rotations of the block in Q
+        // (each thread computes full columns of Q)
+        for(rocblas_int col = tid; col < mw; col += hipBlockDim_x)
+        {
+            for(rocblas_int r = 0; r < mw; r++)
+                q[r] = (r == col) ? 1 : 0;
+
+            for(rocblas_int l = 0; l < ns; l++)
+            {
+                rocblas_int j0 = max(0, w * nb - l);
+                rocblas_int j1 = min(np, (w + 1) * nb - l);
+                for(rocblas_int j = j0; j < j1; j++)
+                {
+                    rocblas_int jj = t2b ? j : np - 1 - j;
+                    c = rc[jj + l * incr];
+                    s = t2b ? rs[jj + l * incr] : -rs[jj + l * incr];
+                    temp1 = q[j - r0];
+                    temp2 = q[j + 1 - r0];
+                    q[j - r0] = c * temp1 + s * temp2;
+                    q[j + 1 - r0] = c * temp2 - s * temp1;
+                }
+            }
+
+            for(rocblas_int r = 0; r < mw; r++)
+                Q[r + col * ldq] = q[r];
+        }
+        __syncthreads();
+
+        // update the vectors
+        for(rocblas_int j = tid; j < nx; j += hipBlockDim_x)
+        {
+            for(rocblas_int r = 0; r < mw; r++)
+                x[r] = X0[(r0 + r) * inc + j * ldx];
+
+            for(rocblas_int r = 0; r < mw; r++)
+            {
+                temp = 0;
+                for(rocblas_int kk = 0; kk < mw; kk++)
+                    temp += Q[r + kk * ldq] * x[kk];
+                X0[(r0 + r) * inc + j * ldx] = temp;
+            }
+        }
+        __syncthreads();
+    }
+}
+
+/** BDSQR_APPLY_SWEEPS device function applies to the singular vectors the rotations
+    of the last ns QR sweeps on the nf-by-nf diagonal block, as saved in rots
+    by BDSQR_T2BQRSTEP or BDSQR_B2TQRSTEP **/
+template <typename T, typename S>
+__device__ void bdsqr_apply_sweeps(const rocblas_int tid,
+                                   const rocblas_int nf,
+                                   const rocblas_int ns,
+                                   const int t2b,
+                                   const rocblas_int nv,
+                                   const rocblas_int nu,
+                                   const rocblas_int nc,
+                                   T* V,
+                                   const rocblas_int ldv,
+                                   T* U,
+                                   const rocblas_int ldu,
+                                   T* C,
+                                   const rocblas_int ldc,
+                                   S* rots,
+                                   const rocblas_int ldr,
+                                   const rocblas_int incr,
+                                   S* Q)
+{
+    rocblas_int nr = nv ? 2 * ldr : 0;
+
+    // V is rotated by rows, U by columns, and C by rows
+    if(nv)
+        bdsqr_apply_rots_blocked<T>(tid, nf, ns, t2b, rots, rots + ldr, incr, V, 1, ldv, nv, Q);
+    if(nu)
+        bdsqr_apply_rots_blocked<T>(tid, nf, ns, t2b, rots + nr, rots + nr + ldr, incr, U, ldu, 1,
+                                    nu, Q);
+    if(nc)
+        bdsqr_apply_rots_blocked<T>(tid, nf, ns, t2b, rots + nr, rots + nr + ldr, incr, C, 1, ldc,
+                                    nc, Q);
+}
+
 /** BDSQR_KERNEL implements the main loop of the bdsqr algorithm
-    to compute the SVD of an upper bidiagonal matrix given by D and E **/
+    to compute the SVD of an upper bidiagonal matrix given by D and E.
+    If nsweeps > 1, the rotations of up to nsweeps QR sweeps are accumulated
+    before updating the singular vectors **/
 template <typename T, typename S, typename W1, typename W2, typename W3>
 ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
                                    const rocblas_int nv,
@@ -322,7 +461,8 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
                                    rocblas_int* splitsA,
                                    S* workA,
                                    const rocblas_int incW,
-                                   const rocblas_stride strideW)
+                                   const rocblas_stride strideW,
+                                   const rocblas_int nsweeps)
 {
     rocblas_int tid = hipThreadIdx_x;
     rocblas_int sid = hipBlockIdx_y;
@@ -346,12 +486,23 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
     rocblas_int* splits = splitsA + bid * n;
     S* work = workA + bid * strideW;
     S* rots = work + 2;
+    S* rotsl = rots;
+    rocblas_int incr = incW * n;
+
+    // shared memory for the orthogonal blocks
+    // (only used if the rotations are accumulated)
+    extern __shared__ double lmem[];
+    S* Q = reinterpret_cast<S*>(lmem);
+
+    // number and direction of the accumulated sweeps
+    rocblas_int nacc = 0;
+    int accdir = 1;
 
     // shared variables
     __shared__ bool applyqr;
     __shared__ int t2b;
     __shared__ S smin, smax, sh, thresh;
-    __shared__ rocblas_int i, k, start;
+    __shared__ rocblas_int i, k, start, kend;
     __shared__ rocblas_int iter;
 
     // get convergence threshold
@@ -369,7 +520,7 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
         {
             // read diagonal block endpoints
             i = start = splits[2 * sid];
-            k = splits[2 * sid + 1];
+            k = kend = splits[2 * sid + 1];
 
             // number of iterations (QR steps) applied to current block
             iter = 0;
@@ -424,14 +575,52 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
                 if(tid == 0)
                     iter += k - i;
 
+                if(nsweeps > 1)
+                {
+                    // the accumulated rotations must be applied before changing direction
+                    if(nacc > 0 && accdir != t2b)
+                    {
+                        bdsqr_apply_sweeps<T>(tid, kend - start + 1, nacc, accdir, nv, nu, nc,
+                                              V + start, ldv, U + start * ldu, ldu, C + start, ldc,
+                                              rots + start, n, incr, Q);
+                        nacc = 0;
+                    }
+
+                    // rotations outside the current range are set to the identity
+                    rotsl = rots + nacc * incr;
+                    for(rocblas_int j = start + tid; j < kend; j += hipBlockDim_x)
+                    {
+                        for(rocblas_int l = 0; l < incW; l += 2)
+                        {
+                            rotsl[j + l * n] = 1;
+                            rotsl[j + (l + 1) * n] = 0;
+                        }
+                    }
+                    __syncthreads();
+                }
+
                 if(t2b)
                     bdsqr_t2bQRstep(tid, k - i + 1, nv, nu, nc, D + i, E + i, V + i, ldv,
-                                    U + i * ldu, ldu, C + i, ldc, smin, rots + incW * i);
+                                    U + i * ldu, ldu, C + i, ldc, smin, rotsl + i, n, nsweeps == 1);
                 else
                     bdsqr_b2tQRstep(tid, k - i + 1, nv, nu, nc, D + i, E + i, V + i, ldv,
-                                    U + i * ldu, ldu, C + i, ldc, smin, rots + incW * i);
+                                    U + i * ldu, ldu, C + i, ldc, smin, rotsl + i, n, nsweeps == 1);
 
+                if(nsweeps > 1)
+                {
+                    accdir = t2b;
+                    nacc++;
+                }
                 __syncthreads();
+
+                // apply the accumulated rotations
+                if(nacc == nsweeps)
+                {
+                    bdsqr_apply_sweeps<T>(tid, kend - start + 1, nacc, accdir, nv, nu, nc,
+                                          V + start, ldv, U + start * ldu, ldu, C + start, ldc,
+                                          rots + start, n, incr, Q);
+                    nacc = 0;
+                }
             }
 
             // update current block endpoints
@@ -453,6 +642,15 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
                 }
                 i++;
             }
+            __syncthreads();
+        }
+
+        // apply the remaining accumulated rotations
+        if(nacc > 0)
+        {
+            bdsqr_apply_sweeps<T>(tid, kend - start + 1, nacc, accdir, nv, nu, nc, V + start, ldv,
+                                  U + start * ldu, ldu, C + start, ldc, rots + start, n, incr, Q);
+            nacc = 0;
         }
 
         sid += hipGridDim_y;
@@ -779,6 +977,19 @@ ROCSOLVER_KERNEL void bdsqr_sort(const rocblas_int n,
 /****** Template function, workspace size and argument validation **********/
 /***************************************************************************/
 
+/** Returns the number of QR sweeps whose rotations are accumulated before
+    updating the singular vectors (1 means that they are not accumulated) **/
+inline rocblas_int bdsqr_num_sweeps(const rocblas_int n,
+                                    const rocblas_int nv,
+                                    const rocblas_int nu,
+                                    const rocblas_int nc)
+{
+    if(n > 2 && max(nv, max(nu, nc)) >= BDSQR_BLOCKED_SWITCH)
+        return BDSQR_ACC_SWEEPS;
+    else
+        return 1;
+}
+
 template <typename T>
 void rocsolver_bdsqr_getMemorySize(const rocblas_int n,
                                    const rocblas_int nv,
@@ -800,12 +1011,14 @@ void rocsolver_bdsqr_getMemorySize(const rocblas_int n,
     *size_splits = sizeof(rocblas_int) * n * batch_count;
 
     // size of workspace
+    // (the rotations of several sweeps are saved if they are accumulated)
     rocblas_int incW = 0;
     if(nv)
         incW += 2;
     if(nu || nc)
         incW += 2;
-    *size_work = sizeof(T) * (2 + incW * n) * batch_count;
+    rocblas_int nsweeps = bdsqr_num_sweeps(n, nv, nu, nc);
+    *size_work = sizeof(T) * (2 + incW * n * nsweeps) * batch_count;
 }
 
 template <typename S, typename W>
@@ -906,7 +1119,12 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
         incW += 2;
     if(nu || nc)
         incW += 2;
-    rocblas_stride strideW = 2 + incW * n;
+    rocblas_int nsweeps = bdsqr_num_sweeps(n, nv, nu, nc);
+    rocblas_stride strideW = 2 + incW * n * nsweeps;
+
+    // shared memory size for the blocked update of the singular vectors
+    constexpr rocblas_int ldq = BDSQR_ACC_BLOCK + BDSQR_ACC_SWEEPS;
+    size_t lmemsize = (nsweeps > 1) ? sizeof(S) * ldq * ldq : 0;
 
     // grid dimensions
     rocblas_int nuc_max = max(nu, nc);
@@ -933,10 +1151,10 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
         }
 
         // main computation of SVD
-        ROCSOLVER_LAUNCH_KERNEL((bdsqr_kernel<T>), grid2, threads3, 0, stream, n, nv, nu, nc, D,
-                                strideD, E, strideE, V, shiftV, ldv, strideV, U, shiftU, ldu,
+        ROCSOLVER_LAUNCH_KERNEL((bdsqr_kernel<T>), grid2, threads3, lmemsize, stream, n, nv, nu, nc,
+                                D, strideD, E, strideE, V, shiftV, ldv, strideV, U, shiftU, ldu,
                                 strideU, C, shiftC, ldc, strideC, info, maxiter, eps, sfm, tol,
-                                minshift, splits, work, incW, strideW);
+                                minshift, splits, work, incW, strideW, nsweeps);
     }
 
     // sort the singular values and vectors
@@ -140,7 +140,7 @@ void rocsolver_bdsvdx_getMemorySize(const rocblas_int n,
                                      size_Esqr, size_bounds, size_inter, size_ninter);
 
     // extra requirements for computing the eigenvectors (stein)
-    rocsolver_stein_getMemorySize<T, T>(2 * n, batch_count, &b1, &a1);
+    rocsolver_stein_getMemorySize<T, T>(2 * n, 2 * n, batch_count, &b1, &a1);
 
     *size_work1_iwork = std::max(*size_work1_iwork, a1);
     *size_work2_pivmin = std::max(*size_work2_pivmin, b1);
@@ -313,9 +313,9 @@ rocblas_status rocsolver_bdsvdx_template(rocblas_handle handle,
     else
     {
         // compute eigenvectors of tridiagonal matrix
-        rocsolver_stein_template<T>(handle, ntgk, Dtgk, 0, ntgk, Etgk, 0, ntgk, nsv, Stmp, 0, ntgk,
-                                    iblock, ntgk, isplit, ntgk, Z, shiftZ, ldz, strideZ, ifail,
-                                    strideF, info, batch_count, work2_pivmin, work1_iwork);
+        rocsolver_stein_template<T>(handle, ntgk, Dtgk, 0, ntgk, Etgk, 0, ntgk, nsv, ntgk, Stmp, 0,
+                                    ntgk, iblock, ntgk, isplit, ntgk, Z, shiftZ, ldz, strideZ,
+                                    ifail, strideF, info, batch_count, work2_pivmin, work1_iwork);
 
         // sort eigenvalues and vectors
         ROCSOLVER_LAUNCH_KERNEL(syevx_sort_eigs<T>, dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
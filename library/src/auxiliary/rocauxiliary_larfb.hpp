@@ -64,6 +64,174 @@ ROCSOLVER_KERNEL void addmatA1(const rocblas_int ldw,
     }
 }
 
+/** LARFB_FUSED_KERNEL applies the block reflector H = I - V * T * V' (or its conjugate transpose),
+    formed by k <= LARFT_SMALL_MAX_K forward column-wise Householder vectors, to the m-by-n matrix
+    A from the left or from the right with a single kernel launch. Every work-group computes
+    W = V'A, W = T * W (or T' * W) and A = A - V * W for LARFT_SMALL_CHUNK columns of A (if side is
+    left) or rows of A (if side is right), keeping W in shared memory and staging blocks of
+    LARFT_SMALL_CHUNK rows of V and A.
+
+    Call this kernel with ceil(n / LARFT_SMALL_CHUNK) groups in x if side is left (or
+    ceil(m / LARFT_SMALL_CHUNK) if side is right), batch_count groups in y, and BS1 threads
+    in x. **/
+template <typename T, typename U1, typename U2>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) larfb_fused_kernel(const rocblas_side side,
+                                                                const rocblas_operation trans,
+                                                                const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                const rocblas_int k,
+                                                                U1 VV,
+                                                                const rocblas_int shiftV,
+                                                                const rocblas_int ldv,
+                                                                const rocblas_stride strideV,
+                                                                T* FA,
+                                                                const rocblas_int shiftF,
+                                                                const rocblas_int ldf,
+                                                                const rocblas_stride strideF,
+                                                                U2 AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA)
+{
+    constexpr rocblas_int CH = LARFT_SMALL_CHUNK;
+    constexpr rocblas_int LDW = LARFT_SMALL_MAX_K;
+    constexpr rocblas_int NACC = (LDW * CH - 1) / BS1 + 1;
+
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    // array pointers
+    T* V = load_ptr_batch<T>(VV, bid, shiftV, strideV);
+    T* F = FA + shiftF + bid * strideF;
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+    // shared memory
+    __shared__ T sv[CH * LDW];
+    __shared__ T sa[CH * CH];
+    __shared__ T sw[LDW * CH];
+
+    // if side is right, the kernel works with A' instead, so that the reflector is always applied
+    // from the left; H' is then applied if side is left and trans is not none, or if side is right
+    // and trans is none
+    bool left = (side == rocblas_side_left);
+    bool conjT = (left == (trans != rocblas_operation_none));
+    rocblas_int nq = (left ? m : n);
+    rocblas_int nc = (left ? n : m);
+    rocblas_int c0 = hipBlockIdx_x * CH;
+    rocblas_int e, l, p, r, rr, c;
+
+    T acc[NACC];
+    for(rocblas_int q = 0; q < NACC; q++)
+        acc[q] = 0;
+
+    // compute W = V'A
+    for(rocblas_int r0 = 0; r0 < nq; r0 += CH)
+    {
+        // load rows r0:r0+CH-1 of V and A
+        for(e = tid; e < CH * k; e += BS1)
+        {
+            r = r0 + e % CH;
+            l = e / CH;
+            sv[e] = (r >= nq || r < l ? T(0) : (r == l ? T(1) : V[r + l * ldv]));
+        }
+        for(e = tid; e < CH * CH; e += BS1)
+        {
+            rr = (left ? e % CH : e / CH);
+            c = (left ? e / CH : e % CH);
+            r = r0 + rr;
+            if(r < nq && c0 + c < nc)
+                sa[rr + c * CH] = (left ? A[r + (c0 + c) * lda] : conj(A[(c0 + c) + r * lda]));
+            else
+                sa[rr + c * CH] = 0;
+        }
+        __syncthreads();
+
+        for(rocblas_int q = 0; q < NACC; q++)
+        {
+            e = tid + q * BS1;
+            l = e % k;
+            c = e / k;
+            if(c < CH)
+            {
+                for(rr = 0; rr < CH; rr++)
+                    acc[q] += conj(sv[rr + l * CH]) * sa[rr + c * CH];
+            }
+        }
+        __syncthreads();
+    }
+
+    for(rocblas_int q = 0; q < NACC; q++)
+    {
+        e = tid + q * BS1;
+        if(e < k * CH)
+            sw[e % k + (e / k) * LDW] = acc[q];
+    }
+    __syncthreads();
+
+    // compute W = T * W or W = T' * W
+    for(rocblas_int q = 0; q < NACC; q++)
+    {
+        e = tid + q * BS1;
+        l = e % k;
+        c = e / k;
+        acc[q] = 0;
+        if(c < CH)
+        {
+            if(conjT)
+            {
+                for(p = 0; p <= l; p++)
+                    acc[q] += conj(F[p + l * ldf]) * sw[p + c * LDW];
+            }
+            else
+            {
+                for(p = l; p < k; p++)
+                    acc[q] += F[l + p * ldf] * sw[p + c * LDW];
+            }
+        }
+    }
+    __syncthreads();
+
+    for(rocblas_int q = 0; q < NACC; q++)
+    {
+        e = tid + q * BS1;
+        if(e < k * CH)
+            sw[e % k + (e / k) * LDW] = acc[q];
+    }
+    __syncthreads();
+
+    // compute A = A - V * W
+    for(rocblas_int r0 = 0; r0 < nq; r0 += CH)
+    {
+        // load rows r0:r0+CH-1 of V
+        for(e = tid; e < CH * k; e += BS1)
+        {
+            r = r0 + e % CH;
+            l = e / CH;
+            sv[e] = (r >= nq || r < l ? T(0) : (r == l ? T(1) : V[r + l * ldv]));
+        }
+        __syncthreads();
+
+        for(e = tid; e < CH * CH; e += BS1)
+        {
+            rr = (left ? e % CH : e / CH);
+            c = (left ? e / CH : e % CH);
+            r = r0 + rr;
+            if(r < nq && c0 + c < nc)
+            {
+                T temp = 0;
+                for(l = 0; l < k; l++)
+                    temp += sv[rr + l * CH] * sw[l + c * LDW];
+
+                if(left)
+                    A[r + (c0 + c) * lda] -= temp;
+                else
+                    A[(c0 + c) + r * lda] -= conj(temp);
+            }
+        }
+        __syncthreads();
+    }
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_larfb_getMemorySize(const rocblas_side side,
                                    const rocblas_int m,
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "lapack_device_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
 
@@ -94,6 +95,100 @@ ROCSOLVER_KERNEL void set_taubeta(T* tau,
     }
 }
 
+/** LARFG_KERNEL generates the Householder reflector of every vector in the batch with a single
+    kernel launch. Each work-group computes the norm of x in one pass, the scalars tau and beta
+    (rescaling them, as LAPACK does, when beta is too small), and then scales x cooperatively.
+    Call this kernel with batch_count groups in y, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) larfg_kernel(const rocblas_int n,
+                                                          U alpha,
+                                                          const rocblas_int shifta,
+                                                          U x,
+                                                          const rocblas_int shiftx,
+                                                          const rocblas_int incx,
+                                                          const rocblas_stride stridex,
+                                                          T* tau,
+                                                          const rocblas_stride strideP,
+                                                          const S safmin)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // select batch instance
+    T* a = load_ptr_batch<T>(alpha, bid, shifta, stridex);
+    T* xx = load_ptr_batch<T>(x, bid, shiftx, stridex);
+    T* t = tau + bid * strideP;
+
+    // shared memory setup
+    __shared__ S sscale[BS1];
+    __shared__ S sssq[BS1];
+
+    // alpha is read before the reduction to ensure no thread reads it after it is overwritten
+    T alph = a[0];
+    S ar = real_part(alph);
+    S ai = imag_part(alph);
+
+    // compute the norm of x
+    nrm2_scaled<BS1>(tid, n - 1, xx, incx, sscale, sssq);
+    __syncthreads();
+    S xnorm = sscale[0];
+
+    // if x is zero and alpha is real, H is the identity
+    if(xnorm == 0 && ai == 0)
+    {
+        if(tid == 0)
+            t[0] = 0;
+        return;
+    }
+
+    // beta = -sign(ar) * lapy3(ar, ai, xnorm)
+    S w = max(max(std::abs(ar), std::abs(ai)), xnorm);
+    S beta = w * sqrt((ar / w) * (ar / w) + (ai / w) * (ai / w) + (xnorm / w) * (xnorm / w));
+    beta = ar >= 0 ? -beta : beta;
+
+    // if beta is tiny, scale x, alpha and beta up (at most 20 times)
+    // and recompute beta; safmin is a power of 2, so the scaling is exact
+    S rsafmn = 1 / safmin;
+    rocblas_int knt = 0;
+    if(std::abs(beta) < safmin)
+    {
+        do
+        {
+            knt++;
+            xnorm *= rsafmn;
+            beta *= rsafmn;
+            ar *= rsafmn;
+            ai *= rsafmn;
+            alph = alph * T(rsafmn);
+        } while(std::abs(beta) < safmin && knt < 20);
+
+        w = max(max(std::abs(ar), std::abs(ai)), xnorm);
+        beta = w * sqrt((ar / w) * (ar / w) + (ai / w) * (ai / w) + (xnorm / w) * (xnorm / w));
+        beta = ar >= 0 ? -beta : beta;
+    }
+
+    // scaling factor of x
+    T scal = T(1) / (alph - T(beta));
+
+    // x = x * scal (including the rescaling, if any)
+    for(int i = tid; i < n - 1; i += BS1)
+    {
+        T v = xx[i * incx];
+        for(int k = 0; k < knt; k++)
+            v = v * T(rsafmn);
+        xx[i * incx] = v * scal;
+    }
+
+    // tau and beta
+    if(tid == 0)
+    {
+        t[0] = (T(beta) - alph) / T(beta);
+        for(int k = 0; k < knt; k++)
+            beta *= safmin;
+        a[0] = beta;
+    }
+}
+
 template <typename T>
 void rocsolver_larfg_getMemorySize(const rocblas_int n,
                                    const rocblas_int batch_count,
@@ -182,6 +277,16 @@ rocblas_status rocsolver_larfg_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    // small vectors are processed with a single kernel launch
+    if(n <= LARFG_SMALL_MAX_N)
+    {
+        using S = decltype(std::real(T{}));
+        ROCSOLVER_LAUNCH_KERNEL((larfg_kernel<T>), dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                                stream, n, alpha, shifta, x, shiftx, incx, stridex, tau, strideP,
+                                S(get_safemin<S>()));
+        return rocblas_status_success;
+    }
+
     // everything must be executed with scalars on the device
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
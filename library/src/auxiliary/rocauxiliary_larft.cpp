@@ -62,9 +62,9 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle,
         init_scalars(handle, (T*)scalars);
 
     // execution
-    return rocsolver_larft_template<T>(handle, direct, storev, n, k, V, shiftV, ldv, stridev, tau,
-                                       stridet, F, ldf, stridef, batch_count, (T*)scalars, (T*)work,
-                                       (T**)workArr);
+    return rocsolver_larft_template<false, false, T>(
+        handle, direct, storev, n, k, V, shiftV, ldv, stridev, tau, stridet, F, ldf, stridef,
+        batch_count, (T*)scalars, (T*)work, (T**)workArr);
 }
 
 /*
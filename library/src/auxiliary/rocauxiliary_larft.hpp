@@ -9,79 +9,159 @@
 
 #pragma once
 
-#include "rocauxiliary_lacgv.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
 
-template <typename T, typename U, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
-ROCSOLVER_KERNEL void set_triangular(const rocblas_int n,
-                                     const rocblas_int k,
-                                     U V,
-                                     const rocblas_int shiftV,
-                                     const rocblas_int ldv,
-                                     const rocblas_stride strideV,
-                                     T* tau,
-                                     const rocblas_stride strideT,
-                                     T* F,
-                                     const rocblas_int ldf,
-                                     const rocblas_stride strideF,
-                                     const rocblas_direct direct,
-                                     const rocblas_storev storev)
+/** LARFT_KERNEL computes the triangular factor T (stored in F) of a block reflector formed by
+    k <= LARFT_SMALL_MAX_K Householder vectors, using a single work-group per matrix. The columns
+    of T are computed one at a time from the Gram matrix G = V'V (where the vectors are the
+    columns of V, or the conjugated rows of V if storev is row-wise, including their implicit
+    ones and zeros): T(0:i-1,i) = -tau(i) * T(0:i-1,0:i-1) * G(0:i-1,i) if direct is forward,
+    and T(i+1:k-1,i) = -tau(i) * T(i+1:k-1,i+1:k-1) * G(i+1:k-1,i) if direct is backward.
+
+    If gram is true, the strictly upper (forward) or lower (backward) triangular part of G is
+    first computed by this kernel, staging blocks of LARFT_SMALL_CHUNK rows of V in shared memory.
+    Otherwise, it is expected to be already stored in F.
+
+    Call this kernel with batch_count groups in y, and BS1 threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) larft_kernel(const rocblas_direct direct,
+                                                          const rocblas_storev storev,
+                                                          const bool gram,
+                                                          const rocblas_int n,
+                                                          const rocblas_int k,
+                                                          U VV,
+                                                          const rocblas_int shiftV,
+                                                          const rocblas_int ldv,
+                                                          const rocblas_stride strideV,
+                                                          T* tauA,
+                                                          const rocblas_stride strideT,
+                                                          T* FA,
+                                                          const rocblas_int ldf,
+                                                          const rocblas_stride strideF)
 {
-    const auto b = hipBlockIdx_z;
-    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    constexpr rocblas_int CH = LARFT_SMALL_CHUNK;
+    constexpr rocblas_int NACC = (LARFT_SMALL_MAX_K * LARFT_SMALL_MAX_K - 1) / BS1 + 1;
 
-    if(i < k && j < k)
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    // array pointers
+    T* tau = tauA + bid * strideT;
+    T* F = FA + bid * strideF;
+
+    // shared memory
+    __shared__ T sv[CH * LARFT_SMALL_MAX_K];
+
+    bool forward = (direct == rocblas_forward_direction);
+    rocblas_int e, i, j, l;
+
+    if(gram)
     {
-        T *tp, *Vp, *Fp;
-        tp = tau + b * strideT;
-        Vp = load_ptr_batch<T>(V, b, shiftV, strideV);
-        Fp = F + b * strideF;
-
-        if(j == i)
-            Fp[j + i * ldf] = tp[i];
-        else if(direct == rocblas_forward_direction)
+        T* V = load_ptr_batch<T>(VV, bid, shiftV, strideV);
+        bool colwise = (storev == rocblas_column_wise);
+
+        T acc[NACC];
+        for(rocblas_int q = 0; q < NACC; q++)
+            acc[q] = 0;
+
+        for(rocblas_int r0 = 0; r0 < n; r0 += CH)
         {
-            if(j < i)
+            // load rows r0:r0+CH-1 of the Householder vectors
+            for(e = tid; e < CH * k; e += BS1)
             {
-                if(storev == rocblas_column_wise)
-                    Fp[j + i * ldf] = -tp[i] * Vp[i + j * ldv];
+                rocblas_int r = r0 + e % CH;
+                l = e / CH;
+
+                // position of the implicit one in the l-th vector
+                rocblas_int p = (forward ? l : n - k + l);
+
+                if(r >= n || (forward ? r < p : r > p))
+                    sv[e] = 0;
+                else if(r == p)
+                    sv[e] = 1;
                 else
-                    Fp[j + i * ldf] = -tp[i] * Vp[j + i * ldv];
+                    sv[e] = (colwise ? V[r + l * ldv] : conj(V[l + r * ldv]));
             }
-            else
-                Fp[j + i * ldf] = 0;
+            __syncthreads();
+
+            // accumulate G(j,i) for j < i (forward) or j > i (backward)
+            for(rocblas_int q = 0; q < NACC; q++)
+            {
+                e = tid + q * BS1;
+                j = e % k;
+                i = e / k;
+                if(i < k && (forward ? j < i : j > i))
+                {
+                    for(rocblas_int rr = 0; rr < CH; rr++)
+                        acc[q] += conj(sv[rr + j * CH]) * sv[rr + i * CH];
+                }
+            }
+            __syncthreads();
         }
-        else
+
+        for(rocblas_int q = 0; q < NACC; q++)
         {
-            if(j > i)
+            e = tid + q * BS1;
+            j = e % k;
+            i = e / k;
+            if(i < k && (forward ? j < i : j > i))
+                F[j + i * ldf] = acc[q];
+        }
+        __syncthreads();
+    }
+
+    // compute T column by column, using the previously computed columns
+    for(rocblas_int ii = 0; ii < k; ii++)
+    {
+        i = (forward ? ii : k - 1 - ii);
+        bool active = (tid < k && (forward ? tid < i : tid > i));
+
+        // load G(:,i) into shared memory
+        if(active)
+            sv[tid] = F[tid + i * ldf];
+        __syncthreads();
+
+        if(active)
+        {
+            T temp = 0;
+            if(forward)
             {
-                if(storev == rocblas_column_wise)
-                    Fp[j + i * ldf] = -tp[i] * Vp[(n - k + i) + j * ldv];
-                else
-                    Fp[j + i * ldf] = -tp[i] * Vp[j + (n - k + i) * ldv];
+                for(l = tid; l < i; l++)
+                    temp += F[tid + l * ldf] * sv[l];
             }
             else
-                Fp[j + i * ldf] = 0;
+            {
+                for(l = i + 1; l <= tid; l++)
+                    temp += F[tid + l * ldf] * sv[l];
+            }
+            F[tid + i * ldf] = -tau[i] * temp;
         }
+        else if(tid == i)
+            F[i + i * ldf] = tau[i];
+        else if(tid < k)
+            F[tid + i * ldf] = 0;
+        __syncthreads();
     }
 }
 
-template <typename T, typename U, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
-ROCSOLVER_KERNEL void set_triangular(const rocblas_int n,
-                                     const rocblas_int k,
-                                     U V,
-                                     const rocblas_int shiftV,
-                                     const rocblas_int ldv,
-                                     const rocblas_stride strideV,
-                                     T* tau,
-                                     const rocblas_stride strideT,
-                                     T* F,
-                                     const rocblas_int ldf,
-                                     const rocblas_stride strideF,
-                                     const rocblas_direct direct,
-                                     const rocblas_storev storev)
+/** LARFT_GRAM_INIT sets the k-by-k matrix F to B', where B is the triangular block of V that
+    contains the implicit ones of the Householder vectors (with unit diagonal), so that G = V'V can
+    be obtained with a TRMM and a GEMM. B is lower triangular if lowerB is true, and upper triangular
+    otherwise.
+
+    Call this kernel with enough groups to cover k rows in x, k columns in y, and batch_count
+    groups in z. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void larft_gram_init(const rocblas_int k,
+                                      const bool lowerB,
+                                      U VV,
+                                      const rocblas_int shiftV,
+                                      const rocblas_int ldv,
+                                      const rocblas_stride strideV,
+                                      T* FA,
+                                      const rocblas_int ldf,
+                                      const rocblas_stride strideF)
 {
     const auto b = hipBlockIdx_z;
     const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
@@ -89,50 +169,88 @@ ROCSOLVER_KERNEL void set_triangular(const rocblas_int n,
 
     if(i < k && j < k)
     {
-        T *tp, *Vp, *Fp;
-        tp = tau + b * strideT;
-        Vp = load_ptr_batch<T>(V, b, shiftV, strideV);
-        Fp = F + b * strideF;
-
-        if(j == i)
-            Fp[j + i * ldf] = tp[i];
-        else if(direct == rocblas_forward_direction)
-        {
-            if(j < i)
-            {
-                if(storev == rocblas_column_wise)
-                    Fp[j + i * ldf] = -tp[i] * conj(Vp[i + j * ldv]);
-                else
-                    Fp[j + i * ldf] = -tp[i] * Vp[j + i * ldv];
-            }
-            else
-                Fp[j + i * ldf] = 0;
-        }
+        T* V = load_ptr_batch<T>(VV, b, shiftV, strideV);
+        T* F = FA + b * strideF;
+
+        if(i == j)
+            F[i + j * ldf] = 1;
+        else if(lowerB ? j > i : j < i)
+            F[i + j * ldf] = conj(V[j + i * ldv]);
         else
-        {
-            if(j > i)
-            {
-                if(storev == rocblas_column_wise)
-                    Fp[j + i * ldf] = -tp[i] * conj(Vp[(n - k + i) + j * ldv]);
-                else
-                    Fp[j + i * ldf] = -tp[i] * Vp[j + (n - k + i) * ldv];
-            }
-            else
-                Fp[j + i * ldf] = 0;
-        }
+            F[i + j * ldf] = 0;
     }
 }
 
-template <typename T>
-ROCSOLVER_KERNEL void set_tau(const rocblas_int k, T* tau, const rocblas_stride strideT)
+/** LARFT_RECURSIVE computes the triangular factor T of a block reflector from the Gram matrix
+    stored in F, splitting it in halves (Elmroth-Gustavson) until they have no more than
+    LARFT_SMALL_MAX_K columns. If direct is forward,
+
+        T = [T11  T12]   with   T12 = -T11 * G12 * T22;
+            [  0  T22]
+
+    if direct is backward,
+
+        T = [T11    0]   with   T21 = -T22 * G21 * T11. **/
+template <typename T, typename U>
+void rocsolver_larft_recursive(rocblas_handle handle,
+                               const rocblas_direct direct,
+                               const rocblas_storev storev,
+                               const rocblas_int n,
+                               const rocblas_int k,
+                               U V,
+                               const rocblas_int shiftV,
+                               const rocblas_int ldv,
+                               const rocblas_stride strideV,
+                               T* tau,
+                               const rocblas_stride strideT,
+                               T* F,
+                               const rocblas_int shiftF,
+                               const rocblas_int ldf,
+                               const rocblas_stride strideF,
+                               const rocblas_int batch_count,
+                               T* scalars)
 {
-    const auto b = hipBlockIdx_y;
-    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
 
-    if(i < k)
+    if(k <= LARFT_SMALL_MAX_K)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(larft_kernel<T>, dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                                stream, direct, storev, false, n, k, V, shiftV, ldv, strideV, tau,
+                                strideT, F + shiftF, ldf, strideF);
+        return;
+    }
+
+    rocblas_int k1 = k / 2;
+    rocblas_int k2 = k - k1;
+    rocsolver_larft_recursive<T>(handle, direct, storev, n, k1, V, shiftV, ldv, strideV, tau,
+                                 strideT, F, shiftF, ldf, strideF, batch_count, scalars);
+    rocsolver_larft_recursive<T>(handle, direct, storev, n, k2, V, shiftV, ldv, strideV, tau + k1,
+                                 strideT, F, shiftF + idx2D(k1, k1, ldf), ldf, strideF, batch_count,
+                                 scalars);
+
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_diagonal diag = rocblas_diagonal_non_unit;
+    if(direct == rocblas_forward_direction)
+    {
+        // T12 = -T11 * G12 * T22
+        rocblas_fill uplo = rocblas_fill_upper;
+        rocblasCall_trmm(handle, rocblas_side_left, uplo, trans, diag, k1, k2, scalars, 0, F, shiftF,
+                         ldf, strideF, F, shiftF + idx2D(0, k1, ldf), ldf, strideF, batch_count);
+        rocblasCall_trmm(handle, rocblas_side_right, uplo, trans, diag, k1, k2, scalars + 2, 0, F,
+                         shiftF + idx2D(k1, k1, ldf), ldf, strideF, F, shiftF + idx2D(0, k1, ldf),
+                         ldf, strideF, batch_count);
+    }
+    else
     {
-        T* tp = tau + b * strideT;
-        tp[i] = -tp[i];
+        // T21 = -T22 * G21 * T11
+        rocblas_fill uplo = rocblas_fill_lower;
+        rocblasCall_trmm(handle, rocblas_side_left, uplo, trans, diag, k2, k1, scalars, 0, F,
+                         shiftF + idx2D(k1, k1, ldf), ldf, strideF, F, shiftF + idx2D(k1, 0, ldf),
+                         ldf, strideF, batch_count);
+        rocblasCall_trmm(handle, rocblas_side_right, uplo, trans, diag, k2, k1, scalars + 2, 0, F,
+                         shiftF, ldf, strideF, F, shiftF + idx2D(k1, 0, ldf), ldf, strideF,
+                         batch_count);
     }
 }
 
@@ -156,8 +274,8 @@ void rocsolver_larft_getMemorySize(const rocblas_int n,
     // size of scalars (constants)
     *size_scalars = sizeof(T) * 3;
 
-    // size of re-usable workspace
-    *size_work = sizeof(T) * k * batch_count;
+    // no re-usable workspace is needed
+    *size_work = 0;
 
     // size of array of pointers to workspace
     if(BATCHED)
@@ -204,7 +322,7 @@ rocblas_status rocsolver_larft_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
+template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_larft_template(rocblas_handle handle,
                                         const rocblas_direct direct,
                                         const rocblas_storev storev,
@@ -234,117 +352,69 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // if the block reflector is small, compute T with a single kernel
+    if(k <= LARFT_SMALL_MAX_K && n <= LARFT_SMALL_MAX_N)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(larft_kernel<T>, dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                                stream, direct, storev, true, n, k, V, shiftV, ldv, strideV, tau,
+                                strideT, F, ldf, strideF);
+        return rocblas_status_success;
+    }
+
     // everything must be executed with scalars on the device
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
 
-    rocblas_stride stridew = rocblas_stride(k);
-    rocblas_diagonal diag = rocblas_diagonal_non_unit;
-    rocblas_fill uplo;
-    rocblas_operation trans;
+    // compute the Gram matrix G = V'V. Let B be the k-by-k triangular block of V that contains
+    // the implicit ones of the Householder vectors, and R the rest of V; then G = B'B + R'R
+    // if storev is column-wise, or G = BB' + RR' if storev is row-wise
+    bool forward = (direct == rocblas_forward_direction);
+    bool colwise = (storev == rocblas_column_wise);
+    bool lowerB = (forward == colwise);
+    rocblas_int shiftB, shiftR;
+    if(colwise)
+    {
+        shiftB = shiftV + (forward ? 0 : idx2D(n - k, 0, ldv));
+        shiftR = shiftV + (forward ? idx2D(k, 0, ldv) : 0);
+    }
+    else
+    {
+        shiftB = shiftV + (forward ? 0 : idx2D(0, n - k, ldv));
+        shiftR = shiftV + (forward ? idx2D(0, k, ldv) : 0);
+    }
+    rocblas_fill uplo = (lowerB ? rocblas_fill_lower : rocblas_fill_upper);
+    rocblas_operation trans = rocblas_operation_none;
+    rocblas_diagonal diag = rocblas_diagonal_unit;
 
-    // Fix diagonal of T, make zero the not used triangular part,
-    // setup tau (changing signs) and account for the non-stored 1's on the
-    // householder vectors
     rocblas_int blocks = (k - 1) / 32 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(set_triangular, dim3(blocks, blocks, batch_count), dim3(32, 32), 0,
-                            stream, n, k, V, shiftV, ldv, strideV, tau, strideT, F, ldf, strideF,
-                            direct, storev);
-    ROCSOLVER_LAUNCH_KERNEL(set_tau, dim3(blocks, batch_count), dim3(32, 1), 0, stream, k, tau,
-                            strideT);
+    ROCSOLVER_LAUNCH_KERNEL(larft_gram_init<T>, dim3(blocks, blocks, batch_count), dim3(32, 32),
+                            0, stream, k, lowerB, V, shiftB, ldv, strideV, F, ldf, strideF);
 
-    if(direct == rocblas_forward_direction)
+    if(colwise)
     {
-        uplo = rocblas_fill_upper;
-
-        // **** FOR NOW, IT DOES NOT LOOK FOR TRAILING ZEROS
-        //      AS THIS WOULD REQUIRE SYNCHRONIZATION WITH GPU.
-        //      IT WILL WORK ON THE ENTIRE MATRIX/VECTOR REGARDLESS OF
-        //      ZERO ENTRIES ****
-
-        for(rocblas_int i = 1; i < k; ++i)
-        {
-            // compute the matrix vector product, using the householder vectors
-            if(storev == rocblas_column_wise)
-            {
-                trans = rocblas_operation_conjugate_transpose;
-                rocblasCall_gemv<T>(handle, trans, n - 1 - i, i, tau + i, strideT, V,
-                                    shiftV + idx2D(i + 1, 0, ldv), ldv, strideV, V,
-                                    shiftV + idx2D(i + 1, i, ldv), 1, strideV, scalars + 2, 0, F,
-                                    idx2D(0, i, ldf), 1, strideF, batch_count, workArr);
-            }
-            else
-            {
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, n - i - 1, V, shiftV + idx2D(i, i + 1, ldv),
-                                                ldv, strideV, batch_count);
-
-                trans = rocblas_operation_none;
-                rocblasCall_gemv<T>(handle, trans, i, n - 1 - i, tau + i, strideT, V,
-                                    shiftV + idx2D(0, i + 1, ldv), ldv, strideV, V,
-                                    shiftV + idx2D(i, i + 1, ldv), ldv, strideV, scalars + 2, 0, F,
-                                    idx2D(0, i, ldf), 1, strideF, batch_count, workArr);
-
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, n - i - 1, V, shiftV + idx2D(i, i + 1, ldv),
-                                                ldv, strideV, batch_count);
-            }
-
-            // multiply by the previous triangular factor
-            trans = rocblas_operation_none;
-            rocblasCall_trmv<T>(handle, uplo, trans, diag, i, F, 0, ldf, strideF, F,
-                                idx2D(0, i, ldf), 1, strideF, work, stridew, batch_count);
-        }
+        rocblasCall_trmm(handle, rocblas_side_right, uplo, trans, diag, k, k, scalars + 2, 0, V,
+                         shiftB, ldv, strideV, F, 0, ldf, strideF, batch_count, workArr);
+        if(n > k)
+            rocblasCall_gemm<BATCHED, STRIDED, T>(
+                handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, k, k, n - k,
+                scalars + 2, V, shiftR, ldv, strideV, V, shiftR, ldv, strideV, scalars + 2, F, 0,
+                ldf, strideF, batch_count, workArr);
     }
     else
     {
-        uplo = rocblas_fill_lower;
-
-        // **** FOR NOW, IT DOES NOT LOOK FOR TRAILING ZEROS
-        //      AS THIS WOULD REQUIRE SYNCHRONIZATION WITH GPU.
-        //      IT WILL WORK ON THE ENTIRE MATRIX/VECTOR REGARDLESS OF
-        //      ZERO ENTRIES ****
-
-        for(rocblas_int i = k - 2; i >= 0; --i)
-        {
-            // compute the matrix vector product, using the householder vectors
-            if(storev == rocblas_column_wise)
-            {
-                trans = rocblas_operation_conjugate_transpose;
-                rocblasCall_gemv<T>(handle, trans, n - k + i, k - i - 1, tau + i, strideT, V,
-                                    shiftV + idx2D(0, i + 1, ldv), ldv, strideV, V,
-                                    shiftV + idx2D(0, i, ldv), 1, strideV, scalars + 2, 0, F,
-                                    idx2D(i + 1, i, ldf), 1, strideF, batch_count, workArr);
-            }
-            else
-            {
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, n - k + i, V, shiftV + idx2D(i, 0, ldv),
-                                                ldv, strideV, batch_count);
-
-                trans = rocblas_operation_none;
-                rocblasCall_gemv<T>(handle, trans, k - i - 1, n - k + i, tau + i, strideT, V,
-                                    shiftV + idx2D(i + 1, 0, ldv), ldv, strideV, V,
-                                    shiftV + idx2D(i, 0, ldv), ldv, strideV, scalars + 2, 0, F,
-                                    idx2D(i + 1, i, ldf), 1, strideF, batch_count, workArr);
-
-                if(COMPLEX)
-                    rocsolver_lacgv_template<T>(handle, n - k + i, V, shiftV + idx2D(i, 0, ldv),
-                                                ldv, strideV, batch_count);
-            }
-
-            // multiply by the previous triangular factor
-            trans = rocblas_operation_none;
-            rocblasCall_trmv<T>(handle, uplo, trans, diag, k - i - 1, F, idx2D(i + 1, i + 1, ldf),
-                                ldf, strideF, F, idx2D(i + 1, i, ldf), 1, strideF, work, stridew,
-                                batch_count);
-        }
+        rocblasCall_trmm(handle, rocblas_side_left, uplo, trans, diag, k, k, scalars + 2, 0, V,
+                         shiftB, ldv, strideV, F, 0, ldf, strideF, batch_count, workArr);
+        if(n > k)
+            rocblasCall_gemm<BATCHED, STRIDED, T>(
+                handle, rocblas_operation_none, rocblas_operation_conjugate_transpose, k, k, n - k,
+                scalars + 2, V, shiftR, ldv, strideV, V, shiftR, ldv, strideV, scalars + 2, F, 0,
+                ldf, strideF, batch_count, workArr);
     }
 
-    // restore tau
-    ROCSOLVER_LAUNCH_KERNEL(set_tau, dim3(blocks, batch_count), dim3(32, 1), 0, stream, k, tau,
-                            strideT);
+    // compute T from the Gram matrix
+    rocsolver_larft_recursive<T>(handle, direct, storev, n, k, V, shiftV, ldv, strideV, tau,
+                                 strideT, F, 0, ldf, strideF, batch_count, scalars);
 
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
@@ -28,23 +28,13 @@ rocblas_status rocsolver_lauum_impl(rocblas_handle handle,
     rocblas_stride strideA = 0;
     rocblas_int batch_count = 1;
 
-    // get and return size of workspace
-    size_t size_work;
-    rocsolver_lauum_getMemorySize<U>(n, batch_count, &size_work);
-
+    // this function does not require memory work space
     if(rocblas_is_device_memory_size_query(handle))
-        rocblas_set_optimal_device_memory_size(handle, size_work);
-
-    void* work;
-    rocblas_device_malloc mem(handle, size_work);
-    if(!mem)
-        return rocblas_status_memory_error;
-
-    work = mem[0];
+        return rocblas_status_size_unchanged;
 
     // execution
-    return rocsolver_lauum_template<T>(handle, uplo, n, A, shiftA, lda, strideA, batch_count,
-                                       (T*)work);
+    return rocsolver_lauum_template<false, T>(handle, uplo, n, A, shiftA, lda, strideA,
+                                              batch_count);
 }
 
 /*
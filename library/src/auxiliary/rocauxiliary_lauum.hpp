@@ -35,20 +35,124 @@ rocblas_status rocsolver_lauum_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-template <typename T>
-void rocsolver_lauum_getMemorySize(const rocblas_int n, const rocblas_int batch_count, size_t* size_work)
+/** LAUUM_KERNEL_SMALL computes U*U' or L'*L for a triangular factor with at most
+    LAUUM_MAX_COLS columns. The factor is kept in shared memory and every thread computes
+    one entry of the result, which is written over the same triangle of A.
+    Call this kernel with batch_count groups in z, and LAUUM_MAX_COLS x LAUUM_MAX_COLS threads. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(LAUUM_MAX_COLS * LAUUM_MAX_COLS)
+    lauum_kernel_small(const rocblas_fill uplo,
+                       const rocblas_int n,
+                       U AA,
+                       const rocblas_int shiftA,
+                       const rocblas_int lda,
+                       const rocblas_stride strideA)
 {
-    *size_work = 0;
+    rocblas_int bid = hipBlockIdx_z;
+    rocblas_int i = hipThreadIdx_x;
+    rocblas_int j = hipThreadIdx_y;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+    // shared memory
+    __shared__ T sA[LAUUM_MAX_COLS * LAUUM_MAX_COLS];
+
+    const bool upper = (uplo == rocblas_fill_upper);
+    const bool triangle = (i < n && j < n && (upper ? i <= j : i >= j));
+
+    // read the triangular factor (the other triangle is not referenced)
+    if(triangle)
+        sA[i + j * LAUUM_MAX_COLS] = A[i + j * lda];
+    __syncthreads();
+
+    if(triangle)
+    {
+        T temp = 0;
+        if(upper)
+        {
+            // (U*U')[i,j] = sum of U[i,k]*conj(U[j,k]) for k >= j
+            for(rocblas_int k = j; k < n; ++k)
+                temp += sA[i + k * LAUUM_MAX_COLS] * conj(sA[j + k * LAUUM_MAX_COLS]);
+        }
+        else
+        {
+            // (L'*L)[i,j] = sum of conj(L[k,i])*L[k,j] for k >= i
+            for(rocblas_int k = i; k < n; ++k)
+                temp += conj(sA[k + i * LAUUM_MAX_COLS]) * sA[k + j * LAUUM_MAX_COLS];
+        }
+        A[i + j * lda] = temp;
+    }
+}
 
-    // if quick return, no workspace is needed
-    if(n == 0 || batch_count == 0)
+/** LAUUM_RECURSIVE splits the triangular factor in two halves. The product associated with
+    the leading diagonal block is computed first (recursively), then it is updated with the
+    off-diagonal block using HERK, the off-diagonal block is multiplied by the trailing
+    diagonal block using TRMM, and finally the trailing diagonal block is computed (recursively).
+    Everything is done in place. Scalars must be on the host. **/
+template <bool BATCHED, typename T, typename U>
+void lauum_recursive(rocblas_handle handle,
+                     const rocblas_fill uplo,
+                     const rocblas_int n,
+                     U A,
+                     const rocblas_int shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     const rocblas_int batch_count)
+{
+    if(n <= LAUUM_MAX_COLS)
+    {
+        hipStream_t stream;
+        rocblas_get_stream(handle, &stream);
+
+        ROCSOLVER_LAUNCH_KERNEL(lauum_kernel_small<T>, dim3(1, 1, batch_count),
+                                dim3(LAUUM_MAX_COLS, LAUUM_MAX_COLS, 1), 0, stream, uplo, n, A,
+                                shiftA, lda, strideA);
         return;
+    }
+
+    using S = decltype(std::real(T{}));
 
-    // size of workspace
-    *size_work = sizeof(T) * n * n * batch_count;
+    // split in two halves, keeping the leading block a multiple of the leaf size
+    rocblas_int n1 = ((n / 2 - 1) / LAUUM_MAX_COLS + 1) * LAUUM_MAX_COLS;
+    rocblas_int n2 = n - n1;
+    T one = 1;
+    S s_one = 1;
+
+    lauum_recursive<BATCHED, T>(handle, uplo, n1, A, shiftA, lda, strideA, batch_count);
+
+    if(uplo == rocblas_fill_upper)
+    {
+        // A11 = A11 + A12 * A12'
+        rocblasCall_syrk_herk<BATCHED, T>(handle, uplo, rocblas_operation_none, n1, n2, &s_one, A,
+                                          shiftA + idx2D(0, n1, lda), lda, strideA, &s_one, A,
+                                          shiftA, lda, strideA, batch_count);
+
+        // A12 = A12 * A22'
+        rocblasCall_trmm(handle, rocblas_side_right, uplo, rocblas_operation_conjugate_transpose,
+                         rocblas_diagonal_non_unit, n1, n2, &one, 0, A,
+                         shiftA + idx2D(n1, n1, lda), lda, strideA, A, shiftA + idx2D(0, n1, lda),
+                         lda, strideA, batch_count);
+    }
+    else // rocblas_fill_lower
+    {
+        // A11 = A11 + A21' * A21
+        rocblasCall_syrk_herk<BATCHED, T>(handle, uplo, rocblas_operation_conjugate_transpose, n1,
+                                          n2, &s_one, A, shiftA + idx2D(n1, 0, lda), lda, strideA,
+                                          &s_one, A, shiftA, lda, strideA, batch_count);
+
+        // A21 = A22' * A21
+        rocblasCall_trmm(handle, rocblas_side_left, uplo, rocblas_operation_conjugate_transpose,
+                         rocblas_diagonal_non_unit, n2, n1, &one, 0, A,
+                         shiftA + idx2D(n1, n1, lda), lda, strideA, A, shiftA + idx2D(n1, 0, lda),
+                         lda, strideA, batch_count);
+    }
+
+    lauum_recursive<BATCHED, T>(handle, uplo, n2, A, shiftA + idx2D(n1, n1, lda), lda, strideA,
+                                batch_count);
 }
 
-template <typename T, typename U>
+template <bool BATCHED, typename T, typename U>
 rocblas_status rocsolver_lauum_template(rocblas_handle handle,
                                         const rocblas_fill uplo,
                                         const rocblas_int n,
@@ -56,8 +160,7 @@ rocblas_status rocsolver_lauum_template(rocblas_handle handle,
                                         const rocblas_int shiftA,
                                         const rocblas_int lda,
                                         const rocblas_stride strideA,
-                                        const rocblas_int batch_count,
-                                        T* work)
+                                        const rocblas_int batch_count)
 {
     ROCSOLVER_ENTER("lauum", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
                     "strideA:", strideA, "bc:", batch_count);
@@ -66,36 +169,13 @@ rocblas_status rocsolver_lauum_template(rocblas_handle handle,
     if(n == 0 || batch_count == 0)
         return rocblas_status_success;
 
-    hipStream_t stream;
-    rocblas_get_stream(handle, &stream);
-
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
 
-    rocblas_int strideW = n * n;
-    rocblas_int blocks = (n - 1) / BS2 + 1;
-    dim3 grid(blocks, blocks, batch_count);
-    dim3 threads(BS2, BS2);
-    T one = 1;
-    T zero = 0;
-
-    // put the triangular factor of interest in work
-    ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, grid, threads, 0, stream, n, n, work, 0, n, strideW);
-    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, grid, threads, 0, stream, n, n, A, shiftA, lda, strideA,
-                            (T*)work, 0, n, strideW, no_mask{}, uplo);
-
-    rocblas_side side = (uplo == rocblas_fill_upper) ? rocblas_side_right : rocblas_side_left;
-
-    // work = work * A' or work = A' * work
-    rocblasCall_trmm(handle, side, uplo, rocblas_operation_conjugate_transpose,
-                     rocblas_diagonal_non_unit, n, n, &one, 0, A, shiftA, lda, strideA, work, 0, n,
-                     strideW, batch_count);
-
-    // copy the new factor into the relevant triangle of A leaving the rest untouched
-    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, grid, threads, 0, stream, n, n, work, 0, n, strideW, A,
-                            shiftA, lda, strideA, no_mask{}, uplo);
+    // compute U*U' or L'*L in place
+    lauum_recursive<BATCHED, T>(handle, uplo, n, A, shiftA, lda, strideA, batch_count);
 
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
@@ -37,29 +37,31 @@ rocblas_status rocsolver_org2r_ung2r_impl(rocblas_handle handle,
     size_t size_scalars;
     // size of arrays of pointers (for batched cases)
     size_t size_workArr;
-    // extra requirements for calling LARF
-    size_t size_Abyx;
-    rocsolver_org2r_ung2r_getMemorySize<false, T>(m, n, batch_count, &size_scalars, &size_Abyx,
+    // size of temporary array for triangular factor
+    size_t size_trfact;
+    rocsolver_org2r_ung2r_getMemorySize<false, T>(m, n, batch_count, &size_scalars, &size_trfact,
                                                   &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_Abyx, size_workArr);
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_trfact,
+                                                      size_workArr);
 
     // memory workspace allocation
-    void *scalars, *Abyx, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_Abyx, size_workArr);
+    void *scalars, *trfact, *workArr;
+    rocblas_device_malloc mem(handle, size_scalars, size_trfact, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
     scalars = mem[0];
-    Abyx = mem[1];
+    trfact = mem[1];
     workArr = mem[2];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
     // execution
-    return rocsolver_org2r_ung2r_template<T>(handle, m, n, k, A, shiftA, lda, strideA, ipiv, strideP,
-                                             batch_count, (T*)scalars, (T*)Abyx, (T**)workArr);
+    return rocsolver_org2r_ung2r_template<false, false, T>(handle, m, n, k, A, shiftA, lda, strideA,
+                                                           ipiv, strideP, batch_count, (T*)scalars,
+                                                           (T*)trfact, (T**)workArr);
 }
 
 /*
@@ -9,7 +9,8 @@
 
 #pragma once
 
-#include "rocauxiliary_larf.hpp"
+#include "rocauxiliary_larfb.hpp"
+#include "rocauxiliary_larft.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
 
@@ -44,26 +45,237 @@ ROCSOLVER_KERNEL void org2r_init_ident(const rocblas_int m,
     }
 }
 
+/** ORG2R_SMALL_KERNEL generates the m-by-n matrix Q with orthonormal columns, for
+    m <= GEQR2_SMALL_MAX_ROWS and n <= GEQR2_SMALL_MAX_COLS, using a single work-group per matrix.
+    The current Householder vector is kept in shared memory while it is applied to the trailing
+    columns; every column is updated by BS1 / GEQR2_SMALL_MAX_COLS threads.
+
+    Call this kernel with batch_count groups in y, and BS1 threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) org2r_small_kernel(const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                const rocblas_int k,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                T* ipivA,
+                                                                const rocblas_stride strideP)
+{
+    constexpr rocblas_int NCOLS = GEQR2_SMALL_MAX_COLS;
+    constexpr rocblas_int NROWS = BS1 / NCOLS;
+
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int rid = tid % NROWS;
+    rocblas_int cid = tid / NROWS;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* ipiv = ipivA + bid * strideP;
+
+    // shared memory
+    __shared__ T sw[BS1];
+    __shared__ T sv[GEQR2_SMALL_MAX_ROWS];
+
+    // initialize the non used columns and the upper triangular part (as in ORG2R_INIT_IDENT)
+    if(cid < n)
+    {
+        for(rocblas_int i = rid; i < m; i += NROWS)
+        {
+            if(i == cid)
+                A[i + cid * lda] = 1;
+            else if(cid > i || cid >= k)
+                A[i + cid * lda] = 0;
+        }
+    }
+    __syncthreads();
+
+    for(rocblas_int j = k - 1; j >= 0; j--)
+    {
+        // load the Householder vector into shared memory
+        for(rocblas_int i = j + 1 + tid; i < m; i += BS1)
+            sv[i] = A[i + j * lda];
+        if(tid == 0)
+            sv[j] = 1;
+        __syncthreads();
+
+        // apply H(j) to A(j:m-1, j+1:n-1) from the left
+        T t = ipiv[j];
+        rocblas_int c = j + 1 + cid;
+        T w = 0;
+        if(c < n)
+        {
+            for(rocblas_int i = j + rid; i < m; i += NROWS)
+                w += conj(sv[i]) * A[i + c * lda];
+        }
+        sw[tid] = w;
+        __syncthreads();
+
+        if(rid == 0)
+        {
+            for(rocblas_int r = 1; r < NROWS; r++)
+                w += sw[tid + r];
+            sw[tid] = t * w;
+        }
+        __syncthreads();
+
+        if(c < n)
+        {
+            w = sw[cid * NROWS];
+            for(rocblas_int i = j + rid; i < m; i += NROWS)
+                A[i + c * lda] -= sv[i] * w;
+        }
+
+        // update the j-th column, corresponding to H(j)
+        for(rocblas_int i = j + 1 + tid; i < m; i += BS1)
+            A[i + j * lda] = -t * sv[i];
+        if(tid == 0)
+            A[j + j * lda] = T(1) - t;
+        __syncthreads();
+    }
+}
+
+/** ORG2R_BLOCK_W overwrites the k-by-k triangular factor T of the block reflector
+    H = I - V * T * V', formed by k <= LARFT_SMALL_MAX_K forward column-wise Householder vectors,
+    with the upper triangular matrix W = T * V1', where V1 is the top k-by-k block of V (with unit
+    diagonal).
+    The first k columns of H are then given by E - V * W (see ORG2R_BLOCK_GEN).
+
+    Call this kernel with batch_count groups in y, and BS1 threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) org2r_block_w(const rocblas_int k,
+                                                           U AA,
+                                                           const rocblas_int shiftA,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           T* FA,
+                                                           const rocblas_int ldf,
+                                                           const rocblas_stride strideF)
+{
+    constexpr rocblas_int NACC = (LARFT_SMALL_MAX_K * LARFT_SMALL_MAX_K - 1) / BS1 + 1;
+
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* F = FA + bid * strideF;
+
+    rocblas_int e, l, c;
+    T acc[NACC];
+
+    // W(l,c) = sum_{p=l}^{c} T(l,p) * conj(V1(c,p))
+    for(rocblas_int q = 0; q < NACC; q++)
+    {
+        e = tid + q * BS1;
+        l = e % k;
+        c = e / k;
+        acc[q] = 0;
+        if(c < k && l <= c)
+        {
+            acc[q] = F[l + c * ldf];
+            for(rocblas_int p = l; p < c; p++)
+                acc[q] += F[l + p * ldf] * conj(A[c + p * lda]);
+        }
+    }
+    __syncthreads();
+
+    for(rocblas_int q = 0; q < NACC; q++)
+    {
+        e = tid + q * BS1;
+        l = e % k;
+        c = e / k;
+        if(c < k && l <= c)
+            F[l + c * ldf] = acc[q];
+    }
+}
+
+/** ORG2R_BLOCK_GEN overwrites the m-by-k block V of Householder vectors with the first k columns
+    of the block reflector H = I - V * T * V', computed as E - V * W with W = T * V1' as returned by
+    ORG2R_BLOCK_W. Every work-group stages LARFT_SMALL_CHUNK rows of V in shared memory before
+    overwriting them.
+
+    Call this kernel with ceil(m / LARFT_SMALL_CHUNK) groups in x, batch_count groups in y, and BS1
+    threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) org2r_block_gen(const rocblas_int m,
+                                                             const rocblas_int k,
+                                                             U AA,
+                                                             const rocblas_int shiftA,
+                                                             const rocblas_int lda,
+                                                             const rocblas_stride strideA,
+                                                             T* FA,
+                                                             const rocblas_int ldf,
+                                                             const rocblas_stride strideF)
+{
+    constexpr rocblas_int CH = LARFT_SMALL_CHUNK;
+
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int r0 = hipBlockIdx_x * CH;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* F = FA + bid * strideF;
+
+    // shared memory
+    __shared__ T sv[CH * LARFT_SMALL_MAX_K];
+
+    rocblas_int e, l, r, rr, c;
+
+    // load rows r0:r0+CH-1 of V
+    for(e = tid; e < CH * k; e += BS1)
+    {
+        r = r0 + e % CH;
+        l = e / CH;
+        sv[e] = (r >= m || r < l ? T(0) : (r == l ? T(1) : A[r + l * lda]));
+    }
+    __syncthreads();
+
+    // Q(r,c) = E(r,c) - sum_{l=0}^{c} V(r,l) * W(l,c)
+    for(e = tid; e < CH * k; e += BS1)
+    {
+        rr = e % CH;
+        c = e / CH;
+        r = r0 + rr;
+        if(r < m)
+        {
+            T temp = (r == c ? T(1) : T(0));
+            for(l = 0; l <= c; l++)
+                temp -= sv[rr + l * CH] * F[l + c * ldf];
+            A[r + c * lda] = temp;
+        }
+    }
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_org2r_ung2r_getMemorySize(const rocblas_int m,
                                          const rocblas_int n,
                                          const rocblas_int batch_count,
                                          size_t* size_scalars,
-                                         size_t* size_Abyx,
+                                         size_t* size_trfact,
                                          size_t* size_workArr)
 {
     // if quick return no workspace needed
     if(m == 0 || n == 0 || batch_count == 0)
     {
         *size_scalars = 0;
-        *size_Abyx = 0;
+        *size_trfact = 0;
         *size_workArr = 0;
         return;
     }
 
-    // memory requirements to call larf
-    rocsolver_larf_getMemorySize<BATCHED, T>(rocblas_side_left, m, n, batch_count, size_scalars,
-                                             size_Abyx, size_workArr);
+    // memory requirements to call larft
+    size_t unused;
+    rocsolver_larft_getMemorySize<BATCHED, T>(m, min(n, LARFT_SMALL_MAX_K), batch_count,
+                                              size_scalars, &unused, size_workArr);
+
+    // size of temporary array for triangular factor
+    if(m <= GEQR2_SMALL_MAX_ROWS && n <= GEQR2_SMALL_MAX_COLS)
+        *size_trfact = 0;
+    else
+        *size_trfact = sizeof(T) * LARFT_SMALL_MAX_K * LARFT_SMALL_MAX_K * batch_count;
 }
 
 template <typename T, typename U>
@@ -95,7 +307,7 @@ rocblas_status rocsolver_org2r_orgqr_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-template <typename T, typename U>
+template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
                                               const rocblas_int m,
                                               const rocblas_int n,
@@ -108,7 +320,7 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
                                               const rocblas_stride strideP,
                                               const rocblas_int batch_count,
                                               T* scalars,
-                                              T* Abyx,
+                                              T* trfact,
                                               T** workArr)
 {
     ROCSOLVER_ENTER("org2r_ung2r", "m:", m, "n:", n, "k:", k, "shiftA:", shiftA, "lda:", lda,
@@ -121,10 +333,13 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    // everything must be executed with scalars on the device
-    rocblas_pointer_mode old_mode;
-    rocblas_get_pointer_mode(handle, &old_mode);
-    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+    // if the matrix is small, generate it with a single kernel
+    if(m <= GEQR2_SMALL_MAX_ROWS && n <= GEQR2_SMALL_MAX_COLS)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(org2r_small_kernel<T>, dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                                stream, m, n, k, A, shiftA, lda, strideA, ipiv, strideP);
+        return rocblas_status_success;
+    }
 
     // Initialize identity matrix (non used columns)
     rocblas_int blocksx = (m - 1) / 32 + 1;
@@ -132,35 +347,44 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
     ROCSOLVER_LAUNCH_KERNEL(org2r_init_ident<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
                             0, stream, m, n, k, A, shiftA, lda, strideA);
 
-    for(rocblas_int j = k - 1; j >= 0; --j)
+    // generate Q by blocks of LARFT_SMALL_MAX_K columns (the last block is allowed to be smaller),
+    // applying every block reflector to the trailing columns with the fused larfb kernel and then
+    // forming its own columns
+    rocblas_int ldw = LARFT_SMALL_MAX_K;
+    rocblas_stride strideW = rocblas_stride(ldw) * ldw;
+    rocblas_int jb, blocks;
+
+    for(rocblas_int j = (k > 0 ? ((k - 1) / ldw) * ldw : -1); j >= 0; j -= ldw)
     {
-        // apply H(i) to Q(i:m,i:n) from the left
-        if(j < n - 1)
+        jb = min(ldw, k - j);
+
+        // generate triangular factor of current block reflector
+        rocsolver_larft_template<BATCHED, STRIDED, T>(
+            handle, rocblas_forward_direction, rocblas_column_wise, m - j, jb, A,
+            shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j), strideP, trfact, ldw, strideW,
+            batch_count, scalars, (T*)nullptr, workArr);
+
+        // apply current block reflector to Q(j:m,j+jb:n) from the left
+        if(j + jb < n)
         {
-            rocsolver_larf_template<T>(handle, rocblas_side_left, m - j, n - j - 1, A,
-                                       shiftA + idx2D(j, j, lda), 1, strideA, (ipiv + j), strideP,
-                                       A, shiftA + idx2D(j, j + 1, lda), lda, strideA, batch_count,
-                                       scalars, Abyx, workArr);
+            blocks = (n - j - jb - 1) / LARFT_SMALL_CHUNK + 1;
+            ROCSOLVER_LAUNCH_KERNEL(larfb_fused_kernel<T>, dim3(blocks, batch_count, 1),
+                                    dim3(BS1, 1, 1), 0, stream, rocblas_side_left,
+                                    rocblas_operation_none, m - j, n - j - jb, jb, A,
+                                    shiftA + idx2D(j, j, lda), lda, strideA, trfact, 0, ldw,
+                                    strideW, A, shiftA + idx2D(j, j + jb, lda), lda, strideA);
         }
 
-        // set the diagonal element and negative tau
-        ROCSOLVER_LAUNCH_KERNEL(subtract_tau<T>, dim3(batch_count), dim3(1), 0, stream, j, j, A,
-                                shiftA, lda, strideA, ipiv + j, strideP);
-
-        // update i-th column -corresponding to H(i)-
-        if(j < m - 1)
-            rocblasCall_scal<T>(handle, m - j - 1, ipiv + j, strideP, A,
-                                shiftA + idx2D(j + 1, j, lda), 1, strideA, batch_count);
-    }
+        // form the columns of the current block
+        ROCSOLVER_LAUNCH_KERNEL(org2r_block_w<T>, dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                                stream, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, trfact,
+                                ldw, strideW);
 
-    // restore values of tau
-    if(k > 0)
-    {
-        blocksx = (k - 1) / 128 + 1;
-        ROCSOLVER_LAUNCH_KERNEL(restau<T>, dim3(blocksx, batch_count), dim3(128), 0, stream, k,
-                                ipiv, strideP);
+        blocks = (m - j - 1) / LARFT_SMALL_CHUNK + 1;
+        ROCSOLVER_LAUNCH_KERNEL(org2r_block_gen<T>, dim3(blocks, batch_count, 1), dim3(BS1, 1, 1),
+                                0, stream, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                trfact, ldw, strideW);
     }
 
-    rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
 }
@@ -132,10 +132,10 @@ rocblas_status rocsolver_orglq_unglq_template(rocblas_handle handle,
         // applying the current block reflector using larft + larfb
         if(j + jb < m)
         {
-            rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_row_wise, n - j,
-                                        jb, A, shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j),
-                                        strideP, trfact, ldw, strideW, batch_count, scalars, work,
-                                        workArr);
+            rocsolver_larft_template<BATCHED, STRIDED, T>(
+                handle, rocblas_forward_direction, rocblas_row_wise, n - j, jb, A,
+                shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j), strideP, trfact, ldw, strideW,
+                batch_count, scalars, work, workArr);
 
             rocsolver_larfb_template<BATCHED, STRIDED, T>(
                 handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
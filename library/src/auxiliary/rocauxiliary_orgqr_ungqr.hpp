@@ -96,8 +96,9 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
 
     // if the matrix is small, use the unblocked variant of the algorithm
     if(k <= xxGQx_xxGQx2_SWITCHSIZE)
-        return rocsolver_org2r_ung2r_template<T>(handle, m, n, k, A, shiftA, lda, strideA, ipiv,
-                                                 strideP, batch_count, scalars, Abyx_tmptr, workArr);
+        return rocsolver_org2r_ung2r_template<BATCHED, STRIDED, T>(
+            handle, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars,
+            Abyx_tmptr, workArr);
 
     rocblas_int ldw = xxGQx_BLOCKSIZE;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
@@ -120,9 +121,9 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
         ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
                                 stream, kk, n - kk, A, shiftA + idx2D(0, kk, lda), lda, strideA);
 
-        rocsolver_org2r_ung2r_template<T>(handle, m - kk, n - kk, k - kk, A,
-                                          shiftA + idx2D(kk, kk, lda), lda, strideA, (ipiv + kk),
-                                          strideP, batch_count, scalars, Abyx_tmptr, workArr);
+        rocsolver_org2r_ung2r_template<BATCHED, STRIDED, T>(
+            handle, m - kk, n - kk, k - kk, A, shiftA + idx2D(kk, kk, lda), lda, strideA,
+            (ipiv + kk), strideP, batch_count, scalars, Abyx_tmptr, workArr);
     }
 
     // compute the blocked part
@@ -132,10 +133,10 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
         // applying the current block reflector using larft + larfb
         if(j + jb < n)
         {
-            rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise,
-                                        m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                                        (ipiv + j), strideP, trfact, ldw, strideW, batch_count,
-                                        scalars, work, workArr);
+            rocsolver_larft_template<BATCHED, STRIDED, T>(
+                handle, rocblas_forward_direction, rocblas_column_wise, m - j, jb, A,
+                shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j), strideP, trfact, ldw, strideW,
+                batch_count, scalars, work, workArr);
 
             rocsolver_larfb_template<BATCHED, STRIDED, T>(
                 handle, rocblas_side_left, rocblas_operation_none, rocblas_forward_direction,
@@ -153,9 +154,9 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
             ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
                                     0, stream, j, jb, A, shiftA + idx2D(0, j, lda), lda, strideA);
         }
-        rocsolver_org2r_ung2r_template<T>(handle, m - j, jb, jb, A, shiftA + idx2D(j, j, lda), lda,
-                                          strideA, (ipiv + j), strideP, batch_count, scalars,
-                                          Abyx_tmptr, workArr);
+        rocsolver_org2r_ung2r_template<BATCHED, STRIDED, T>(
+            handle, m - j, jb, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j), strideP,
+            batch_count, scalars, Abyx_tmptr, workArr);
 
         j -= jb;
     }
@@ -0,0 +1,164 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocauxiliary_larfb.hpp"
+#include "rocauxiliary_larft.hpp"
+#include "rocauxiliary_orgr2_ungr2.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+template <bool BATCHED, typename T>
+void rocsolver_orgrq_ungrq_getMemorySize(const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int k,
+                                         const rocblas_int batch_count,
+                                         size_t* size_scalars,
+                                         size_t* size_work,
+                                         size_t* size_Abyx_tmptr,
+                                         size_t* size_trfact,
+                                         size_t* size_workArr)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work = 0;
+        *size_Abyx_tmptr = 0;
+        *size_trfact = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    size_t temp, unused;
+    rocsolver_orgr2_ungr2_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars,
+                                                    size_Abyx_tmptr, size_workArr);
+
+    if(k <= xxGxQ_xxGxQ2_SWITCHSIZE)
+    {
+        *size_work = 0;
+        *size_trfact = 0;
+    }
+
+    else
+    {
+        rocblas_int jb = xxGxQ_BLOCKSIZE;
+
+        // size of workspace is maximum of what is needed by larft and larfb.
+        // size of Abyx_tmptr is maximum of what is needed by orgr2/ungr2 and larfb.
+        rocsolver_larft_getMemorySize<BATCHED, T>(n, jb, batch_count, &unused, size_work, &unused);
+        rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_right, m - jb, n, jb, batch_count,
+                                                  &temp, &unused);
+
+        *size_Abyx_tmptr = *size_Abyx_tmptr >= temp ? *size_Abyx_tmptr : temp;
+
+        // size of temporary array for triangular factor
+        *size_trfact = sizeof(T) * jb * jb * batch_count;
+    }
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_orgrq_ungrq_template(rocblas_handle handle,
+                                              const rocblas_int m,
+                                              const rocblas_int n,
+                                              const rocblas_int k,
+                                              U A,
+                                              const rocblas_int shiftA,
+                                              const rocblas_int lda,
+                                              const rocblas_stride strideA,
+                                              T* ipiv,
+                                              const rocblas_stride strideP,
+                                              const rocblas_int batch_count,
+                                              T* scalars,
+                                              T* work,
+                                              T* Abyx_tmptr,
+                                              T* trfact,
+                                              T** workArr)
+{
+    ROCSOLVER_ENTER("orgrq_ungrq", "m:", m, "n:", n, "k:", k, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(!n || !m || !batch_count)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // if the matrix is small, use the unblocked variant of the algorithm
+    if(k <= xxGxQ_xxGxQ2_SWITCHSIZE)
+        return rocsolver_orgr2_ungr2_template<T>(handle, m, n, k, A, shiftA, lda, strideA, ipiv,
+                                                 strideP, batch_count, scalars, Abyx_tmptr, workArr);
+
+    rocblas_int ldw = xxGxQ_BLOCKSIZE;
+    rocblas_stride strideW = rocblas_stride(ldw) * ldw;
+
+    // size of blocked part
+    rocblas_int jb = ldw;
+    rocblas_int kk = min(k, ((k - xxGxQ_xxGxQ2_SWITCHSIZE + jb - 1) / jb) * jb);
+
+    // start of first blocked block is j + m - k = m - kk
+    rocblas_int j = k - kk;
+
+    rocblas_int blocksy, blocksx;
+
+    // compute the unblocked part and set to zero the
+    // corresponding right submatrix
+    if(kk < m)
+    {
+        blocksx = (m - kk - 1) / 32 + 1;
+        blocksy = (kk - 1) / 32 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
+                                stream, m - kk, kk, A, shiftA + idx2D(0, n - kk, lda), lda, strideA);
+
+        rocsolver_orgr2_ungr2_template<T>(handle, m - kk, n - kk, k - kk, A, shiftA, lda, strideA,
+                                          ipiv, strideP, batch_count, scalars, Abyx_tmptr, workArr);
+    }
+
+    // compute the blocked part
+    while(j < k)
+    {
+        rocblas_int ii = m - k + j;
+
+        // first update the already computed part
+        // applying the current block reflector using larft + larfb
+        if(ii > 0)
+        {
+            rocsolver_larft_template<BATCHED, STRIDED, T>(
+                handle, rocblas_backward_direction, rocblas_row_wise, n - k + j + jb, jb, A,
+                shiftA + idx2D(ii, 0, lda), lda, strideA, (ipiv + j), strideP, trfact, ldw,
+                strideW, batch_count, scalars, work, workArr);
+
+            rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+                rocblas_backward_direction, rocblas_row_wise, ii, n - k + j + jb, jb, A,
+                shiftA + idx2D(ii, 0, lda), lda, strideA, trfact, 0, ldw, strideW, A, shiftA, lda,
+                strideA, batch_count, Abyx_tmptr, workArr);
+        }
+
+        // now compute the current block and set to zero
+        // the corresponding right submatrix
+        if(j + jb < k)
+        {
+            blocksx = (jb - 1) / 32 + 1;
+            blocksy = (k - j - jb - 1) / 32 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
+                                    0, stream, jb, k - j - jb, A,
+                                    shiftA + idx2D(ii, n - k + j + jb, lda), lda, strideA);
+        }
+        rocsolver_orgr2_ungr2_template<T>(handle, jb, n - k + j + jb, jb, A,
+                                          shiftA + idx2D(ii, 0, lda), lda, strideA, (ipiv + j),
+                                          strideP, batch_count, scalars, Abyx_tmptr, workArr);
+
+        j += jb;
+    }
+
+    return rocblas_status_success;
+}
@@ -43,36 +43,33 @@ rocblas_status rocsolver_orm2r_unm2r_impl(rocblas_handle handle,
     // memory workspace sizes:
     // size for constants in rocblas calls
     size_t size_scalars;
-    // extra requirements for calling LARF
-    size_t size_Abyx;
-    // size of temporary array for diagonal elements
-    size_t size_diag;
+    // size of temporary array for triangular factor
+    size_t size_trfact;
     // size of arrays of pointers (for batched cases)
     size_t size_workArr;
     rocsolver_orm2r_unm2r_getMemorySize<false, T>(side, m, n, k, batch_count, &size_scalars,
-                                                  &size_Abyx, &size_diag, &size_workArr);
+                                                  &size_trfact, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_Abyx, size_diag,
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_trfact,
                                                       size_workArr);
 
     // memory workspace allocation
-    void *scalars, *Abyx, *diag, *workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_Abyx, size_diag, size_workArr);
+    void *scalars, *trfact, *workArr;
+    rocblas_device_malloc mem(handle, size_scalars, size_trfact, size_workArr);
     if(!mem)
         return rocblas_status_memory_error;
 
     scalars = mem[0];
-    Abyx = mem[1];
-    diag = mem[2];
-    workArr = mem[3];
+    trfact = mem[1];
+    workArr = mem[2];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
     // execution
-    return rocsolver_orm2r_unm2r_template<T>(handle, side, trans, m, n, k, A, shiftA, lda, strideA,
-                                             ipiv, strideP, C, shiftC, ldc, strideC, batch_count,
-                                             (T*)scalars, (T*)Abyx, (T*)diag, (T**)workArr);
+    return rocsolver_orm2r_unm2r_template<false, false, T>(
+        handle, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC, ldc,
+        strideC, batch_count, (T*)scalars, (T*)trfact, (T**)workArr);
 }
 
 /*
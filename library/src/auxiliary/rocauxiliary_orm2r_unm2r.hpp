@@ -9,11 +9,103 @@
 
 #pragma once
 
-#include "rocauxiliary_lacgv.hpp"
-#include "rocauxiliary_larf.hpp"
+#include "rocauxiliary_larfb.hpp"
+#include "rocauxiliary_larft.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
 
+/** ORM2R_SMALL_KERNEL applies the orthogonal/unitary matrix Q (or Q'), of order nq <=
+    GEQR2_SMALL_MAX_ROWS, to the m-by-n matrix C with a single kernel launch. Every work-group
+    updates GEQR2_SMALL_MAX_COLS columns of C (if side is left) or rows of C (if side is right),
+    keeping the current Householder vector in shared memory.
+
+    Call this kernel with ceil(n / GEQR2_SMALL_MAX_COLS) groups in x if side is left (or
+    ceil(m / GEQR2_SMALL_MAX_COLS) if side is right), batch_count groups in y, and BS1 threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) orm2r_small_kernel(const rocblas_side side,
+                                                                const rocblas_operation trans,
+                                                                const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                const rocblas_int k,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                T* ipivA,
+                                                                const rocblas_stride strideP,
+                                                                U CC,
+                                                                const rocblas_int shiftC,
+                                                                const rocblas_int ldc,
+                                                                const rocblas_stride strideC)
+{
+    constexpr rocblas_int NCOLS = GEQR2_SMALL_MAX_COLS;
+    constexpr rocblas_int NROWS = BS1 / NCOLS;
+
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int rid = tid % NROWS;
+    rocblas_int cid = tid / NROWS;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
+    T* ipiv = ipivA + bid * strideP;
+
+    // shared memory
+    __shared__ T sw[BS1];
+    __shared__ T sv[GEQR2_SMALL_MAX_ROWS];
+
+    // the Householder vectors run along the columns of C if side is left,
+    // and along its rows if side is right
+    bool left = (side == rocblas_side_left);
+    bool transpose = (trans != rocblas_operation_none);
+    bool forward = (left == transpose);
+    rocblas_int nq = (left ? m : n);
+    rocblas_int nc = (left ? n : m);
+    rocblas_int incq = (left ? 1 : ldc);
+    rocblas_int incc = (left ? ldc : 1);
+    rocblas_int c = hipBlockIdx_x * NCOLS + cid;
+
+    for(rocblas_int jj = 0; jj < k; jj++)
+    {
+        rocblas_int j = (forward ? jj : k - 1 - jj);
+
+        // load the Householder vector into shared memory
+        for(rocblas_int i = j + 1 + tid; i < nq; i += BS1)
+            sv[i] = A[i + j * lda];
+        if(tid == 0)
+            sv[j] = 1;
+        __syncthreads();
+
+        // apply H(j) (or H(j)') to C(j:nq-1, c) if side is left, or to C(c, j:nq-1) if side is right
+        T t = (transpose ? conj(ipiv[j]) : ipiv[j]);
+        T w = 0;
+        if(c < nc)
+        {
+            for(rocblas_int i = j + rid; i < nq; i += NROWS)
+                w += (left ? conj(sv[i]) * C[i * incq + c * incc] : C[i * incq + c * incc] * sv[i]);
+        }
+        sw[tid] = w;
+        __syncthreads();
+
+        if(rid == 0)
+        {
+            for(rocblas_int r = 1; r < NROWS; r++)
+                w += sw[tid + r];
+            sw[tid] = t * w;
+        }
+        __syncthreads();
+
+        if(c < nc)
+        {
+            w = sw[cid * NROWS];
+            for(rocblas_int i = j + rid; i < nq; i += NROWS)
+                C[i * incq + c * incc] -= (left ? sv[i] * w : w * conj(sv[i]));
+        }
+        __syncthreads();
+    }
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_orm2r_unm2r_getMemorySize(const rocblas_side side,
                                          const rocblas_int m,
@@ -21,26 +113,30 @@ void rocsolver_orm2r_unm2r_getMemorySize(const rocblas_side side,
                                          const rocblas_int k,
                                          const rocblas_int batch_count,
                                          size_t* size_scalars,
-                                         size_t* size_Abyx,
-                                         size_t* size_diag,
+                                         size_t* size_trfact,
                                          size_t* size_workArr)
 {
     // if quick return no workspace needed
     if(m == 0 || n == 0 || k == 0 || batch_count == 0)
     {
         *size_scalars = 0;
-        *size_Abyx = 0;
-        *size_diag = 0;
+        *size_trfact = 0;
         *size_workArr = 0;
         return;
     }
 
-    // size of temporary array for diagonal elements
-    *size_diag = sizeof(T) * batch_count;
+    rocblas_int nq = (side == rocblas_side_left ? m : n);
 
-    // extra memory requirements for calling LARF
-    rocsolver_larf_getMemorySize<BATCHED, T>(side, m, n, batch_count, size_scalars, size_Abyx,
-                                             size_workArr);
+    // memory requirements to call larft
+    size_t unused;
+    rocsolver_larft_getMemorySize<BATCHED, T>(nq, min(k, LARFT_SMALL_MAX_K), batch_count,
+                                              size_scalars, &unused, size_workArr);
+
+    // size of temporary array for triangular factor
+    if(nq <= GEQR2_SMALL_MAX_ROWS)
+        *size_trfact = 0;
+    else
+        *size_trfact = sizeof(T) * LARFT_SMALL_MAX_K * LARFT_SMALL_MAX_K * batch_count;
 }
 
 template <bool COMPLEX, typename T, typename U>
@@ -88,7 +184,7 @@ rocblas_status rocsolver_orm2r_ormqr_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
+template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_orm2r_unm2r_template(rocblas_handle handle,
                                               const rocblas_side side,
                                               const rocblas_operation trans,
@@ -107,8 +203,7 @@ rocblas_status rocsolver_orm2r_unm2r_template(rocblas_handle handle,
                                               const rocblas_stride strideC,
                                               const rocblas_int batch_count,
                                               T* scalars,
-                                              T* Abyx,
-                                              T* diag,
+                                              T* trfact,
                                               T** workArr)
 {
     ROCSOLVER_ENTER("orm2r_unm2r", "side:", side, "trans:", trans, "m:", m, "n:", n, "k:", k,
@@ -122,78 +217,59 @@ rocblas_status rocsolver_orm2r_unm2r_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // if the order of Q is small, apply it with a single kernel
+    if((side == rocblas_side_left ? m : n) <= GEQR2_SMALL_MAX_ROWS)
+    {
+        rocblas_int blocks = ((side == rocblas_side_left ? n : m) - 1) / GEQR2_SMALL_MAX_COLS + 1;
+        ROCSOLVER_LAUNCH_KERNEL(orm2r_small_kernel<T>, dim3(blocks, batch_count, 1),
+                                dim3(BS1, 1, 1), 0, stream, side, trans, m, n, k, A, shiftA, lda,
+                                strideA, ipiv, strideP, C, shiftC, ldc, strideC);
+        return rocblas_status_success;
+    }
+
+    // otherwise, apply Q by blocks of LARFT_SMALL_MAX_K reflectors (the last block is allowed to
+    // be smaller), computing the triangular factor of every block reflector and applying it with
+    // the fused larfb kernel
+    rocblas_int ldw = LARFT_SMALL_MAX_K;
+    rocblas_stride strideW = rocblas_stride(ldw) * ldw;
+
     // determine limits and indices
     bool left = (side == rocblas_side_left);
     bool transpose = (trans != rocblas_operation_none);
-    rocblas_int start, step, ncol, nrow, ic, jc;
-    if(left)
+    rocblas_int nq = (left ? m : n);
+    rocblas_int start, step;
+    if(left == transpose)
     {
-        ncol = n;
-        jc = 0;
-        if(transpose)
-        {
-            start = -1;
-            step = 1;
-        }
-        else
-        {
-            start = k;
-            step = -1;
-        }
+        start = 0;
+        step = 1;
     }
     else
     {
-        nrow = m;
-        ic = 0;
-        if(transpose)
-        {
-            start = k;
-            step = -1;
-        }
-        else
-        {
-            start = -1;
-            step = 1;
-        }
+        start = ((k - 1) / ldw) * ldw;
+        step = -1;
     }
+    rocblas_int blocks = ((left ? n : m) - 1) / LARFT_SMALL_CHUNK + 1;
 
-    // conjugate tau
-    if(COMPLEX && transpose)
-        rocsolver_lacgv_template<T>(handle, k, ipiv, 0, 1, strideP, batch_count);
-
-    rocblas_int i;
-    for(rocblas_int j = 1; j <= k; ++j)
+    rocblas_int i, ib;
+    for(rocblas_int j = 0; j < k; j += ldw)
     {
-        i = start + step * j; // current householder vector
-        if(left)
-        {
-            nrow = m - i;
-            ic = i;
-        }
-        else
-        {
-            ncol = n - i;
-            jc = i;
-        }
+        i = start + step * j; // current householder block
+        ib = min(ldw, k - i);
 
-        // insert one in A(i,i), i.e. the i-th element along the main diagonal,
-        // to build/apply the householder matrix
-        ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
-                                diag, 0, 1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1, true);
+        // generate triangular factor of current block reflector
+        rocsolver_larft_template<BATCHED, STRIDED, T>(
+            handle, rocblas_forward_direction, rocblas_column_wise, nq - i, ib, A,
+            shiftA + idx2D(i, i, lda), lda, strideA, (ipiv + i), strideP, trfact, ldw, strideW,
+            batch_count, scalars, (T*)nullptr, workArr);
 
-        // Apply current Householder reflector
-        rocsolver_larf_template(handle, side, nrow, ncol, A, shiftA + idx2D(i, i, lda), 1, strideA,
-                                (ipiv + i), strideP, C, shiftC + idx2D(ic, jc, ldc), ldc, strideC,
-                                batch_count, scalars, Abyx, workArr);
-
-        // restore original value of A(i,i)
-        ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
-                                diag, 0, 1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1);
+        // apply current block reflector
+        ROCSOLVER_LAUNCH_KERNEL(larfb_fused_kernel<T>, dim3(blocks, batch_count, 1),
+                                dim3(BS1, 1, 1), 0, stream, side, trans, (left ? m - i : m),
+                                (left ? n : n - i), ib, A, shiftA + idx2D(i, i, lda), lda, strideA,
+                                trfact, 0, ldw, strideW, C,
+                                shiftC + (left ? idx2D(i, 0, ldc) : idx2D(0, i, ldc)), ldc,
+                                strideC);
     }
 
-    // restore tau
-    if(COMPLEX && transpose)
-        rocsolver_lacgv_template<T>(handle, k, ipiv, 0, 1, strideP, batch_count);
-
     return rocblas_status_success;
 }
@@ -166,9 +166,10 @@ rocblas_status rocsolver_ormlq_unmlq_template(rocblas_handle handle,
         }
 
         // generate triangular factor of current block reflector
-        rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_row_wise, nq - i, ib,
-                                    A, shiftA + idx2D(i, i, lda), lda, strideA, ipiv + i, strideP,
-                                    trfact, ldw, strideW, batch_count, scalars, AbyxORwork, workArr);
+        rocsolver_larft_template<BATCHED, STRIDED, T>(
+            handle, rocblas_forward_direction, rocblas_row_wise, nq - i, ib, A,
+            shiftA + idx2D(i, i, lda), lda, strideA, ipiv + i, strideP, trfact, ldw, strideW,
+            batch_count, scalars, AbyxORwork, workArr);
 
         // apply current block reflector
         rocsolver_larfb_template<BATCHED, STRIDED, T>(
@@ -155,10 +155,10 @@ rocblas_status rocsolver_ormql_unmql_template(rocblas_handle handle,
         }
 
         // generate triangular factor of current block reflector
-        rocsolver_larft_template<T>(handle, rocblas_backward_direction, rocblas_column_wise,
-                                    nq - k + i + ib, ib, A, shiftA + idx2D(0, i, lda), lda, strideA,
-                                    ipiv + i, strideP, trfact, ldw, strideW, batch_count, scalars,
-                                    AbyxORwork, workArr);
+        rocsolver_larft_template<BATCHED, STRIDED, T>(
+            handle, rocblas_backward_direction, rocblas_column_wise, nq - k + i + ib, ib, A,
+            shiftA + idx2D(0, i, lda), lda, strideA, ipiv + i, strideP, trfact, ldw, strideW,
+            batch_count, scalars, AbyxORwork, workArr);
 
         // apply current block reflector
         rocsolver_larfb_template<BATCHED, STRIDED, T>(
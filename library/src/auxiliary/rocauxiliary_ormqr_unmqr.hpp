@@ -40,7 +40,8 @@ void rocsolver_ormqr_unmqr_getMemorySize(const rocblas_side side,
 
     size_t unused;
     rocsolver_orm2r_unm2r_getMemorySize<BATCHED, T>(side, m, n, k, batch_count, size_scalars,
-                                                    size_AbyxORwork, size_diagORtmptr, size_workArr);
+                                                    size_AbyxORwork, size_workArr);
+    *size_diagORtmptr = 0;
 
     if(k > xxMQx_BLOCKSIZE)
     {
@@ -99,9 +100,9 @@ rocblas_status rocsolver_ormqr_unmqr_template(rocblas_handle handle,
 
     // if the matrix is small, use the unblocked variant of the algorithm
     if(k <= xxMQx_BLOCKSIZE)
-        return rocsolver_orm2r_unm2r_template<T>(
+        return rocsolver_orm2r_unm2r_template<BATCHED, STRIDED, T>(
             handle, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC, ldc,
-            strideC, batch_count, scalars, AbyxORwork, diagORtmptr, workArr);
+            strideC, batch_count, scalars, AbyxORwork, workArr);
 
     rocblas_int ldw = xxMQx_BLOCKSIZE;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
@@ -160,9 +161,10 @@ rocblas_status rocsolver_ormqr_unmqr_template(rocblas_handle handle,
         }
 
         // generate triangular factor of current block reflector
-        rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise, nq - i,
-                                    ib, A, shiftA + idx2D(i, i, lda), lda, strideA, ipiv + i, strideP,
-                                    trfact, ldw, strideW, batch_count, scalars, AbyxORwork, workArr);
+        rocsolver_larft_template<BATCHED, STRIDED, T>(
+            handle, rocblas_forward_direction, rocblas_column_wise, nq - i, ib, A,
+            shiftA + idx2D(i, i, lda), lda, strideA, ipiv + i, strideP, trfact, ldw, strideW,
+            batch_count, scalars, AbyxORwork, workArr);
 
         // apply current block reflector
         rocsolver_larfb_template<BATCHED, STRIDED, T>(
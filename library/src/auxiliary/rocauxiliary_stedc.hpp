@@ -1572,6 +1572,58 @@ rocblas_status rocsolver_stedc_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
+/** STEDC_RUN_DC computes all the eigenvalues and eigenvectors of the tridiagonal matrix (D,E)
+    with the divide-and-conquer kernel. The eigenvectors are returned in the real n-by-n array
+    tempvect and the eigenvalues, not sorted, overwrite D. **/
+template <typename S>
+void rocsolver_stedc_run_dc(rocblas_handle handle,
+                            const rocblas_int n,
+                            S* D,
+                            const rocblas_int shiftD,
+                            const rocblas_stride strideD,
+                            S* E,
+                            const rocblas_int shiftE,
+                            const rocblas_stride strideE,
+                            S* tempvect,
+                            const rocblas_int ldt,
+                            const rocblas_stride strideT,
+                            rocblas_int* info,
+                            const rocblas_int batch_count,
+                            S* work_stack,
+                            S* tempgemm,
+                            S* tmpz,
+                            rocblas_int* splits)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // constants
+    S eps = get_epsilon<S>();
+    S ssfmin = get_safemin<S>();
+    S ssfmax = S(1.0) / ssfmin;
+    ssfmin = sqrt(ssfmin) / (eps * eps);
+    ssfmax = sqrt(ssfmax) / S(3.0);
+    rocblas_int blocksn = (n - 1) / BS2 + 1;
+
+    // find independent split blocks in matrix
+    ROCSOLVER_LAUNCH_KERNEL(stedc_split, dim3(batch_count), dim3(1), 0, stream, n, D + shiftD,
+                            strideD, E + shiftE, strideE, splits, eps);
+
+    // initialize identity matrix in tempvect
+    ROCSOLVER_LAUNCH_KERNEL(init_ident<S>, dim3(blocksn, blocksn, batch_count), dim3(BS2, BS2), 0,
+                            stream, n, n, tempvect, 0, ldt, strideT);
+
+    // find max number of sub-blocks to consider during the divide phase
+    rocblas_int maxblks = 1 << stedc_num_levels(n);
+    size_t lmemsize = sizeof(rocblas_int) * 2 * maxblks + sizeof(S) * BDIM;
+
+    // execute divide and conquer kernel with tempvect
+    ROCSOLVER_LAUNCH_KERNEL((stedc_kernel<S>), dim3(STEDC_NUM_SPLIT_BLKS, batch_count), dim3(BDIM),
+                            lmemsize, stream, n, D + shiftD, strideD, E + shiftE, strideE,
+                            tempvect, 0, ldt, strideT, info, work_stack, tmpz, tempgemm, splits,
+                            eps, ssfmin, ssfmax, maxblks);
+}
+
 /** STEDC templated function **/
 template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
 rocblas_status rocsolver_stedc_template(rocblas_handle handle,
@@ -1637,38 +1689,19 @@ rocblas_status rocsolver_stedc_template(rocblas_handle handle,
     // otherwise use divide and conquer algorithm:
     else
     {
-        // constants
-        S eps = get_epsilon<S>();
-        S ssfmin = get_safemin<S>();
-        S ssfmax = S(1.0) / ssfmin;
-        ssfmin = sqrt(ssfmin) / (eps * eps);
-        ssfmax = sqrt(ssfmax) / S(3.0);
         rocblas_int blocksn = (n - 1) / BS2 + 1;
 
-        // find independent split blocks in matrix
-        ROCSOLVER_LAUNCH_KERNEL(stedc_split, dim3(batch_count), dim3(1), 0, stream, n, D + shiftD,
-                                strideD, E + shiftE, strideE, splits, eps);
-
         // initialize identity matrix in C if required
         if(evect == rocblas_evect_tridiagonal)
             ROCSOLVER_LAUNCH_KERNEL(init_ident<T>, dim3(blocksn, blocksn, batch_count),
                                     dim3(BS2, BS2), 0, stream, n, n, C, shiftC, ldc, strideC);
 
-        // initialize identity matrix in tempvect
+        // compute eigenvalues and eigenvectors of the tridiagonal matrix in tempvect
         rocblas_int ldt = n;
         rocblas_stride strideT = n * n;
-        ROCSOLVER_LAUNCH_KERNEL(init_ident<S>, dim3(blocksn, blocksn, batch_count), dim3(BS2, BS2),
-                                0, stream, n, n, tempvect, 0, ldt, strideT);
-
-        // find max number of sub-blocks to consider during the divide phase
-        rocblas_int maxblks = 1 << stedc_num_levels(n);
-        size_t lmemsize = sizeof(rocblas_int) * 2 * maxblks + sizeof(S) * BDIM;
-
-        // execute divide and conquer kernel with tempvect
-        ROCSOLVER_LAUNCH_KERNEL((stedc_kernel<S>), dim3(STEDC_NUM_SPLIT_BLKS, batch_count),
-                                dim3(BDIM), lmemsize, stream, n, D + shiftD, strideD, E + shiftE,
-                                strideE, tempvect, 0, ldt, strideT, info, (S*)work_stack, tmpz,
-                                tempgemm, splits, eps, ssfmin, ssfmax, maxblks);
+        rocsolver_stedc_run_dc<S>(handle, n, D, shiftD, strideD, E, shiftE, strideE, tempvect, ldt,
+                                  strideT, info, batch_count, (S*)work_stack, tempgemm, tmpz,
+                                  splits);
 
         // update eigenvectors C <- C*tempvect
         local_gemm<BATCHED, STRIDED, T>(handle, n, C, shiftC, ldc, strideC, tempvect, tempgemm,
@@ -47,8 +47,9 @@ rocblas_status rocsolver_stein_impl(rocblas_handle handle,
 
     // memory workspace sizes:
     // size for lagtf/stein workspace
+    // (nev is only known on the device, so it is bounded by n)
     size_t size_work, size_iwork;
-    rocsolver_stein_getMemorySize<T, S>(n, batch_count, &size_work, &size_iwork);
+    rocsolver_stein_getMemorySize<T, S>(n, n, batch_count, &size_work, &size_iwork);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(handle, size_work, size_iwork);
@@ -63,10 +64,10 @@ rocblas_status rocsolver_stein_impl(rocblas_handle handle,
     iwork = mem[1];
 
     // execution
-    return rocsolver_stein_template<T>(handle, n, D, shiftD, strideD, E, shiftE, strideE, nev, W,
-                                       shiftW, strideW, iblock, strideIblock, isplit, strideIsplit,
-                                       Z, shiftZ, ldz, strideZ, ifail, strideIfail, info,
-                                       batch_count, (S*)work, (rocblas_int*)iwork);
+    return rocsolver_stein_template<T>(handle, n, D, shiftD, strideD, E, shiftE, strideE, nev, n,
+                                       W, shiftW, strideW, iblock, strideIblock, isplit,
+                                       strideIsplit, Z, shiftZ, ldz, strideZ, ifail, strideIfail,
+                                       info, batch_count, (S*)work, (rocblas_int*)iwork);
 }
 
 /*
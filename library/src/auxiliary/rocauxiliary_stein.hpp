@@ -21,52 +21,67 @@
 
 #define STEIN_MAX_NRMCHK 2
 
-template <typename T, typename S, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
-__device__ void stein_reorthogonalize(rocblas_int i,
+/** maximum number of workgroups computing the eigenvectors of the same matrix.
+    (independent clusters of eigenvalues are distributed among them) **/
+#define STEIN_MAX_GROUPS 64
+
+/** This device function reorthogonalizes work against the vectors in columns i to j-1 of Z
+    using block classical Gram-Schmidt with reorthogonalization (CGS2). For each block of
+    MAX_THDS vectors, the projections are computed with one thread per vector, and the
+    update is applied with one thread per row. sval should be a shared array of size MAX_THDS. **/
+template <int MAX_THDS, typename T, typename S>
+__device__ void stein_reorthogonalize(const int tid,
+                                      const rocblas_int i,
                                       const rocblas_int j,
                                       const rocblas_int n,
                                       const rocblas_int b1,
                                       S* work,
                                       T* Z,
-                                      const rocblas_int ldz)
+                                      const rocblas_int ldz,
+                                      S* sval)
 {
+    rocblas_int jr, k, kb;
     S ztr;
-    rocblas_int jr;
 
-    for(; i <= j - 1; i++)
+    for(int pass = 0; pass < 2; pass++)
     {
-        ztr = 0;
-        for(jr = 0; jr < n; jr++)
-            ztr = ztr + work[jr] * Z[(b1 + jr) + i * ldz];
-        for(jr = 0; jr < n; jr++)
-            work[jr] = work[jr] - ztr * Z[(b1 + jr) + i * ldz];
-    }
-}
+        for(rocblas_int k0 = i; k0 < j; k0 += MAX_THDS)
+        {
+            kb = std::min(MAX_THDS, j - k0);
 
-template <typename T, typename S, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
-__device__ void stein_reorthogonalize(rocblas_int i,
-                                      const rocblas_int j,
-                                      const rocblas_int n,
-                                      const rocblas_int b1,
-                                      S* work,
-                                      T* Z,
-                                      const rocblas_int ldz)
-{
-    S ztr;
-    rocblas_int jr;
+            // projections onto the current block of vectors
+            if(tid < kb)
+            {
+                ztr = 0;
+                for(jr = 0; jr < n; jr++)
+                    ztr = ztr + work[jr] * real_part(Z[(b1 + jr) + (k0 + tid) * ldz]);
+                sval[tid] = ztr;
+            }
+            __syncthreads();
 
-    for(; i <= j - 1; i++)
-    {
-        ztr = 0;
-        for(jr = 0; jr < n; jr++)
-            ztr = ztr + work[jr] * Z[(b1 + jr) + i * ldz].real();
-        for(jr = 0; jr < n; jr++)
-            work[jr] = work[jr] - ztr * Z[(b1 + jr) + i * ldz].real();
+            // remove the projections
+            for(jr = tid; jr < n; jr += MAX_THDS)
+            {
+                ztr = 0;
+                for(k = 0; k < kb; k++)
+                    ztr = ztr + sval[k] * real_part(Z[(b1 + jr) + (k0 + k) * ldz]);
+                work[jr] = work[jr] - ztr;
+            }
+            __syncthreads();
+        }
     }
 }
 
+/** This device function computes the eigenvectors of the clusters assigned to the calling
+    workgroup. A cluster is a maximal sequence of eigenvalues of the same split-off block whose
+    consecutive gaps are not larger than ortol; clusters are independent and their first
+    eigenvalues are distributed among the ngroups workgroups associated with the matrix.
+    If mask is not null, only the clusters containing a flagged eigenvalue are computed.
+    Eigenvectors whose computation did not converge are flagged in fail. **/
 template <int MAX_THDS, typename T, typename S>
 __device__ void run_stein(const int tid,
+                          const rocblas_int gid,
+                          const rocblas_int ngroups,
                           const rocblas_int n,
                           S* D,
                           S* E,
@@ -76,8 +91,8 @@ __device__ void run_stein(const int tid,
                           rocblas_int* isplit,
                           T* Z,
                           const rocblas_int ldz,
-                          rocblas_int* ifail,
-                          rocblas_int* info,
+                          rocblas_int* fail,
+                          rocblas_int* mask,
                           S* work,
                           rocblas_int* iwork,
                           S* sval1,
@@ -86,55 +101,89 @@ __device__ void run_stein(const int tid,
                           S eps,
                           S ssfmin)
 {
-    __shared__ rocblas_int _info;
-    rocblas_int i, j, j1 = 0, b1, bn, blksize, gpind;
-    S scl, onenrm, ortol, stpcrt, xj, xjm;
-
-    // zero info and ifail
-    if(tid == 0)
-        _info = 0;
-    if(ifail)
-        for(i = tid; i < nev; i += MAX_THDS)
-            ifail[i] = 0;
+    rocblas_int i, j, jc, j1 = 0, b1 = 0, bn = 0, blksize = 0, nblk, lo, hi;
+    rocblas_int cblk = -1;
+    S scl, onenrm = 0, ortol = 0, stpcrt = 0, xj, xjm = 0;
 
-    // iterate over submatrix blocks
-    for(rocblas_int nblk = 0; nblk < iblock[nev - 1]; nblk++)
+    // iterate over the eigenvalues that can start a cluster
+    for(jc = gid; jc < nev; jc += ngroups)
     {
-        // start and end indices of the submatrix
-        b1 = (nblk == 0 ? 0 : isplit[nblk - 1]);
-        bn = isplit[nblk] - 1;
-        blksize = bn - b1 + 1;
+        nblk = iblock[jc] - 1;
+        if(nblk != cblk)
+        {
+            cblk = nblk;
+
+            // start and end indices of the submatrix
+            b1 = (nblk == 0 ? 0 : isplit[nblk - 1]);
+            bn = isplit[nblk] - 1;
+            blksize = bn - b1 + 1;
 
-        if(blksize > 1)
+            // index of the first eigenvalue of the block (eigenvalues are in block order)
+            lo = 0;
+            hi = jc;
+            while(lo < hi)
+            {
+                i = (lo + hi) / 2;
+                if(iblock[i] - 1 < nblk)
+                    lo = i + 1;
+                else
+                    hi = i;
+            }
+            j1 = lo;
+
+            if(blksize > 1)
+            {
+                // compute reorthogonalization criterion and stopping criterion
+                scl = 0;
+                for(j = b1 + tid; j <= bn; j += MAX_THDS)
+                    scl = max(scl,
+                              abs(D[j]) + (j > b1 ? abs(E[j - 1]) : S(0))
+                                  + (j < bn ? abs(E[j]) : S(0)));
+                sval2[tid] = scl;
+                __syncthreads();
+                onenrm = 0;
+                for(i = 0; i < MAX_THDS; i++)
+                    onenrm = max(onenrm, sval2[i]);
+                __syncthreads();
+                ortol = S(0.001) * onenrm;
+                stpcrt = sqrt(0.1 / blksize);
+            }
+        }
+
+        // only the first eigenvalue of a cluster starts a new computation
+        if(jc > j1 && blksize > 1 && abs(W[jc] - W[jc - 1]) <= ortol)
+            continue;
+
+        // skip the clusters without flagged eigenvalues
+        if(mask)
         {
-            gpind = j1;
-
-            // compute reorthogonalization criterion and stopping criterion
-            onenrm = abs(D[b1]) + abs(E[b1]);
-            onenrm = max(onenrm, abs(D[bn]) + abs(E[bn - 1]));
-            for(j = b1 + 1; j <= bn - 1; j++)
-                onenrm = max(onenrm, abs(D[j]) + abs(E[j - 1]) + abs(E[j])); // <- parallelize?
-            ortol = S(0.001) * onenrm;
-            stpcrt = sqrt(0.1 / blksize);
+            bool flagged = false;
+            for(j = jc; j < nev && !flagged; j++)
+            {
+                if(iblock[j] - 1 != nblk)
+                    break;
+                if(j > jc && abs(W[j] - W[j - 1]) > ortol)
+                    break;
+                flagged = (mask[j] != 0);
+            }
+            if(!flagged)
+                continue;
         }
 
-        // loop through eigenvalues for current block
-        rocblas_int jblk = 0;
-        for(j = j1; j < nev; j++)
+        // loop through eigenvalues of the current cluster
+        for(j = jc; j < nev; j++)
         {
             if(iblock[j] - 1 != nblk)
-            {
-                j1 = j;
                 break;
-            }
+            if(j > jc && abs(W[j] - W[j - 1]) > ortol)
+                break;
 
-            jblk++;
             xj = W[j];
 
             if(blksize > 1)
             {
                 // if eigenvalues j and j-1 are too close, add a perturbation
-                if(jblk > 1)
+                if(j > jc)
                 {
                     S pertol = 10 * abs(eps * xj);
                     if(xj - xjm < pertol)
@@ -181,18 +230,10 @@ __device__ void run_stein(const int tid,
                                                work + 4 * n, iwork, work, 0, eps, ssfmin);
                     __syncthreads();
 
-                    // reorthogonalize by modified Gram-Schmidt if eigenvalues are close enough
-                    if(jblk > 1)
-                    {
-                        if(abs(xj - xjm) > ortol)
-                            gpind = j;
-                        if(gpind != j)
-                        {
-                            if(tid == 0)
-                                stein_reorthogonalize<T>(gpind, j, blksize, b1, work, Z, ldz);
-                            __syncthreads();
-                        }
-                    }
+                    // reorthogonalize against the previous vectors of the cluster
+                    if(j > jc)
+                        stein_reorthogonalize<MAX_THDS>(tid, jc, j, blksize, b1, work, Z, ldz,
+                                                        sval2);
 
                     // check the infinity norm of the iterate against stopping condition
                     iamax<MAX_THDS, S>(tid, blksize, work, 1, sval1, sidx);
@@ -203,11 +244,8 @@ __device__ void run_stein(const int tid,
                     iters++;
                 }
 
-                if(ifail && tid == 0 && nrmchk < STEIN_MAX_NRMCHK)
-                {
-                    ifail[_info] = j + 1;
-                    _info++;
-                }
+                if(tid == 0)
+                    fail[j] = (nrmchk < STEIN_MAX_NRMCHK ? 1 : 0);
 
                 iamax<MAX_THDS, S>(tid, blksize, work, 1, sval1, sidx);
                 nrm2<MAX_THDS, S>(tid, blksize, work, 1, sval2);
@@ -220,7 +258,10 @@ __device__ void run_stein(const int tid,
             else
             {
                 if(tid == 0)
+                {
                     work[0] = S(1);
+                    fail[j] = 0;
+                }
                 __syncthreads();
             }
 
@@ -231,9 +272,6 @@ __device__ void run_stein(const int tid,
             xjm = xj;
         }
     }
-
-    if(tid == 0)
-        *info = _info;
 }
 
 template <typename T, typename S, typename U>
@@ -254,27 +292,26 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEIN_MAX_THDS)
                  const rocblas_int shiftZ,
                  const rocblas_int ldz,
                  const rocblas_stride strideZ,
-                 rocblas_int* ifailA,
-                 const rocblas_stride strideIfail,
-                 rocblas_int* info,
+                 rocblas_int* fail,
+                 rocblas_int* mask,
                  S* work,
                  rocblas_int* iwork,
                  S eps,
                  S ssfmin)
 {
-    // select batch instance
+    // select batch instance and workgroup
     rocblas_int bid = hipBlockIdx_y;
+    rocblas_int gid = hipBlockIdx_x;
+    rocblas_int ngroups = hipGridDim_x;
     rocblas_int tid = hipThreadIdx_x;
     rocblas_stride stride_work = 5 * n;
     rocblas_stride stride_iwork = n;
+    rocblas_stride sid = bid * ngroups + gid;
 
     if(nev[bid] <= 0)
         return;
 
     T* Z = load_ptr_batch<T>(ZZ, bid, shiftZ, strideZ);
-    rocblas_int* ifail = nullptr;
-    if(ifailA)
-        ifail = ifailA + (bid * strideIfail);
 
     // shared mem for temporary values
     extern __shared__ double lmem[];
@@ -283,14 +320,57 @@ ROCSOLVER_KERNEL void __launch_bounds__(STEIN_MAX_THDS)
     rocblas_int* sidx = reinterpret_cast<rocblas_int*>(sval2 + STEIN_MAX_THDS);
 
     // execute
-    run_stein<STEIN_MAX_THDS, T>(
-        tid, n, D + (bid * strideD), E + (bid * strideE), nev[bid], W + (bid * strideW),
-        iblock + (bid * strideIblock), isplit + (bid * strideIsplit), Z, ldz, ifail, info + bid,
-        work + (bid * stride_work), iwork + (bid * stride_iwork), sval1, sval2, sidx, eps, ssfmin);
+    run_stein<STEIN_MAX_THDS, T>(tid, gid, ngroups, n, D + (bid * strideD), E + (bid * strideE),
+                                 nev[bid], W + (bid * strideW), iblock + (bid * strideIblock),
+                                 isplit + (bid * strideIsplit), Z, ldz, fail + (bid * n),
+                                 (mask ? mask + (bid * n) : nullptr), work + (sid * stride_work),
+                                 iwork + (sid * stride_iwork), sval1, sval2, sidx, eps, ssfmin);
+}
+
+/** This kernel gathers the indices of the eigenvectors that failed to converge
+    into ifail (in increasing order), and sets info to the number of failures **/
+ROCSOLVER_KERNEL void stein_info_kernel(const rocblas_int n,
+                                        rocblas_int* nevA,
+                                        rocblas_int* failA,
+                                        rocblas_int* ifailA,
+                                        const rocblas_stride strideIfail,
+                                        rocblas_int* info)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int nev = nevA[bid];
+    rocblas_int* fail = failA + (bid * n);
+    rocblas_int* ifail = nullptr;
+    if(ifailA)
+        ifail = ifailA + (bid * strideIfail);
+
+    rocblas_int nfail = 0;
+    for(rocblas_int j = 0; j < nev; j++)
+    {
+        if(fail[j])
+        {
+            if(ifail)
+                ifail[nfail] = j + 1;
+            nfail++;
+        }
+    }
+    if(ifail)
+        for(rocblas_int j = nfail; j < nev; j++)
+            ifail[j] = 0;
+
+    info[bid] = nfail;
+}
+
+/** Number of workgroups that compute the eigenvectors of a matrix of size n. As every
+    workgroup starts at least one cluster, there is no need for more than nev_max workgroups,
+    where nev_max is an upper bound of the number of eigenvectors to compute **/
+inline rocblas_int stein_get_ngroups(const rocblas_int n, const rocblas_int nev_max)
+{
+    return std::max(1, std::min({n, nev_max, STEIN_MAX_GROUPS}));
 }
 
 template <typename T, typename S>
 void rocsolver_stein_getMemorySize(const rocblas_int n,
+                                   const rocblas_int nev_max,
                                    const rocblas_int batch_count,
                                    size_t* size_work,
                                    size_t* size_iwork)
@@ -303,11 +383,13 @@ void rocsolver_stein_getMemorySize(const rocblas_int n,
         return;
     }
 
-    // size of workspace
-    *size_work = sizeof(S) * 5 * n * batch_count;
+    rocblas_int ngroups = stein_get_ngroups(n, nev_max);
+
+    // size of workspace (for every workgroup)
+    *size_work = sizeof(S) * 5 * n * ngroups * batch_count;
 
-    // size of integer workspace
-    *size_iwork = sizeof(rocblas_int) * n * batch_count;
+    // size of integer workspace (for every workgroup, plus the convergence flags)
+    *size_iwork = sizeof(rocblas_int) * n * (ngroups + 1) * batch_count;
 }
 
 template <typename T, typename S>
@@ -355,6 +437,7 @@ rocblas_status rocsolver_stein_template(rocblas_handle handle,
                                         const rocblas_int shiftE,
                                         const rocblas_stride strideE,
                                         rocblas_int* nev,
+                                        const rocblas_int nev_max,
                                         S* W,
                                         const rocblas_int shiftW,
                                         const rocblas_stride strideW,
@@ -373,8 +456,8 @@ rocblas_status rocsolver_stein_template(rocblas_handle handle,
                                         S* work,
                                         rocblas_int* iwork)
 {
-    ROCSOLVER_ENTER("stein", "n:", n, "shiftD:", shiftD, "shiftE:", shiftE, "shiftW:", shiftW,
-                    "shiftZ:", shiftZ, "ldz:", ldz, "bc:", batch_count);
+    ROCSOLVER_ENTER("stein", "n:", n, "nev_max:", nev_max, "shiftD:", shiftD, "shiftE:", shiftE,
+                    "shiftW:", shiftW, "shiftZ:", shiftZ, "ldz:", ldz, "bc:", batch_count);
 
     // quick return
     if(batch_count == 0)
@@ -397,13 +480,21 @@ rocblas_status rocsolver_stein_template(rocblas_handle handle,
     S eps = get_epsilon<T>();
     S ssfmin = get_safemin<T>();
 
-    dim3 grid(1, batch_count, 1);
+    rocblas_int ngroups = stein_get_ngroups(n, nev_max);
+    rocblas_int* fail = iwork + size_t(n) * ngroups * batch_count;
+
+    // compute the eigenvectors (independent clusters in different workgroups)
+    dim3 grid(ngroups, batch_count, 1);
     dim3 threads(STEIN_MAX_THDS, 1, 1);
     size_t lmemsize = STEIN_MAX_THDS * (2 * sizeof(S) + sizeof(rocblas_int));
     ROCSOLVER_LAUNCH_KERNEL(stein_kernel<T>, grid, threads, lmemsize, stream, n, D + shiftD,
                             strideD, E + shiftE, strideE, nev, W + shiftW, strideW, iblock,
-                            strideIblock, isplit, strideIsplit, Z, shiftZ, ldz, strideZ, ifail,
-                            strideIfail, info, work, iwork, eps, ssfmin);
+                            strideIblock, isplit, strideIsplit, Z, shiftZ, ldz, strideZ, fail,
+                            (rocblas_int*)nullptr, work, iwork, eps, ssfmin);
+
+    // set info and ifail
+    ROCSOLVER_LAUNCH_KERNEL(stein_info_kernel, dim3(1, batch_count, 1), dim3(1, 1, 1), 0, stream,
+                            n, nev, fail, ifail, strideIfail, info);
 
     return rocblas_status_success;
 }
@@ -0,0 +1,730 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.10.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocauxiliary_stein.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** thread-block size for calling the stemr kernels.
+    (each thread computes a different eigenvector) **/
+#define STEMR_THDS 64
+
+/** maximum number of levels in the representation tree **/
+#define STEMR_MAX_DEPTH 6
+
+/** maximum number of Rayleigh quotient corrections applied to an eigenvalue **/
+#define STEMR_MAX_ITERS 4
+
+/** maximum number of bisection steps used to refine an eigenvalue **/
+#define STEMR_MAX_BISEC 128
+
+/** eigenvalues with a relative gap smaller than STEMR_MINRGP are considered a cluster **/
+#define STEMR_MINRGP 1.0e-3
+
+/************** Kernels and device functions *********************************/
+/*****************************************************************************/
+
+/** This device function determines if the consecutive eigenvalues a <= b belong to
+    the same cluster of the representation with the given shift; i.e. if their relative
+    gap is too small, or if they cannot be distinguished within the absolute accuracy eabs **/
+template <typename S>
+__device__ bool stemr_clustered(const S a, const S b, const S shift, const S eabs)
+{
+    S den = std::max(std::abs(a - shift), std::abs(b - shift));
+    return (b - a <= eabs || b - a < S(STEMR_MINRGP) * den);
+}
+
+/** This device function returns the next pivot of the representation obtained by applying
+    the nt shifts in tau to the root representation, given the next pivot d of the root and the
+    corresponding off-diagonal product ld = D*L (which does not change with the shifts, and is
+    zero for the last pivot). The carries of the stationary qd transforms are kept in sq, which
+    must be initialized with stemr_init before the first pivot **/
+template <typename S>
+__device__ S stemr_pivot(const rocblas_int nt, const S* tau, S* sq, S d, const S ld, const S pmin)
+{
+    S dplus;
+    for(rocblas_int l = 0; l < nt; l++)
+    {
+        dplus = d + sq[l];
+        if(std::abs(dplus) < pmin)
+            dplus = -pmin;
+        sq[l] = (ld / dplus) * (ld / d) * sq[l] - tau[l];
+        d = dplus;
+    }
+
+    return d;
+}
+
+template <typename S>
+__device__ void stemr_init(const rocblas_int nt, const S* tau, S* sq)
+{
+    for(rocblas_int l = 0; l < nt; l++)
+        sq[l] = -tau[l];
+}
+
+/** This device function counts the number of eigenvalues of L*D*L' that are smaller
+    than x, using the stationary qd transform (differential form). The representation is
+    given by the root pivots D, the products LD and the nt shifts in tau **/
+template <typename S>
+__device__ rocblas_int stemr_negcount(const rocblas_int m,
+                                      const S* D,
+                                      const S* LD,
+                                      const rocblas_int nt,
+                                      const S* tau,
+                                      const S x,
+                                      const S pmin)
+{
+    S sq[STEMR_MAX_DEPTH];
+    stemr_init(nt, tau, sq);
+
+    rocblas_int neg = 0;
+    S d, dplus;
+    S s = -x;
+
+    for(rocblas_int i = 0; i < m - 1; i++)
+    {
+        d = stemr_pivot(nt, tau, sq, D[i], LD[i], pmin);
+        dplus = d + s;
+        if(dplus <= pmin)
+        {
+            neg++;
+            dplus = std::min(dplus, -pmin);
+        }
+        s = s * (LD[i] * LD[i] / d) / dplus - x;
+    }
+    d = stemr_pivot(nt, tau, sq, D[m - 1], S(0), pmin);
+    dplus = d + s;
+    if(dplus <= pmin)
+        neg++;
+
+    return neg;
+}
+
+/** This device function refines, by bisection, the only eigenvalue of L*D*L'
+    in the interval (lo, hi]. clo is the number of eigenvalues smaller than lo **/
+template <typename S>
+__device__ S stemr_bisect(const rocblas_int m,
+                          const S* D,
+                          const S* LD,
+                          const rocblas_int nt,
+                          const S* tau,
+                          S lo,
+                          S hi,
+                          const rocblas_int clo,
+                          const S pmin,
+                          const S eps)
+{
+    S mid;
+    for(rocblas_int it = 0; it < STEMR_MAX_BISEC; it++)
+    {
+        if(hi - lo <= std::max(2 * eps * std::max(std::abs(lo), std::abs(hi)), pmin))
+            break;
+
+        mid = (lo + hi) / 2;
+        if(stemr_negcount(m, D, LD, nt, tau, mid, pmin) > clo)
+            hi = mid;
+        else
+            lo = mid;
+    }
+
+    return (lo + hi) / 2;
+}
+
+/** This device function returns the element growth max|D+| of the representation
+    L+*D+*L+' = L*D*L' - shift*I, where L*D*L' is given by D, LD and the nt shifts in tau
+    (tau must have room for nt + 1 shifts) **/
+template <typename S>
+__device__ S stemr_growth(const rocblas_int m,
+                          const S* D,
+                          const S* LD,
+                          const rocblas_int nt,
+                          S* tau,
+                          const S shift,
+                          const S pmin)
+{
+    S sq[STEMR_MAX_DEPTH];
+    tau[nt] = shift;
+    stemr_init(nt + 1, tau, sq);
+
+    S growth = 0;
+    for(rocblas_int i = 0; i < m; i++)
+        growth = std::max(
+            growth, std::abs(stemr_pivot(nt + 1, tau, sq, D[i], (i < m - 1 ? LD[i] : S(0)), pmin)));
+
+    return growth;
+}
+
+/** This device function computes the twisted factorization of L*D*L' - lambda*I
+    and the corresponding (unnormalized) eigenvector approximation z, with z[r] = 1,
+    where the twist index r minimizes |gamma(r)|. Returns gamma(r) and the squared norm of z.
+    The vector z is also used to hold the intermediate qd arrays, and the pivots of
+    L*D*L' are recomputed from the root representation when needed, so no other
+    workspace is required **/
+template <typename T, typename S>
+__device__ void stemr_twisted(const rocblas_int m,
+                              const S* D,
+                              const S* LD,
+                              const rocblas_int nt,
+                              const S* tau,
+                              const S lambda,
+                              const S pmin,
+                              T* z,
+                              S* gamma,
+                              S* znrm)
+{
+    S sq[STEMR_MAX_DEPTH];
+    rocblas_int i, r;
+    S d, dd, p, s, tmp, mingma, zi, zi1, nrm;
+
+    // pivots of the representation
+    stemr_init(nt, tau, sq);
+    for(i = 0; i < m; i++)
+        z[i] = T(stemr_pivot(nt, tau, sq, D[i], (i < m - 1 ? LD[i] : S(0)), pmin));
+
+    // progressive qd transform from the bottom (p overwrites the pivots)
+    p = real_part(z[m - 1]) - lambda;
+    z[m - 1] = T(p);
+    for(i = m - 2; i >= 0; i--)
+    {
+        d = real_part(z[i]);
+        dd = LD[i] * LD[i] / d + p;
+        if(std::abs(dd) < pmin)
+            dd = -pmin;
+        p = p * d / dd - lambda;
+        z[i] = T(p);
+    }
+
+    // stationary qd transform from the top, and twist index
+    stemr_init(nt, tau, sq);
+    s = -lambda;
+    r = 0;
+    mingma = s + real_part(z[0]) + lambda;
+    for(i = 0; i < m - 1; i++)
+    {
+        if(i > 0)
+        {
+            tmp = s + real_part(z[i]) + lambda;
+            if(std::abs(tmp) < std::abs(mingma))
+            {
+                mingma = tmp;
+                r = i;
+            }
+        }
+        d = stemr_pivot(nt, tau, sq, D[i], LD[i], pmin);
+        dd = d + s;
+        if(std::abs(dd) < pmin)
+            dd = -pmin;
+        s = s * (LD[i] * LD[i] / d) / dd - lambda;
+    }
+    if(m > 1)
+    {
+        tmp = s + real_part(z[m - 1]) + lambda;
+        if(std::abs(tmp) < std::abs(mingma))
+        {
+            mingma = tmp;
+            r = m - 1;
+        }
+    }
+
+    // pivots of the stationary transform above the twist index (overwrite p)
+    stemr_init(nt, tau, sq);
+    s = -lambda;
+    for(i = 0; i < r; i++)
+    {
+        d = stemr_pivot(nt, tau, sq, D[i], LD[i], pmin);
+        dd = d + s;
+        if(std::abs(dd) < pmin)
+            dd = -pmin;
+        z[i] = T(dd);
+        s = s * (LD[i] * LD[i] / d) / dd - lambda;
+    }
+
+    // solve for the vector going down from the twist index (z[i] holds p[i] for i > r)
+    nrm = 1;
+    zi = 1;
+    zi1 = 0;
+    stemr_init(nt, tau, sq);
+    for(i = 0; i < m - 1; i++)
+    {
+        d = stemr_pivot(nt, tau, sq, D[i], LD[i], pmin);
+        if(i < r)
+            continue;
+
+        tmp = zi;
+        if(zi != 0)
+        {
+            dd = LD[i] * LD[i] / d + real_part(z[i + 1]);
+            if(std::abs(dd) < pmin)
+                dd = -pmin;
+            zi = -(LD[i] / dd) * zi;
+        }
+        else
+            zi = -(LD[i - 1] / LD[i]) * zi1;
+        zi1 = tmp;
+        z[i + 1] = T(zi);
+        nrm += zi * zi;
+    }
+
+    // solve for the vector going up from the twist index (z[i] holds D+[i] for i < r)
+    zi = 1;
+    zi1 = 0;
+    for(i = r - 1; i >= 0; i--)
+    {
+        tmp = zi;
+        if(zi != 0)
+            zi = -(LD[i] / real_part(z[i])) * zi;
+        else
+            zi = -(LD[i + 1] / LD[i]) * zi1;
+        zi1 = tmp;
+        z[i] = T(zi);
+        nrm += zi * zi;
+    }
+    z[r] = T(1);
+
+    *gamma = mingma;
+    *znrm = nrm;
+}
+
+/** This device function normalizes z so that its largest component is positive **/
+template <typename T, typename S>
+__device__ void stemr_normalize(const rocblas_int m, T* z, S nrm)
+{
+    rocblas_int imax = 0;
+    for(rocblas_int i = 1; i < m; i++)
+    {
+        if(std::abs(real_part(z[i])) > std::abs(real_part(z[imax])))
+            imax = i;
+    }
+
+    S scl = (nrm > 0 ? S(1) / sqrt(nrm) : S(0));
+    if(real_part(z[imax]) < 0)
+        scl = -scl;
+    for(rocblas_int i = 0; i < m; i++)
+        z[i] = T(real_part(z[i]) * scl);
+}
+
+/** This kernel computes the root representation L*D*L' = T - sigma*I of each
+    split-off block of the tridiagonal matrix. Sigma is chosen slightly below the
+    smallest eigenvalue of the block so that the representation is positive definite
+    and, therefore, determines all its eigenvalues to high relative accuracy.
+    Only the pivots D are stored, as the products D*L are the off-diagonal elements of T **/
+template <typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(STEMR_THDS)
+    stemr_root_kernel(const rocblas_int n,
+                      S* DD,
+                      const rocblas_stride strideD,
+                      S* EE,
+                      const rocblas_stride strideE,
+                      rocblas_int* nevA,
+                      rocblas_int* iblockA,
+                      const rocblas_stride strideIblock,
+                      rocblas_int* isplitA,
+                      const rocblas_stride strideIsplit,
+                      S* work,
+                      const S eps,
+                      const S ssfmin)
+{
+    // select batch instance
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int nev = nevA[bid];
+
+    if(nev <= 0)
+        return;
+
+    S* D = DD + (bid * strideD);
+    S* E = EE + (bid * strideE);
+    rocblas_int* iblock = iblockA + (bid * strideIblock);
+    rocblas_int* isplit = isplitA + (bid * strideIsplit);
+    S* root = work + bid * 4 * size_t(n);
+
+    rocblas_int b1, bn, m, i, ev;
+    S t, tnrm, emax, gl, gu, lo, hi, mid, sigma, delta, pmin, l;
+
+    // each thread works with a different split-off block
+    for(rocblas_int nblk = tid; nblk < iblock[nev - 1]; nblk += STEMR_THDS)
+    {
+        b1 = (nblk == 0 ? 0 : isplit[nblk - 1]);
+        bn = isplit[nblk] - 1;
+        m = bn - b1 + 1;
+        S* Dr = root + b1;
+        S* bs = root + n + 3 * nblk;
+
+        // norm, gershgorin bounds and pivmin of the block
+        tnrm = 0;
+        emax = 0;
+        gl = D[b1];
+        gu = D[b1];
+        for(i = b1; i <= bn; i++)
+        {
+            t = (i > b1 ? std::abs(E[i - 1]) : S(0)) + (i < bn ? std::abs(E[i]) : S(0));
+            gl = std::min(gl, D[i] - t);
+            gu = std::max(gu, D[i] + t);
+            tnrm = std::max(tnrm, std::abs(D[i]) + t);
+            if(i < bn)
+                emax = std::max(emax, E[i] * E[i]);
+        }
+        pmin = ssfmin * std::max(S(1), emax);
+
+        // lower bound of the smallest eigenvalue of the block (bisection with sturm counts)
+        lo = gl;
+        hi = gu;
+        for(rocblas_int it = 0; it < STEMR_MAX_BISEC; it++)
+        {
+            if(hi - lo <= std::max(2 * eps * std::max(std::abs(lo), std::abs(hi)), pmin))
+                break;
+
+            mid = (lo + hi) / 2;
+            ev = 0;
+            t = D[b1] - mid;
+            if(t <= pmin)
+                ev++;
+            for(i = b1 + 1; i <= bn && ev == 0; i++)
+            {
+                t = D[i] - mid - E[i - 1] * E[i - 1] / t;
+                if(t <= pmin)
+                    ev++;
+            }
+
+            if(ev > 0)
+                hi = mid;
+            else
+                lo = mid;
+        }
+
+        // factorize T - sigma*I; if it is not numerically positive definite,
+        // move sigma further away from the spectrum
+        delta = 2 * eps * tnrm;
+        for(rocblas_int it = 0; it < 16; it++)
+        {
+            sigma = lo - delta;
+            Dr[0] = D[b1] - sigma;
+            bool posdef = (Dr[0] > 0);
+            for(i = 0; i < m - 1 && posdef; i++)
+            {
+                l = E[b1 + i] / Dr[i];
+                Dr[i + 1] = D[b1 + i + 1] - sigma - l * E[b1 + i];
+                posdef = (Dr[i + 1] > 0);
+            }
+
+            if(posdef)
+                break;
+            delta *= 4;
+        }
+
+        bs[0] = sigma;
+        bs[1] = pmin;
+        bs[2] = tnrm;
+    }
+}
+
+/** This device function computes the eigenvector j of the tridiagonal matrix
+    from the representation tree rooted at the block representation. Eigenvalues
+    forming a cluster (with small relative gaps) are shifted to a new representation
+    closer to the cluster until they become singletons. The representation at every level
+    is given by the root pivots and the (at most STEMR_MAX_DEPTH - 1) accumulated shifts, and
+    its pivots are recomputed when needed, so that no per-eigenvector copies are kept.
+    Clusters that cannot be resolved after STEMR_MAX_DEPTH levels (i.e. numerically multiple
+    eigenvalues) are flagged in mask, and their eigenvectors are computed afterwards with STEIN **/
+template <typename T, typename S>
+__device__ void run_stemr(const rocblas_int j,
+                          const rocblas_int n,
+                          const rocblas_int nev,
+                          S* E,
+                          S* W,
+                          rocblas_int* iblock,
+                          rocblas_int* isplit,
+                          T* Z,
+                          const rocblas_int ldz,
+                          S* root,
+                          rocblas_int* mask,
+                          const S eps)
+{
+    rocblas_int i, depth, c1, c2, cl, cu, clo, chi;
+    S gamma, nrm, lambda, lo, hi, corr;
+
+    // block containing eigenvalue j
+    rocblas_int nblk = iblock[j] - 1;
+    rocblas_int b1 = (nblk == 0 ? 0 : isplit[nblk - 1]);
+    rocblas_int bn = isplit[nblk] - 1;
+    rocblas_int m = bn - b1 + 1;
+    S* bs = root + n + 3 * nblk;
+    S shift = bs[0];
+    S pmin = bs[1];
+    S tnrm = bs[2];
+    S eabs = 2 * m * eps * tnrm;
+
+    // zero the entries of the eigenvector outside of the block
+    for(i = 0; i < b1; i++)
+        Z[i + j * ldz] = T(0);
+    for(i = bn + 1; i < n; i++)
+        Z[i + j * ldz] = T(0);
+    T* z = Z + b1 + j * ldz;
+
+    if(m == 1)
+    {
+        z[0] = T(1);
+        return;
+    }
+
+    // root representation and accumulated shifts
+    const S* D = root + b1;
+    const S* LD = E + b1;
+    S tau[STEMR_MAX_DEPTH];
+    rocblas_int nt = 0;
+
+    // descend the representation tree until eigenvalue j is a singleton
+    bool singleton = false;
+    cl = 0;
+    cu = nev - 1;
+    for(depth = 0; depth < STEMR_MAX_DEPTH; depth++)
+    {
+        c1 = j;
+        c2 = j;
+        while(c1 > cl && iblock[c1 - 1] == iblock[j]
+              && stemr_clustered(W[c1 - 1], W[c1], shift, eabs))
+            c1--;
+        while(c2 < cu && iblock[c2 + 1] == iblock[j]
+              && stemr_clustered(W[c2], W[c2 + 1], shift, eabs))
+            c2++;
+
+        if(c1 == c2)
+        {
+            singleton = true;
+            break;
+        }
+        if(depth == STEMR_MAX_DEPTH - 1)
+            break;
+
+        // new representation shifted to the end of the cluster with the smaller element growth
+        S delta = std::max(eabs, 2 * eps * std::max(std::abs(W[c1]), std::abs(W[c2])));
+        S tauL = W[c1] - delta - shift;
+        S tauR = W[c2] + delta - shift;
+        S growL = stemr_growth(m, D, LD, nt, tau, tauL, pmin);
+        S growR = stemr_growth(m, D, LD, nt, tau, tauR, pmin);
+        tau[nt] = (growR < growL ? tauR : tauL);
+        shift += tau[nt];
+        nt++;
+        cl = c1;
+        cu = c2;
+    }
+
+    if(!singleton)
+    {
+        // unresolved cluster: the eigenvector is computed by STEIN
+        mask[j] = 1;
+        return;
+    }
+
+    // refine the eigenvalue to high relative accuracy with respect to the representation
+    lambda = W[j] - shift;
+    lo = lambda - (j > 0 && iblock[j - 1] == iblock[j] ? (W[j] - W[j - 1]) / 2 : tnrm);
+    hi = lambda + (j < nev - 1 && iblock[j + 1] == iblock[j] ? (W[j + 1] - W[j]) / 2 : tnrm);
+    clo = stemr_negcount(m, D, LD, nt, tau, lo, pmin);
+    chi = stemr_negcount(m, D, LD, nt, tau, hi, pmin);
+    if(chi - clo != 1)
+    {
+        lo = lambda - eabs;
+        hi = lambda + eabs;
+        clo = stemr_negcount(m, D, LD, nt, tau, lo, pmin);
+        chi = stemr_negcount(m, D, LD, nt, tau, hi, pmin);
+    }
+    if(chi - clo == 1)
+        lambda = stemr_bisect(m, D, LD, nt, tau, lo, hi, clo, pmin, eps);
+    else
+    {
+        lo = lambda - tnrm;
+        hi = lambda + tnrm;
+    }
+
+    // compute the eigenvector with the twisted factorization, applying
+    // Rayleigh quotient corrections to the eigenvalue if needed
+    for(rocblas_int it = 0; it < STEMR_MAX_ITERS; it++)
+    {
+        stemr_twisted(m, D, LD, nt, tau, lambda, pmin, z, &gamma, &nrm);
+
+        corr = gamma / nrm;
+        if(std::abs(corr) <= 4 * eps * std::abs(lambda) || lambda + corr <= lo
+           || lambda + corr >= hi)
+            break;
+        lambda += corr;
+    }
+
+    stemr_normalize(m, z, nrm);
+}
+
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(STEMR_THDS) stemr_kernel(const rocblas_int n,
+                                                                 S* EE,
+                                                                 const rocblas_stride strideE,
+                                                                 rocblas_int* nevA,
+                                                                 S* WW,
+                                                                 const rocblas_stride strideW,
+                                                                 rocblas_int* iblockA,
+                                                                 const rocblas_stride strideIblock,
+                                                                 rocblas_int* isplitA,
+                                                                 const rocblas_stride strideIsplit,
+                                                                 U ZZ,
+                                                                 const rocblas_int shiftZ,
+                                                                 const rocblas_int ldz,
+                                                                 const rocblas_stride strideZ,
+                                                                 rocblas_int* failA,
+                                                                 rocblas_int* maskA,
+                                                                 S* work,
+                                                                 const S eps)
+{
+    // select batch instance and eigenvector
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int nev = nevA[bid];
+
+    if(j >= nev)
+        return;
+
+    T* Z = load_ptr_batch<T>(ZZ, bid, shiftZ, strideZ);
+    rocblas_int* mask = maskA + (bid * n);
+    failA[j + bid * n] = 0;
+    mask[j] = 0;
+
+    S* root = work + bid * 4 * size_t(n);
+
+    // execute
+    run_stemr<T>(j, n, nev, EE + (bid * strideE), WW + (bid * strideW),
+                 iblockA + (bid * strideIblock), isplitA + (bid * strideIsplit), Z, ldz, root,
+                 mask, eps);
+}
+
+/****** Template function, workspace size and argument validation **********/
+/***************************************************************************/
+
+/** Returns true if the eigenvectors are computed with STEMR instead of STEIN, i.e. if the
+    number of requested eigenvectors can reach STEMR_MIN_NEV **/
+inline bool rocsolver_stemr_selected(const rocblas_int n,
+                                     const rocblas_erange erange,
+                                     const rocblas_int il,
+                                     const rocblas_int iu)
+{
+    rocblas_int nev = (erange == rocblas_erange_index ? iu - il + 1 : n);
+    return nev >= STEMR_MIN_NEV;
+}
+
+template <typename T, typename S>
+void rocsolver_stemr_getMemorySize(const rocblas_int n,
+                                   const rocblas_int nev_max,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work,
+                                   size_t* size_iwork)
+{
+    // requirements for calling STEIN on the unresolved clusters
+    rocsolver_stein_getMemorySize<T, S>(n, nev_max, batch_count, size_work, size_iwork);
+
+    // if quick return no more workspace needed
+    if(n == 0 || !batch_count)
+        return;
+
+    // the root representations (and block scalars) reuse the workspace of STEIN
+    *size_work = std::max(*size_work, sizeof(S) * 4 * n * batch_count);
+
+    // flags for the eigenvalues of unresolved clusters
+    *size_iwork += sizeof(rocblas_int) * n * batch_count;
+}
+
+/** STEMR computes the eigenvectors associated with the eigenvalues (given by STEBZ in
+    block order) of a symmetric tridiagonal matrix using the MRRR algorithm. It has the same
+    interface as STEIN and is used as an alternative to it when many eigenvectors are
+    requested. The eigenvectors of clusters that cannot be resolved by the representation
+    tree are computed with STEIN, distributing the clusters among its workgroups **/
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_stemr_template(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        S* D,
+                                        const rocblas_int shiftD,
+                                        const rocblas_stride strideD,
+                                        S* E,
+                                        const rocblas_int shiftE,
+                                        const rocblas_stride strideE,
+                                        rocblas_int* nev,
+                                        const rocblas_int nev_max,
+                                        S* W,
+                                        const rocblas_int shiftW,
+                                        const rocblas_stride strideW,
+                                        rocblas_int* iblock,
+                                        const rocblas_stride strideIblock,
+                                        rocblas_int* isplit,
+                                        const rocblas_stride strideIsplit,
+                                        U Z,
+                                        const rocblas_int shiftZ,
+                                        const rocblas_int ldz,
+                                        const rocblas_stride strideZ,
+                                        rocblas_int* ifail,
+                                        const rocblas_stride strideIfail,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        S* work,
+                                        rocblas_int* iwork)
+{
+    ROCSOLVER_ENTER("stemr", "n:", n, "nev_max:", nev_max, "shiftD:", shiftD, "shiftE:", shiftE,
+                    "shiftW:", shiftW, "shiftZ:", shiftZ, "ldz:", ldz, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threadsReset(BS1, 1, 1);
+
+    // info = 0
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    S eps = get_epsilon<T>();
+    S ssfmin = get_safemin<T>();
+
+    rocblas_int ngroups = stein_get_ngroups(n, nev_max);
+    rocblas_int* fail = iwork + size_t(n) * ngroups * batch_count;
+    rocblas_int* mask = fail + size_t(n) * batch_count;
+
+    // compute the root representation of every split-off block
+    ROCSOLVER_LAUNCH_KERNEL(stemr_root_kernel<S>, dim3(1, batch_count, 1), dim3(STEMR_THDS, 1, 1),
+                            0, stream, n, D + shiftD, strideD, E + shiftE, strideE, nev, iblock,
+                            strideIblock, isplit, strideIsplit, work, eps, ssfmin);
+
+    // compute the eigenvectors, one per thread
+    rocblas_int blocks = (n - 1) / STEMR_THDS + 1;
+    ROCSOLVER_LAUNCH_KERNEL(stemr_kernel<T>, dim3(blocks, batch_count, 1), dim3(STEMR_THDS, 1, 1),
+                            0, stream, n, E + shiftE, strideE, nev, W + shiftW, strideW, iblock,
+                            strideIblock, isplit, strideIsplit, Z, shiftZ, ldz, strideZ, fail,
+                            mask, work, eps);
+
+    // compute the eigenvectors of the unresolved clusters with inverse iteration
+    // (the root representations are not needed anymore, so work is reused)
+    dim3 grid(ngroups, batch_count, 1);
+    dim3 threads(STEIN_MAX_THDS, 1, 1);
+    size_t lmemsize = STEIN_MAX_THDS * (2 * sizeof(S) + sizeof(rocblas_int));
+    ROCSOLVER_LAUNCH_KERNEL(stein_kernel<T>, grid, threads, lmemsize, stream, n, D + shiftD,
+                            strideD, E + shiftE, strideE, nev, W + shiftW, strideW, iblock,
+                            strideIblock, isplit, strideIsplit, Z, shiftZ, ldz, strideZ, fail,
+                            mask, work, iwork, eps, ssfmin);
+
+    // set info and ifail
+    ROCSOLVER_LAUNCH_KERNEL(stein_info_kernel, dim3(1, batch_count, 1), dim3(1, 1, 1), 0, stream,
+                            n, nev, fail, ifail, strideIfail, info);
+
+    return rocblas_status_success;
+}
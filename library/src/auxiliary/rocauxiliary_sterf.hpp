@@ -27,27 +27,20 @@ __device__ void sterf_sq_e(const rocblas_int start, const rocblas_int end, T* E)
         E[i] = E[i] * E[i];
 }
 
-/** STERF_KERNEL implements the main loop of the sterf algorithm
+/** STERF_KERNEL/RUN_STERF implements the main loop of the sterf algorithm
     to compute the eigenvalues of a symmetric tridiagonal matrix given by D
     and E **/
 template <typename T>
-ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
-                                   T* DD,
-                                   const rocblas_stride strideD,
-                                   T* EE,
-                                   const rocblas_stride strideE,
-                                   rocblas_int* info,
-                                   rocblas_int* stack,
-                                   const rocblas_int max_iters,
-                                   const T eps,
-                                   const T ssfmin,
-                                   const T ssfmax)
+__device__ void run_sterf(const rocblas_int n,
+                          T* D,
+                          T* E,
+                          rocblas_int* info,
+                          rocblas_int* stack,
+                          const rocblas_int max_iters,
+                          const T eps,
+                          const T ssfmin,
+                          const T ssfmax)
 {
-    rocblas_int bid = hipBlockIdx_x;
-
-    T* D = DD + (bid * strideD);
-    T* E = EE + (bid * strideE);
-
     rocblas_int m, l, lsv, lend, lendsv;
     rocblas_int l1 = 0;
     rocblas_int iters = 0;
@@ -252,14 +245,14 @@ ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
     // Check for convergence
     for(int i = 0; i < n - 1; i++)
         if(E[i] != 0)
-            info[bid]++;
+            info[0]++;
 
     // Sort eigenvalues
     /** (TODO: the quick-sort method implemented in lasrt_increasing fails for some cases.
         Substituting it here with a simple sorting algorithm. If more performance is required in
         the future, lasrt_increasing should be debugged or another quick-sort method
         could be implemented) **/
-    //lasrt_increasing(n, D, stack + bid * (2 * 32));
+    //lasrt_increasing(n, D, stack);
 
     for(int ii = 1; ii < n; ii++)
     {
@@ -282,6 +275,29 @@ ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
     }
 }
 
+template <typename T>
+ROCSOLVER_KERNEL void sterf_kernel(const rocblas_int n,
+                                   T* DD,
+                                   const rocblas_stride strideD,
+                                   T* EE,
+                                   const rocblas_stride strideE,
+                                   rocblas_int* info,
+                                   rocblas_int* stack,
+                                   const rocblas_int max_iters,
+                                   const T eps,
+                                   const T ssfmin,
+                                   const T ssfmax)
+{
+    // select batch instance
+    rocblas_int bid = hipBlockIdx_x;
+
+    T* D = DD + (bid * strideD);
+    T* E = EE + (bid * strideE);
+
+    // execute
+    run_sterf(n, D, E, info + bid, stack + bid * (2 * 32), max_iters, eps, ssfmin, ssfmax);
+}
+
 template <typename T>
 void rocsolver_sterf_getMemorySize(const rocblas_int n,
                                    const rocblas_int batch_count,
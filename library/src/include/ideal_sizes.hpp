@@ -24,6 +24,17 @@
     if any, will be factorized with the unblocked algorithm (GEQR2 or GEQL2).*/
 #define GEQxF_GEQx2_SWITCHSIZE 128
 
+/*! \brief Determines the maximum number of rows and columns for which rocSOLVER uses a single
+    kernel when executing GEQR2, ORG2R/UNG2R or ORM2R/UNM2R. It also applies to the
+    corresponding batched and strided-batched routines.
+
+    \details If m <= GEQR2_SMALL_MAX_ROWS and n <= GEQR2_SMALL_MAX_COLS, GEQR2 (and ORG2R/UNG2R) will
+    process each matrix in the batch with one work-group, keeping the current Householder vector in
+    shared memory. ORM2R/UNM2R will do the same when the order of Q is not greater than
+    GEQR2_SMALL_MAX_ROWS, using one work-group for every GEQR2_SMALL_MAX_COLS columns (or rows) of C.*/
+#define GEQR2_SMALL_MAX_ROWS 1024
+#define GEQR2_SMALL_MAX_COLS 64 //always <= BS1
+
 /***************** gerq2/gerqf and gelq2/gelqf ********************************
 *******************************************************************************/
 /*! \brief Determines the size of the block row factorized at each step
@@ -40,6 +51,13 @@
     if any, will be factorized with the unblocked algorithm (GERQ2 or GELQ2).*/
 #define GExQF_GExQ2_SWITCHSIZE 128
 
+/*********************************** geqp3 ************************************
+*******************************************************************************/
+/*! \brief Determines the size of the block column factorized at each step
+    in the blocked QR algorithm with column pivoting (GEQP3). It also applies to the
+    corresponding batched and strided-batched routines. */
+#define GEQP3_BLOCKSIZE 32
+
 /******** org2r/orgqr, org2l/orgql, ung2r/ungqr and ung2l/ungql ***************
 *******************************************************************************/
 /*! \brief Determines the size of the block reflector that is applied at each step when
@@ -88,6 +106,56 @@
     the last block that updates C in the blocked process is allowed to be smaller than xxMxQ_BLOCKSIZE.*/
 #define xxMxQ_BLOCKSIZE 64
 
+/********************************** larfg *************************************
+*******************************************************************************/
+/*! \brief Determines the maximum size of the vectors for which rocSOLVER generates the
+    Householder reflectors with a single kernel when executing LARFG.
+
+    \details If n <= LARFG_SMALL_MAX_N, LARFG will compute the norm of x, the scalars tau and beta,
+    and the scaled vector v with one kernel launch, using one work-group per vector in the batch.
+    Otherwise, the norm and the scaling of x are computed with rocBLAS.*/
+#define LARFG_SMALL_MAX_N 4096
+
+/********************************** larft *************************************
+*******************************************************************************/
+/*! \brief Determines the maximum number of Householder vectors for which rocSOLVER computes the
+    triangular factor of a block reflector (LARFT) with a single kernel.
+
+    \details If k <= LARFT_SMALL_MAX_K and n <= LARFT_SMALL_MAX_N, the Gram matrix V'V and the
+    triangular factor T are computed by one work-group per matrix, staging blocks of LARFT_SMALL_CHUNK
+    rows of V in shared memory. Otherwise, V'V is computed with TRMM and GEMM, and T is computed
+    recursively, splitting it in halves until they have no more than LARFT_SMALL_MAX_K columns.
+
+    When the order of Q is larger than GEQR2_SMALL_MAX_ROWS (or n > GEQR2_SMALL_MAX_COLS for
+    ORG2R/UNG2R), ORM2R/UNM2R and ORG2R/UNG2R apply the reflectors by blocks of LARFT_SMALL_MAX_K,
+    using a fused LARFB kernel that processes LARFT_SMALL_CHUNK columns of C per work-group.*/
+#define LARFT_SMALL_MAX_K 64 //always <= BS1
+#define LARFT_SMALL_MAX_N 512
+#define LARFT_SMALL_CHUNK 16
+
+/******************************** gels ****************************************
+*******************************************************************************/
+/*! \brief Determines the maximum size of the overdetermined least-squares problems that rocSOLVER
+    solves with a single kernel when executing GELS. It also applies to the corresponding batched
+    and strided-batched routines.
+
+    \details If trans is none, n <= m <= GELS_SMALL_MAX_ROWS and n <= GELS_SMALL_MAX_COLS, GELS will
+    compute the QR factorization of A, apply Q' to B and solve the triangular system with one
+    work-group per problem, instead of calling GEQRF, ORMQR and TRSM. The columns of A and B are
+    updated GELS_SMALL_MAX_COLS at a time.*/
+#define GELS_SMALL_MAX_ROWS 256
+#define GELS_SMALL_MAX_COLS 16 //always <= BS1
+
+/*! \brief Determines the minimum aspect ratio m/n for which rocSOLVER orthogonalizes A with
+    Cholesky QR when executing GELS_OUTOFPLACE.
+
+    \details If trans is none and m >= GELS_CHOLQR_RATIO * n, GELS_OUTOFPLACE will compute Q and R
+    with two passes of Cholesky QR (Gram matrix with GEMM, POTRF and TRSM), instead of calling
+    GEQRF and ORMQR. If the Gram matrix of any problem in the batch is not positive definite, or if
+    the diagonal of its Cholesky factor indicates that A is too ill-conditioned for Cholesky QR to
+    be accurate, the Householder QR path is used for the whole batch.*/
+#define GELS_CHOLQR_RATIO 8
+
 /**************************** gebd2/gebrd *************************************
 *******************************************************************************/
 /*! \brief Determines the size of the leading block that is reduced to bidiagonal form at each step
@@ -113,6 +181,27 @@
     in parallel. */
 #define BDSQR_SPLIT_GROUPS 5
 
+/*! \brief Determines the minimum number of singular vectors (or columns of C) that must be updated
+    for BDSQR to accumulate the Givens rotations of several QR sweeps before applying them.
+
+    \details If the number of columns of V, rows of U, or columns of C is at least BDSQR_BLOCKED_SWITCH,
+    BDSQR will record the rotations of up to BDSQR_ACC_SWEEPS consecutive QR sweeps, combine them into
+    small orthogonal blocks, and apply these blocks to the vectors with matrix-matrix products.
+    Otherwise, the rotations of each sweep are applied to the vectors immediately. */
+#define BDSQR_BLOCKED_SWITCH 64
+
+/*! \brief Determines the maximum number of QR sweeps whose rotations are accumulated by BDSQR
+    when using the blocked update of the singular vectors.
+
+    \details Must be at least 2. */
+#define BDSQR_ACC_SWEEPS 8
+
+/*! \brief Determines the number of rotations per sweep combined into each orthogonal block
+    when BDSQR uses the blocked update of the singular vectors.
+
+    \details Every orthogonal block has order at most BDSQR_ACC_BLOCK + BDSQR_ACC_SWEEPS. */
+#define BDSQR_ACC_BLOCK 24
+
 /******************************* gesvd ****************************************
 *******************************************************************************/
 /*! \brief Determines the factor by which one dimension of a matrix should exceed
@@ -123,6 +212,17 @@
     n >= THIN_SVD_SWITCH*m, then the thin SVD is computed.*/
 #define THIN_SVD_SWITCH 1.6
 
+/****************************** gesvdj ****************************************
+*******************************************************************************/
+/*! \brief Determines the size at which rocSOLVER switches from
+    the small-size kernel to the pairwise algorithm when executing GESVDJ. It also applies to the
+    corresponding batched and strided-batched routines. Must be <= 40.
+
+    \details If min(m,n) is not greater than GESVDJ_SMALL_SIZE, the one-sided Jacobi
+    iterations will be executed by a single kernel call, keeping the working matrix and the
+    accumulated rotations in shared memory. */
+#define GESVDJ_SMALL_SIZE 32
+
 /******************* sytd2/sytrd and hetd2/hetrd *******************************
 *******************************************************************************/
 /*! \brief Determines the size of the leading block that is reduced to tridiagonal form at each step
@@ -150,6 +250,25 @@
     multiple of xxGST_BLOCKSIZE, the last block reduced in the blocked process is allowed to be smaller than xxGST_BLOCKSIZE.*/
 #define xxGST_BLOCKSIZE 64
 
+/*! \brief Determines the largest size for which SYGS2/HEGS2 is executed with a single kernel.
+    It also applies to the diagonal blocks reduced by SYGST/HEGST, and to the
+    corresponding batched and strided-batched routines.
+
+    \details If n <= SYGS2_SMALL_SIZE, every matrix in the batch is reduced by one work-group that
+    keeps the current column of A and B in shared memory; otherwise, the unblocked algorithm
+    is executed as a sequence of level-2 BLAS calls.*/
+#define SYGS2_SMALL_SIZE 64
+
+/*! \brief Determines the size at which SYGST/HEGST switches to the two-sided formulation. It also
+    applies to the corresponding batched and strided-batched routines.
+
+    \details If n >= xxGST_TWOSIDED_SWITCH, SYGST/HEGST copies A (with both triangular parts) and the
+    triangular factor in B to the workspace, and reduces the whole matrix with two full-size triangular
+    solves (itype = ax) or two full-size triangular products (itype = abx or bax). This doubles the
+    number of flops and needs two extra n-by-n arrays per matrix, but all the work is done by level-3 BLAS
+    calls of the largest possible size.*/
+#define xxGST_TWOSIDED_SWITCH 2048
+
 /****************************** stedc ******************************************
 *******************************************************************************/
 /*! \brief Determines the minimum size required for the eigenvectors of an independent block of
@@ -163,6 +282,29 @@
     are analyzed in parallel with the divide & conquer method. */
 #define STEDC_NUM_SPLIT_BLKS 8
 
+/*! \brief Determines the minimum size required for SYEVDX/HEEVDX (in-place) and SYGVDX/HEGVDX (in-place)
+    to compute the eigenvectors with the divide-and-conquer algorithm. It also applies to the
+    corresponding batched and strided-batched routines.
+
+    \details If eigenvectors are requested and n >= SYEVDX_DC_MIN_SIZE, all the eigenvalues and eigenvectors
+    of the tridiagonal matrix are computed with the divide-and-conquer kernel, and only the eigenvectors in the
+    requested range are copied out and back-transformed (ORMTR/UNMTR is applied to nev columns).
+    Otherwise, the eigenvalues are computed with bisection (STEBZ) and the eigenvectors with STEIN or STEMR.*/
+#define SYEVDX_DC_MIN_SIZE 1024
+
+/***************************** stemr ******************************************
+*******************************************************************************/
+/*! \brief Determines the minimum number of eigenvectors required for SYEVX/HEEVX,
+    SYEVDX/HEEVDX (in-place) and SYGVDX/HEGVDX (in-place) to compute the eigenvectors of the
+    tridiagonal matrix with the MRRR algorithm (STEMR). It also applies to the corresponding
+    batched and strided-batched routines.
+
+    \details If the number of requested eigenvectors (n when erange is all or value, iu-il+1 when erange
+    is index) is smaller than STEMR_MIN_NEV, the eigenvectors are computed with inverse iteration (STEIN).
+    Otherwise, every eigenvector that can be isolated from a relatively robust representation is computed
+    independently (one thread per eigenvector); the clusters that remain unresolved are handed back to STEIN.*/
+#define STEMR_MIN_NEV 32
+
 /************************** potf2/potrf ***************************************
 *******************************************************************************/
 /*! \brief Determines the size of the leading block that is factorized at each step
@@ -179,6 +321,18 @@
     if any, will be factorized with the unblocked algorithm (POTF2).*/
 #define POTRF_POTF2_SWITCHSIZE 128
 
+/************************** syev/heev *****************************************
+*******************************************************************************/
+/*! \brief Determines the size at which rocSOLVER switches from
+    the small-size kernel to the normal algorithm when executing SYEV, SYEVD and SYEVX.
+    It also applies to the corresponding batched and strided-batched routines, and to the
+    generalized eigensolvers that call them. Must be <= 40.
+
+    \details If the size of the matrix is not greater than SYEV_SMALL_SIZE, the matrix is kept
+    in shared memory while it is reduced to tridiagonal form, its eigenvalues are computed with the
+    QL/QR algorithm, and the eigenvectors are accumulated, all within a single kernel call. */
+#define SYEV_SMALL_SIZE 32
+
 /************************** syevj/heevj ***************************************
 *******************************************************************************/
 /*! \brief Determines the size at which rocSOLVER switches from
@@ -205,6 +359,18 @@
     if any, will be factorized with the unblocked algorithm (SYTF2).*/
 #define SYTRF_SYTF2_SWITCHSIZE 128
 
+/*************************** sytrs/sysv ***************************************
+*******************************************************************************/
+/*! \brief Determines the number of right-hand sides at which rocSOLVER switches from
+    the unblocked to the blocked algorithm when executing SYTRS. It also applies to the
+    corresponding batched and strided-batched routines, and to SYSV.
+
+    \details With fewer than SYTRS_BLOCKED_SWITCH right-hand sides, SYTRS applies the
+    factorization one pivot block at a time in a single kernel call. Otherwise, the factor
+    is temporarily converted into a unit triangular matrix and a block diagonal matrix, and
+    the triangular systems are solved with TRSM. */
+#define SYTRS_BLOCKED_SWITCH 8
+
 /**************************** getf2/getfr *************************************
 *******************************************************************************/
 #define GETF2_SPKER_MAX_M 1024 //always <= 1024
@@ -251,12 +417,25 @@
 #define GETRI_BATCH_INTERVALS 505, 2049
 #define GETRI_BATCH_BLKSIZES 32, 0, 256
 
+/****************************** lauum *****************************************
+*******************************************************************************/
+/*! \brief Determines the size of the diagonal blocks at which the recursive algorithm
+    for LAUUM stops splitting the matrix. It also applies to POTRI.
+
+    \details LAUUM splits the triangular factor in two halves, updates the off-diagonal
+    block with HERK and TRMM, and recurses on the diagonal blocks until they have no more
+    than LAUUM_MAX_COLS columns. Each of these blocks is then computed by a single kernel
+    that holds it in shared memory.*/
+#define LAUUM_MAX_COLS 32 //always <= sqrt(maximum work-group size)
+
 /***************************** trtri ******************************************
 *******************************************************************************/
 #define TRTRI_MAX_COLS 64 //always <= wavefront size
+// a block size of 0 calls rocBLAS TRTRI, 1 uses the unblocked algorithm (TRTI2), and -1 uses the
+// recursive algorithm with diagonal blocks of at most TRTRI_MAX_COLS columns as leaves
 #define TRTRI_NUM_INTERVALS 1
-#define TRTRI_INTERVALS 0
-#define TRTRI_BLKSIZES 0, 0
+#define TRTRI_INTERVALS 1024
+#define TRTRI_BLKSIZES 0, -1
 #define TRTRI_BATCH_NUM_INTERVALS 3
 #define TRTRI_BATCH_INTERVALS 32, 245, 1009
 #define TRTRI_BATCH_BLKSIZES 0, 16, 32, 0
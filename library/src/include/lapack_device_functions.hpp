@@ -856,6 +856,262 @@ __device__ void nrm2(const rocblas_int tid, const rocblas_int n, T* A, const roc
         sval[0] = sqrt(sval[0]);
 }
 
+/** LASSQ_ACC accumulates the value a = |val| into the scaled sum of squares
+    given by (scale, ssq), so that scale^2 * ssq is updated without
+    unnecessary overflow or underflow. **/
+template <typename S>
+__device__ void lassq_acc(const S val, S& scale, S& ssq)
+{
+    S a = std::abs(val);
+    if(a > 0)
+    {
+        if(scale < a)
+        {
+            ssq = 1 + ssq * (scale / a) * (scale / a);
+            scale = a;
+        }
+        else
+            ssq = ssq + (a / scale) * (a / scale);
+    }
+}
+
+/** NRM2_SCALED finds the euclidean norm of a given vector in a single pass,
+    keeping a scaled sum of squares (as in LAPACK's LASSQ) to avoid overflow and
+    underflow. MAX_THDS should be 128, 256, 512, or 1024, and sscale and sssq should
+    be shared arrays of size MAX_THDS. **/
+template <int MAX_THDS, typename T, typename S>
+__device__ void nrm2_scaled(const rocblas_int tid,
+                            const rocblas_int n,
+                            T* A,
+                            const rocblas_int incA,
+                            S* sscale,
+                            S* sssq)
+{
+    // local memory setup
+    S scale = 0;
+    S ssq = 1;
+    S s2, q2;
+
+    // read into shared memory while doing initial step
+    // (each thread reduce as many elements as needed to cover the original array;
+    // real and imaginary parts are accumulated as independent entries)
+    for(int i = tid; i < n; i += MAX_THDS)
+    {
+        lassq_acc(real_part(A[i * incA]), scale, ssq);
+        lassq_acc(imag_part(A[i * incA]), scale, ssq);
+    }
+    sscale[tid] = scale;
+    sssq[tid] = ssq;
+    __syncthreads();
+
+    /** <========= Next do the reduction on the shared memory array =========>
+        (We halve the number of active threads at each step
+        combining two scaled sums of squares in the shared arrays. **/
+
+#pragma unroll
+    for(int i = MAX_THDS / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+        {
+            s2 = sscale[tid + i];
+            q2 = sssq[tid + i];
+            if(s2 > 0)
+            {
+                if(scale < s2)
+                {
+                    ssq = q2 + ssq * (scale / s2) * (scale / s2);
+                    scale = s2;
+                }
+                else
+                    ssq = ssq + q2 * (s2 / scale) * (s2 / scale);
+            }
+            sscale[tid] = scale;
+            sssq[tid] = ssq;
+        }
+        __syncthreads();
+    }
+
+    // after the reduction, the euclidean norm of the elements is in sscale[0]
+    if(tid == 0)
+        sscale[0] = scale * sqrt(ssq);
+}
+
+/** DOT finds the dot product x' * y of two given vectors (no conjugation is applied).
+    MAX_THDS should be 128, 256, 512, or 1024, and sval should
+    be a shared array of size MAX_THDS. **/
+template <int MAX_THDS, typename T>
+__device__ void dot(const rocblas_int tid,
+                    const rocblas_int n,
+                    T* x,
+                    const rocblas_int incx,
+                    T* y,
+                    const rocblas_int incy,
+                    T* sval)
+{
+    // local memory setup
+    T val = 0;
+
+    // read into shared memory while doing initial step
+    // (each thread reduce as many elements as needed to cover the original array)
+    for(int i = tid; i < n; i += MAX_THDS)
+        val = val + x[i * incx] * y[i * incy];
+    sval[tid] = val;
+    __syncthreads();
+
+    if(n <= 1)
+        return;
+
+    /** <========= Next do the reduction on the shared memory array =========>
+        (We halve the number of active threads at each step
+        reducing two elements in the shared array. **/
+
+#pragma unroll
+    for(int i = MAX_THDS / 2; i > warpSize; i /= 2)
+    {
+        if(tid < i)
+            val = val + sval[tid + i];
+        __syncthreads();
+        if(tid < i)
+            sval[tid] = val;
+        __syncthreads();
+    }
+
+    // from this point, as all the active threads will form a single wavefront
+    // and work in lock-step, there is no need for synchronizations and barriers
+    if(tid < warpSize)
+    {
+        if(warpSize >= 64)
+        {
+            sval[tid] = sval[tid] + sval[tid + 64];
+            __threadfence();
+        }
+        sval[tid] = sval[tid] + sval[tid + 32];
+        __threadfence();
+        sval[tid] = sval[tid] + sval[tid + 16];
+        __threadfence();
+        sval[tid] = sval[tid] + sval[tid + 8];
+        __threadfence();
+        sval[tid] = sval[tid] + sval[tid + 4];
+        __threadfence();
+        sval[tid] = sval[tid] + sval[tid + 2];
+        __threadfence();
+        sval[tid] = sval[tid] + sval[tid + 1];
+        __threadfence();
+    }
+
+    // after the reduction, the dot product of the vectors is in sval[0]
+}
+
+/** LARFG_COL generates, in place, the Householder reflector H(j) that annihilates the
+    elements A(j+1:m-1, j) (as in LARFG), and keeps a copy of the Householder vector in the
+    shared array sv (with sv[j] = 1). On exit, A(j,j) is overwritten by beta, and tau and the
+    scaling factor of the vector are in tau_s and scal_s. MAX_THDS should be a power of 2, and
+    sval should be a shared array of size MAX_THDS. **/
+template <int MAX_THDS, typename T, typename S>
+__device__ void larfg_col(const rocblas_int tid,
+                          const rocblas_int m,
+                          const rocblas_int j,
+                          T* A,
+                          const rocblas_int lda,
+                          S* sval,
+                          T* sv,
+                          T* tau_s,
+                          T* scal_s)
+{
+    // compute the squared norm of A(j+1:m-1, j)
+    S s = 0;
+    for(rocblas_int i = j + 1 + tid; i < m; i += MAX_THDS)
+        s += std::norm(A[i + j * lda]);
+    sval[tid] = s;
+    __syncthreads();
+
+    for(rocblas_int i = MAX_THDS / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+            sval[tid] += sval[tid + i];
+        __syncthreads();
+    }
+
+    // generate the Householder reflector
+    if(tid == 0)
+    {
+        T alpha = A[j + j * lda];
+        if(sval[0] == 0 && std::imag(alpha) == 0)
+        {
+            tau_s[0] = 0;
+            scal_s[0] = 1;
+        }
+        else
+        {
+            S beta = -copysign(sqrt(std::norm(alpha) + sval[0]), std::real(alpha));
+            tau_s[0] = (T(beta) - alpha) / T(beta);
+            scal_s[0] = T(1) / (alpha - T(beta));
+            A[j + j * lda] = T(beta);
+        }
+        sv[j] = 1;
+    }
+    __syncthreads();
+
+    // scale the Householder vector and keep a copy in shared memory
+    T scal = scal_s[0];
+    for(rocblas_int i = j + 1 + tid; i < m; i += MAX_THDS)
+    {
+        T v = A[i + j * lda] * scal;
+        A[i + j * lda] = v;
+        sv[i] = v;
+    }
+    __syncthreads();
+}
+
+/** LARF_COL applies H(j)' = I - conj(tau) * v * v' from the left to rows j to m-1 of the
+    ncols columns of X, where v is the Householder vector kept in the shared array sv by
+    LARFG_COL. NCOLS columns are updated at a time, each by MAX_THDS / NCOLS threads, and sw
+    should be a shared array of size MAX_THDS. **/
+template <int MAX_THDS, int NCOLS, typename T>
+__device__ void larf_col(const rocblas_int tid,
+                         const rocblas_int m,
+                         const rocblas_int j,
+                         T* sv,
+                         const T tau,
+                         T* X,
+                         const rocblas_int ldx,
+                         const rocblas_int ncols,
+                         T* sw)
+{
+    constexpr rocblas_int NROWS = MAX_THDS / NCOLS;
+    rocblas_int rid = tid % NROWS;
+    rocblas_int cid = tid / NROWS;
+
+    for(rocblas_int c0 = 0; c0 < ncols; c0 += NCOLS)
+    {
+        rocblas_int c = c0 + cid;
+        T w = 0;
+        if(c < ncols)
+        {
+            for(rocblas_int i = j + rid; i < m; i += NROWS)
+                w += conj(sv[i]) * X[i + c * ldx];
+        }
+        sw[tid] = w;
+        __syncthreads();
+
+        if(rid == 0)
+        {
+            for(rocblas_int r = 1; r < NROWS; r++)
+                w += sw[tid + r];
+            sw[tid] = conj(tau) * w;
+        }
+        __syncthreads();
+
+        if(c < ncols)
+        {
+            w = sw[cid * NROWS];
+            for(rocblas_int i = j + rid; i < m; i += NROWS)
+                X[i + c * ldx] -= sv[i] * w;
+        }
+        __syncthreads();
+    }
+}
+
 /** LAGTF computes an LU factorization of a matrix T - lambda*I, where T
     is a tridiagonal matrix and lambda is a scalar. **/
 template <typename T>
@@ -37,6 +37,30 @@ __device__ S aabs(T val)
     return asum(val);
 }
 
+template <typename T, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
+__device__ T real_part(T val)
+{
+    return val;
+}
+
+template <typename T, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
+__device__ auto real_part(T val)
+{
+    return val.real();
+}
+
+template <typename T, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
+__device__ T imag_part(T val)
+{
+    return 0;
+}
+
+template <typename T, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
+__device__ auto imag_part(T val)
+{
+    return val.imag();
+}
+
 template <typename T>
 __device__ __forceinline__ void swap(T& a, T& b)
 {
@@ -750,3 +774,37 @@ ROCSOLVER_KERNEL void check_singularity(const rocblas_int n,
     if(hipThreadIdx_y == 0)
         info[b] = _info;
 }
+
+/** FLAG_SINGULARITY checks for zeros in the diagonal of the n-by-n triangular matrix A and
+    sets info to val if there is any, and info has not been set before (i.e. info is 0).
+    Call this kernel with as many groups in x as the batch count, and a single
+    dimension of threads in y (e.g. dim3(batch_count, 1, 1) and dim3(1, min(n, BS1), 1)) **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void flag_singularity(const rocblas_int n,
+                                       U A,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int lda,
+                                       const rocblas_stride strideA,
+                                       rocblas_int* info,
+                                       const rocblas_int val)
+{
+    int b = hipBlockIdx_x;
+
+    T* a = load_ptr_batch<T>(A, b, shiftA, strideA);
+
+    __shared__ rocblas_int _singular;
+
+    if(hipThreadIdx_y == 0)
+        _singular = 0;
+    __syncthreads();
+
+    for(int i = hipThreadIdx_y; i < n; i += hipBlockDim_y)
+    {
+        if(a[i + i * lda] == 0)
+            _singular = 1;
+    }
+    __syncthreads();
+
+    if(hipThreadIdx_y == 0 && _singular && info[b] == 0)
+        info[b] = val;
+}
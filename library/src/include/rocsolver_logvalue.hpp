@@ -196,6 +196,16 @@ struct formatter<rocsolver_logvalue<rocblas_esort>> : formatter<char>
     }
 };
 
+template <>
+struct formatter<rocsolver_logvalue<rocblas_norm_type>> : formatter<char>
+{
+    template <typename FormatCtx>
+    auto format(rocsolver_logvalue<rocblas_norm_type> wrapper, FormatCtx& ctx) ROCSOLVER_FMT_CONST
+    {
+        return formatter<char>::format(rocblas2char_norm_type(wrapper.value), ctx);
+    }
+};
+
 template <>
 struct formatter<rocsolver_logvalue<rocblas_datatype>> : formatter<string_view>
 {
@@ -0,0 +1,575 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * and
+ * Higham, N. J. (1988). FORTRAN codes for estimating the one-norm of a real or
+ *     complex matrix, with applications to condition estimation.
+ *     ACM Transactions on Mathematical Software 14(4), p. 381-396.
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** Maximum number of iterations of the Hager/Higham estimator (as in LAPACK) **/
+#define LACN2_ITMAX 5
+/** Maximum number of products with inv(A) or inv(A)' required by the estimator **/
+#define LACN2_MAX_SOLVES (2 * LACN2_ITMAX + 1)
+
+/** States of the estimator. LACN2_JUMP_1, 3 and 5 require a product with inv(A),
+    LACN2_JUMP_2 and 4 require a product with inv(A)' **/
+#define LACN2_JUMP_INIT 0
+#define LACN2_JUMP_1 1
+#define LACN2_JUMP_2 2
+#define LACN2_JUMP_3 3
+#define LACN2_JUMP_4 4
+#define LACN2_JUMP_5 5
+#define LACN2_DONE 6
+
+/** LACN2_ASUM computes the sum of the absolute values (moduli) of the
+    elements of vector x. MAX_THDS should be 128, 256, 512, or 1024, and sval
+    should be a shared array of size MAX_THDS. **/
+template <int MAX_THDS, typename T, typename S>
+__device__ S lacn2_asum(const rocblas_int tid, const rocblas_int n, T* x, S* sval)
+{
+    S val = 0;
+    for(rocblas_int i = tid; i < n; i += MAX_THDS)
+        val += std::abs(x[i]);
+    sval[tid] = val;
+    __syncthreads();
+
+    for(rocblas_int i = MAX_THDS / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+            sval[tid] += sval[tid + i];
+        __syncthreads();
+    }
+
+    val = sval[0];
+    __syncthreads();
+    return val;
+}
+
+/** LACN2_XVAL returns the value of x that is compared with max|x| to decide
+    whether to stop iterating: x itself if REAL, and |x| if COMPLEX **/
+template <typename T, typename S, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
+__device__ S lacn2_xval(const T x)
+{
+    return x;
+}
+
+template <typename T, typename S, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
+__device__ S lacn2_xval(const T x)
+{
+    return aabs<S>(x);
+}
+
+/** LACN2_SIGN overwrites x with sign(x). If REAL, also returns
+    true if sign(x) coincides with the sign vector in sgn **/
+template <int MAX_THDS, typename T, typename S, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
+__device__ bool lacn2_sign(const rocblas_int tid, const rocblas_int n, T* x, T* sgn, int* sflag)
+{
+    if(tid == 0)
+        *sflag = 1;
+    __syncthreads();
+
+    T s;
+    for(rocblas_int i = tid; i < n; i += MAX_THDS)
+    {
+        s = (x[i] >= 0 ? T(1) : T(-1));
+        if(s != sgn[i])
+            *sflag = 0;
+        x[i] = s;
+    }
+    __syncthreads();
+
+    bool repeated = (*sflag == 1);
+    __syncthreads();
+
+    for(rocblas_int i = tid; i < n; i += MAX_THDS)
+        sgn[i] = x[i];
+
+    return repeated;
+}
+
+template <int MAX_THDS, typename T, typename S, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
+__device__ bool lacn2_sign(const rocblas_int tid, const rocblas_int n, T* x, T* sgn, int* sflag)
+{
+    const S safmin = std::numeric_limits<S>::min();
+
+    S absx;
+    for(rocblas_int i = tid; i < n; i += MAX_THDS)
+    {
+        absx = std::abs(x[i]);
+        x[i] = (absx > safmin ? x[i] * (S(1) / absx) : T(1));
+    }
+
+    // the repeated sign vector test is only meaningful in the real case
+    return false;
+}
+
+/** LACN2_KERNEL executes one step of the Hager/Higham 1-norm estimator
+    (LAPACK's xLACN2) for every matrix in the batch. The reverse communication
+    of LAPACK is replaced by a fixed schedule: on the host side, products with inv(A)
+    (kase = 1) and inv(A)' (kase = 2) alternate, and each problem consumes only the
+    products it needs. The state of every problem is kept on the device in state.
+
+    kase_done is the product that has just been applied to x (0 at initialization),
+    and kase_next is the product that will be applied next (0 if none). When a problem is
+    waiting for a product of the other kind, or it has converged, x is set to zero.
+
+    Call this kernel with batch_count groups in x, and MAX_THDS threads in x. **/
+template <int MAX_THDS, typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(MAX_THDS) lacn2_kernel(const rocblas_int n,
+                                                               const rocblas_int kase_done,
+                                                               const rocblas_int kase_next,
+                                                               T* XX,
+                                                               T* sgnA,
+                                                               S* estA,
+                                                               rocblas_int* stateA)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_x;
+
+    // array pointers
+    T* x = XX + bid * n;
+    T* sgn = sgnA + bid * n;
+    rocblas_int* state = stateA + bid * 4;
+
+    // shared memory
+    __shared__ S sval[MAX_THDS];
+    __shared__ rocblas_int sidx[MAX_THDS];
+    __shared__ int sflag;
+
+    // local variables
+    rocblas_int jump = state[0];
+    rocblas_int iter = state[1];
+    rocblas_int j = state[2];
+    S est = estA[bid];
+    S estold, temp;
+    bool repeated;
+
+    if(jump == LACN2_JUMP_INIT)
+    {
+        // start with x = [1/n, 1/n, ..., 1/n]
+        for(rocblas_int i = tid; i < n; i += MAX_THDS)
+        {
+            x[i] = T(S(1) / S(n));
+            sgn[i] = 0;
+        }
+        jump = LACN2_JUMP_1;
+    }
+
+    else if(jump != LACN2_DONE && kase_done == (jump % 2 == 1 ? 1 : 2))
+    {
+        switch(jump)
+        {
+        case LACN2_JUMP_1:
+            // x has been overwritten by inv(A)*x
+            if(n == 1)
+            {
+                est = std::abs(x[0]);
+                jump = LACN2_DONE;
+                break;
+            }
+            est = lacn2_asum<MAX_THDS>(tid, n, x, sval);
+            lacn2_sign<MAX_THDS, T, S>(tid, n, x, sgn, &sflag);
+            jump = LACN2_JUMP_2;
+            break;
+
+        case LACN2_JUMP_2:
+            // x has been overwritten by inv(A)'*x
+            iamax<MAX_THDS>(tid, n, x, 1, sval, sidx);
+            __syncthreads();
+            j = sidx[0] - 1;
+            iter = 2;
+            for(rocblas_int i = tid; i < n; i += MAX_THDS)
+                x[i] = (i == j ? T(1) : T(0));
+            jump = LACN2_JUMP_3;
+            break;
+
+        case LACN2_JUMP_3:
+            // x has been overwritten by inv(A)*x
+            estold = est;
+            est = lacn2_asum<MAX_THDS>(tid, n, x, sval);
+            repeated = lacn2_sign<MAX_THDS, T, S>(tid, n, x, sgn, &sflag);
+            // converged if the sign vector is repeated or the estimate did not increase
+            jump = (repeated || est <= estold) ? LACN2_JUMP_5 : LACN2_JUMP_4;
+            break;
+
+        case LACN2_JUMP_4:
+            // x has been overwritten by inv(A)'*x
+            {
+                rocblas_int jlast = j;
+                iamax<MAX_THDS>(tid, n, x, 1, sval, sidx);
+                __syncthreads();
+                j = sidx[0] - 1;
+                temp = lacn2_xval<T, S>(x[jlast]);
+                if(temp != sval[0] && iter < LACN2_ITMAX)
+                {
+                    iter++;
+                    for(rocblas_int i = tid; i < n; i += MAX_THDS)
+                        x[i] = (i == j ? T(1) : T(0));
+                    jump = LACN2_JUMP_3;
+                }
+                else
+                    jump = LACN2_JUMP_5;
+            }
+            break;
+
+        case LACN2_JUMP_5:
+            // x has been overwritten by inv(A)*altsgn
+            temp = 2 * lacn2_asum<MAX_THDS>(tid, n, x, sval) / S(3 * n);
+            if(temp > est)
+                est = temp;
+            jump = LACN2_DONE;
+            break;
+        }
+    }
+    __syncthreads();
+
+    // prepare x for the next product
+    if(jump == LACN2_DONE || kase_next != (jump % 2 == 1 ? 1 : 2))
+    {
+        for(rocblas_int i = tid; i < n; i += MAX_THDS)
+            x[i] = 0;
+    }
+    else if(jump == LACN2_JUMP_5)
+    {
+        // alternating-sign vector x = [1, -(1+1/(n-1)), 1+2/(n-1), ...]
+        for(rocblas_int i = tid; i < n; i += MAX_THDS)
+            x[i] = T((i % 2 == 0 ? S(1) : S(-1)) * (S(1) + S(i) / S(n - 1)));
+    }
+
+    if(tid == 0)
+    {
+        state[0] = jump;
+        state[1] = iter;
+        state[2] = j;
+        estA[bid] = est;
+    }
+}
+
+/** CON_CHECK initializes the state of the estimator. It sets to zero the
+    reciprocal condition number of those problems with a zero norm or with an exactly
+    zero diagonal element in the triangular factor, and marks them as done.
+
+    Call this kernel with batch_count groups in x, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) con_check(const rocblas_int n,
+                                                       const rocblas_diagonal diag,
+                                                       U AA,
+                                                       const rocblas_int shiftA,
+                                                       const rocblas_int lda,
+                                                       const rocblas_stride strideA,
+                                                       const S* anorm,
+                                                       S* estA,
+                                                       rocblas_int* stateA,
+                                                       S* rcond)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_x;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    rocblas_int* state = stateA + bid * 4;
+
+    __shared__ int singular;
+    if(tid == 0)
+        singular = 0;
+    __syncthreads();
+
+    if(diag == rocblas_diagonal_non_unit)
+    {
+        for(rocblas_int i = tid; i < n; i += BS1)
+        {
+            if(A[i + i * lda] == T(0))
+                singular = 1;
+        }
+    }
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        S a = anorm[bid];
+        bool skip = (singular == 1 || !(a > 0));
+
+        rcond[bid] = 0;
+        estA[bid] = 0;
+        state[0] = skip ? LACN2_DONE : LACN2_JUMP_INIT;
+        state[1] = 0;
+        state[2] = 0;
+        state[3] = skip ? 1 : 0;
+    }
+}
+
+/** CON_RCOND computes the reciprocal condition number from the estimated norm of
+    inv(A) and the norm of A.
+
+    Call this kernel with ceil(batch_count / BS1) groups in x, and BS1 threads in x. **/
+template <typename S>
+ROCSOLVER_KERNEL void con_rcond(const rocblas_int batch_count,
+                                const S* anorm,
+                                S* estA,
+                                rocblas_int* stateA,
+                                S* rcond)
+{
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < batch_count && stateA[b * 4 + 3] == 0)
+    {
+        S ainvnm = estA[b];
+        S rc = 0;
+
+        // if inv(A) overflowed, the matrix is numerically singular and rcond = 0
+        if(ainvnm > 0 && ainvnm <= std::numeric_limits<S>::max())
+            rc = (S(1) / ainvnm) / anorm[b];
+
+        rcond[b] = (rc == rc) ? rc : S(0);
+    }
+}
+
+/** Helper to allocate the workspace used by the 1-norm estimator **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_lacn2_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work,
+                                   size_t* size_sgn,
+                                   size_t* size_est,
+                                   size_t* size_state,
+                                   size_t* size_workArr)
+{
+    *size_work = sizeof(T) * n * batch_count;
+    *size_sgn = sizeof(T) * n * batch_count;
+    *size_est = sizeof(S) * batch_count;
+    *size_state = sizeof(rocblas_int) * 4 * batch_count;
+
+    if(BATCHED)
+        *size_workArr = sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_gecon_argCheck(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(norm_type != rocblas_norm_one && norm_type != rocblas_norm_inf)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !anorm) || (batch_count && !rcond))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S>
+void rocsolver_gecon_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_work,
+                                   size_t* size_sgn,
+                                   size_t* size_est,
+                                   size_t* size_state,
+                                   size_t* size_workArr,
+                                   bool* optim_mem)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_work = 0;
+        *size_sgn = 0;
+        *size_est = 0;
+        *size_state = 0;
+        *size_workArr = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // workspace required for calling GETRS with one right-hand side
+    // call with both rocblas_operation_none and rocblas_operation_conjugate_transpose and take maximum memory
+    size_t w1a, w1b, w2a, w2b, w3a, w3b, w4a, w4b;
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(rocblas_operation_none, n, 1, batch_count,
+                                                       &w1a, &w2a, &w3a, &w4a, optim_mem);
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(rocblas_operation_conjugate_transpose, n, 1,
+                                                       batch_count, &w1b, &w2b, &w3b, &w4b,
+                                                       optim_mem);
+    *size_work1 = std::max(w1a, w1b);
+    *size_work2 = std::max(w2a, w2b);
+    *size_work3 = std::max(w3a, w3b);
+    *size_work4 = std::max(w4a, w4b);
+
+    // workspace required by the estimator
+    rocsolver_lacn2_getMemorySize<BATCHED, T, S>(n, batch_count, size_work, size_sgn, size_est,
+                                                 size_state, size_workArr);
+}
+
+/** Helper to call GETRS on the estimator vectors; if the matrices are given
+    as an array of pointers, the vectors must be passed the same way **/
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gecon_getrs(rocblas_handle handle,
+                           const rocblas_operation trans,
+                           const rocblas_int n,
+                           T* A,
+                           const rocblas_int shiftA,
+                           const rocblas_int lda,
+                           const rocblas_stride strideA,
+                           T* x,
+                           T** workArr,
+                           const rocblas_int batch_count,
+                           void* work1,
+                           void* work2,
+                           void* work3,
+                           void* work4,
+                           const bool optim_mem)
+{
+    rocsolver_getrs_template<BATCHED, STRIDED, T>(handle, trans, n, 1, A, shiftA, lda, strideA,
+                                                  (rocblas_int*)nullptr, 0, x, 0, n, n, batch_count,
+                                                  work1, work2, work3, work4, optim_mem, false);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gecon_getrs(rocblas_handle handle,
+                           const rocblas_operation trans,
+                           const rocblas_int n,
+                           T* const A[],
+                           const rocblas_int shiftA,
+                           const rocblas_int lda,
+                           const rocblas_stride strideA,
+                           T* x,
+                           T** workArr,
+                           const rocblas_int batch_count,
+                           void* work1,
+                           void* work2,
+                           void* work3,
+                           void* work4,
+                           const bool optim_mem)
+{
+    rocsolver_getrs_template<BATCHED, STRIDED, T>(
+        handle, trans, n, 1, A, shiftA, lda, strideA, (rocblas_int*)nullptr, 0,
+        (T* const*)workArr, 0, n, n, batch_count, work1, work2, work3, work4, optim_mem, false);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gecon_template(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* work,
+                                        T* sgn,
+                                        S* est,
+                                        rocblas_int* state,
+                                        T** workArr,
+                                        const bool optim_mem)
+{
+    ROCSOLVER_ENTER("gecon", "norm:", norm_type, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 gridB(batch_count, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return with rcond = 1
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, rcond, batch_count, 1);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    if(BATCHED)
+        ROCSOLVER_LAUNCH_KERNEL(get_array, gridReset, threads, 0, stream, workArr, work, n,
+                                batch_count);
+
+    // check for singular U and zero anorm, and initialize estimator
+    ROCSOLVER_LAUNCH_KERNEL((con_check<T>), gridB, threads, 0, stream, n, rocblas_diagonal_non_unit,
+                            A, shiftA, lda, strideA, anorm, est, state, rcond);
+
+    // estimate the 1-norm of inv(A) (or of inv(A)' if using the infinity-norm)
+    rocblas_operation trans1 = (norm_type == rocblas_norm_one)
+        ? rocblas_operation_none
+        : rocblas_operation_conjugate_transpose;
+    rocblas_operation trans2 = (norm_type == rocblas_norm_one)
+        ? rocblas_operation_conjugate_transpose
+        : rocblas_operation_none;
+
+    // initialize the estimator vectors
+    ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<BS1, T>), gridB, threads, 0, stream, n, 0, 1, work, sgn,
+                            est, state);
+
+    // alternate products with inv(A) and inv(A)'; problems that have converged
+    // (or are waiting for a product of the other kind) work on zero vectors
+    rocblas_int kase, kase_next;
+    for(rocblas_int r = 0; r < LACN2_MAX_SOLVES; r++)
+    {
+        kase = (r % 2 == 0 ? 1 : 2);
+        kase_next = (r + 1 < LACN2_MAX_SOLVES ? 3 - kase : 0);
+
+        rocsolver_gecon_getrs<BATCHED, STRIDED, T>(handle, kase == 1 ? trans1 : trans2, n, A, shiftA,
+                                                   lda, strideA, work, workArr, batch_count, work1,
+                                                   work2, work3, work4, optim_mem);
+
+        ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<BS1, T>), gridB, threads, 0, stream, n, kase,
+                                kase_next, work, sgn, est, state);
+    }
+
+    // compute the reciprocal condition number
+    ROCSOLVER_LAUNCH_KERNEL(con_rcond<S>, gridReset, threads, 0, stream, batch_count, anorm, est,
+                            state, rcond);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
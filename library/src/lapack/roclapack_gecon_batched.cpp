@@ -0,0 +1,134 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gecon.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gecon_batched_impl(rocblas_handle handle,
+                                            const rocblas_norm_type norm_type,
+                                            const rocblas_int n,
+                                            U A,
+                                            const rocblas_int lda,
+                                            const S* anorm,
+                                            S* rcond,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gecon_batched", "--norm", norm_type, "-n", n, "--lda", lda,
+                        "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gecon_argCheck(handle, norm_type, n, lda, A, anorm, rcond,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // memory workspace sizes:
+    // size of workspace (for calling GETRS)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // size of vectors and state of the norm estimator
+    size_t size_work, size_sgn, size_est, size_state;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_gecon_getMemorySize<true, true, T, S>(n, batch_count, &size_work1, &size_work2,
+                                                    &size_work3, &size_work4, &size_work, &size_sgn,
+                                                    &size_est, &size_state, &size_workArr,
+                                                    &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+                                                      size_work4, size_work, size_sgn, size_est,
+                                                      size_state, size_workArr);
+
+    // memory workspace allocation
+    void *work1, *work2, *work3, *work4, *work, *sgn, *est, *state, *workArr;
+    rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4, size_work,
+                              size_sgn, size_est, size_state, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work1 = mem[0];
+    work2 = mem[1];
+    work3 = mem[2];
+    work4 = mem[3];
+    work = mem[4];
+    sgn = mem[5];
+    est = mem[6];
+    state = mem[7];
+    workArr = mem[8];
+
+    // execution
+    return rocsolver_gecon_template<true, true, T>(handle, norm_type, n, A, shiftA, lda, strideA,
+                                                   anorm, rcond, batch_count, work1, work2, work3,
+                                                   work4, (T*)work, (T*)sgn, (S*)est,
+                                                   (rocblas_int*)state, (T**)workArr, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_sgecon_batched(rocblas_handle handle,
+                                                   const rocblas_norm_type norm_type,
+                                                   const rocblas_int n,
+                                                   float* const A[],
+                                                   const rocblas_int lda,
+                                                   const float* anorm,
+                                                   float* rcond,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gecon_batched_impl<float>(handle, norm_type, n, A, lda, anorm, rcond,
+                                               batch_count);
+}
+
+extern "C" rocblas_status rocsolver_dgecon_batched(rocblas_handle handle,
+                                                   const rocblas_norm_type norm_type,
+                                                   const rocblas_int n,
+                                                   double* const A[],
+                                                   const rocblas_int lda,
+                                                   const double* anorm,
+                                                   double* rcond,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gecon_batched_impl<double>(handle, norm_type, n, A, lda, anorm, rcond,
+                                                batch_count);
+}
+
+extern "C" rocblas_status rocsolver_cgecon_batched(rocblas_handle handle,
+                                                   const rocblas_norm_type norm_type,
+                                                   const rocblas_int n,
+                                                   rocblas_float_complex* const A[],
+                                                   const rocblas_int lda,
+                                                   const float* anorm,
+                                                   float* rcond,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gecon_batched_impl<rocblas_float_complex>(handle, norm_type, n, A, lda, anorm,
+                                                               rcond, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_zgecon_batched(rocblas_handle handle,
+                                                   const rocblas_norm_type norm_type,
+                                                   const rocblas_int n,
+                                                   rocblas_double_complex* const A[],
+                                                   const rocblas_int lda,
+                                                   const double* anorm,
+                                                   double* rcond,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gecon_batched_impl<rocblas_double_complex>(handle, norm_type, n, A, lda, anorm,
+                                                                rcond, batch_count);
+}
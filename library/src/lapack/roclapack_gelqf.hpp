@@ -124,10 +124,10 @@ rocblas_status rocsolver_gelqf_template(rocblas_handle handle,
         if(j + jb < m)
         {
             // compute block reflector
-            rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_row_wise, n - j,
-                                        jb, A, shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j),
-                                        strideP, Abyx_norms_trfact, ldw, strideW, batch_count,
-                                        scalars, (T*)work_workArr, workArr);
+            rocsolver_larft_template<BATCHED, STRIDED, T>(
+                handle, rocblas_forward_direction, rocblas_row_wise, n - j, jb, A,
+                shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j), strideP, Abyx_norms_trfact,
+                ldw, strideW, batch_count, scalars, (T*)work_workArr, workArr);
 
             // apply the block reflector
             rocsolver_larfb_template<BATCHED, STRIDED, T>(
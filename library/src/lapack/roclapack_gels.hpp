@@ -11,6 +11,7 @@
 
 #include "auxiliary/rocauxiliary_ormlq_unmlq.hpp"
 #include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "lapack_device_functions.hpp"
 #include "rocblas.hpp"
 #include "roclapack_gelqf.hpp"
 #include "roclapack_geqrf.hpp"
@@ -39,6 +40,93 @@ ROCSOLVER_KERNEL void gels_set_zero(const rocblas_int k1,
     }
 }
 
+/** GELS_SMALL_KERNEL solves the overdetermined least-squares problem min ||AX - B|| for a small
+    m-by-n matrix A, with n <= m <= GELS_SMALL_MAX_ROWS and n <= GELS_SMALL_MAX_COLS, using a single
+    work-group per problem. The QR factorization of A is computed as in GEQR2_SMALL_KERNEL, applying
+    every Householder reflector to the trailing columns of A and then to B. The diagonal
+    of R is kept in shared memory to check for singularity, and RX = Q'B is then solved by back
+    substitution. If A is singular, B is left overwritten with Q'B (as in the general path).
+
+    Call this kernel with batch_count groups in y, and BS1 threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gels_small_kernel(const rocblas_int m,
+                                                               const rocblas_int n,
+                                                               const rocblas_int nrhs,
+                                                               U AA,
+                                                               const rocblas_int shiftA,
+                                                               const rocblas_int lda,
+                                                               const rocblas_stride strideA,
+                                                               U BB,
+                                                               const rocblas_int shiftB,
+                                                               const rocblas_int ldb,
+                                                               const rocblas_stride strideB,
+                                                               rocblas_int* info)
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+
+    // shared memory
+    __shared__ S sval[BS1];
+    __shared__ T sw[BS1];
+    __shared__ T sv[GELS_SMALL_MAX_ROWS];
+    __shared__ T sd[GELS_SMALL_MAX_COLS];
+    __shared__ T tau_s;
+    __shared__ T scal_s;
+    __shared__ rocblas_int info_s;
+
+    for(rocblas_int j = 0; j < n; j++)
+    {
+        // generate the Householder reflector (as in LARFG)
+        larfg_col<BS1>(tid, m, j, A, lda, sval, sv, &tau_s, &scal_s);
+        if(tid == 0)
+            sd[j] = A[j + j * lda];
+
+        // apply H(j)' to A(j:m-1, j+1:n-1) and B(j:m-1, 0:nrhs-1) from the left
+        larf_col<BS1, GELS_SMALL_MAX_COLS>(tid, m, j, sv, tau_s, A + (j + 1) * lda, lda,
+                                           n - j - 1, sw);
+        larf_col<BS1, GELS_SMALL_MAX_COLS>(tid, m, j, sv, tau_s, B, ldb, nrhs, sw);
+    }
+
+    // check for singularities (as in CHECK_SINGULARITY)
+    if(tid == 0)
+    {
+        rocblas_int _info = 0;
+        for(rocblas_int j = 0; j < n && _info == 0; j++)
+        {
+            if(sd[j] == 0)
+                _info = j + 1;
+        }
+        info_s = _info;
+        info[bid] = _info;
+    }
+    __syncthreads();
+
+    if(info_s != 0)
+        return;
+
+    // solve RX = Q'B by back substitution, overwriting B with X
+    for(rocblas_int j = n - 1; j >= 0; j--)
+    {
+        for(rocblas_int c = tid; c < nrhs; c += BS1)
+            B[j + c * ldb] /= sd[j];
+        __syncthreads();
+
+        for(rocblas_int e = tid; e < j * nrhs; e += BS1)
+        {
+            rocblas_int i = e % j;
+            rocblas_int c = e / j;
+            B[i + c * ldb] -= A[i + j * lda] * B[j + c * ldb];
+        }
+        __syncthreads();
+    }
+}
+
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_gels_getMemorySize(const rocblas_operation trans,
                                   const rocblas_int m,
@@ -206,6 +294,16 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    // if the least-squares problem is small, solve it with a single kernel
+    if(trans == rocblas_operation_none && m >= n && m <= GELS_SMALL_MAX_ROWS
+       && n <= GELS_SMALL_MAX_COLS)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(gels_small_kernel<T>, dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                                stream, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb,
+                                strideB, info);
+        return rocblas_status_success;
+    }
+
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
@@ -15,8 +15,43 @@
 #include "roclapack_gelqf.hpp"
 #include "roclapack_gels.hpp"
 #include "roclapack_geqrf.hpp"
+#include "roclapack_potrf.hpp"
 #include "rocsolver/rocsolver.h"
 
+/** GELS_CHOLQR_CHECK sets fallback to 1 if the Cholesky factorization of the Gram matrix of any
+    problem in the batch failed, or if the smallest diagonal entry of its factor R is not larger
+    than tol times the largest one (i.e. A is too ill-conditioned for Cholesky QR).
+    Call this kernel with one thread per problem in the batch. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void gels_cholqr_check(const rocblas_int n,
+                                        T* R,
+                                        const rocblas_stride strideR,
+                                        rocblas_int* cinfo,
+                                        rocblas_int* fallback,
+                                        const S tol,
+                                        const rocblas_int batch_count)
+{
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(bid < batch_count)
+    {
+        T* Rp = R + bid * strideR;
+
+        // the diagonal of a Cholesky factor is real and positive
+        S dmin = std::real(Rp[0]);
+        S dmax = dmin;
+        for(rocblas_int j = 1; j < n; j++)
+        {
+            S d = std::real(Rp[j + j * n]);
+            dmin = (d < dmin ? d : dmin);
+            dmax = (d > dmax ? d : dmax);
+        }
+
+        if(cinfo[bid] != 0 || !(dmin > tol * dmax))
+            fallback[0] = 1;
+    }
+}
+
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_gels_outofplace_getMemorySize(const rocblas_operation trans,
                                              const rocblas_int m,
@@ -30,6 +65,8 @@ void rocsolver_gels_outofplace_getMemorySize(const rocblas_operation trans,
                                              size_t* size_trfact_workTrmm_invA_arr,
                                              size_t* size_ipiv,
                                              size_t* size_savedB,
+                                             size_t* size_Rfact,
+                                             size_t* size_cinfo,
                                              bool* optim_mem)
 {
     // if quick return no workspace needed
@@ -42,6 +79,8 @@ void rocsolver_gels_outofplace_getMemorySize(const rocblas_operation trans,
         *size_trfact_workTrmm_invA_arr = 0;
         *size_ipiv = 0;
         *size_savedB = 0;
+        *size_Rfact = 0;
+        *size_cinfo = 0;
         *optim_mem = true;
         return;
     }
@@ -58,6 +97,60 @@ void rocsolver_gels_outofplace_getMemorySize(const rocblas_operation trans,
         *size_savedB = sizeof(T) * std::max(m, n) * nrhs * batch_count;
     else
         *size_savedB = 0;
+
+    // extra requirements for the Cholesky QR path
+    if(trans == rocblas_operation_none && m >= GELS_CHOLQR_RATIO * n)
+    {
+        size_t potrf_scalars, potrf_work1, potrf_work2, potrf_work3, potrf_work4, potrf_pivots,
+            potrf_iinfo;
+        size_t trsmA_x_temp, trsmA_x_temp_arr, trsmA_invA, trsmA_invA_arr;
+        size_t trsmX_x_temp, trsmX_x_temp_arr, trsmX_invA, trsmX_invA_arr;
+        bool potrf_optim;
+
+        // requirements for calling POTRF on the Gram matrices
+        rocsolver_potrf_getMemorySize<false, true, T>(
+            n, rocblas_fill_upper, batch_count, &potrf_scalars, &potrf_work1, &potrf_work2,
+            &potrf_work3, &potrf_work4, &potrf_pivots, &potrf_iinfo, &potrf_optim);
+
+        // requirements for calling TRSM to form Q and to solve for X
+        rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_right, rocblas_operation_none, m, n,
+                                         batch_count, &trsmA_x_temp, &trsmA_x_temp_arr,
+                                         &trsmA_invA, &trsmA_invA_arr);
+        rocblasCall_trsm_mem<BATCHED, T>(rocblas_side_left, rocblas_operation_none, n, nrhs,
+                                         batch_count, &trsmX_x_temp, &trsmX_x_temp_arr,
+                                         &trsmX_invA, &trsmX_invA_arr);
+
+        *size_scalars = std::max(*size_scalars, potrf_scalars);
+        *size_work_x_temp = std::max({*size_work_x_temp, potrf_work1, trsmA_x_temp, trsmX_x_temp});
+        *size_workArr_temp_arr
+            = std::max({*size_workArr_temp_arr, potrf_work2, trsmA_x_temp_arr, trsmX_x_temp_arr});
+        *size_diag_trfac_invA
+            = std::max({*size_diag_trfac_invA, potrf_work3, trsmA_invA, trsmX_invA});
+        *size_trfact_workTrmm_invA_arr = std::max(
+            {*size_trfact_workTrmm_invA_arr, potrf_work4, trsmA_invA_arr, trsmX_invA_arr});
+        *optim_mem = *optim_mem && potrf_optim;
+
+        // ipiv holds the pivots of POTRF, and then the array of pointers to R when calling
+        // TRSM on the batched problems; workArr_temp_arr also holds the array of pointers to
+        // the Gram matrices when calling GEMM
+        *size_ipiv = std::max(*size_ipiv, potrf_pivots);
+        if(BATCHED)
+        {
+            *size_ipiv = std::max(*size_ipiv, sizeof(T*) * batch_count);
+            *size_workArr_temp_arr = std::max(*size_workArr_temp_arr, sizeof(T*) * batch_count);
+        }
+
+        // size to store the factors R1 and R2 of both passes
+        *size_Rfact = sizeof(T) * 2 * n * n * batch_count;
+
+        // size to store the info of POTRF, the fallback flag and the info about the subblocks
+        *size_cinfo = sizeof(rocblas_int) * (batch_count + 1) + potrf_iinfo;
+    }
+    else
+    {
+        *size_Rfact = 0;
+        *size_cinfo = 0;
+    }
 }
 
 template <bool COMPLEX, typename T>
@@ -106,6 +199,135 @@ rocblas_status rocsolver_gels_outofplace_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
+/** GELS_CHOLQR2 solves the overdetermined least-squares problems min||AX - B|| by orthogonalizing
+    A with two passes of Cholesky QR, A = Q1*R1 and Q1 = Q*R2, so that R = R2*R1. Each pass forms
+    the Gram matrix with GEMM, factorizes it with POTRF and applies the inverse of the Cholesky
+    factor with TRSM. A is overwritten with Q, and X = inv(R)*Q'*B. If any problem in the batch
+    fails the check after the first factorization, A and X are left untouched and fallback is set
+    to true. (Scalars must be in host memory) **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gels_cholqr2(rocblas_handle handle,
+                                      const rocblas_int m,
+                                      const rocblas_int n,
+                                      const rocblas_int nrhs,
+                                      U A,
+                                      const rocblas_int shiftA,
+                                      const rocblas_int lda,
+                                      const rocblas_stride strideA,
+                                      U B,
+                                      const rocblas_int shiftB,
+                                      const rocblas_int ldb,
+                                      const rocblas_stride strideB,
+                                      U X,
+                                      const rocblas_int shiftX,
+                                      const rocblas_int ldx,
+                                      const rocblas_stride strideX,
+                                      const rocblas_int batch_count,
+                                      T* scalars,
+                                      T* work_x_temp,
+                                      T* workArr_temp_arr,
+                                      T* diag_trfac_invA,
+                                      T** trfact_workTrmm_invA_arr,
+                                      T* ipiv,
+                                      T* Rfact,
+                                      rocblas_int* cinfo,
+                                      bool optim_mem,
+                                      bool* fallback)
+{
+    using S = decltype(std::real(T{}));
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // constants in host memory
+    T one = 1;
+    T zero = 0;
+
+    const rocblas_stride strideR = n * n;
+    T* R1 = Rfact;
+    T* R2 = Rfact + strideR * batch_count;
+    T** RArr = (T**)ipiv;
+    rocblas_int* flag = cinfo + batch_count;
+    rocblas_int* iinfo = cinfo + batch_count + 1;
+    rocblas_int h_flag;
+
+    // Cholesky QR2 is accurate as long as cond(A) is not much larger than 1/sqrt(eps*m*n)
+    // (Yamamoto et al., 2015); min(diag(R1))/max(diag(R1)) is used as a cheap estimate of 1/cond(A)
+    const S tol = sqrt(get_epsilon<S>() * S(m) * S(n));
+    const rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+
+    // first pass: compute the Gram matrix A'A and its Cholesky factor R1
+    rocblasCall_gemm<BATCHED, STRIDED, T>(
+        handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, n, n, m, &one, A,
+        shiftA, lda, strideA, A, shiftA, lda, strideA, &zero, R1, 0, n, strideR, batch_count,
+        (T**)workArr_temp_arr);
+
+    rocsolver_potrf_template<false, true, T>(handle, rocblas_fill_upper, n, R1, 0, n, strideR,
+                                             cinfo, batch_count, scalars, work_x_temp,
+                                             workArr_temp_arr, diag_trfac_invA,
+                                             trfact_workTrmm_invA_arr, ipiv, iinfo, optim_mem);
+
+    // check that R1 is accurate enough for every problem in the batch
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1, 1, 1), dim3(1, 1, 1), 0, stream, flag, 1, 0);
+    ROCSOLVER_LAUNCH_KERNEL((gels_cholqr_check<T, S>), dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0,
+                            stream, n, R1, strideR, cinfo, flag, tol, batch_count);
+
+    hipError_t status
+        = hipMemcpyAsync(&h_flag, flag, sizeof(rocblas_int), hipMemcpyDeviceToHost, stream);
+    if(status != hipSuccess)
+        return get_rocblas_status_for_hip_status(status);
+
+    status = hipStreamSynchronize(stream);
+    if(status != hipSuccess)
+        return get_rocblas_status_for_hip_status(status);
+
+    *fallback = (h_flag != 0);
+    if(*fallback)
+        return rocblas_status_success;
+
+    // Q1 = A*inv(R1)
+    rocblasCall_trsm(handle, rocblas_side_right, rocblas_fill_upper, rocblas_operation_none,
+                     rocblas_diagonal_non_unit, m, n, &one, R1, 0, n, strideR, A, shiftA, lda,
+                     strideA, batch_count, optim_mem, work_x_temp, workArr_temp_arr,
+                     diag_trfac_invA, trfact_workTrmm_invA_arr, RArr);
+
+    // second pass: compute the Gram matrix Q1'Q1 and its Cholesky factor R2
+    // (Q1'Q1 is close to the identity once R1 passed the check, so this POTRF does not fail)
+    rocblasCall_gemm<BATCHED, STRIDED, T>(
+        handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, n, n, m, &one, A,
+        shiftA, lda, strideA, A, shiftA, lda, strideA, &zero, R2, 0, n, strideR, batch_count,
+        (T**)workArr_temp_arr);
+
+    rocsolver_potrf_template<false, true, T>(handle, rocblas_fill_upper, n, R2, 0, n, strideR,
+                                             cinfo, batch_count, scalars, work_x_temp,
+                                             workArr_temp_arr, diag_trfac_invA,
+                                             trfact_workTrmm_invA_arr, ipiv, iinfo, optim_mem);
+
+    // Q = Q1*inv(R2)
+    rocblasCall_trsm(handle, rocblas_side_right, rocblas_fill_upper, rocblas_operation_none,
+                     rocblas_diagonal_non_unit, m, n, &one, R2, 0, n, strideR, A, shiftA, lda,
+                     strideA, batch_count, optim_mem, work_x_temp, workArr_temp_arr,
+                     diag_trfac_invA, trfact_workTrmm_invA_arr, RArr);
+
+    // X = Q'B
+    rocblasCall_gemm<BATCHED, STRIDED, T>(
+        handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, n, nrhs, m, &one, A,
+        shiftA, lda, strideA, B, shiftB, ldb, strideB, &zero, X, shiftX, ldx, strideX, batch_count,
+        (T**)workArr_temp_arr);
+
+    // solve R2*R1*X = Q'B
+    rocblasCall_trsm(handle, rocblas_side_left, rocblas_fill_upper, rocblas_operation_none,
+                     rocblas_diagonal_non_unit, n, nrhs, &one, R2, 0, n, strideR, X, shiftX, ldx,
+                     strideX, batch_count, optim_mem, work_x_temp, workArr_temp_arr,
+                     diag_trfac_invA, trfact_workTrmm_invA_arr, RArr);
+    rocblasCall_trsm(handle, rocblas_side_left, rocblas_fill_upper, rocblas_operation_none,
+                     rocblas_diagonal_non_unit, n, nrhs, &one, R1, 0, n, strideR, X, shiftX, ldx,
+                     strideX, batch_count, optim_mem, work_x_temp, workArr_temp_arr,
+                     diag_trfac_invA, trfact_workTrmm_invA_arr, RArr);
+
+    return rocblas_status_success;
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
                                                   rocblas_operation trans,
@@ -133,6 +355,8 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
                                                   T** trfact_workTrmm_invA_arr,
                                                   T* ipiv,
                                                   T* savedB,
+                                                  T* Rfact,
+                                                  rocblas_int* cinfo,
                                                   bool optim_mem)
 {
     ROCSOLVER_ENTER("gels_outofplace", "trans:", trans, "m:", m, "n:", n, "nrhs:", nrhs,
@@ -188,6 +412,23 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
 
     if(m >= n)
     {
+        // orthogonalize tall-skinny A with Cholesky QR when it is well-conditioned enough
+        if(trans == rocblas_operation_none && m >= GELS_CHOLQR_RATIO * n)
+        {
+            bool fallback;
+            rocblas_status status = rocsolver_gels_cholqr2<BATCHED, STRIDED, T>(
+                handle, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, X, shiftX,
+                ldx, strideX, batch_count, scalars, work_x_temp, workArr_temp_arr,
+                diag_trfac_invA, trfact_workTrmm_invA_arr, ipiv, Rfact, cinfo, optim_mem,
+                &fallback);
+
+            if(status != rocblas_status_success || !fallback)
+            {
+                rocblas_set_pointer_mode(handle, old_mode);
+                return status;
+            }
+        }
+
         // compute QR factorization of A
         rocsolver_geqrf_template<BATCHED, STRIDED>(
             handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars, work_x_temp,
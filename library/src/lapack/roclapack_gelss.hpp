@@ -0,0 +1,407 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.10.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     June 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gesvd.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** GELSS_SCALE divides the rows of C by the corresponding singular values larger than
+    thresh = max(rcond * S[0], sfmin), and zeroes the rows corresponding to smaller singular
+    values. The number of singular values larger than the threshold is the effective rank.
+
+    Call this kernel with batch_count groups in x, and BS1 threads in x. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gelss_scale(const rocblas_int k,
+                                                         const rocblas_int nrhs,
+                                                         S* SS,
+                                                         const rocblas_stride strideS,
+                                                         const S rcond,
+                                                         const S sfmin,
+                                                         rocblas_int* rank,
+                                                         T* CC,
+                                                         const rocblas_int ldc,
+                                                         const rocblas_stride strideC)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int b = hipBlockIdx_x;
+
+    S* Sv = SS + b * strideS;
+    T* C = CC + b * strideC;
+
+    const S thresh = max(rcond * Sv[0], sfmin);
+
+    for(rocblas_int idx = tid; idx < k * nrhs; idx += BS1)
+    {
+        rocblas_int i = idx % k;
+        rocblas_int j = idx / k;
+        C[i + j * ldc] = (Sv[i] > thresh) ? C[i + j * ldc] / Sv[i] : T(0);
+    }
+
+    if(tid == 0)
+    {
+        // singular values are sorted in decreasing order
+        rocblas_int r = 0;
+        while(r < k && Sv[r] > thresh)
+            r++;
+        rank[b] = r;
+    }
+}
+
+/** GELSS_SCALE_INPUT scales the m-by-n matrix M, if needed, so that its largest entry in
+    absolute value lies in the range [smlnum, bignum]. The applied scaling factor is stored in
+    scl (scl = 1 if M is not scaled).
+
+    Call this kernel with batch_count groups in x, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gelss_scale_input(const rocblas_int m,
+                                                               const rocblas_int n,
+                                                               U MM,
+                                                               const rocblas_int shiftM,
+                                                               const rocblas_int ldm,
+                                                               const rocblas_stride strideM,
+                                                               const S smlnum,
+                                                               const S bignum,
+                                                               S* scl)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int b = hipBlockIdx_x;
+
+    T* M = load_ptr_batch<T>(MM, b, shiftM, strideM);
+
+    // shared memory
+    __shared__ S sval[BS1];
+
+    // largest entry of M in absolute value
+    S mnrm = 0;
+    for(rocblas_int idx = tid; idx < m * n; idx += BS1)
+        mnrm = max(mnrm, aabs<S>(M[(idx % m) + (idx / m) * ldm]));
+    sval[tid] = mnrm;
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        for(rocblas_int i = 1; i < BS1; i++)
+            mnrm = max(mnrm, sval[i]);
+
+        S c = 1;
+        if(mnrm > 0 && mnrm < smlnum)
+            c = smlnum / mnrm;
+        else if(mnrm > bignum)
+            c = bignum / mnrm;
+        sval[0] = c;
+        scl[b] = c;
+    }
+    __syncthreads();
+
+    const S c = sval[0];
+    if(c != 1)
+    {
+        for(rocblas_int idx = tid; idx < m * n; idx += BS1)
+            M[(idx % m) + (idx / m) * ldm] = M[(idx % m) + (idx / m) * ldm] * c;
+    }
+}
+
+/** GELSS_UNSCALE undoes the scaling of A and B applied by GELSS_SCALE_INPUT. The singular
+    values are divided by sclA, and the solution in the first n rows of B is multiplied by
+    sclA / sclB. Any other rows of the input B (including all of them when info is nonzero,
+    as B then holds the restored right-hand sides) are divided by sclB.
+
+    Call this kernel with batch_count groups in x, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gelss_unscale(const rocblas_int m,
+                                                           const rocblas_int n,
+                                                           const rocblas_int nrhs,
+                                                           S* SS,
+                                                           const rocblas_stride strideS,
+                                                           U BB,
+                                                           const rocblas_int shiftB,
+                                                           const rocblas_int ldb,
+                                                           const rocblas_stride strideB,
+                                                           S* sclA,
+                                                           S* sclB,
+                                                           rocblas_int* info)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int b = hipBlockIdx_x;
+
+    S* Sv = SS + b * strideS;
+    const rocblas_int k = std::min(m, n);
+    const S ca = sclA[b];
+
+    if(ca != 1)
+    {
+        for(rocblas_int i = tid; i < k; i += BS1)
+            Sv[i] /= ca;
+    }
+
+    if(nrhs > 0)
+    {
+        T* B = load_ptr_batch<T>(BB, b, shiftB, strideB);
+        const S cb = sclB[b];
+        const rocblas_int nx = (info[b] == 0 ? n : 0);
+        const rocblas_int rows = std::max(m, nx);
+
+        if(ca != 1 || cb != 1)
+        {
+            for(rocblas_int idx = tid; idx < rows * nrhs; idx += BS1)
+            {
+                rocblas_int i = idx % rows;
+                rocblas_int j = idx / rows;
+                if(i < nx)
+                    B[i + j * ldb] = (B[i + j * ldb] * ca) / cb;
+                else
+                    B[i + j * ldb] = B[i + j * ldb] / cb;
+            }
+        }
+    }
+}
+
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gelss_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_Abyx_norms_tmptr,
+                                   size_t* size_Abyx_norms_trfact_X,
+                                   size_t* size_diag_tmptr_Y,
+                                   size_t* size_tau_splits,
+                                   size_t* size_tempArrayT,
+                                   size_t* size_tempArrayC,
+                                   size_t* size_workArr,
+                                   size_t* size_UV,
+                                   size_t* size_E,
+                                   size_t* size_C_savedB)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms_tmptr = 0;
+        *size_Abyx_norms_trfact_X = 0;
+        *size_diag_tmptr_Y = 0;
+        *size_tau_splits = 0;
+        *size_tempArrayT = 0;
+        *size_tempArrayC = 0;
+        *size_workArr = 0;
+        *size_UV = 0;
+        *size_E = 0;
+        *size_C_savedB = 0;
+        return;
+    }
+
+    const rocblas_int k = std::min(m, n);
+
+    // requirements for calling GESVD (the array of pointers is also used by GEMM)
+    rocsolver_gesvd_getMemorySize<BATCHED, T, S>(
+        rocblas_svect_singular, rocblas_svect_singular, m, n, batch_count, rocblas_outofplace,
+        size_scalars, size_work_workArr, size_Abyx_norms_tmptr, size_Abyx_norms_trfact_X,
+        size_diag_tmptr_Y, size_tau_splits, size_tempArrayT, size_tempArrayC, size_workArr);
+
+    // size of the left (m-by-k) and right (k-by-n) singular vectors
+    *size_UV = sizeof(T) * (m + n) * k * batch_count;
+
+    // size of the off-diagonal of the bidiagonal form, and of the scaling factors of A and B
+    *size_E = sizeof(S) * (k + 2) * batch_count;
+
+    // size of the intermediate product U' * B, and the copy of B used when the SVD fails
+    *size_C_savedB = sizeof(T) * (k + n) * nrhs * batch_count;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_gelss_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        T A,
+                                        const rocblas_int lda,
+                                        T B,
+                                        const rocblas_int ldb,
+                                        S* Sv,
+                                        rocblas_int* rank,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || ((m * nrhs || n * nrhs) && !B) || (std::min(m, n) && !Sv)
+       || (batch_count && !rank) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gelss_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        S* Sv,
+                                        const rocblas_stride strideS,
+                                        const S rcond,
+                                        rocblas_int* rank,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* Abyx_norms_tmptr,
+                                        T* Abyx_norms_trfact_X,
+                                        T* diag_tmptr_Y,
+                                        T* tau_splits,
+                                        T* tempArrayT,
+                                        T* tempArrayC,
+                                        T** workArr,
+                                        T* UV,
+                                        S* E,
+                                        T* C_savedB)
+{
+    ROCSOLVER_ENTER("gelss", "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "rcond:", rcond, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return if A is empty
+    // (rank = 0, and the minimum norm solution is zero)
+    if(m == 0 || n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, rank, batch_count, 0);
+
+        rocblas_int rowsB = std::max(m, n);
+        if(nrhs > 0)
+        {
+            rocblas_int blocksx = (rowsB - 1) / 32 + 1;
+            rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
+                                    0, stream, rowsB, nrhs, B, shiftB, ldb, strideB);
+        }
+
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants in host memory
+    T one = 1;
+    T zero = 0;
+    const rocblas_int k = std::min(m, n);
+    const rocblas_int ldu = m;
+    const rocblas_int ldv = k;
+    const rocblas_int ldc = k;
+    const rocblas_stride strideU = ldu * k;
+    const rocblas_stride strideV = ldv * n;
+    const rocblas_stride strideC = ldc * nrhs;
+    T* Umat = UV;
+    T* Vmat = UV + strideU * batch_count;
+    T* Cmat = C_savedB;
+    T* savedB = C_savedB + strideC * batch_count;
+    S* sclA = E + k * batch_count;
+    S* sclB = sclA + batch_count;
+    const S eps = get_epsilon<S>();
+    const S sfmin = get_safemin<S>();
+    const S smlnum = sfmin / eps;
+    const S bignum = S(1) / smlnum;
+
+    // scale A and B if their largest entries are outside the range [smlnum, bignum]
+    ROCSOLVER_LAUNCH_KERNEL((gelss_scale_input<T, S>), dim3(batch_count), threads, 0, stream, m, n,
+                            A, shiftA, lda, strideA, smlnum, bignum, sclA);
+    if(nrhs > 0)
+        ROCSOLVER_LAUNCH_KERNEL((gelss_scale_input<T, S>), dim3(batch_count), threads, 0, stream,
+                                m, nrhs, B, shiftB, ldb, strideB, smlnum, bignum, sclB);
+
+    // compute the singular value decomposition A = U * S * V'
+    rocsolver_gesvd_template<BATCHED, STRIDED, T>(
+        handle, rocblas_svect_singular, rocblas_svect_singular, m, n, A, shiftA, lda, strideA, Sv,
+        strideS, Umat, ldu, strideU, Vmat, ldv, strideV, E, k, rocblas_outofplace, info,
+        batch_count, scalars, work_workArr, Abyx_norms_tmptr, Abyx_norms_trfact_X, diag_tmptr_Y,
+        tau_splits, tempArrayT, tempArrayC, workArr);
+
+    if(nrhs > 0)
+    {
+        const rocblas_int copyblocksx = (n - 1) / 32 + 1;
+        const rocblas_int copyblocksy = (nrhs - 1) / 32 + 1;
+
+        // C = U' * B
+        rocblasCall_gemm<BATCHED, STRIDED>(
+            handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, k, nrhs, m, &one,
+            Umat, 0, ldu, strideU, B, shiftB, ldb, strideB, &zero, Cmat, 0, ldc, strideC,
+            batch_count, workArr);
+
+        // C = pinv(S) * C, discarding the singular values smaller than rcond * S[0]
+        ROCSOLVER_LAUNCH_KERNEL((gelss_scale<T, S>), dim3(batch_count), threads, 0, stream, k, nrhs,
+                                Sv, strideS, (rcond < 0 ? eps : rcond), sfmin, rank, Cmat, ldc,
+                                strideC);
+
+        // save elements of B that will be overwritten in cases where info is nonzero
+        ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, copymat_to_buffer, n, nrhs, B, shiftB,
+                                ldb, strideB, savedB, info_mask(info));
+
+        // B = V * C
+        rocblasCall_gemm<BATCHED, STRIDED>(
+            handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, n, nrhs, k, &one,
+            Vmat, 0, ldv, strideV, Cmat, 0, ldc, strideC, &zero, B, shiftB, ldb, strideB,
+            batch_count, workArr);
+
+        // restore elements of B that were overwritten in cases where info is nonzero
+        ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksx, copyblocksy, batch_count),
+                                dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B, shiftB,
+                                ldb, strideB, savedB, info_mask(info));
+    }
+    else
+    {
+        // only the effective rank is needed
+        ROCSOLVER_LAUNCH_KERNEL((gelss_scale<T, S>), dim3(batch_count), threads, 0, stream, k, 0,
+                                Sv, strideS, (rcond < 0 ? eps : rcond), sfmin, rank, Cmat, ldc,
+                                strideC);
+    }
+
+    // undo the scaling of the singular values and of the solution
+    ROCSOLVER_LAUNCH_KERNEL((gelss_unscale<T, S>), dim3(batch_count), threads, 0, stream, m, n,
+                            nrhs, Sv, strideS, B, shiftB, ldb, strideB, sclA, sclB, info);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
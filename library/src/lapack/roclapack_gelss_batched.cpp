@@ -0,0 +1,190 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gelss.hpp"
+
+template <typename T, typename TT, typename U>
+rocblas_status rocsolver_gelss_batched_impl(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            U A,
+                                            const rocblas_int lda,
+                                            U B,
+                                            const rocblas_int ldb,
+                                            TT* S,
+                                            const rocblas_stride strideS,
+                                            const TT rcond,
+                                            rocblas_int* rank,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gelss_batched", "-m", m, "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldb",
+                        ldb, "--strideS", strideS, "--rcond", rcond, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gelss_argCheck(handle, m, n, nrhs, A, lda, B, ldb, S, rank, info,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace and array of pointers (batched case)
+    size_t size_work_workArr;
+    // extra requirements for calling orthogonal/unitary matrix operations and factorizations
+    size_t size_Abyx_norms_tmptr, size_Abyx_norms_trfact_X, size_diag_tmptr_Y;
+    // size of array tau to store householder scalars, plus extra requirements for calling BDSQR
+    size_t size_tau_splits;
+    // size of temporary arrays for copies
+    size_t size_tempArrayT, size_tempArrayC;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    // size of the singular vectors, the off-diagonal elements, and the right-hand sides
+    size_t size_UV, size_E, size_C_savedB;
+    rocsolver_gelss_getMemorySize<true, T, TT>(m, n, nrhs, batch_count, &size_scalars,
+                                               &size_work_workArr, &size_Abyx_norms_tmptr,
+                                               &size_Abyx_norms_trfact_X, &size_diag_tmptr_Y,
+                                               &size_tau_splits, &size_tempArrayT, &size_tempArrayC,
+                                               &size_workArr, &size_UV, &size_E, &size_C_savedB);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+                                                      size_Abyx_norms_tmptr,
+                                                      size_Abyx_norms_trfact_X, size_diag_tmptr_Y,
+                                                      size_tau_splits, size_tempArrayT,
+                                                      size_tempArrayC, size_workArr, size_UV,
+                                                      size_E, size_C_savedB);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms_tmptr, *Abyx_norms_trfact_X, *diag_tmptr_Y;
+    void *tau_splits, *tempArrayT, *tempArrayC, *workArr, *UV, *E, *C_savedB;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_tmptr,
+                              size_Abyx_norms_trfact_X, size_diag_tmptr_Y, size_tau_splits,
+                              size_tempArrayT, size_tempArrayC, size_workArr, size_UV, size_E,
+                              size_C_savedB);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms_tmptr = mem[2];
+    Abyx_norms_trfact_X = mem[3];
+    diag_tmptr_Y = mem[4];
+    tau_splits = mem[5];
+    tempArrayT = mem[6];
+    tempArrayC = mem[7];
+    workArr = mem[8];
+    UV = mem[9];
+    E = mem[10];
+    C_savedB = mem[11];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_gelss_template<true, false, T>(handle, m, n, nrhs, A, shiftA, lda, strideA, B,
+                                                    shiftB, ldb, strideB, S, strideS, rcond, rank,
+                                                    info, batch_count, (T*)scalars, work_workArr,
+                                                    (T*)Abyx_norms_tmptr, (T*)Abyx_norms_trfact_X,
+                                                    (T*)diag_tmptr_Y, (T*)tau_splits,
+                                                    (T*)tempArrayT, (T*)tempArrayC, (T**)workArr,
+                                                    (T*)UV, (TT*)E, (T*)C_savedB);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_sgelss_batched(rocblas_handle handle,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   float* const A[],
+                                                   const rocblas_int lda,
+                                                   float* const B[],
+                                                   const rocblas_int ldb,
+                                                   float* S,
+                                                   const rocblas_stride strideS,
+                                                   const float rcond,
+                                                   rocblas_int* rank,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gelss_batched_impl<float>(handle, m, n, nrhs, A, lda, B, ldb, S, strideS,
+                                               rcond, rank, info, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_dgelss_batched(rocblas_handle handle,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   double* const A[],
+                                                   const rocblas_int lda,
+                                                   double* const B[],
+                                                   const rocblas_int ldb,
+                                                   double* S,
+                                                   const rocblas_stride strideS,
+                                                   const double rcond,
+                                                   rocblas_int* rank,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gelss_batched_impl<double>(handle, m, n, nrhs, A, lda, B, ldb, S, strideS,
+                                                rcond, rank, info, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_cgelss_batched(rocblas_handle handle,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   rocblas_float_complex* const A[],
+                                                   const rocblas_int lda,
+                                                   rocblas_float_complex* const B[],
+                                                   const rocblas_int ldb,
+                                                   float* S,
+                                                   const rocblas_stride strideS,
+                                                   const float rcond,
+                                                   rocblas_int* rank,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gelss_batched_impl<rocblas_float_complex>(handle, m, n, nrhs, A, lda, B, ldb,
+                                                               S, strideS, rcond, rank, info,
+                                                               batch_count);
+}
+
+extern "C" rocblas_status rocsolver_zgelss_batched(rocblas_handle handle,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   rocblas_double_complex* const A[],
+                                                   const rocblas_int lda,
+                                                   rocblas_double_complex* const B[],
+                                                   const rocblas_int ldb,
+                                                   double* S,
+                                                   const rocblas_stride strideS,
+                                                   const double rcond,
+                                                   rocblas_int* rank,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gelss_batched_impl<rocblas_double_complex>(handle, m, n, nrhs, A, lda, B, ldb,
+                                                                S, strideS, rcond, rank, info,
+                                                                batch_count);
+}
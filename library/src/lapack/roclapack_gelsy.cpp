@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gelsy.hpp"
+
+template <typename T, typename S>
+rocblas_status rocsolver_gelsy_impl(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    T* A,
+                                    const rocblas_int lda,
+                                    T* B,
+                                    const rocblas_int ldb,
+                                    rocblas_int* jpvt,
+                                    const S rcond,
+                                    rocblas_int* rank)
+{
+    ROCSOLVER_ENTER_TOP("gelsy", "-m", m, "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldb", ldb,
+                        "--rcond", rcond);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gelsy_argCheck(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rank);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideJ = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of workspace (for calling GEQP3, ORMQR and TRSM)
+    bool optim_mem;
+    size_t size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
+        size_F_trfact_workTrmm_invA_arr;
+    // extra requirements for calling GEQP3
+    size_t size_auxv, size_vnorms, size_done;
+    // size of the Householder scalars, the triangular factor and the intermediate solution
+    size_t size_tau, size_Tw, size_X;
+    rocsolver_gelsy_getMemorySize<false, false, T, S>(m, n, nrhs, batch_count, &size_scalars,
+                                                      &size_work_x_temp, &size_workArr_temp_arr,
+                                                      &size_diag_trfac_invA,
+                                                      &size_F_trfact_workTrmm_invA_arr, &size_auxv,
+                                                      &size_vnorms, &size_done, &size_tau, &size_Tw,
+                                                      &size_X, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_x_temp,
+                                                      size_workArr_temp_arr, size_diag_trfac_invA,
+                                                      size_F_trfact_workTrmm_invA_arr, size_auxv,
+                                                      size_vnorms, size_done, size_tau, size_Tw,
+                                                      size_X);
+
+    // memory workspace allocation
+    void *scalars, *work_x_temp, *workArr_temp_arr, *diag_trfac_invA, *F_trfact_workTrmm_invA_arr;
+    void *auxv, *vnorms, *done, *tau, *Tw, *X;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+                              size_diag_trfac_invA, size_F_trfact_workTrmm_invA_arr, size_auxv,
+                              size_vnorms, size_done, size_tau, size_Tw, size_X);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_x_temp = mem[1];
+    workArr_temp_arr = mem[2];
+    diag_trfac_invA = mem[3];
+    F_trfact_workTrmm_invA_arr = mem[4];
+    auxv = mem[5];
+    vnorms = mem[6];
+    done = mem[7];
+    tau = mem[8];
+    Tw = mem[9];
+    X = mem[10];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_gelsy_template<false, false, T>(handle, m, n, nrhs, A, shiftA, lda, strideA, B,
+                                                     shiftB, ldb, strideB, jpvt, strideJ, rcond,
+                                                     rank, batch_count, (T*)scalars, work_x_temp,
+                                                     workArr_temp_arr, diag_trfac_invA,
+                                                     F_trfact_workTrmm_invA_arr, (T*)auxv,
+                                                     (S*)vnorms, (rocblas_int*)done, (T*)tau,
+                                                     (T*)Tw, (T*)X, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_sgelsy(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           float* A,
+                                           const rocblas_int lda,
+                                           float* B,
+                                           const rocblas_int ldb,
+                                           rocblas_int* jpvt,
+                                           const float rcond,
+                                           rocblas_int* rank)
+{
+    return rocsolver_gelsy_impl<float>(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+extern "C" rocblas_status rocsolver_dgelsy(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           double* A,
+                                           const rocblas_int lda,
+                                           double* B,
+                                           const rocblas_int ldb,
+                                           rocblas_int* jpvt,
+                                           const double rcond,
+                                           rocblas_int* rank)
+{
+    return rocsolver_gelsy_impl<double>(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+extern "C" rocblas_status rocsolver_cgelsy(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           rocblas_float_complex* A,
+                                           const rocblas_int lda,
+                                           rocblas_float_complex* B,
+                                           const rocblas_int ldb,
+                                           rocblas_int* jpvt,
+                                           const float rcond,
+                                           rocblas_int* rank)
+{
+    return rocsolver_gelsy_impl<rocblas_float_complex>(handle, m, n, nrhs, A, lda, B, ldb, jpvt,
+                                                       rcond, rank);
+}
+
+extern "C" rocblas_status rocsolver_zgelsy(rocblas_handle handle,
+                                           const rocblas_int m,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           rocblas_double_complex* A,
+                                           const rocblas_int lda,
+                                           rocblas_double_complex* B,
+                                           const rocblas_int ldb,
+                                           rocblas_int* jpvt,
+                                           const double rcond,
+                                           rocblas_int* rank)
+{
+    return rocsolver_gelsy_impl<rocblas_double_complex>(handle, m, n, nrhs, A, lda, B, ldb, jpvt,
+                                                        rcond, rank);
+}
@@ -0,0 +1,495 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.10.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     June 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqp3.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+/** GELSY_TZRZ reduces the leading rank-by-n upper trapezoidal part of A to upper triangular
+    form by means of orthogonal/unitary transformations applied from the right
+    (equivalent to LAPACK's LATRZ). The rank can be different for every matrix in the batch.
+
+    The Householder vectors are stored in A(i, rank:n-1), and the Householder scalars in tau.
+
+    Call this kernel with batch_count groups in x, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gelsy_tzrz(const rocblas_int n,
+                                                        U AA,
+                                                        const rocblas_int shiftA,
+                                                        const rocblas_int lda,
+                                                        const rocblas_stride strideA,
+                                                        const rocblas_int* rankA,
+                                                        T* tauA,
+                                                        const rocblas_stride strideT)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int b = hipBlockIdx_x;
+
+    const rocblas_int r = rankA[b];
+    const rocblas_int l = n - r;
+
+    // nothing to do if A(0:rank-1,:) is already triangular
+    if(r == 0 || l == 0)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* tau = tauA + b * strideT;
+
+    // shared memory
+    __shared__ S sval[BS1];
+    __shared__ T tau_s;
+    __shared__ T scal_s;
+
+    for(rocblas_int i = r - 1; i >= 0; i--)
+    {
+        T* x = A + i + r * lda;
+
+        // conjugate the row to be annihilated and compute its norm
+        S s = 0;
+        for(rocblas_int j = tid; j < l; j += BS1)
+        {
+            x[j * lda] = conj(x[j * lda]);
+            s += std::norm(x[j * lda]);
+        }
+        sval[tid] = s;
+        __syncthreads();
+
+        for(rocblas_int j = BS1 / 2; j > 0; j /= 2)
+        {
+            if(tid < j)
+                sval[tid] += sval[tid + j];
+            __syncthreads();
+        }
+
+        // generate the Householder reflector
+        if(tid == 0)
+        {
+            T alpha = conj(A[i + i * lda]);
+            if(sval[0] == 0 && std::imag(alpha) == 0)
+            {
+                tau_s = 0;
+                scal_s = 1;
+            }
+            else
+            {
+                S beta = -copysign(sqrt(std::norm(alpha) + sval[0]), std::real(alpha));
+                tau_s = (T(beta) - alpha) / T(beta);
+                scal_s = T(1) / (alpha - T(beta));
+                alpha = T(beta);
+            }
+            tau[i] = tau_s;
+            A[i + i * lda] = conj(alpha);
+        }
+        __syncthreads();
+
+        T t = tau_s;
+        T scal = scal_s;
+        for(rocblas_int j = tid; j < l; j += BS1)
+            x[j * lda] *= scal;
+        __syncthreads();
+
+        // apply the reflector from the right to the rows above
+        for(rocblas_int p = tid; p < i; p += BS1)
+        {
+            T w = A[p + i * lda];
+            for(rocblas_int j = 0; j < l; j++)
+                w += A[p + (r + j) * lda] * x[j * lda];
+
+            A[p + i * lda] -= t * w;
+            for(rocblas_int j = 0; j < l; j++)
+                A[p + (r + j) * lda] -= t * w * conj(x[j * lda]);
+        }
+        __syncthreads();
+    }
+}
+
+/** GELSY_ORMRZ overwrites X with Z' * X, where Z is the orthogonal/unitary matrix
+    computed by GELSY_TZRZ (equivalent to LAPACK's ORMRZ/UNMRZ with side = left and
+    trans = transpose/conjugate transpose).
+
+    Call this kernel with nrhs groups in x, batch_count groups in y, and BS1 threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gelsy_ormrz(const rocblas_int n,
+                                                         U AA,
+                                                         const rocblas_int shiftA,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         const rocblas_int* rankA,
+                                                         T* tauA,
+                                                         const rocblas_stride strideT,
+                                                         T* XX,
+                                                         const rocblas_int ldx,
+                                                         const rocblas_stride strideX)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_x;
+    rocblas_int b = hipBlockIdx_y;
+
+    const rocblas_int r = rankA[b];
+    const rocblas_int l = n - r;
+
+    if(r == 0 || l == 0)
+        return;
+
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* tau = tauA + b * strideT;
+    T* x = XX + b * strideX + j * ldx;
+
+    // shared memory
+    __shared__ T sval[BS1];
+
+    for(rocblas_int i = 0; i < r; i++)
+    {
+        T* v = A + i + r * lda;
+
+        T s = 0;
+        for(rocblas_int k = tid; k < l; k += BS1)
+            s += conj(v[k * lda]) * x[r + k];
+        sval[tid] = s;
+        __syncthreads();
+
+        for(rocblas_int k = BS1 / 2; k > 0; k /= 2)
+        {
+            if(tid < k)
+                sval[tid] += sval[tid + k];
+            __syncthreads();
+        }
+
+        T w = tau[i] * (x[i] + sval[0]);
+        __syncthreads();
+
+        if(tid == 0)
+            x[i] -= w;
+        for(rocblas_int k = tid; k < l; k += BS1)
+            x[r + k] -= w * v[k * lda];
+        __syncthreads();
+    }
+}
+
+/** GELSY_SET_TRIANGULAR copies the leading rank-by-rank upper triangular factor of A into
+    the k-by-k matrix Tw, completing it with the identity.
+
+    Call this kernel with enough groups to cover k rows in x, k columns in y, and
+    batch_count groups in z. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_set_triangular(const rocblas_int k,
+                                           U AA,
+                                           const rocblas_int shiftA,
+                                           const rocblas_int lda,
+                                           const rocblas_stride strideA,
+                                           const rocblas_int* rankA,
+                                           T* TwA)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < k && j < k)
+    {
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        T* Tw = TwA + b * k * k;
+        const rocblas_int r = rankA[b];
+
+        if(i <= j && j < r)
+            Tw[i + j * k] = A[i + j * lda];
+        else
+            Tw[i + j * k] = T(i == j ? 1 : 0);
+    }
+}
+
+/** GELSY_COPY_RHS copies the leading rank rows of B into the n-by-nrhs matrix X,
+    and zeroes the remaining rows.
+
+    Call this kernel with enough groups to cover n rows in x, nrhs columns in y, and
+    batch_count groups in z. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_copy_rhs(const rocblas_int n,
+                                     const rocblas_int nrhs,
+                                     U BB,
+                                     const rocblas_int shiftB,
+                                     const rocblas_int ldb,
+                                     const rocblas_stride strideB,
+                                     const rocblas_int* rankA,
+                                     T* XX)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < nrhs)
+    {
+        T* B = load_ptr_batch<T>(BB, b, shiftB, strideB);
+        T* X = XX + b * n * nrhs;
+
+        X[i + j * n] = (i < rankA[b]) ? B[i + j * ldb] : T(0);
+    }
+}
+
+/** GELSY_PERMUTE_SOLUTION writes the rows of X into B following the column permutation
+    given by jpvt, i.e. B(jpvt[i]-1, :) = X(i, :).
+
+    Call this kernel with enough groups to cover n rows in x, nrhs columns in y, and
+    batch_count groups in z. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_permute_solution(const rocblas_int n,
+                                             const rocblas_int nrhs,
+                                             T* XX,
+                                             const rocblas_int* jpvtA,
+                                             const rocblas_stride strideJ,
+                                             U BB,
+                                             const rocblas_int shiftB,
+                                             const rocblas_int ldb,
+                                             const rocblas_stride strideB)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < nrhs)
+    {
+        T* B = load_ptr_batch<T>(BB, b, shiftB, strideB);
+        T* X = XX + b * n * nrhs;
+        const rocblas_int* jpvt = jpvtA + b * strideJ;
+
+        B[(jpvt[i] - 1) + j * ldb] = X[i + j * n];
+    }
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S>
+void rocsolver_gelsy_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_x_temp,
+                                   size_t* size_workArr_temp_arr,
+                                   size_t* size_diag_trfac_invA,
+                                   size_t* size_F_trfact_workTrmm_invA_arr,
+                                   size_t* size_auxv,
+                                   size_t* size_vnorms,
+                                   size_t* size_done,
+                                   size_t* size_tau,
+                                   size_t* size_Tw,
+                                   size_t* size_X,
+                                   bool* optim_mem)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_x_temp = 0;
+        *size_workArr_temp_arr = 0;
+        *size_diag_trfac_invA = 0;
+        *size_F_trfact_workTrmm_invA_arr = 0;
+        *size_auxv = 0;
+        *size_vnorms = 0;
+        *size_done = 0;
+        *size_tau = 0;
+        *size_Tw = 0;
+        *size_X = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    const rocblas_int k = std::min(m, n);
+    size_t geqp3_work, geqp3_norms, geqp3_diag, geqp3_F;
+    size_t ormqr_scalars, ormqr_work, ormqr_workArr, ormqr_trfact, ormqr_workTrmm;
+    size_t trsm_x_temp = 0, trsm_x_temp_arr = 0, trsm_invA = 0, trsm_invA_arr = 0;
+
+    // requirements for calling GEQP3
+    rocsolver_geqp3_getMemorySize<BATCHED, T, S>(m, n, batch_count, size_scalars, &geqp3_work,
+                                                 &geqp3_norms, &geqp3_diag, &geqp3_F, size_auxv,
+                                                 size_vnorms, size_done);
+
+    // requirements for calling ORMQR/UNMQR
+    rocsolver_ormqr_unmqr_getMemorySize<BATCHED, T>(rocblas_side_left, m, nrhs, k, batch_count,
+                                                    &ormqr_scalars, &ormqr_work, &ormqr_workArr,
+                                                    &ormqr_trfact, &ormqr_workTrmm);
+
+    // requirements for calling TRSM
+    *optim_mem = true;
+    if(nrhs > 0)
+        rocsolver_trsm_mem<false, true, T>(rocblas_side_left, rocblas_operation_none, k, nrhs,
+                                           batch_count, &trsm_x_temp, &trsm_x_temp_arr, &trsm_invA,
+                                           &trsm_invA_arr, optim_mem);
+
+    // get max values
+    *size_work_x_temp = std::max({geqp3_work, ormqr_work, trsm_x_temp});
+    *size_workArr_temp_arr = std::max({geqp3_norms, ormqr_workArr, trsm_x_temp_arr});
+    *size_diag_trfac_invA = std::max({geqp3_diag, ormqr_trfact, trsm_invA});
+    *size_F_trfact_workTrmm_invA_arr = std::max({geqp3_F, ormqr_workTrmm, trsm_invA_arr});
+
+    // size of the Householder scalars of the QR and RZ factorizations
+    *size_tau = sizeof(T) * 2 * k * batch_count;
+
+    // size of the triangular factor and the intermediate solution
+    *size_Tw = (nrhs > 0) ? sizeof(T) * k * k * batch_count : 0;
+    *size_X = sizeof(T) * n * nrhs * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_gelsy_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        T A,
+                                        const rocblas_int lda,
+                                        T B,
+                                        const rocblas_int ldb,
+                                        rocblas_int* jpvt,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || ((m * nrhs || n * nrhs) && !B) || (n && !jpvt) || (batch_count && !rank))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gelsy_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        const S rcond,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_x_temp,
+                                        void* workArr_temp_arr,
+                                        void* diag_trfac_invA,
+                                        void* F_trfact_workTrmm_invA_arr,
+                                        T* auxv,
+                                        S* vnorms,
+                                        rocblas_int* done,
+                                        T* tau,
+                                        T* Tw,
+                                        T* X,
+                                        bool optim_mem)
+{
+    ROCSOLVER_ENTER("gelsy", "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "rcond:", rcond, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if A is empty
+    // (rank = 0, and jpvt is the identity permutation)
+    if(m == 0 || n == 0)
+    {
+        rocsolver_geqp3_template<BATCHED, STRIDED>(
+            handle, m, n, A, shiftA, lda, strideA, jpvt, strideJ, tau, 0, rcond, rank, batch_count,
+            scalars, work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
+            (T*)F_trfact_workTrmm_invA_arr, auxv, vnorms, done);
+
+        rocblas_int rowsB = std::max(m, n);
+        if(nrhs > 0)
+        {
+            rocblas_int blocksx = (rowsB - 1) / 32 + 1;
+            rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
+                                    0, stream, rowsB, nrhs, B, shiftB, ldb, strideB);
+        }
+
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants in host memory
+    const rocblas_int k = std::min(m, n);
+    const rocblas_stride strideP = k;
+    T* tauQ = tau;
+    T* tauZ = tau + k * batch_count;
+
+    // compute QR factorization with column pivoting of A, determining the numerical rank
+    // (the factorization stops as soon as the rank is known)
+    rocsolver_geqp3_template<BATCHED, STRIDED>(
+        handle, m, n, A, shiftA, lda, strideA, jpvt, strideJ, tauQ, strideP, rcond, rank,
+        batch_count, scalars, work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
+        (T*)F_trfact_workTrmm_invA_arr, auxv, vnorms, done);
+
+    // reduce R(0:rank-1, 0:n-1) to triangular form, i.e. R = [T 0] Z
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_tzrz<T, S>), dim3(batch_count), dim3(BS1), 0, stream, n, A,
+                            shiftA, lda, strideA, rank, tauZ, strideP);
+
+    if(nrhs > 0)
+    {
+        const rocblas_int blocksk = (k - 1) / 32 + 1;
+        const rocblas_int blocksn = (n - 1) / 32 + 1;
+        const rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+
+        // B = Q' * B
+        rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+            handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, k, A, shiftA,
+            lda, strideA, tauQ, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
+            (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
+            (T**)F_trfact_workTrmm_invA_arr);
+
+        // solve T * Y = B(0:rank-1, :), with Y(rank:n-1, :) = 0
+        // (T is completed with the identity so that the same triangular solve can be used
+        // for all the matrices in the batch, regardless of their rank)
+        ROCSOLVER_LAUNCH_KERNEL((gelsy_set_triangular<T>), dim3(blocksk, blocksk, batch_count),
+                                dim3(32, 32), 0, stream, k, A, shiftA, lda, strideA, rank, Tw);
+        ROCSOLVER_LAUNCH_KERNEL((gelsy_copy_rhs<T>), dim3(blocksn, blocksy, batch_count),
+                                dim3(32, 32), 0, stream, n, nrhs, B, shiftB, ldb, strideB, rank, X);
+
+        rocsolver_trsm_upper<false, true, T>(
+            handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, k, nrhs,
+            Tw, 0, k, k * k, X, 0, n, n * nrhs, batch_count, optim_mem, work_x_temp,
+            workArr_temp_arr, diag_trfac_invA, F_trfact_workTrmm_invA_arr);
+
+        // X = Z' * Y
+        ROCSOLVER_LAUNCH_KERNEL((gelsy_ormrz<T>), dim3(nrhs, batch_count), dim3(BS1), 0, stream, n,
+                                A, shiftA, lda, strideA, rank, tauZ, strideP, X, n, n * nrhs);
+
+        // B = P * X
+        ROCSOLVER_LAUNCH_KERNEL((gelsy_permute_solution<T>), dim3(blocksn, blocksy, batch_count),
+                                dim3(32, 32), 0, stream, n, nrhs, X, jpvt, strideJ, B, shiftB, ldb,
+                                strideB);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -127,10 +127,10 @@ rocblas_status rocsolver_geqlf_template(rocblas_handle handle,
         if(n - k + j > 0)
         {
             // compute block reflector
-            rocsolver_larft_template<T>(handle, rocblas_backward_direction, rocblas_column_wise,
-                                        m - k + j + jb, jb, A, shiftA + idx2D(0, n - k + j, lda),
-                                        lda, strideA, (ipiv + j), strideP, Abyx_norms_trfact, ldw,
-                                        strideW, batch_count, scalars, (T*)work_workArr, workArr);
+            rocsolver_larft_template<BATCHED, STRIDED, T>(
+                handle, rocblas_backward_direction, rocblas_column_wise, m - k + j + jb, jb, A,
+                shiftA + idx2D(0, n - k + j, lda), lda, strideA, (ipiv + j), strideP,
+                Abyx_norms_trfact, ldw, strideW, batch_count, scalars, (T*)work_workArr, workArr);
 
             // apply the block reflector
             rocsolver_larfb_template<BATCHED, STRIDED, T>(
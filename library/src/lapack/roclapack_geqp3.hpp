@@ -0,0 +1,576 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lacgv.hpp"
+#include "auxiliary/rocauxiliary_larfg.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** GEQP3_INIT_JPVT sets the initial column permutation to the identity.
+
+    Call this kernel with ceil(n / BS1) groups in x, batch_count groups in y,
+    and BS1 threads in x. **/
+template <typename I>
+ROCSOLVER_KERNEL void geqp3_init_jpvt(const I n, I* jpvtA, const rocblas_stride strideJ)
+{
+    I j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int b = hipBlockIdx_y;
+
+    if(j < n)
+        jpvtA[b * strideJ + j] = j + 1;
+}
+
+/** GEQP3_INIT_NORMS computes the initial norms of the columns of A. It also initializes
+    the numerical rank of every matrix in the batch, and the counter of matrices
+    for which the rank has been determined.
+
+    Call this kernel with n groups in x, batch_count groups in y, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqp3_init_norms(const rocblas_int m,
+                                                              const rocblas_int n,
+                                                              const rocblas_int dim,
+                                                              U AA,
+                                                              const rocblas_int shiftA,
+                                                              const rocblas_int lda,
+                                                              const rocblas_stride strideA,
+                                                              S* vn1A,
+                                                              S* vn2A,
+                                                              rocblas_int* rank,
+                                                              rocblas_int* done)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_x;
+    rocblas_int b = hipBlockIdx_y;
+
+    T* a = load_ptr_batch<T>(AA, b, shiftA, strideA) + j * lda;
+
+    // shared memory
+    __shared__ S sval[BS1];
+
+    S s = 0;
+    for(rocblas_int i = tid; i < m; i += BS1)
+        s += std::norm(a[i]);
+    sval[tid] = s;
+    __syncthreads();
+
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+            sval[tid] += sval[tid + i];
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        s = sqrt(sval[0]);
+        vn1A[b * n + j] = s;
+        vn2A[b * n + j] = s;
+
+        if(j == 0)
+        {
+            rank[b] = dim;
+            if(b == 0)
+                done[0] = 0;
+        }
+    }
+}
+
+/** GEQP3_PIVOT selects the pivot column for step i (the k-th step of the current panel
+    starting at column offset), as the remaining column with the largest norm. It
+    then interchanges the pivot column with column i, updating jpvt, the partial
+    column norms and the rows of the auxiliary matrix F accordingly, and sets to zero
+    the first k+1 entries of the k-th column of F.
+    The numerical rank is also determined here: if the norm of the pivot column is not
+    larger than tol times the norm of the first pivot column, the rank is set to i.
+
+    Call this kernel with batch_count groups in x, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqp3_pivot(const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         const rocblas_int dim,
+                                                         const rocblas_int i,
+                                                         const rocblas_int k,
+                                                         const rocblas_int offset,
+                                                         U AA,
+                                                         const rocblas_int shiftA,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_int* jpvtA,
+                                                         const rocblas_stride strideJ,
+                                                         T* FA,
+                                                         const rocblas_int ldf,
+                                                         const rocblas_stride strideF,
+                                                         S* vn1A,
+                                                         S* vn2A,
+                                                         S* nrmref,
+                                                         const S tol,
+                                                         rocblas_int* rank,
+                                                         rocblas_int* done)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int b = hipBlockIdx_x;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* F = FA + b * strideF;
+    rocblas_int* jpvt = jpvtA + b * strideJ;
+    S* vn1 = vn1A + b * n;
+    S* vn2 = vn2A + b * n;
+
+    // shared memory
+    __shared__ S sval[BS1];
+    __shared__ rocblas_int sidx[BS1];
+
+    // find the remaining column with the largest norm
+    // (the first one in case of ties)
+    S v, vmax = -1;
+    rocblas_int jmax = i;
+    for(rocblas_int j = i + tid; j < n; j += BS1)
+    {
+        v = vn1[j];
+        if(v > vmax)
+        {
+            vmax = v;
+            jmax = j;
+        }
+    }
+    sval[tid] = vmax;
+    sidx[tid] = jmax;
+    __syncthreads();
+
+    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+        {
+            if(sval[tid + r] > sval[tid]
+               || (sval[tid + r] == sval[tid] && sidx[tid + r] < sidx[tid]))
+            {
+                sval[tid] = sval[tid + r];
+                sidx[tid] = sidx[tid + r];
+            }
+        }
+        __syncthreads();
+    }
+
+    vmax = sval[0];
+    rocblas_int p = sidx[0];
+
+    // interchange columns and rows of F if needed
+    if(p != i)
+    {
+        for(rocblas_int r = tid; r < m; r += BS1)
+            swap(A[r + p * lda], A[r + i * lda]);
+        for(rocblas_int c = tid; c < k; c += BS1)
+            swap(F[(p - offset) + c * ldf], F[(i - offset) + c * ldf]);
+    }
+
+    // padding of F
+    for(rocblas_int r = tid; r <= k; r += BS1)
+        F[r + k * ldf] = 0;
+
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        if(p != i)
+        {
+            swap(jpvt[p], jpvt[i]);
+            vn1[p] = vn1[i];
+            vn2[p] = vn2[i];
+        }
+
+        // determine numerical rank
+        if(i == 0)
+            nrmref[b] = vmax;
+        if(rank[b] == dim && !(vmax > tol * nrmref[b]))
+        {
+            rank[b] = i;
+            atomicAdd(done, 1);
+        }
+    }
+}
+
+/** GEQP3_NORMS updates the partial norms of the remaining columns after step i
+    (the k-th step of the current panel starting at column offset).
+    When the downdating formula becomes unreliable due to cancellation, the norm is
+    recomputed from the current (lazily updated) trailing part of the column,
+    A(i+1:m-1, j) - V(i+1:m-1, 0:k) * F(j-offset, 0:k)'.
+
+    Call this kernel with n-i-1 groups in x, batch_count groups in y, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqp3_norms(const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         const rocblas_int i,
+                                                         const rocblas_int k,
+                                                         const rocblas_int offset,
+                                                         U AA,
+                                                         const rocblas_int shiftA,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         T* FA,
+                                                         const rocblas_int ldf,
+                                                         const rocblas_stride strideF,
+                                                         S* vn1A,
+                                                         S* vn2A,
+                                                         const S tol3z)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int j = i + 1 + hipBlockIdx_x;
+    rocblas_int b = hipBlockIdx_y;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+    T* F = FA + b * strideF;
+    S* vn1 = vn1A + b * n;
+    S* vn2 = vn2A + b * n;
+
+    // shared memory
+    __shared__ S sval[BS1];
+
+    S nrm1 = vn1[j];
+    S nrm2 = vn2[j];
+    __syncthreads();
+
+    if(nrm1 == 0)
+        return;
+
+    S temp = std::abs(A[i + j * lda]) / nrm1;
+    temp = (1 + temp) * (1 - temp);
+    temp = temp > 0 ? temp : S(0);
+    S temp2 = temp * (nrm1 / nrm2) * (nrm1 / nrm2);
+
+    if(temp2 > tol3z)
+    {
+        // downdate the norm
+        if(tid == 0)
+            vn1[j] = nrm1 * sqrt(temp);
+        return;
+    }
+
+    // recompute the norm
+    S s = 0;
+    T aij;
+    for(rocblas_int r = i + 1 + tid; r < m; r += BS1)
+    {
+        aij = A[r + j * lda];
+        for(rocblas_int c = 0; c <= k; c++)
+            aij -= A[r + (offset + c) * lda] * conj(F[(j - offset) + c * ldf]);
+        s += std::norm(aij);
+    }
+    sval[tid] = s;
+    __syncthreads();
+
+    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            sval[tid] += sval[tid + r];
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        s = sqrt(sval[0]);
+        vn1[j] = s;
+        vn2[j] = s;
+    }
+}
+
+template <bool BATCHED, typename T, typename S>
+void rocsolver_geqp3_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_norms,
+                                   size_t* size_diag,
+                                   size_t* size_F,
+                                   size_t* size_auxv,
+                                   size_t* size_vnorms,
+                                   size_t* size_done)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_norms = 0;
+        *size_diag = 0;
+        *size_F = 0;
+        *size_auxv = 0;
+        *size_vnorms = 0;
+        *size_done = 0;
+        return;
+    }
+
+    rocblas_int nb = min(min(m, n), GEQP3_BLOCKSIZE);
+
+    // size of scalars (constants) for rocblas calls
+    *size_scalars = sizeof(T) * 3;
+
+    // size_work_workArr is maximum of re-usable work space for larfg and array of pointers
+    // to workspace
+    size_t w1, w2 = 0;
+    rocsolver_larfg_getMemorySize<T>(m, batch_count, &w1, size_norms);
+    if(BATCHED)
+        w2 = sizeof(T*) * batch_count;
+    *size_work_workArr = max(w1, w2);
+
+    // size of array to store temporary diagonal values
+    *size_diag = sizeof(T) * batch_count;
+
+    // size of the auxiliary matrix F and vector auxv of the panel factorization
+    *size_F = sizeof(T) * n * nb * batch_count;
+    *size_auxv = sizeof(T) * nb * batch_count;
+
+    // size of the partial column norms, and reference norms for the rank determination
+    *size_vnorms = sizeof(S) * (2 * n + 1) * batch_count;
+
+    // size of the counter of problems with determined rank
+    *size_done = sizeof(rocblas_int);
+}
+
+template <typename T, typename U, typename V>
+rocblas_status rocsolver_geqp3_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        U jpvt,
+                                        V ipiv,
+                                        U rank,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || (n && !jpvt) || (m * n && !ipiv) || (batch_count && !rank))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED,
+          bool STRIDED,
+          typename T,
+          typename S,
+          typename U,
+          bool COMPLEX = rocblas_is_complex<T>>
+rocblas_status rocsolver_geqp3_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        T* ipiv,
+                                        const rocblas_stride strideP,
+                                        const S tol,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* norms,
+                                        T* diag,
+                                        T* F,
+                                        T* auxv,
+                                        S* vnorms,
+                                        rocblas_int* done)
+{
+    ROCSOLVER_ENTER("geqp3", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    rocblas_int blocksJ = (n - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return
+    if(m == 0 || n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, rank, batch_count, 0);
+        if(n > 0)
+            ROCSOLVER_LAUNCH_KERNEL(geqp3_init_jpvt<rocblas_int>, dim3(blocksJ, batch_count),
+                                    threads, 0, stream, n, jpvt, strideJ);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the device
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+
+    rocblas_int dim = min(m, n); // total number of pivots
+    rocblas_int nb = min(dim, GEQP3_BLOCKSIZE);
+    rocblas_int ldf = n;
+    rocblas_stride strideF = rocblas_stride(ldf) * nb;
+    S* vn1 = vnorms;
+    S* vn2 = vnorms + n * batch_count;
+    S* nrmref = vnorms + 2 * n * batch_count;
+    const S tol3z = sqrt(get_epsilon<S>());
+    T** workArr = (T**)work_workArr;
+
+    // compute initial column norms
+    ROCSOLVER_LAUNCH_KERNEL(geqp3_init_jpvt<rocblas_int>, dim3(blocksJ, batch_count), threads, 0,
+                            stream, n, jpvt, strideJ);
+    ROCSOLVER_LAUNCH_KERNEL((geqp3_init_norms<T, S>), dim3(n, batch_count), threads, 0, stream, m,
+                            n, dim, A, shiftA, lda, strideA, vn1, vn2, rank, done);
+
+    rocblas_int offset, kb, nn, i;
+    for(offset = 0; offset < dim; offset += nb)
+    {
+        // the panel factorization uses the auxiliary matrix F (with the last nn columns
+        // of A as its rows) to defer the update of the trailing matrix, as in LAPACK's xLAQPS
+        kb = min(dim - offset, nb);
+        nn = n - offset;
+
+        for(rocblas_int k = 0; k < kb; ++k)
+        {
+            i = offset + k;
+
+            // determine pivot column and swap if necessary
+            ROCSOLVER_LAUNCH_KERNEL((geqp3_pivot<T, S>), dim3(batch_count), threads, 0, stream, m,
+                                    n, dim, i, k, offset, A, shiftA, lda, strideA, jpvt, strideJ,
+                                    F, ldf, strideF, vn1, vn2, nrmref, tol, rank, done);
+
+            // apply previous reflectors to the pivot column
+            if(k > 0)
+            {
+                if(COMPLEX)
+                    rocsolver_lacgv_template<T>(handle, k, F, k, ldf, strideF, batch_count);
+
+                rocblasCall_gemv<T>(handle, rocblas_operation_none, m - i, k,
+                                    cast2constType<T>(scalars), 0, A,
+                                    shiftA + idx2D(i, offset, lda), lda, strideA, F, k, ldf,
+                                    strideF, cast2constType<T>(scalars + 2), 0, A,
+                                    shiftA + idx2D(i, i, lda), 1, strideA, batch_count, workArr);
+
+                if(COMPLEX)
+                    rocsolver_lacgv_template<T>(handle, k, F, k, ldf, strideF, batch_count);
+            }
+
+            // generate Householder reflector to work on column i
+            rocsolver_larfg_template(handle, m - i, A, shiftA + idx2D(i, i, lda), A,
+                                     shiftA + idx2D(min(i + 1, m - 1), i, lda), 1, strideA,
+                                     (ipiv + i), strideP, batch_count, (T*)work_workArr, norms);
+
+            // insert one in A(i,i) to build/apply the householder matrix
+            ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
+                                    diag, 0, 1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1,
+                                    true);
+
+            // compute the k-th column of F:
+            // F(k+1:nn-1,k) = tau * A(i:m-1,i+1:n-1)' * v
+            if(i < n - 1)
+                rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, m - i, n - i - 1,
+                                    cast2constType<T>(ipiv + i), strideP, A,
+                                    shiftA + idx2D(i, i + 1, lda), lda, strideA, A,
+                                    shiftA + idx2D(i, i, lda), 1, strideA,
+                                    cast2constType<T>(scalars + 1), 0, F, idx2D(k + 1, k, ldf), 1,
+                                    strideF, batch_count, workArr);
+
+            // incremental update of F:
+            // F(0:nn-1,k) = F(0:nn-1,k) - F(0:nn-1,0:k-1) * (tau * A(i:m-1,offset:i-1)' * v)
+            if(k > 0)
+            {
+                rocblasCall_gemv<T>(handle, rocblas_operation_conjugate_transpose, m - i, k,
+                                    cast2constType<T>(ipiv + i), strideP, A,
+                                    shiftA + idx2D(i, offset, lda), lda, strideA, A,
+                                    shiftA + idx2D(i, i, lda), 1, strideA,
+                                    cast2constType<T>(scalars + 1), 0, auxv, 0, 1, nb, batch_count,
+                                    workArr);
+
+                rocblasCall_gemv<T>(handle, rocblas_operation_none, nn, k,
+                                    cast2constType<T>(scalars), 0, F, 0, ldf, strideF, auxv, 0, 1,
+                                    nb, cast2constType<T>(scalars + 2), 0, F, idx2D(0, k, ldf), 1,
+                                    strideF, batch_count, workArr);
+            }
+
+            if(i < n - 1)
+            {
+                // update the current row of A:
+                // A(i,i+1:n-1) = A(i,i+1:n-1) - A(i,offset:i) * F(k+1:nn-1,0:k)'
+                rocblasCall_gemm<BATCHED, STRIDED, T>(
+                    handle, rocblas_operation_none, rocblas_operation_conjugate_transpose, 1,
+                    n - i - 1, k + 1, cast2constType<T>(scalars), A,
+                    shiftA + idx2D(i, offset, lda), lda, strideA, F, idx2D(k + 1, 0, ldf), ldf,
+                    strideF, cast2constType<T>(scalars + 2), A, shiftA + idx2D(i, i + 1, lda), lda,
+                    strideA, batch_count, workArr);
+
+                // update partial column norms
+                ROCSOLVER_LAUNCH_KERNEL((geqp3_norms<T, S>), dim3(n - i - 1, batch_count), threads,
+                                        0, stream, m, n, i, k, offset, A, shiftA, lda, strideA, F,
+                                        ldf, strideF, vn1, vn2, tol3z);
+            }
+
+            // restore original value of A(i,i)
+            ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
+                                    stream, diag, 0, 1, A, shiftA + idx2D(i, i, lda), lda, strideA,
+                                    1);
+        }
+
+        // apply the block reflector to the rest of the matrix:
+        // A(i:m-1,i:n-1) = A(i:m-1,i:n-1) - A(i:m-1,offset:i-1) * F(kb:nn-1,0:kb-1)'
+        i = offset + kb;
+        if(i < m && i < n)
+            rocblasCall_gemm<BATCHED, STRIDED, T>(
+                handle, rocblas_operation_none, rocblas_operation_conjugate_transpose, m - i,
+                n - i, kb, cast2constType<T>(scalars), A, shiftA + idx2D(i, offset, lda), lda,
+                strideA, F, idx2D(kb, 0, ldf), ldf, strideF, cast2constType<T>(scalars + 2), A,
+                shiftA + idx2D(i, i, lda), lda, strideA, batch_count, workArr);
+
+        // in truncated mode, stop when the rank of all the matrices in the batch
+        // has been determined
+        if(tol > 0 && i < dim)
+        {
+            rocblas_int h_done = 0;
+            hipError_t status = hipMemcpyAsync(&h_done, done, sizeof(rocblas_int),
+                                               hipMemcpyDeviceToHost, stream);
+            if(status != hipSuccess)
+                return get_rocblas_status_for_hip_status(status);
+
+            status = hipStreamSynchronize(stream);
+            if(status != hipSuccess)
+                return get_rocblas_status_for_hip_status(status);
+
+            if(h_done == batch_count)
+            {
+                // no more reflectors are computed; the trailing matrix
+                // A(i:m-1,i:n-1) contains the residual
+                ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<T>,
+                                        dim3((dim - i - 1) / BS1 + 1, batch_count), threads, 0,
+                                        stream, ipiv + i, strideP, dim - i, 0);
+                break;
+            }
+        }
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
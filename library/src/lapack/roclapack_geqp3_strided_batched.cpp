@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_geqp3.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_geqp3_strided_batched_impl(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    U A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    rocblas_int* jpvt,
+                                                    const rocblas_stride strideJ,
+                                                    T* ipiv,
+                                                    const rocblas_stride strideP,
+                                                    const S tol,
+                                                    rocblas_int* rank,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("geqp3_strided_batched", "-m", m, "-n", n, "--lda", lda, "--strideA",
+                        strideA, "--strideJ", strideJ, "--strideP", strideP, "--tol", tol,
+                        "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geqp3_argCheck(handle, m, n, lda, A, jpvt, ipiv, rank,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases) and re-usable workspace
+    size_t size_work_workArr;
+    // extra requirements for calling LARFG
+    size_t size_norms, size_diag;
+    // size of the auxiliary matrix and vector of the panel factorization
+    size_t size_F, size_auxv;
+    // size of the partial column norms and the rank determination
+    size_t size_vnorms, size_done;
+    rocsolver_geqp3_getMemorySize<false, T, S>(m, n, batch_count, &size_scalars, &size_work_workArr,
+                                               &size_norms, &size_diag, &size_F, &size_auxv,
+                                               &size_vnorms, &size_done);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+                                                      size_norms, size_diag, size_F, size_auxv,
+                                                      size_vnorms, size_done);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *norms, *diag, *F, *auxv, *vnorms, *done;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_norms, size_diag,
+                              size_F, size_auxv, size_vnorms, size_done);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    norms = mem[2];
+    diag = mem[3];
+    F = mem[4];
+    auxv = mem[5];
+    vnorms = mem[6];
+    done = mem[7];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_geqp3_template<false, true, T>(handle, m, n, A, shiftA, lda, strideA, jpvt,
+                                                    strideJ, ipiv, strideP, tol, rank, batch_count,
+                                                    (T*)scalars, work_workArr, (T*)norms, (T*)diag,
+                                                    (T*)F, (T*)auxv, (S*)vnorms,
+                                                    (rocblas_int*)done);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_sgeqp3_strided_batched(rocblas_handle handle,
+                                                           const rocblas_int m,
+                                                           const rocblas_int n,
+                                                           float* A,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           rocblas_int* jpvt,
+                                                           const rocblas_stride strideJ,
+                                                           float* ipiv,
+                                                           const rocblas_stride strideP,
+                                                           const float tol,
+                                                           rocblas_int* rank,
+                                                           const rocblas_int batch_count)
+{
+    return rocsolver_geqp3_strided_batched_impl<float>(handle, m, n, A, lda, strideA, jpvt, strideJ,
+                                                       ipiv, strideP, tol, rank, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_dgeqp3_strided_batched(rocblas_handle handle,
+                                                           const rocblas_int m,
+                                                           const rocblas_int n,
+                                                           double* A,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           rocblas_int* jpvt,
+                                                           const rocblas_stride strideJ,
+                                                           double* ipiv,
+                                                           const rocblas_stride strideP,
+                                                           const double tol,
+                                                           rocblas_int* rank,
+                                                           const rocblas_int batch_count)
+{
+    return rocsolver_geqp3_strided_batched_impl<double>(handle, m, n, A, lda, strideA, jpvt,
+                                                        strideJ, ipiv, strideP, tol, rank,
+                                                        batch_count);
+}
+
+extern "C" rocblas_status rocsolver_cgeqp3_strided_batched(rocblas_handle handle,
+                                                           const rocblas_int m,
+                                                           const rocblas_int n,
+                                                           rocblas_float_complex* A,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           rocblas_int* jpvt,
+                                                           const rocblas_stride strideJ,
+                                                           rocblas_float_complex* ipiv,
+                                                           const rocblas_stride strideP,
+                                                           const float tol,
+                                                           rocblas_int* rank,
+                                                           const rocblas_int batch_count)
+{
+    return rocsolver_geqp3_strided_batched_impl<rocblas_float_complex>(handle, m, n, A, lda,
+                                                                       strideA, jpvt, strideJ, ipiv,
+                                                                       strideP, tol, rank,
+                                                                       batch_count);
+}
+
+extern "C" rocblas_status rocsolver_zgeqp3_strided_batched(rocblas_handle handle,
+                                                           const rocblas_int m,
+                                                           const rocblas_int n,
+                                                           rocblas_double_complex* A,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           rocblas_int* jpvt,
+                                                           const rocblas_stride strideJ,
+                                                           rocblas_double_complex* ipiv,
+                                                           const rocblas_stride strideP,
+                                                           const double tol,
+                                                           rocblas_int* rank,
+                                                           const rocblas_int batch_count)
+{
+    return rocsolver_geqp3_strided_batched_impl<rocblas_double_complex>(handle, m, n, A, lda,
+                                                                        strideA, jpvt, strideJ,
+                                                                        ipiv, strideP, tol, rank,
+                                                                        batch_count);
+}
@@ -12,9 +12,56 @@
 #include "auxiliary/rocauxiliary_lacgv.hpp"
 #include "auxiliary/rocauxiliary_larf.hpp"
 #include "auxiliary/rocauxiliary_larfg.hpp"
+#include "lapack_device_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
 
+/** GEQR2_SMALL_KERNEL computes the QR factorization of a small m-by-n matrix A, with
+    m <= GEQR2_SMALL_MAX_ROWS and n <= GEQR2_SMALL_MAX_COLS, using a single work-group per matrix.
+    The current Householder vector is kept in shared memory while it is applied to the trailing
+    columns; every column of the trailing matrix is updated by BS1 / GEQR2_SMALL_MAX_COLS threads.
+
+    Call this kernel with batch_count groups in y, and BS1 threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqr2_small_kernel(const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                U AA,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                T* ipivA,
+                                                                const rocblas_stride strideP)
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* ipiv = ipivA + bid * strideP;
+
+    // shared memory
+    __shared__ S sval[BS1];
+    __shared__ T sw[BS1];
+    __shared__ T sv[GEQR2_SMALL_MAX_ROWS];
+    __shared__ T tau_s;
+    __shared__ T scal_s;
+
+    rocblas_int dim = min(m, n);
+    for(rocblas_int j = 0; j < dim; j++)
+    {
+        // generate the Householder reflector (as in LARFG)
+        larfg_col<BS1>(tid, m, j, A, lda, sval, sv, &tau_s, &scal_s);
+        if(tid == 0)
+            ipiv[j] = tau_s;
+
+        // apply H(j)' to A(j:m-1, j+1:n-1) from the left
+        larf_col<BS1, GEQR2_SMALL_MAX_COLS>(tid, m, j, sv, tau_s, A + (j + 1) * lda, lda,
+                                            n - j - 1, sw);
+    }
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_geqr2_getMemorySize(const rocblas_int m,
                                    const rocblas_int n,
@@ -101,6 +148,14 @@ rocblas_status rocsolver_geqr2_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // if the matrix is small, factorize it with a single kernel
+    if(m <= GEQR2_SMALL_MAX_ROWS && n <= GEQR2_SMALL_MAX_COLS)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(geqr2_small_kernel<T>, dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                                stream, m, n, A, shiftA, lda, strideA, ipiv, strideP);
+        return rocblas_status_success;
+    }
+
     rocblas_int dim = min(m, n); // total number of pivots
 
     for(rocblas_int j = 0; j < dim; ++j)
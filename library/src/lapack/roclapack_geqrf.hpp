@@ -126,10 +126,10 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
         if(j + jb < n)
         {
             // compute block reflector
-            rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise,
-                                        m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                                        (ipiv + j), strideP, Abyx_norms_trfact, ldw, strideW,
-                                        batch_count, scalars, (T*)work_workArr, workArr);
+            rocsolver_larft_template<BATCHED, STRIDED, T>(
+                handle, rocblas_forward_direction, rocblas_column_wise, m - j, jb, A,
+                shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j), strideP, Abyx_norms_trfact,
+                ldw, strideW, batch_count, scalars, (T*)work_workArr, workArr);
 
             // apply the block reflector
             rocsolver_larfb_template<BATCHED, STRIDED, T>(
@@ -0,0 +1,206 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.9.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     November 2019
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_larfb.hpp"
+#include "auxiliary/rocauxiliary_larft.hpp"
+#include "auxiliary/rocauxiliary_org2r_ung2r.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqr2.hpp"
+#include "rocsolver/rocsolver.h"
+
+template <bool BATCHED, typename T>
+void rocsolver_geqrfq_getMemorySize(const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int batch_count,
+                                    size_t* size_scalars,
+                                    size_t* size_work_workArr,
+                                    size_t* size_Abyx_norms,
+                                    size_t* size_diag_tmptr,
+                                    size_t* size_workArr,
+                                    size_t* size_ipiv,
+                                    size_t* size_trfact)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms = 0;
+        *size_diag_tmptr = 0;
+        *size_workArr = 0;
+        *size_ipiv = 0;
+        *size_trfact = 0;
+        return;
+    }
+
+    size_t unused, s1, s2;
+    rocblas_int jb = LARFT_SMALL_MAX_K;
+
+    // requirements for calling GEQR2 with sub blocks
+    rocsolver_geqr2_getMemorySize<BATCHED, T>(m, min(n, jb), batch_count, size_scalars,
+                                              size_work_workArr, size_Abyx_norms, &s1);
+
+    // requirements for calling LARFT
+    rocsolver_larft_getMemorySize<BATCHED, T>(m, min(n, jb), batch_count, &unused, &unused,
+                                              size_workArr);
+
+    // requirements for calling LARFB
+    rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_left, m, max(n - jb, 0), jb,
+                                              batch_count, &s2, &unused);
+
+    *size_diag_tmptr = max(s1, s2);
+
+    // size of workArr is double to accomodate
+    // LARFB's TRMM calls in the batched case
+    if(BATCHED)
+        *size_workArr *= 2;
+
+    // size to store the Householder scalars
+    *size_ipiv = sizeof(T) * n * batch_count;
+
+    // size to keep the triangular factors of all the block reflectors
+    *size_trfact = sizeof(T) * jb * n * batch_count;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrfq_argCheck(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         const rocblas_int lda,
+                                         const rocblas_int ldr,
+                                         T A,
+                                         U R,
+                                         const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || n > m || lda < m || ldr < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || (n && !R))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_geqrfq_template(rocblas_handle handle,
+                                         const rocblas_int m,
+                                         const rocblas_int n,
+                                         U A,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         T* R,
+                                         const rocblas_int ldr,
+                                         const rocblas_stride strideR,
+                                         const rocblas_int batch_count,
+                                         T* scalars,
+                                         void* work_workArr,
+                                         T* Abyx_norms,
+                                         T* diag_tmptr,
+                                         T** workArr,
+                                         T* ipiv,
+                                         T* trfact)
+{
+    ROCSOLVER_ENTER("geqrfq", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "ldr:", ldr,
+                    "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // the factorization and the generation of Q are carried out by blocks of LARFT_SMALL_MAX_K
+    // columns; the triangular factor of every block reflector is kept in trfact, so that
+    // generating Q does not need to call LARFT again
+    rocblas_int nb = LARFT_SMALL_MAX_K;
+    rocblas_int ldw = LARFT_SMALL_MAX_K;
+    rocblas_stride strideW = rocblas_stride(ldw) * n;
+    rocblas_stride strideP = n;
+    rocblas_int jb, j, blocks;
+
+    // factorize A = QR
+    for(j = 0; j < n; j += nb)
+    {
+        jb = min(n - j, nb);
+
+        // factor diagonal and subdiagonal blocks
+        rocsolver_geqr2_template<T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                    (ipiv + j), strideP, batch_count, scalars, work_workArr,
+                                    Abyx_norms, diag_tmptr);
+
+        // compute and keep the block reflector
+        rocsolver_larft_template<BATCHED, STRIDED, T>(
+            handle, rocblas_forward_direction, rocblas_column_wise, m - j, jb, A,
+            shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j), strideP, (trfact + j * ldw), ldw,
+            strideW, batch_count, scalars, (T*)nullptr, workArr);
+
+        // apply the block reflector to the rest of the matrix
+        if(j + jb < n)
+            rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                rocblas_forward_direction, rocblas_column_wise, m - j, n - j - jb, jb, A,
+                shiftA + idx2D(j, j, lda), lda, strideA, trfact, idx2D(0, j, ldw), ldw, strideW, A,
+                shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count, diag_tmptr, workArr);
+    }
+
+    // copy the upper triangular factor R
+    blocks = (n - 1) / 32 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocks, blocks, batch_count), dim3(32, 32), 0, stream,
+                            n, n, R, 0, ldr, strideR, rocblas_fill_upper);
+    ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U, T*>), dim3(blocks, blocks, batch_count), dim3(32, 32),
+                            0, stream, n, n, A, shiftA, lda, strideA, R, 0, ldr, strideR,
+                            no_mask{}, rocblas_fill_upper);
+
+    // overwrite the upper triangular part of A with the identity
+    rocblas_int blocksx = (m - 1) / 32 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(org2r_init_ident<T>, dim3(blocksx, blocks, batch_count), dim3(32, 32),
+                            0, stream, m, n, n, A, shiftA, lda, strideA);
+
+    // generate Q, going through the blocks backwards: apply every block reflector to the columns
+    // already generated, and then form its own columns from the kept triangular factor
+    for(j = ((n - 1) / nb) * nb; j >= 0; j -= nb)
+    {
+        jb = min(n - j, nb);
+
+        // apply current block reflector to Q(j:m,j+jb:n) from the left
+        if(j + jb < n)
+            rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_none, rocblas_forward_direction,
+                rocblas_column_wise, m - j, n - j - jb, jb, A, shiftA + idx2D(j, j, lda), lda,
+                strideA, trfact, idx2D(0, j, ldw), ldw, strideW, A, shiftA + idx2D(j, j + jb, lda),
+                lda, strideA, batch_count, diag_tmptr, workArr);
+
+        // form the columns of the current block
+        ROCSOLVER_LAUNCH_KERNEL(org2r_block_w<T>, dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                                stream, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                (trfact + j * ldw), ldw, strideW);
+
+        blocks = (m - j - 1) / LARFT_SMALL_CHUNK + 1;
+        ROCSOLVER_LAUNCH_KERNEL(org2r_block_gen<T>, dim3(blocks, batch_count, 1), dim3(BS1, 1, 1),
+                                0, stream, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                (trfact + j * ldw), ldw, strideW);
+    }
+
+    return rocblas_status_success;
+}
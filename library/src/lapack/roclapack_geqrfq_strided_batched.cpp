@@ -0,0 +1,143 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_geqrfq.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrfq_strided_batched_impl(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     U A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     T* R,
+                                                     const rocblas_int ldr,
+                                                     const rocblas_stride strideR,
+                                                     const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("geqrfq_strided_batched", "-m", m, "-n", n, "--lda", lda, "--strideA",
+                        strideA, "--ldr", ldr, "--strideR", strideR, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geqrfq_argCheck(handle, m, n, lda, ldr, A, R, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases) and re-usable workspace
+    size_t size_work_workArr, size_workArr;
+    // extra requirements for calling GEQR2 and LARFB
+    size_t size_Abyx_norms, size_diag_tmptr;
+    // size to store the Householder scalars and the triangular factors
+    size_t size_ipiv, size_trfact;
+    rocsolver_geqrfq_getMemorySize<false, T>(m, n, batch_count, &size_scalars, &size_work_workArr,
+                                             &size_Abyx_norms, &size_diag_tmptr, &size_workArr,
+                                             &size_ipiv, &size_trfact);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+                                                      size_Abyx_norms, size_diag_tmptr,
+                                                      size_workArr, size_ipiv, size_trfact);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms, *diag_tmptr, *workArr, *ipiv, *trfact;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms,
+                              size_diag_tmptr, size_workArr, size_ipiv, size_trfact);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms = mem[2];
+    diag_tmptr = mem[3];
+    workArr = mem[4];
+    ipiv = mem[5];
+    trfact = mem[6];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_geqrfq_template<false, true, T>(
+        handle, m, n, A, shiftA, lda, strideA, R, ldr, strideR, batch_count, (T*)scalars,
+        work_workArr, (T*)Abyx_norms, (T*)diag_tmptr, (T**)workArr, (T*)ipiv, (T*)trfact);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeqrfq_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 float* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 float* R,
+                                                 const rocblas_int ldr,
+                                                 const rocblas_stride strideR,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_geqrfq_strided_batched_impl<float>(handle, m, n, A, lda, strideA, R, ldr,
+                                                        strideR, batch_count);
+}
+
+rocblas_status rocsolver_dgeqrfq_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 double* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 double* R,
+                                                 const rocblas_int ldr,
+                                                 const rocblas_stride strideR,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_geqrfq_strided_batched_impl<double>(handle, m, n, A, lda, strideA, R, ldr,
+                                                         strideR, batch_count);
+}
+
+rocblas_status rocsolver_cgeqrfq_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 rocblas_float_complex* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 rocblas_float_complex* R,
+                                                 const rocblas_int ldr,
+                                                 const rocblas_stride strideR,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_geqrfq_strided_batched_impl<rocblas_float_complex>(
+        handle, m, n, A, lda, strideA, R, ldr, strideR, batch_count);
+}
+
+rocblas_status rocsolver_zgeqrfq_strided_batched(rocblas_handle handle,
+                                                 const rocblas_int m,
+                                                 const rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 const rocblas_int lda,
+                                                 const rocblas_stride strideA,
+                                                 rocblas_double_complex* R,
+                                                 const rocblas_int ldr,
+                                                 const rocblas_stride strideR,
+                                                 const rocblas_int batch_count)
+{
+    return rocsolver_geqrfq_strided_batched_impl<rocblas_double_complex>(
+        handle, m, n, A, lda, strideA, R, ldr, strideR, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,620 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gecon.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** Maximum number of refinement steps per right-hand side (as in LAPACK) **/
+#define RFS_ITMAX 5
+
+/** RFS_INIT initializes the refinement counters and the state of the
+    error estimator of every right-hand side. A counter equal to zero indicates that
+    the refinement of the corresponding solution has finished.
+
+    Call this kernel with ceil(ncols / BS1) groups in x, and BS1 threads in x. **/
+template <typename S>
+ROCSOLVER_KERNEL void rfs_init(const rocblas_int ncols,
+                               S* lstresA,
+                               rocblas_int* countA,
+                               S* estA,
+                               rocblas_int* stateA)
+{
+    rocblas_int c = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(c < ncols)
+    {
+        lstresA[c] = 3;
+        countA[c] = 1;
+        estA[c] = 0;
+        stateA[c * 4] = LACN2_JUMP_INIT;
+        stateA[c * 4 + 1] = 0;
+        stateA[c * 4 + 2] = 0;
+        stateA[c * 4 + 3] = 0;
+    }
+}
+
+/** RFS_ABS_ENTRY returns |op(A)_ik|. If uplo is upper or lower, A is hermitian (or symmetric)
+    and only the corresponding triangular part is referenced. **/
+template <typename S, typename T>
+__device__ S rfs_abs_entry(const rocblas_operation trans,
+                           const rocblas_fill uplo,
+                           const rocblas_int i,
+                           const rocblas_int k,
+                           T* A,
+                           const rocblas_int lda)
+{
+    bool direct;
+    if(uplo == rocblas_fill_upper)
+        direct = (i <= k);
+    else if(uplo == rocblas_fill_lower)
+        direct = (i >= k);
+    else
+        direct = (trans == rocblas_operation_none);
+
+    return direct ? aabs<S>(A[i + k * lda]) : aabs<S>(A[k + i * lda]);
+}
+
+/** RFS_BERR computes the componentwise relative backward error of every solution
+    that is still being refined, given the residual R = B - op(A)*X. It then decides
+    on the device whether another refinement step is required: if so, R is kept
+    to compute the correction, otherwise R is set to zero (so that the next correction
+    is zero) and the counter is set to zero. When the refinement of a solution finishes,
+    the vector W = |R| + nz*eps*(|op(A)|*|X| + |B|) used to bound the forward error
+    is also computed.
+
+    Call this kernel with nrhs groups in x, batch_count groups in y, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) rfs_berr(const rocblas_operation trans,
+                                                      const rocblas_fill uplo,
+                                                      const rocblas_int n,
+                                                      const rocblas_int nrhs,
+                                                      U AA,
+                                                      const rocblas_int shiftA,
+                                                      const rocblas_int lda,
+                                                      const rocblas_stride strideA,
+                                                      U BB,
+                                                      const rocblas_int shiftB,
+                                                      const rocblas_int ldb,
+                                                      const rocblas_stride strideB,
+                                                      U XX,
+                                                      const rocblas_int shiftX,
+                                                      const rocblas_int ldx,
+                                                      const rocblas_stride strideX,
+                                                      T* RR,
+                                                      S* WW,
+                                                      S* berrA,
+                                                      const rocblas_stride strideE,
+                                                      S* lstresA,
+                                                      rocblas_int* countA,
+                                                      const S eps,
+                                                      const S safmin)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int c = bid * nrhs + j;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* b = load_ptr_batch<T>(BB, bid, shiftB, strideB) + j * ldb;
+    T* x = load_ptr_batch<T>(XX, bid, shiftX, strideX) + j * ldx;
+    T* r = RR + c * n;
+    S* w = WW + c * n;
+
+    // shared memory
+    __shared__ S sval[BS1];
+
+    rocblas_int count = countA[c];
+    if(count == 0)
+    {
+        // refinement has finished; the correction must be zero
+        for(rocblas_int i = tid; i < n; i += BS1)
+            r[i] = 0;
+        return;
+    }
+
+    // nz = maximum number of nonzero elements in each row of A, plus 1
+    const S nz = S(n + 1);
+    const S safe1 = nz * safmin;
+    const S safe2 = safe1 / eps;
+
+    // compute s = |op(A)|*|X| + |B| (stored in w) and the backward error
+    S s, ri, bmax = 0;
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        s = aabs<S>(b[i]);
+        for(rocblas_int k = 0; k < n; k++)
+            s += rfs_abs_entry<S>(trans, uplo, i, k, A, lda) * aabs<S>(x[k]);
+        w[i] = s;
+
+        ri = aabs<S>(r[i]);
+        ri = (s > safe2) ? ri / s : (ri + safe1) / (s + safe1);
+        bmax = (ri > bmax || ri != ri) ? ri : bmax;
+    }
+    sval[tid] = bmax;
+    __syncthreads();
+
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i && (sval[tid + i] > sval[tid] || sval[tid + i] != sval[tid + i]))
+            sval[tid] = sval[tid + i];
+        __syncthreads();
+    }
+
+    S berr = sval[0];
+    S lstres = lstresA[c];
+
+    // test stopping criterion: continue refining only while the backward error is
+    // larger than eps and it has been at least halved in the last step
+    bool active = (berr > eps && 2 * berr <= lstres && count <= RFS_ITMAX);
+
+    if(!active)
+    {
+        for(rocblas_int i = tid; i < n; i += BS1)
+        {
+            s = w[i];
+            w[i] = aabs<S>(r[i]) + nz * eps * s + (s > safe2 ? S(0) : safe1);
+            r[i] = 0;
+        }
+    }
+
+    if(tid == 0)
+    {
+        berrA[bid * strideE + j] = berr;
+        lstresA[c] = berr;
+        countA[c] = active ? count + 1 : 0;
+    }
+}
+
+/** RFS_UPDATE adds the corrections in R to the solutions in X.
+
+    Call this kernel with ceil(n / BS2) groups in x, ceil(nrhs / BS2) groups in y,
+    batch_count groups in z, and BS2 threads in x and y. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void rfs_update(const rocblas_int n,
+                                 const rocblas_int nrhs,
+                                 U XX,
+                                 const rocblas_int shiftX,
+                                 const rocblas_int ldx,
+                                 const rocblas_stride strideX,
+                                 T* RR)
+{
+    rocblas_int b = hipBlockIdx_z;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < nrhs)
+    {
+        T* x = load_ptr_batch<T>(XX, b, shiftX, strideX);
+        x[i + j * ldx] += RR[i + j * n + b * n * nrhs];
+    }
+}
+
+/** RFS_SCALE multiplies the estimator vectors in R by the diagonal matrices
+    diag(W) (all vectors are stored contiguously).
+
+    Call this kernel with ceil(size / BS1) groups in x, and BS1 threads in x. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void rfs_scale(const rocblas_int size, T* RR, S* WW)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < size)
+        RR[i] *= WW[i];
+}
+
+/** RFS_FERR computes the forward error bound of every solution from the estimated
+    norm of inv(op(A))*diag(W) and the largest element of the solution.
+
+    Call this kernel with nrhs groups in x, batch_count groups in y, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) rfs_ferr(const rocblas_int n,
+                                                      const rocblas_int nrhs,
+                                                      U XX,
+                                                      const rocblas_int shiftX,
+                                                      const rocblas_int ldx,
+                                                      const rocblas_stride strideX,
+                                                      S* estA,
+                                                      S* ferrA,
+                                                      const rocblas_stride strideE)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    // array pointers
+    T* x = load_ptr_batch<T>(XX, bid, shiftX, strideX) + j * ldx;
+
+    // shared memory
+    __shared__ S sval[BS1];
+
+    S xmax = 0;
+    for(rocblas_int i = tid; i < n; i += BS1)
+        xmax = std::max(xmax, aabs<S>(x[i]));
+    sval[tid] = xmax;
+    __syncthreads();
+
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+            sval[tid] = std::max(sval[tid], sval[tid + i]);
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        S ferr = estA[bid * nrhs + j];
+        xmax = sval[0];
+        ferrA[bid * strideE + j] = (xmax != 0) ? ferr / xmax : ferr;
+    }
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_gerfs_argCheck(rocblas_handle handle,
+                                        const rocblas_operation trans,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int lda,
+                                        const rocblas_int ldaf,
+                                        const rocblas_int ldb,
+                                        const rocblas_int ldx,
+                                        T A,
+                                        T AF,
+                                        const rocblas_int* ipiv,
+                                        T B,
+                                        T X,
+                                        S* ferr,
+                                        S* berr,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldaf < n || ldb < n || ldx < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !AF) || (n && !ipiv) || (nrhs * n && !B) || (nrhs * n && !X)
+       || (nrhs && batch_count && !ferr) || (nrhs && batch_count && !berr))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Helper to allocate the workspace shared by GERFS and PORFS, other than the
+    workspace required by the solver **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_rfs_getMemorySize(const rocblas_int n,
+                                 const rocblas_int nrhs,
+                                 const rocblas_int batch_count,
+                                 size_t* size_work,
+                                 size_t* size_sgn,
+                                 size_t* size_wvec,
+                                 size_t* size_est,
+                                 size_t* size_lstres,
+                                 size_t* size_state,
+                                 size_t* size_count,
+                                 size_t* size_workArr)
+{
+    // vectors and state of the norm estimator (one problem per right-hand side)
+    rocsolver_lacn2_getMemorySize<false, T, S>(n, nrhs * batch_count, size_work, size_sgn,
+                                               size_est, size_state, size_workArr);
+
+    // componentwise bounds, last backward errors, and refinement counters
+    *size_wvec = sizeof(S) * n * nrhs * batch_count;
+    *size_lstres = sizeof(S) * nrhs * batch_count;
+    *size_count = sizeof(rocblas_int) * nrhs * batch_count;
+
+    // array of pointers to the residuals
+    if(BATCHED)
+        *size_workArr = sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S>
+void rocsolver_gerfs_getMemorySize(const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_work,
+                                   size_t* size_sgn,
+                                   size_t* size_wvec,
+                                   size_t* size_est,
+                                   size_t* size_lstres,
+                                   size_t* size_state,
+                                   size_t* size_count,
+                                   size_t* size_workArr,
+                                   bool* optim_mem)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_work = 0;
+        *size_sgn = 0;
+        *size_wvec = 0;
+        *size_est = 0;
+        *size_lstres = 0;
+        *size_state = 0;
+        *size_count = 0;
+        *size_workArr = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // workspace required for calling GETRS with nrhs right-hand sides
+    // call with both rocblas_operation_none and rocblas_operation_conjugate_transpose and take maximum memory
+    size_t w1a, w1b, w2a, w2b, w3a, w3b, w4a, w4b;
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(rocblas_operation_none, n, nrhs, batch_count,
+                                                       &w1a, &w2a, &w3a, &w4a, optim_mem);
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(rocblas_operation_conjugate_transpose, n,
+                                                       nrhs, batch_count, &w1b, &w2b, &w3b, &w4b,
+                                                       optim_mem);
+    *size_work1 = std::max(w1a, w1b);
+    *size_work2 = std::max(w2a, w2b);
+    *size_work3 = std::max(w3a, w3b);
+    *size_work4 = std::max(w4a, w4b);
+
+    // workspace required by the refinement and the error estimator
+    rocsolver_rfs_getMemorySize<BATCHED, T, S>(n, nrhs, batch_count, size_work, size_sgn, size_wvec,
+                                               size_est, size_lstres, size_state, size_count,
+                                               size_workArr);
+}
+
+/** Helper to call GETRS on the residuals; if the matrices are given
+    as an array of pointers, the residuals must be passed the same way **/
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gerfs_getrs(rocblas_handle handle,
+                           const rocblas_operation trans,
+                           const rocblas_int n,
+                           const rocblas_int nrhs,
+                           T* AF,
+                           const rocblas_int shiftAF,
+                           const rocblas_int ldaf,
+                           const rocblas_stride strideAF,
+                           const rocblas_int* ipiv,
+                           const rocblas_stride strideP,
+                           T* R,
+                           T** workArr,
+                           const rocblas_int batch_count,
+                           void* work1,
+                           void* work2,
+                           void* work3,
+                           void* work4,
+                           const bool optim_mem)
+{
+    rocsolver_getrs_template<BATCHED, STRIDED, T>(handle, trans, n, nrhs, AF, shiftAF, ldaf,
+                                                  strideAF, ipiv, strideP, R, 0, n, n * nrhs,
+                                                  batch_count, work1, work2, work3, work4,
+                                                  optim_mem, true);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gerfs_getrs(rocblas_handle handle,
+                           const rocblas_operation trans,
+                           const rocblas_int n,
+                           const rocblas_int nrhs,
+                           T* const AF[],
+                           const rocblas_int shiftAF,
+                           const rocblas_int ldaf,
+                           const rocblas_stride strideAF,
+                           const rocblas_int* ipiv,
+                           const rocblas_stride strideP,
+                           T* R,
+                           T** workArr,
+                           const rocblas_int batch_count,
+                           void* work1,
+                           void* work2,
+                           void* work3,
+                           void* work4,
+                           const bool optim_mem)
+{
+    rocsolver_getrs_template<BATCHED, STRIDED, T>(handle, trans, n, nrhs, AF, shiftAF, ldaf,
+                                                  strideAF, ipiv, strideP, (T* const*)workArr, 0, n,
+                                                  n * nrhs, batch_count, work1, work2, work3, work4,
+                                                  optim_mem, true);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gerfs_template(rocblas_handle handle,
+                                        const rocblas_operation trans,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U AF,
+                                        const rocblas_int shiftAF,
+                                        const rocblas_int ldaf,
+                                        const rocblas_stride strideAF,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        U X,
+                                        const rocblas_int shiftX,
+                                        const rocblas_int ldx,
+                                        const rocblas_stride strideX,
+                                        S* ferr,
+                                        S* berr,
+                                        const rocblas_stride strideE,
+                                        const rocblas_int batch_count,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* work,
+                                        T* sgn,
+                                        S* wvec,
+                                        S* est,
+                                        S* lstres,
+                                        rocblas_int* state,
+                                        rocblas_int* count,
+                                        T** workArr,
+                                        const bool optim_mem)
+{
+    ROCSOLVER_ENTER("gerfs", "trans:", trans, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:",
+                    lda, "shiftAF:", shiftAF, "ldaf:", ldaf, "shiftB:", shiftB, "ldb:", ldb,
+                    "shiftX:", shiftX, "ldx:", ldx, "bc:", batch_count);
+
+    // quick return
+    if(nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int ncols = nrhs * batch_count;
+    dim3 threads(BS1, 1, 1);
+
+    // quick return with zero error bounds
+    if(n == 0)
+    {
+        dim3 gridReset((nrhs - 1) / BS1 + 1, batch_count, 1);
+        ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<S>, gridReset, threads, 0, stream, ferr, strideE,
+                                nrhs, 0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<S>, gridReset, threads, 0, stream, berr, strideE,
+                                nrhs, 0);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    rocblas_int blocksCols = (ncols - 1) / BS1 + 1;
+    rocblas_int blocksScale = (n * ncols - 1) / BS1 + 1;
+    rocblas_int blocksx = (n - 1) / BS2 + 1;
+    rocblas_int blocksy = (nrhs - 1) / BS2 + 1;
+    dim3 gridCols(blocksCols, 1, 1);
+    dim3 gridScale(blocksScale, 1, 1);
+    dim3 gridRHS(nrhs, batch_count, 1);
+    dim3 gridCopy(blocksx, blocksy, batch_count);
+    dim3 gridEst(ncols, 1, 1);
+    dim3 threadsCopy(BS2, BS2, 1);
+
+    T one = T(1);
+    T minone = T(-1);
+    S eps = get_epsilon<T>();
+    S safmin = get_safemin<T>();
+
+    if(BATCHED)
+        ROCSOLVER_LAUNCH_KERNEL(get_array, dim3((batch_count - 1) / BS1 + 1), threads, 0, stream,
+                                workArr, work, n * nrhs, batch_count);
+
+    ROCSOLVER_LAUNCH_KERNEL(rfs_init<S>, gridCols, threads, 0, stream, ncols, lstres, count, est,
+                            state);
+
+    // iterative refinement: the schedule is fixed (at most RFS_ITMAX corrections), and
+    // the stopping criterion is evaluated on the device for every right-hand side.
+    // Solutions that do not need more refinement receive zero corrections
+    for(rocblas_int it = 0; it <= RFS_ITMAX; it++)
+    {
+        // compute residual R = B - op(A)*X
+        ROCSOLVER_LAUNCH_KERNEL((copy_mat<T>), gridCopy, threadsCopy, 0, stream, copymat_to_buffer,
+                                n, nrhs, B, shiftB, ldb, strideB, work);
+        rocblasCall_gemm<BATCHED, STRIDED, T>(handle, trans, rocblas_operation_none, n, nrhs, n,
+                                              &minone, A, shiftA, lda, strideA, X, shiftX, ldx,
+                                              strideX, &one, work, 0, n, n * nrhs, batch_count,
+                                              workArr);
+
+        // compute backward error and check stopping criterion
+        ROCSOLVER_LAUNCH_KERNEL((rfs_berr<T>), gridRHS, threads, 0, stream, trans,
+                                rocblas_fill_full, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb,
+                                strideB, X, shiftX, ldx, strideX, work, wvec, berr, strideE,
+                                lstres, count, eps, safmin);
+
+        // after RFS_ITMAX corrections the refinement has finished for all solutions
+        if(it == RFS_ITMAX)
+            break;
+
+        // solve op(A)*dX = R and update X = X + dX
+        rocsolver_gerfs_getrs<BATCHED, STRIDED, T>(handle, trans, n, nrhs, AF, shiftAF, ldaf,
+                                                   strideAF, ipiv, strideP, work, workArr,
+                                                   batch_count, work1, work2, work3, work4,
+                                                   optim_mem);
+        ROCSOLVER_LAUNCH_KERNEL((rfs_update<T>), gridCopy, threadsCopy, 0, stream, n, nrhs, X,
+                                shiftX, ldx, strideX, work);
+    }
+
+    // bound the forward error by estimating the infinity-norm of inv(op(A))*diag(W),
+    // i.e. the 1-norm of diag(W)*inv(op(A))'
+    rocblas_operation transn = (trans == rocblas_operation_none)
+        ? rocblas_operation_none
+        : rocblas_operation_conjugate_transpose;
+    rocblas_operation transt = (trans == rocblas_operation_none)
+        ? rocblas_operation_conjugate_transpose
+        : rocblas_operation_none;
+
+    // initialize the estimator vectors
+    ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<BS1, T>), gridEst, threads, 0, stream, n, 0, 1, work, sgn,
+                            est, state);
+
+    rocblas_int kase, kase_next;
+    for(rocblas_int r = 0; r < LACN2_MAX_SOLVES; r++)
+    {
+        kase = (r % 2 == 0 ? 1 : 2);
+        kase_next = (r + 1 < LACN2_MAX_SOLVES ? 3 - kase : 0);
+
+        if(kase == 1)
+        {
+            // multiply by diag(W)*inv(op(A))'
+            rocsolver_gerfs_getrs<BATCHED, STRIDED, T>(handle, transt, n, nrhs, AF, shiftAF, ldaf,
+                                                       strideAF, ipiv, strideP, work, workArr,
+                                                       batch_count, work1, work2, work3, work4,
+                                                       optim_mem);
+            ROCSOLVER_LAUNCH_KERNEL((rfs_scale<T>), gridScale, threads, 0, stream, n * ncols, work,
+                                    wvec);
+        }
+        else
+        {
+            // multiply by inv(op(A))*diag(W)
+            ROCSOLVER_LAUNCH_KERNEL((rfs_scale<T>), gridScale, threads, 0, stream, n * ncols, work,
+                                    wvec);
+            rocsolver_gerfs_getrs<BATCHED, STRIDED, T>(handle, transn, n, nrhs, AF, shiftAF, ldaf,
+                                                       strideAF, ipiv, strideP, work, workArr,
+                                                       batch_count, work1, work2, work3, work4,
+                                                       optim_mem);
+        }
+
+        ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<BS1, T>), gridEst, threads, 0, stream, n, kase,
+                                kase_next, work, sgn, est, state);
+    }
+
+    // normalize the error bounds
+    ROCSOLVER_LAUNCH_KERNEL((rfs_ferr<T>), gridRHS, threads, 0, stream, n, nrhs, X, shiftX, ldx,
+                            strideX, est, ferr, strideE);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -0,0 +1,205 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gerfs.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gerfs_batched_impl(rocblas_handle handle,
+                                            const rocblas_operation trans,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            U A,
+                                            const rocblas_int lda,
+                                            U AF,
+                                            const rocblas_int ldaf,
+                                            const rocblas_int* ipiv,
+                                            const rocblas_stride strideP,
+                                            U B,
+                                            const rocblas_int ldb,
+                                            U X,
+                                            const rocblas_int ldx,
+                                            S* ferr,
+                                            S* berr,
+                                            const rocblas_stride strideE,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gerfs_batched", "--trans", trans, "-n", n, "--nrhs", nrhs, "--lda", lda,
+                        "--ldaf", ldaf, "--strideP", strideP, "--ldb", ldb, "--ldx", ldx,
+                        "--strideE", strideE, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gerfs_argCheck(handle, trans, n, nrhs, lda, ldaf, ldb, ldx, A, AF,
+                                                 ipiv, B, X, ferr, berr, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftAF = 0;
+    rocblas_int shiftB = 0;
+    rocblas_int shiftX = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideAF = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideX = 0;
+
+    // memory workspace sizes:
+    // size of workspace (for calling the solver)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // size of residuals, componentwise bounds, and state of the refinement and the norm estimator
+    size_t size_work, size_sgn, size_wvec, size_est, size_lstres, size_state, size_count;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_gerfs_getMemorySize<true, true, T, S>(n, nrhs, batch_count, &size_work1, &size_work2,
+                                                    &size_work3, &size_work4, &size_work, &size_sgn,
+                                                    &size_wvec, &size_est, &size_lstres,
+                                                    &size_state, &size_count, &size_workArr,
+                                                    &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+                                                      size_work4, size_work, size_sgn, size_wvec,
+                                                      size_est, size_lstres, size_state, size_count,
+                                                      size_workArr);
+
+    // memory workspace allocation
+    void *work1, *work2, *work3, *work4, *work, *sgn, *wvec, *est, *lstres, *state, *count,
+        *workArr;
+    rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4, size_work,
+                              size_sgn, size_wvec, size_est, size_lstres, size_state, size_count,
+                              size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work1 = mem[0];
+    work2 = mem[1];
+    work3 = mem[2];
+    work4 = mem[3];
+    work = mem[4];
+    sgn = mem[5];
+    wvec = mem[6];
+    est = mem[7];
+    lstres = mem[8];
+    state = mem[9];
+    count = mem[10];
+    workArr = mem[11];
+
+    // execution
+    return rocsolver_gerfs_template<true, true, T>(handle, trans, n, nrhs, A, shiftA, lda, strideA,
+                                                   AF, shiftAF, ldaf, strideAF, ipiv, strideP, B,
+                                                   shiftB, ldb, strideB, X, shiftX, ldx, strideX,
+                                                   ferr, berr, strideE, batch_count, work1, work2,
+                                                   work3, work4, (T*)work, (T*)sgn, (S*)wvec,
+                                                   (S*)est, (S*)lstres, (rocblas_int*)state,
+                                                   (rocblas_int*)count, (T**)workArr, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_sgerfs_batched(rocblas_handle handle,
+                                                   const rocblas_operation trans,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   float* const A[],
+                                                   const rocblas_int lda,
+                                                   float* const AF[],
+                                                   const rocblas_int ldaf,
+                                                   const rocblas_int* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   float* const B[],
+                                                   const rocblas_int ldb,
+                                                   float* const X[],
+                                                   const rocblas_int ldx,
+                                                   float* ferr,
+                                                   float* berr,
+                                                   const rocblas_stride strideE,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gerfs_batched_impl<float>(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv,
+                                               strideP, B, ldb, X, ldx, ferr, berr, strideE,
+                                               batch_count);
+}
+
+extern "C" rocblas_status rocsolver_dgerfs_batched(rocblas_handle handle,
+                                                   const rocblas_operation trans,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   double* const A[],
+                                                   const rocblas_int lda,
+                                                   double* const AF[],
+                                                   const rocblas_int ldaf,
+                                                   const rocblas_int* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   double* const B[],
+                                                   const rocblas_int ldb,
+                                                   double* const X[],
+                                                   const rocblas_int ldx,
+                                                   double* ferr,
+                                                   double* berr,
+                                                   const rocblas_stride strideE,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gerfs_batched_impl<double>(handle, trans, n, nrhs, A, lda, AF, ldaf, ipiv,
+                                                strideP, B, ldb, X, ldx, ferr, berr, strideE,
+                                                batch_count);
+}
+
+extern "C" rocblas_status rocsolver_cgerfs_batched(rocblas_handle handle,
+                                                   const rocblas_operation trans,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   rocblas_float_complex* const A[],
+                                                   const rocblas_int lda,
+                                                   rocblas_float_complex* const AF[],
+                                                   const rocblas_int ldaf,
+                                                   const rocblas_int* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   rocblas_float_complex* const B[],
+                                                   const rocblas_int ldb,
+                                                   rocblas_float_complex* const X[],
+                                                   const rocblas_int ldx,
+                                                   float* ferr,
+                                                   float* berr,
+                                                   const rocblas_stride strideE,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gerfs_batched_impl<rocblas_float_complex>(handle, trans, n, nrhs, A, lda, AF,
+                                                               ldaf, ipiv, strideP, B, ldb, X, ldx,
+                                                               ferr, berr, strideE, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_zgerfs_batched(rocblas_handle handle,
+                                                   const rocblas_operation trans,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   rocblas_double_complex* const A[],
+                                                   const rocblas_int lda,
+                                                   rocblas_double_complex* const AF[],
+                                                   const rocblas_int ldaf,
+                                                   const rocblas_int* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   rocblas_double_complex* const B[],
+                                                   const rocblas_int ldb,
+                                                   rocblas_double_complex* const X[],
+                                                   const rocblas_int ldx,
+                                                   double* ferr,
+                                                   double* berr,
+                                                   const rocblas_stride strideE,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gerfs_batched_impl<rocblas_double_complex>(handle, trans, n, nrhs, A, lda, AF,
+                                                                ldaf, ipiv, strideP, B, ldb, X, ldx,
+                                                                ferr, berr, strideE, batch_count);
+}
@@ -0,0 +1,277 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.10.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_bdsdc.hpp"
+#include "auxiliary/rocauxiliary_ormbr_unmbr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_gebrd.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** Argument checking **/
+template <typename T, typename TT, typename W>
+rocblas_status rocsolver_gesdd_argCheck(rocblas_handle handle,
+                                        const rocblas_svect svect,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        W A,
+                                        const rocblas_int lda,
+                                        TT* S,
+                                        T* U,
+                                        const rocblas_int ldu,
+                                        T* V,
+                                        const rocblas_int ldv,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(svect != rocblas_svect_all && svect != rocblas_svect_singular && svect != rocblas_svect_none)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || m < 0 || lda < m || ldu < 1 || ldv < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(svect != rocblas_svect_none && ldu < m)
+        return rocblas_status_invalid_size;
+    if((svect == rocblas_svect_all && ldv < n)
+       || (svect == rocblas_svect_singular && ldv < min(m, n)))
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n * m && !A) || (min(m, n) && !S) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+    if((svect == rocblas_svect_all && m && !U)
+       || (svect == rocblas_svect_singular && min(m, n) && !U))
+        return rocblas_status_invalid_pointer;
+    if(svect != rocblas_svect_none && n && !V)
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Helper to calculate workspace sizes **/
+template <bool BATCHED, typename T, typename S>
+void rocsolver_gesdd_getMemorySize(const rocblas_svect svect,
+                                   const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_Abyx_norms_tmptr,
+                                   size_t* size_Abyx_norms_trfact_X,
+                                   size_t* size_diag_tmptr_Y,
+                                   size_t* size_tau,
+                                   size_t* size_E,
+                                   size_t* size_tempvect,
+                                   size_t* size_tempgemm,
+                                   size_t* size_tmpz,
+                                   size_t* size_splits,
+                                   size_t* size_tgk,
+                                   size_t* size_Z,
+                                   size_t* size_workArr)
+{
+    // if quick return, set workspace to zero
+    if(n == 0 || m == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms_tmptr = 0;
+        *size_Abyx_norms_trfact_X = 0;
+        *size_diag_tmptr_Y = 0;
+        *size_tau = 0;
+        *size_E = 0;
+        *size_tempvect = 0;
+        *size_tempgemm = 0;
+        *size_tmpz = 0;
+        *size_splits = 0;
+        *size_tgk = 0;
+        *size_Z = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    size_t w[2] = {0, 0};
+    size_t a[3] = {0, 0, 0};
+    size_t x[3] = {0, 0, 0};
+    size_t y[3] = {0, 0, 0};
+    size_t unused;
+
+    // auxiliary sizes
+    const rocblas_int k = min(m, n);
+    const rocblas_int nu = (svect == rocblas_svect_all) ? m : k;
+    const rocblas_int nv = (svect == rocblas_svect_all) ? n : k;
+
+    // size of array of pointers to workspace
+    if(BATCHED)
+        *size_workArr = 2 * sizeof(T*) * batch_count;
+    else
+        *size_workArr = 0;
+
+    // workspace required for the bidiagonalization
+    rocsolver_gebrd_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars, &w[0], &a[0],
+                                              &x[0], &y[0]);
+
+    // size of the householder scalars and the off-diagonal of the bidiagonal form
+    *size_tau = 2 * sizeof(T) * k * batch_count;
+    *size_E = sizeof(S) * k * batch_count;
+
+    // workspace required for the SVD of the bidiagonal form
+    rocsolver_bdsdc_getMemorySize<T, S>(svect == rocblas_svect_none ? rocblas_svect_none
+                                                                    : rocblas_svect_singular,
+                                        k, batch_count, &w[1], size_tempvect, size_tempgemm,
+                                        size_tmpz, size_splits, size_tgk, size_Z);
+
+    // extra requirements to update the singular vectors with the bidiagonalization
+    if(svect != rocblas_svect_none)
+    {
+        rocsolver_ormbr_unmbr_getMemorySize<BATCHED, T>(rocblas_column_wise, rocblas_side_left, m,
+                                                        nu, n, batch_count, &unused, &a[1],
+                                                        &y[1], &x[1], &unused);
+        rocsolver_ormbr_unmbr_getMemorySize<BATCHED, T>(rocblas_row_wise, rocblas_side_right, nv,
+                                                        n, m, batch_count, &unused, &a[2], &y[2],
+                                                        &x[2], &unused);
+    }
+
+    // get max sizes
+    *size_work_workArr = *std::max_element(std::begin(w), std::end(w));
+    *size_Abyx_norms_tmptr = *std::max_element(std::begin(a), std::end(a));
+    *size_Abyx_norms_trfact_X = *std::max_element(std::begin(x), std::end(x));
+    *size_diag_tmptr_Y = *std::max_element(std::begin(y), std::end(y));
+}
+
+/** GESDD templated function.
+    The matrix is reduced to bidiagonal form, and the SVD of the bidiagonal matrix is
+    computed with the divide-and-conquer method of BDSDC. The singular vectors of A are
+    recovered by applying the orthogonal/unitary transformations of the bidiagonalization. **/
+template <bool BATCHED, bool STRIDED, typename T, typename TT, typename W>
+rocblas_status rocsolver_gesdd_template(rocblas_handle handle,
+                                        const rocblas_svect svect,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        W A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        TT* S,
+                                        const rocblas_stride strideS,
+                                        T* U,
+                                        const rocblas_int ldu,
+                                        const rocblas_stride strideU,
+                                        T* V,
+                                        const rocblas_int ldv,
+                                        const rocblas_stride strideV,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* Abyx_norms_tmptr,
+                                        T* Abyx_norms_trfact_X,
+                                        T* diag_tmptr_Y,
+                                        T* tau,
+                                        TT* E,
+                                        TT* tempvect,
+                                        TT* tempgemm,
+                                        TT* tmpz,
+                                        rocblas_int* splits,
+                                        TT* tgk,
+                                        TT* Z,
+                                        T** workArr)
+{
+    ROCSOLVER_ENTER("gesdd", "svect:", svect, "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "ldu:", ldu, "ldv:", ldv, "bc:", batch_count);
+
+    constexpr bool COMPLEX = rocblas_is_complex<T>;
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info = 0
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return
+    if(n == 0 || m == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // auxiliary sizes and variables
+    const rocblas_int k = min(m, n);
+    const rocblas_int nu = (svect == rocblas_svect_all) ? m : k;
+    const rocblas_int nv = (svect == rocblas_svect_all) ? n : k;
+    const rocblas_int shiftX = 0;
+    const rocblas_int shiftY = 0;
+    const rocblas_int ldx = m;
+    const rocblas_int ldy = n;
+    const rocblas_stride strideX = ldx * GEBRD_GEBD2_SWITCHSIZE;
+    const rocblas_stride strideY = ldy * GEBRD_GEBD2_SWITCHSIZE;
+    const rocblas_fill uplo = (m >= n) ? rocblas_fill_upper : rocblas_fill_lower;
+
+    //*** STAGE 1: Bidiagonalization ***//
+    rocsolver_gebrd_template<BATCHED, STRIDED>(
+        handle, m, n, A, shiftA, lda, strideA, S, strideS, E, k, tau, k, (tau + k * batch_count),
+        k, Abyx_norms_trfact_X, shiftX, ldx, strideX, diag_tmptr_Y, shiftY, ldy, strideY,
+        batch_count, scalars, work_workArr, Abyx_norms_tmptr);
+
+    //*** STAGE 2: SVD of the bidiagonal form ***//
+    if(svect != rocblas_svect_none)
+    {
+        // the parts of U and V that are not overwritten by BDSDC are set to the identity
+        rocblas_int blocks_m = (m - 1) / BS2 + 1;
+        rocblas_int blocks_n = (n - 1) / BS2 + 1;
+        rocblas_int blocks_nu = (nu - 1) / BS2 + 1;
+        rocblas_int blocks_nv = (nv - 1) / BS2 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(init_ident<T>, dim3(blocks_m, blocks_nu, batch_count),
+                                dim3(BS2, BS2), 0, stream, m, nu, U, 0, ldu, strideU);
+        ROCSOLVER_LAUNCH_KERNEL(init_ident<T>, dim3(blocks_nv, blocks_n, batch_count),
+                                dim3(BS2, BS2), 0, stream, nv, n, V, 0, ldv, strideV);
+    }
+
+    rocsolver_bdsdc_template<T>(
+        handle, uplo, (svect == rocblas_svect_none ? rocblas_svect_none : rocblas_svect_singular),
+        k, S, strideS, E, k, U, 0, ldu, strideU, V, 0, ldv, strideV, info, batch_count,
+        work_workArr, tempvect, tempgemm, tmpz, splits, tgk, Z);
+
+    //*** STAGE 3: Update the singular vectors with the orthogonal/unitary matrices ***//
+    if(svect != rocblas_svect_none)
+    {
+        // U = Q * U
+        rocsolver_ormbr_unmbr_template<BATCHED, STRIDED>(
+            handle, rocblas_column_wise, rocblas_side_left, rocblas_operation_none, m, nu, n, A,
+            shiftA, lda, strideA, tau, k, U, 0, ldu, strideU, batch_count, scalars,
+            Abyx_norms_tmptr, diag_tmptr_Y, Abyx_norms_trfact_X, workArr);
+
+        // V = V * P'
+        rocsolver_ormbr_unmbr_template<BATCHED, STRIDED>(
+            handle, rocblas_row_wise, rocblas_side_right,
+            (COMPLEX ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose), nv, n,
+            m, A, shiftA, lda, strideA, (tau + k * batch_count), k, V, 0, ldv, strideV,
+            batch_count, scalars, Abyx_norms_tmptr, diag_tmptr_Y, Abyx_norms_trfact_X, workArr);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
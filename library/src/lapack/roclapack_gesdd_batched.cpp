@@ -0,0 +1,206 @@
+/* ************************************************************************
+ * Copyright (c) 2023 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gesdd.hpp"
+
+template <typename T, typename TT, typename W>
+rocblas_status rocsolver_gesdd_batched_impl(rocblas_handle handle,
+                                            const rocblas_svect svect,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            W A,
+                                            const rocblas_int lda,
+                                            TT* S,
+                                            const rocblas_stride strideS,
+                                            T* U,
+                                            const rocblas_int ldu,
+                                            const rocblas_stride strideU,
+                                            T* V,
+                                            const rocblas_int ldv,
+                                            const rocblas_stride strideV,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gesdd_batched", "--svect", svect, "-m", m, "-n", n, "--lda", lda,
+                        "--strideS", strideS, "--ldu", ldu, "--strideU", strideU, "--ldv", ldv,
+                        "--strideV", strideV, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gesdd_argCheck(handle, svect, m, n, A, lda, S, U, ldu, V, ldv,
+                                                 info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace and array of pointers (batched case)
+    size_t size_work_workArr;
+    // extra requirements for calling GEBRD and ORMBR/UNMBR
+    size_t size_Abyx_norms_tmptr, size_Abyx_norms_trfact_X, size_diag_tmptr_Y;
+    // size of the householder scalars and of the off-diagonal of the bidiagonal form
+    size_t size_tau, size_E;
+    // extra requirements for calling BDSDC
+    size_t size_tempvect, size_tempgemm, size_tmpz, size_splits, size_tgk, size_Z;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+
+    rocsolver_gesdd_getMemorySize<true, T, TT>(svect, m, n, batch_count, &size_scalars,
+                                               &size_work_workArr, &size_Abyx_norms_tmptr,
+                                               &size_Abyx_norms_trfact_X, &size_diag_tmptr_Y,
+                                               &size_tau, &size_E, &size_tempvect, &size_tempgemm,
+                                               &size_tmpz, &size_splits, &size_tgk, &size_Z,
+                                               &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+                                                      size_Abyx_norms_tmptr,
+                                                      size_Abyx_norms_trfact_X, size_diag_tmptr_Y,
+                                                      size_tau, size_E, size_tempvect,
+                                                      size_tempgemm, size_tmpz, size_splits,
+                                                      size_tgk, size_Z, size_workArr);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms_tmptr, *Abyx_norms_trfact_X, *diag_tmptr_Y, *tau, *E;
+    void *tempvect, *tempgemm, *tmpz, *splits, *tgk, *Z, *workArr;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_tmptr,
+                              size_Abyx_norms_trfact_X, size_diag_tmptr_Y, size_tau, size_E,
+                              size_tempvect, size_tempgemm, size_tmpz, size_splits, size_tgk,
+                              size_Z, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms_tmptr = mem[2];
+    Abyx_norms_trfact_X = mem[3];
+    diag_tmptr_Y = mem[4];
+    tau = mem[5];
+    E = mem[6];
+    tempvect = mem[7];
+    tempgemm = mem[8];
+    tmpz = mem[9];
+    splits = mem[10];
+    tgk = mem[11];
+    Z = mem[12];
+    workArr = mem[13];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_gesdd_template<true, false, T>(handle, svect, m, n, A, shiftA, lda, strideA, S,
+                                                    strideS, U, ldu, strideU, V, ldv, strideV, info,
+                                                    batch_count, (T*)scalars, work_workArr,
+                                                    (T*)Abyx_norms_tmptr, (T*)Abyx_norms_trfact_X,
+                                                    (T*)diag_tmptr_Y, (T*)tau, (TT*)E,
+                                                    (TT*)tempvect, (TT*)tempgemm, (TT*)tmpz,
+                                                    (rocblas_int*)splits, (TT*)tgk, (TT*)Z,
+                                                    (T**)workArr);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgesdd_batched(rocblas_handle handle,
+                                        const rocblas_svect svect,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        float* const A[],
+                                        const rocblas_int lda,
+                                        float* S,
+                                        const rocblas_stride strideS,
+                                        float* U,
+                                        const rocblas_int ldu,
+                                        const rocblas_stride strideU,
+                                        float* V,
+                                        const rocblas_int ldv,
+                                        const rocblas_stride strideV,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_gesdd_batched_impl<float>(handle, svect, m, n, A, lda, S, strideS, U, ldu,
+                                               strideU, V, ldv, strideV, info, batch_count);
+}
+
+rocblas_status rocsolver_dgesdd_batched(rocblas_handle handle,
+                                        const rocblas_svect svect,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        double* const A[],
+                                        const rocblas_int lda,
+                                        double* S,
+                                        const rocblas_stride strideS,
+                                        double* U,
+                                        const rocblas_int ldu,
+                                        const rocblas_stride strideU,
+                                        double* V,
+                                        const rocblas_int ldv,
+                                        const rocblas_stride strideV,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_gesdd_batched_impl<double>(handle, svect, m, n, A, lda, S, strideS, U, ldu,
+                                                strideU, V, ldv, strideV, info, batch_count);
+}
+
+rocblas_status rocsolver_cgesdd_batched(rocblas_handle handle,
+                                        const rocblas_svect svect,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int lda,
+                                        float* S,
+                                        const rocblas_stride strideS,
+                                        rocblas_float_complex* U,
+                                        const rocblas_int ldu,
+                                        const rocblas_stride strideU,
+                                        rocblas_float_complex* V,
+                                        const rocblas_int ldv,
+                                        const rocblas_stride strideV,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_gesdd_batched_impl<rocblas_float_complex>(handle, svect, m, n, A, lda, S,
+                                                               strideS, U, ldu, strideU, V, ldv,
+                                                               strideV, info, batch_count);
+}
+
+rocblas_status rocsolver_zgesdd_batched(rocblas_handle handle,
+                                        const rocblas_svect svect,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int lda,
+                                        double* S,
+                                        const rocblas_stride strideS,
+                                        rocblas_double_complex* U,
+                                        const rocblas_int ldu,
+                                        const rocblas_stride strideU,
+                                        rocblas_double_complex* V,
+                                        const rocblas_int ldv,
+                                        const rocblas_stride strideV,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_gesdd_batched_impl<rocblas_double_complex>(handle, svect, m, n, A, lda, S,
+                                                                strideS, U, ldu, strideU, V, ldv,
+                                                                strideV, info, batch_count);
+}
+
+} // extern C
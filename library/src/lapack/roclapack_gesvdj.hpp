@@ -9,8 +9,8 @@
 
 #pragma once
 
-#include "auxiliary/rocauxiliary_orglq_unglq.hpp"
-#include "auxiliary/rocauxiliary_orgqr_ungqr.hpp"
+#include "auxiliary/rocauxiliary_ormlq_unmlq.hpp"
+#include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
 #include "rocblas.hpp"
 #include "roclapack_gelqf.hpp"
 #include "roclapack_geqrf.hpp"
@@ -55,6 +55,824 @@ ROCSOLVER_KERNEL void gesvdj_finalize(const rocblas_int n,
     }
 }
 
+/************** Kernels and device functions for one-sided Jacobi *************/
+/*****************************************************************************/
+
+/** GESVDJ_ROTATION computes the Jacobi rotation that orthogonalizes the columns xi and xj of
+    the working matrix, given a = ||xi||^2, b = ||xj||^2 and aij = xi'xj. The rotation is the one
+    that SYEVJ would compute to annihilate the off-diagonal element of the 2-by-2 Gram matrix,
+    and it is skipped (c = 1, s1 = 0) if |aij| <= tol * ||xi|| * ||xj||. Returns true if a
+    rotation must be applied. **/
+template <typename T, typename S>
+__device__ bool gesvdj_rotation(const S a, const S b, const T aij, const S tol, S& c, T& s1)
+{
+    S mag = std::abs(aij);
+    if(mag <= tol * sqrt(a) * sqrt(b))
+    {
+        c = 1;
+        s1 = 0;
+        return false;
+    }
+
+    S f, g, r, s;
+    g = 2 * mag;
+    f = b - a;
+    f += (f < 0) ? -std::hypot(f, g) : std::hypot(f, g);
+    lartg(f, g, c, s, r);
+    s1 = s * aij / mag;
+    return true;
+}
+
+/** GESVDJ_GRAM_NORMS computes the squared Frobenius norms of the off-diagonal part (off) and
+    of the diagonal part (diag) of the Gram matrix X'X of the k-by-k matrix X. The Frobenius norm
+    of X'X, sqrt(off + diag), is not changed by the rotations.
+
+    All threads in the group must call this function; tid and nthreads identify the thread
+    within the group. sh_val is an array in shared memory of size nthreads. **/
+template <typename T, typename S>
+__device__ void gesvdj_gram_norms(const rocblas_int tid,
+                                  const rocblas_int nthreads,
+                                  const rocblas_int k,
+                                  T* X,
+                                  const rocblas_int ldx,
+                                  S* sh_val,
+                                  S& off,
+                                  S& diag)
+{
+    rocblas_int i, j, l;
+    S o = 0, d = 0;
+
+    // only the lower triangle of the hermitian Gram matrix is computed
+    for(l = tid; l < k * k; l += nthreads)
+    {
+        i = l % k;
+        j = l / k;
+        if(i >= j)
+        {
+            T g = 0;
+            for(rocblas_int r = 0; r < k; r++)
+                g += conj(X[r + i * ldx]) * X[r + j * ldx];
+
+            if(i == j)
+                d += std::norm(g);
+            else
+                o += 2 * std::norm(g);
+        }
+    }
+
+    sh_val[tid] = o;
+    __syncthreads();
+    if(tid == 0)
+    {
+        for(l = 1; l < nthreads; l++)
+            o += sh_val[l];
+        sh_val[0] = o;
+    }
+    __syncthreads();
+    off = sh_val[0];
+    __syncthreads();
+
+    sh_val[tid] = d;
+    __syncthreads();
+    if(tid == 0)
+    {
+        for(l = 1; l < nthreads; l++)
+            d += sh_val[l];
+        sh_val[0] = d;
+    }
+    __syncthreads();
+    diag = sh_val[0];
+    __syncthreads();
+}
+
+/** GESVDJ_SORT_NORMALIZE computes the singular values as the column norms of X (k-by-k),
+    sorts them in decreasing order together with the columns of X and V, and (if leftv)
+    normalizes the columns of X. Columns of X associated with zero singular values are
+    replaced by unit vectors orthogonal to the previous columns, so that the left singular
+    vectors are always orthonormal.
+
+    All threads in the group must call this function; tid and nthreads identify the thread
+    within the group. sh_val and sh_idx are arrays in shared memory of size nthreads. **/
+template <typename T, typename S>
+__device__ void gesvdj_sort_normalize(const rocblas_int tid,
+                                      const rocblas_int nthreads,
+                                      const bool leftv,
+                                      const bool rightv,
+                                      const rocblas_int k,
+                                      T* X,
+                                      const rocblas_int ldx,
+                                      T* V,
+                                      const rocblas_int ldv,
+                                      S* Sv,
+                                      const S safmin,
+                                      S* sh_val,
+                                      rocblas_int* sh_idx)
+{
+    rocblas_int i, j, l, m;
+    S p;
+
+    // singular values are the norms of the columns of X
+    for(j = tid; j < k; j += nthreads)
+    {
+        p = 0;
+        for(i = 0; i < k; i++)
+            p += std::norm(X[i + j * ldx]);
+        Sv[j] = sqrt(p);
+    }
+    __syncthreads();
+
+    // sort singular values & vectors by selection sort
+    for(j = 0; j < k - 1; j++)
+    {
+        m = j;
+        p = Sv[j];
+        for(i = j + 1; i < k; i++)
+        {
+            if(Sv[i] > p)
+            {
+                m = i;
+                p = Sv[i];
+            }
+        }
+        __syncthreads();
+
+        if(m != j)
+        {
+            if(tid == 0)
+            {
+                Sv[m] = Sv[j];
+                Sv[j] = p;
+            }
+
+            for(i = tid; i < k; i += nthreads)
+            {
+                if(leftv)
+                    swap(X[i + m * ldx], X[i + j * ldx]);
+                if(rightv)
+                    swap(V[i + m * ldv], V[i + j * ldv]);
+            }
+        }
+        __syncthreads();
+    }
+
+    if(!leftv)
+        return;
+
+    // normalize the columns associated with non-zero singular values
+    rocblas_int rank = k;
+    while(rank > 0 && Sv[rank - 1] <= safmin)
+        rank--;
+
+    for(i = tid; i < k * rank; i += nthreads)
+    {
+        j = i / k;
+        T scl = T(1 / Sv[j]);
+        X[(i % k) + j * ldx] *= scl;
+    }
+    __syncthreads();
+
+    // complete the basis for the columns associated with zero singular values
+    for(j = rank; j < k; j++)
+    {
+        // choose the unit vector e_l with the smallest component in the span of X[:,0:j]
+        p = 2;
+        l = 0;
+        for(i = tid; i < k; i += nthreads)
+        {
+            S w = 0;
+            for(m = 0; m < j; m++)
+                w += std::norm(X[i + m * ldx]);
+            if(w < p)
+            {
+                p = w;
+                l = i;
+            }
+        }
+        sh_val[tid] = p;
+        sh_idx[tid] = l;
+        __syncthreads();
+
+        if(tid == 0)
+        {
+            for(i = 1; i < min(k, nthreads); i++)
+            {
+                if(sh_val[i] < p)
+                {
+                    p = sh_val[i];
+                    l = sh_idx[i];
+                }
+            }
+            sh_idx[0] = l;
+        }
+        __syncthreads();
+        l = sh_idx[0];
+
+        // X[:,j] = (I - X[:,0:j] X[:,0:j]') e_l
+        p = 0;
+        for(i = tid; i < k; i += nthreads)
+        {
+            T w = (i == l ? T(1) : T(0));
+            for(m = 0; m < j; m++)
+                w -= X[i + m * ldx] * conj(X[l + m * ldx]);
+            X[i + j * ldx] = w;
+            p += std::norm(w);
+        }
+        __syncthreads();
+        sh_val[tid] = p;
+        __syncthreads();
+
+        if(tid == 0)
+        {
+            for(i = 1; i < min(k, nthreads); i++)
+                p += sh_val[i];
+            sh_val[0] = p;
+        }
+        __syncthreads();
+
+        T scl = T(1 / sqrt(sh_val[0]));
+        for(i = tid; i < k; i += nthreads)
+            X[i + j * ldx] *= scl;
+        __syncthreads();
+    }
+}
+
+/** GESVDJ_SMALL_KERNEL applies the one-sided Jacobi SVD algorithm to the k-by-k matrix X
+    (k <= GESVDJ_SMALL_SIZE) copied from A as in GESVDJ_INIT.
+    Pairs of columns (i,j) are orthogonalized by plane rotations applied from the right
+    (accumulated in V if rightv); ceil(k / 2) non-conflicting pairs, given by top/bottom
+    pairs, are processed in parallel. A pair is skipped if its columns are orthogonal to the
+    relative tolerance rot_tol, and the iterations stop once the off-diagonal part of X'X is
+    <= tol * norm(X'X), or once a sweep applies no rotation. X and V are kept in shared memory
+    for all the sweeps; the sorted and normalized results are written back to XX and VV.
+
+    Call this kernel with batch_count groups in z, and ceil(k / 2) threads in x and y. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void gesvdj_small_kernel(const bool leftv,
+                                          const bool rightv,
+                                          const rocblas_fill uplo,
+                                          const rocblas_int k,
+                                          U AA,
+                                          const rocblas_int shiftA,
+                                          const rocblas_int lda,
+                                          const rocblas_stride strideA,
+                                          const S tol,
+                                          const S rot_tol,
+                                          const S safmin,
+                                          S* residual,
+                                          const rocblas_int max_sweeps,
+                                          rocblas_int* n_sweeps,
+                                          S* SS,
+                                          const rocblas_stride strideS,
+                                          rocblas_int* info,
+                                          T* XX,
+                                          T* VV)
+{
+    rocblas_int tix = hipThreadIdx_x;
+    rocblas_int tiy = hipThreadIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    // local variables
+    S c, a, b;
+    T s1, s2, aij, temp1, temp2;
+    rocblas_int i, j, l;
+    rocblas_int x1 = 2 * tix, x2 = x1 + 1;
+    rocblas_int y1 = 2 * tiy, y2 = y1 + 1;
+    rocblas_int even_k = k + k % 2;
+    rocblas_int half_k = even_k / 2;
+    rocblas_int tid = tix + tiy * half_k;
+    rocblas_int nthreads = half_k * half_k;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    S* Sv = SS + bid * strideS;
+
+    // shared memory
+    extern __shared__ double lmem[];
+    T* X = reinterpret_cast<T*>(lmem);
+    T* V = X + k * k;
+    T* sines = V + (rightv ? k * k : 0);
+    S* cosines = reinterpret_cast<S*>(sines + half_k);
+    S* sh_val = cosines + half_k;
+    rocblas_int* top = reinterpret_cast<rocblas_int*>(sh_val + nthreads);
+    rocblas_int* bottom = top + half_k;
+    rocblas_int* sh_idx = bottom + half_k;
+
+    // load the matrix into shared memory and initialize V to the identity
+    for(l = tid; l < k * k; l += nthreads)
+    {
+        i = l % k;
+        j = l / k;
+        if(uplo == rocblas_fill_full || (uplo == rocblas_fill_upper && i <= j))
+            X[i + j * k] = A[i + j * lda];
+        else if(uplo == rocblas_fill_lower && i <= j)
+            X[i + j * k] = conj(A[j + i * lda]);
+        else
+            X[i + j * k] = 0;
+
+        if(rightv)
+            V[i + j * k] = (i == j ? 1 : 0);
+    }
+
+    // initialize top/bottom pairs
+    if(tiy == 0)
+    {
+        top[tix] = x1;
+        bottom[tix] = x2;
+    }
+    __syncthreads();
+
+    // norm of the Gram matrix for the convergence test
+    S off, diag;
+    gesvdj_gram_norms(tid, nthreads, k, X, k, sh_val, off, diag);
+    const S nrm = sqrt(off + diag);
+
+    // execute sweeps until convergence
+    rocblas_int sweeps = 0;
+    S local_res = 0;
+    bool converged = false;
+    while(sweeps < max_sweeps && !converged)
+    {
+        S local_rot = 0;
+        local_res = 0;
+
+        i = x1;
+        j = x2;
+        for(l = 0; l < even_k - 1; l++)
+        {
+            // compute the rotation for the pair of columns (i,j)
+            if(tiy == 0 && i < k && j < k)
+            {
+                a = 0;
+                b = 0;
+                aij = 0;
+                for(rocblas_int r = 0; r < k; r++)
+                {
+                    a += std::norm(X[r + i * k]);
+                    b += std::norm(X[r + j * k]);
+                    aij += conj(X[r + i * k]) * X[r + j * k];
+                }
+                local_res += 2 * std::norm(aij);
+
+                if(gesvdj_rotation(a, b, aij, rot_tol, c, s1))
+                    local_rot++;
+
+                cosines[tix] = c;
+                sines[tix] = s1;
+            }
+            __syncthreads();
+
+            // apply the rotation from the right
+            if(i < k && j < k && sines[tix] != T(0))
+            {
+                c = cosines[tix];
+                s1 = sines[tix];
+                s2 = conj(s1);
+
+                temp1 = X[y1 + i * k];
+                temp2 = X[y1 + j * k];
+                X[y1 + i * k] = c * temp1 + s2 * temp2;
+                X[y1 + j * k] = -s1 * temp1 + c * temp2;
+
+                if(y2 < k)
+                {
+                    temp1 = X[y2 + i * k];
+                    temp2 = X[y2 + j * k];
+                    X[y2 + i * k] = c * temp1 + s2 * temp2;
+                    X[y2 + j * k] = -s1 * temp1 + c * temp2;
+                }
+
+                // update right singular vectors
+                if(rightv)
+                {
+                    temp1 = V[y1 + i * k];
+                    temp2 = V[y1 + j * k];
+                    V[y1 + i * k] = c * temp1 + s2 * temp2;
+                    V[y1 + j * k] = -s1 * temp1 + c * temp2;
+
+                    if(y2 < k)
+                    {
+                        temp1 = V[y2 + i * k];
+                        temp2 = V[y2 + j * k];
+                        V[y2 + i * k] = c * temp1 + s2 * temp2;
+                        V[y2 + j * k] = -s1 * temp1 + c * temp2;
+                    }
+                }
+            }
+
+            // cycle top/bottom pairs
+            if(tix == 1)
+                i = bottom[0];
+            else if(tix > 1)
+                i = top[tix - 1];
+            if(tix == half_k - 1)
+                j = top[half_k - 1];
+            else
+                j = bottom[tix + 1];
+            __syncthreads();
+
+            if(tiy == 0)
+            {
+                top[tix] = i;
+                bottom[tix] = j;
+            }
+        }
+
+        // check convergence with the off-diagonal norm measured during the sweep
+        if(tiy == 0)
+        {
+            cosines[tix] = local_res;
+            sh_val[tix] = local_rot;
+        }
+        __syncthreads();
+
+        local_res = 0;
+        local_rot = 0;
+        for(l = 0; l < half_k; l++)
+        {
+            local_res += cosines[l];
+            local_rot += sh_val[l];
+        }
+        converged = (local_rot == 0 || sqrt(local_res) <= tol * nrm);
+        sweeps++;
+        __syncthreads();
+    }
+
+    // the residual is the off-diagonal norm of the Gram matrix at the final iteration
+    gesvdj_gram_norms(tid, nthreads, k, X, k, sh_val, off, diag);
+
+    // finalize outputs
+    if(tid == 0)
+    {
+        residual[bid] = sqrt(off);
+        n_sweeps[bid] = sweeps;
+        info[bid] = converged ? 0 : 1;
+    }
+
+    // compute singular values and sort & normalize singular vectors
+    gesvdj_sort_normalize(tid, nthreads, leftv, rightv, k, X, k, V, k, Sv, safmin, sh_val, sh_idx);
+
+    // write singular vectors back to global memory
+    T* Xg = XX + bid * k * k;
+    T* Vg = VV + bid * k * k;
+    for(l = tid; l < k * k; l += nthreads)
+    {
+        if(leftv)
+            Xg[l] = X[l];
+        if(rightv)
+            Vg[l] = V[l];
+    }
+}
+
+/** GESVDJ_INIT copies A to the k-by-k working matrix X, and sets V to the identity if rightv.
+    X is all of A if uplo is full, the upper triangle of A if uplo is upper, or the conjugate
+    transpose of the lower triangle of A if uplo is lower.
+
+    Call this kernel with batch_count groups in z, and enough groups and threads in x and y
+    to cover the k-by-k matrix. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gesvdj_init(const bool rightv,
+                                  const rocblas_fill uplo,
+                                  const rocblas_int k,
+                                  U AA,
+                                  const rocblas_int shiftA,
+                                  const rocblas_int lda,
+                                  const rocblas_stride strideA,
+                                  T* XX,
+                                  T* VV)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    if(i < k && j < k)
+    {
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+        T* X = XX + bid * k * k;
+
+        if(uplo == rocblas_fill_full || (uplo == rocblas_fill_upper && i <= j))
+            X[i + j * k] = A[i + j * lda];
+        else if(uplo == rocblas_fill_lower && i <= j)
+            X[i + j * k] = conj(A[j + i * lda]);
+        else
+            X[i + j * k] = 0;
+
+        if(rightv)
+            VV[bid * k * k + i + j * k] = (i == j ? 1 : 0);
+    }
+}
+
+/** GESVDJ_INIT_PAIRS initializes the top/bottom pairs.
+
+    Call this kernel with any number of threads in x. (Top/bottom pairs are shared across
+    batch instances, so only one thread group is needed.) **/
+ROCSOLVER_KERNEL void
+    gesvdj_init_pairs(const rocblas_int half_k, rocblas_int* top, rocblas_int* bottom)
+{
+    for(rocblas_int i = hipThreadIdx_x; i < half_k; i += hipBlockDim_x)
+    {
+        top[i] = 2 * i;
+        bottom[i] = 2 * i + 1;
+    }
+}
+
+/** GESVDJ_ROTATE orthogonalizes the pair of columns of X indexed by the top/bottom pair
+    associated with the thread group, and applies the same rotation to V if rightv. The squared
+    off-diagonal element of the Gram matrix and the number of rotations are accumulated
+    in pair_res and pair_rot for the convergence test.
+
+    Call this kernel with batch_count groups in y, ceil(k / 2) groups in x, and BS1 threads
+    in x. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gesvdj_rotate(const bool rightv,
+                                                           const rocblas_int k,
+                                                           T* XX,
+                                                           T* VV,
+                                                           const S tol,
+                                                           S* pair_res,
+                                                           S* pair_rot,
+                                                           rocblas_int* top,
+                                                           rocblas_int* bottom,
+                                                           rocblas_int* completed)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int pid = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int half_k = hipGridDim_x;
+
+    if(completed[bid + 1])
+        return;
+
+    rocblas_int i = top[pid];
+    rocblas_int j = bottom[pid];
+    if(i >= k || j >= k)
+        return;
+
+    // local variables
+    S c, a = 0, b = 0;
+    T s1, s2, aij = 0, temp1, temp2;
+    rocblas_int r;
+
+    // array pointers
+    T* X = XX + bid * k * k;
+    T* V = VV + bid * k * k;
+
+    // shared memory
+    __shared__ S sh_a[BS1];
+    __shared__ S sh_b[BS1];
+    __shared__ T sh_aij[BS1];
+
+    // compute the entries of the 2-by-2 Gram matrix
+    for(r = tid; r < k; r += BS1)
+    {
+        a += std::norm(X[r + i * k]);
+        b += std::norm(X[r + j * k]);
+        aij += conj(X[r + i * k]) * X[r + j * k];
+    }
+    sh_a[tid] = a;
+    sh_b[tid] = b;
+    sh_aij[tid] = aij;
+    __syncthreads();
+
+    for(r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+        {
+            sh_a[tid] += sh_a[tid + r];
+            sh_b[tid] += sh_b[tid + r];
+            sh_aij[tid] += sh_aij[tid + r];
+        }
+        __syncthreads();
+    }
+
+    // compute the rotation
+    if(tid == 0)
+    {
+        aij = sh_aij[0];
+        pair_res[bid * half_k + pid] += 2 * std::norm(aij);
+        if(gesvdj_rotation(sh_a[0], sh_b[0], aij, tol, c, s1))
+            pair_rot[bid * half_k + pid] += 1;
+
+        sh_a[0] = c;
+        sh_aij[0] = s1;
+    }
+    __syncthreads();
+
+    c = sh_a[0];
+    s1 = sh_aij[0];
+    s2 = conj(s1);
+    if(s1 == T(0))
+        return;
+
+    // apply the rotation from the right
+    for(r = tid; r < k; r += BS1)
+    {
+        temp1 = X[r + i * k];
+        temp2 = X[r + j * k];
+        X[r + i * k] = c * temp1 + s2 * temp2;
+        X[r + j * k] = -s1 * temp1 + c * temp2;
+
+        if(rightv)
+        {
+            temp1 = V[r + i * k];
+            temp2 = V[r + j * k];
+            V[r + i * k] = c * temp1 + s2 * temp2;
+            V[r + j * k] = -s1 * temp1 + c * temp2;
+        }
+    }
+}
+
+/** GESVDJ_GRAM_NORMS_KERNEL adds to off and diag the squared Frobenius norms of the
+    off-diagonal and diagonal parts of the Gram matrix X'X (see GESVDJ_GRAM_NORMS).
+
+    Call this kernel with batch_count groups in y, ceil(k * k / BS1) groups in x, and BS1
+    threads in x. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    gesvdj_gram_norms_kernel(const rocblas_int k, T* XX, S* off, S* diag)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int l = hipBlockIdx_x * BS1 + tid;
+    rocblas_int bid = hipBlockIdx_y;
+
+    // array pointers
+    T* X = XX + bid * k * k;
+
+    // shared memory
+    __shared__ S sh_off[BS1];
+    __shared__ S sh_diag[BS1];
+
+    // only the lower triangle of the hermitian Gram matrix is computed
+    S o = 0, d = 0;
+    rocblas_int i = l % k;
+    rocblas_int j = l / k;
+    if(l < k * k && i >= j)
+    {
+        T g = 0;
+        for(rocblas_int r = 0; r < k; r++)
+            g += conj(X[r + i * k]) * X[r + j * k];
+
+        if(i == j)
+            d = std::norm(g);
+        else
+            o = 2 * std::norm(g);
+    }
+    sh_off[tid] = o;
+    sh_diag[tid] = d;
+    __syncthreads();
+
+    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+        {
+            sh_off[tid] += sh_off[tid + r];
+            sh_diag[tid] += sh_diag[tid + r];
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        atomicAdd(off + bid, sh_off[0]);
+        atomicAdd(diag + bid, sh_diag[0]);
+    }
+}
+
+/** GESVDJ_CALC_NORM checks convergence at the end of a sweep. An instance has converged if
+    the off-diagonal norm of the Gram matrix measured during the sweep is <= tol times the
+    norm of the Gram matrix (given by off and diag, see GESVDJ_GRAM_NORMS), or if no rotation
+    was applied during the sweep.
+
+    Call this kernel with batch_count groups in y, and BS1 threads in x. **/
+template <typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gesvdj_calc_norm(const rocblas_int half_k,
+                                                              const rocblas_int sweeps,
+                                                              const S tol,
+                                                              S* off,
+                                                              S* diag,
+                                                              S* pair_res,
+                                                              S* pair_rot,
+                                                              rocblas_int* completed)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(completed[bid + 1])
+        return;
+
+    // shared memory
+    __shared__ S sh_res[BS1];
+    __shared__ S sh_rot[BS1];
+
+    S local_res = 0;
+    S local_rot = 0;
+    for(rocblas_int i = tid; i < half_k; i += BS1)
+    {
+        local_res += pair_res[bid * half_k + i];
+        local_rot += pair_rot[bid * half_k + i];
+        pair_res[bid * half_k + i] = 0;
+        pair_rot[bid * half_k + i] = 0;
+    }
+    sh_res[tid] = local_res;
+    sh_rot[tid] = local_rot;
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        for(rocblas_int i = 1; i < min(half_k, BS1); i++)
+        {
+            local_res += sh_res[i];
+            local_rot += sh_rot[i];
+        }
+
+        if(local_rot == 0 || sqrt(local_res) <= tol * sqrt(off[bid] + diag[bid]))
+        {
+            completed[bid + 1] = sweeps;
+            atomicAdd(completed, 1);
+        }
+    }
+}
+
+/** GESVDJ_FINALIZE_ONESIDED sets the output values for the blocked algorithm (the residual is
+    given by off, see GESVDJ_GRAM_NORMS), and computes, sorts and normalizes the singular values
+    and vectors.
+
+    Call this kernel with batch_count groups in y, and BS1 threads in x. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gesvdj_finalize_onesided(const bool leftv,
+                                                                      const bool rightv,
+                                                                      const rocblas_int k,
+                                                                      const rocblas_int max_sweeps,
+                                                                      S* residual,
+                                                                      S* off,
+                                                                      rocblas_int* n_sweeps,
+                                                                      S* SS,
+                                                                      const rocblas_stride strideS,
+                                                                      rocblas_int* info,
+                                                                      const S safmin,
+                                                                      T* XX,
+                                                                      T* VV,
+                                                                      rocblas_int* completed)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    // shared memory
+    __shared__ S sh_val[BS1];
+    __shared__ rocblas_int sh_idx[BS1];
+
+    // finalize outputs
+    if(tid == 0)
+    {
+        residual[bid] = sqrt(off[bid]);
+
+        rocblas_int sweeps = completed[bid + 1];
+        if(sweeps > 0)
+        {
+            n_sweeps[bid] = sweeps;
+            info[bid] = 0;
+        }
+        else
+        {
+            n_sweeps[bid] = max_sweeps;
+            info[bid] = 1;
+        }
+    }
+
+    gesvdj_sort_normalize(tid, BS1, leftv, rightv, k, XX + bid * k * k, k, VV + bid * k * k, k,
+                          SS + bid * strideS, safmin, sh_val, sh_idx);
+}
+
+/** GESVDJ_SET_SVECT copies the k-by-k matrix X (or its conjugate transpose if trans) to the
+    leading block of the rows-by-cols matrix B, and sets the rest of B to the identity.
+
+    Call this kernel with batch_count groups in z, and enough groups and threads in x and y
+    to cover the rows-by-cols matrix. **/
+template <typename T>
+ROCSOLVER_KERNEL void gesvdj_set_svect(const bool trans,
+                                       const rocblas_int rows,
+                                       const rocblas_int cols,
+                                       const rocblas_int k,
+                                       T* XX,
+                                       T* BB,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    rocblas_int bid = hipBlockIdx_z;
+
+    if(i < rows && j < cols)
+    {
+        T* X = XX + bid * k * k;
+        T* B = BB + bid * strideB;
+
+        if(i < k && j < k)
+            B[i + j * ldb] = (trans ? conj(X[j + i * k]) : X[i + j * k]);
+        else
+            B[i + j * ldb] = (i == j ? 1 : 0);
+    }
+}
+
 /** Argument checking **/
 template <typename T, typename SS, typename W>
 rocblas_status rocsolver_gesvdj_argCheck(rocblas_handle handle,
@@ -120,25 +938,27 @@ void rocsolver_gesvdj_getMemorySize(const rocblas_svect left_svect,
                                     const rocblas_int n,
                                     const rocblas_int batch_count,
                                     size_t* size_scalars,
-                                    size_t* size_VUtmp,
-                                    size_t* size_work1_UVtmp,
+                                    size_t* size_Xtmp,
+                                    size_t* size_Vtmp,
+                                    size_t* size_Qtmp,
+                                    size_t* size_work1,
                                     size_t* size_work2,
                                     size_t* size_work3,
-                                    size_t* size_work4,
-                                    size_t* size_work5_ipiv,
-                                    size_t* size_work6_workArr)
+                                    size_t* size_work4_workArr,
+                                    size_t* size_ipiv)
 {
     // if quick return, set workspace to zero
     if(n == 0 || m == 0 || batch_count == 0)
     {
         *size_scalars = 0;
-        *size_VUtmp = 0;
-        *size_work1_UVtmp = 0;
+        *size_Xtmp = 0;
+        *size_Vtmp = 0;
+        *size_Qtmp = 0;
+        *size_work1 = 0;
         *size_work2 = 0;
         *size_work3 = 0;
-        *size_work4 = 0;
-        *size_work5_ipiv = 0;
-        *size_work6_workArr = 0;
+        *size_work4_workArr = 0;
+        *size_ipiv = 0;
         return;
     }
 
@@ -146,69 +966,62 @@ void rocsolver_gesvdj_getMemorySize(const rocblas_svect left_svect,
     bool rightv = right_svect != rocblas_svect_none;
     bool left_full = left_svect == rocblas_svect_all;
     bool right_full = right_svect == rocblas_svect_all;
-    size_t a1 = 0, a2 = 0;
+    rocblas_int k = min(m, n);
+    rocblas_int half_k = (k + k % 2) / 2;
+    size_t a1 = 0, a2 = 0, a3 = 0;
     size_t b1 = 0, b2 = 0, b3 = 0;
     size_t c1 = 0, c2 = 0, c3 = 0;
-    size_t d1 = 0, d2 = 0, d3 = 0;
-    size_t e1 = 0, e2 = 0;
-    size_t f1 = 0, f2 = 0, f3 = 0, f4 = 0;
-    size_t unused;
+    size_t d1 = 0, d2 = 0;
+    size_t s1 = 0, s2 = 0;
 
-    *size_VUtmp = 0;
+    *size_Qtmp = 0;
+    *size_ipiv = 0;
 
-    if(m >= n)
+    if(m > n)
     {
-        // requirements for Jacobi eigensolver
-        rocsolver_syevj_heevj_getMemorySize<BATCHED, T, SS>(rocblas_evect_original,
-                                                            rocblas_fill_upper, n, batch_count, &a1,
-                                                            &b1, &c1, &d1, &e1, &f1);
-
-        // requirements for QR factorization
-        rocsolver_geqrf_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars, &b2, &c2, &d2,
-                                                  &f2);
-        if(left_svect != rocblas_svect_none)
-            rocsolver_orgqr_ungqr_getMemorySize<BATCHED, T>(m, (left_full ? m : n), n, batch_count,
-                                                            &unused, &b3, &c3, &d3, &f3);
-
-        // extra requirements for temporary V & U storage
-        *size_VUtmp = sizeof(T) * n * n * batch_count;
-        if(!leftv)
-            a2 = sizeof(T) * m * n * batch_count;
+        // requirements for QR preconditioning
+        rocsolver_geqrf_getMemorySize<false, T>(m, n, batch_count, &s1, &a1, &b1, &c1, &d1);
+        if(leftv)
+            rocsolver_ormqr_unmqr_getMemorySize<false, T>(rocblas_side_left, m,
+                                                          (left_full ? m : n), n, batch_count,
+                                                          &s2, &a2, &b2, &c2, &d2);
     }
-    else
+    else if(m < n)
     {
-        // requirements for Jacobi eigensolver
-        rocsolver_syevj_heevj_getMemorySize<BATCHED, T, SS>(rocblas_evect_original,
-                                                            rocblas_fill_upper, m, batch_count, &a1,
-                                                            &b1, &c1, &d1, &e1, &f1);
-
-        // requirements for LQ factorization
-        rocsolver_gelqf_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars, &b2, &c2, &d2,
-                                                  &f2);
-        if(right_svect != rocblas_svect_none)
-            rocsolver_orglq_unglq_getMemorySize<BATCHED, T>((right_full ? n : m), n, m, batch_count,
-                                                            &unused, &b3, &c3, &d3, &f3);
+        // requirements for LQ preconditioning
+        rocsolver_gelqf_getMemorySize<false, T>(m, n, batch_count, &s1, &a1, &b1, &c1, &d1);
+        if(rightv)
+            rocsolver_ormlq_unmlq_getMemorySize<false, T>(rocblas_side_right, (right_full ? n : m),
+                                                          n, m, batch_count, &s2, &a2, &b2, &c2,
+                                                          &d2);
+    }
 
-        // extra requirements for temporary U & V storage
-        if(!leftv)
-            *size_VUtmp = sizeof(T) * m * m * batch_count;
-        if(!rightv)
-            a2 = sizeof(T) * m * n * batch_count;
+    if(m != n)
+    {
+        // extra requirements for the copy of A holding the Householder vectors and scalars
+        *size_Qtmp = sizeof(T) * m * n * batch_count;
+        *size_ipiv = sizeof(T) * k * batch_count;
     }
 
-    // extra requirements for temporary Householder scalars
-    e2 = sizeof(T) * min(m, n) * batch_count;
+    // extra requirements for the working matrix and the accumulated rotations
+    // (which hold the left singular vectors if m < n)
+    bool rotv = (m < n ? leftv : rightv);
+    *size_Xtmp = sizeof(T) * k * k * batch_count;
+    *size_Vtmp = (rotv ? sizeof(T) * k * k * batch_count : 0);
 
-    // size of array of pointers (batched cases)
-    if(BATCHED)
-        f4 = sizeof(T*) * 2 * batch_count;
+    if(k > GESVDJ_SMALL_SIZE)
+    {
+        // extra requirements for top/bottom pairs, completion flags and convergence test
+        a3 = sizeof(rocblas_int) * 2 * half_k;
+        b3 = sizeof(rocblas_int) * (batch_count + 1);
+        c3 = sizeof(SS) * 2 * (half_k + 1) * batch_count;
+    }
 
-    *size_work1_UVtmp = std::max({a1, a2});
+    *size_scalars = std::max(s1, s2);
+    *size_work1 = std::max({a1, a2, a3});
     *size_work2 = std::max({b1, b2, b3});
     *size_work3 = std::max({c1, c2, c3});
-    *size_work4 = std::max({d1, d2, d3});
-    *size_work5_ipiv = std::max({e1, e2});
-    *size_work6_workArr = std::max({f1, f2, f3, f4});
+    *size_work4_workArr = std::max(d1, d2);
 }
 
 template <bool BATCHED, bool STRIDED, typename T, typename SS, typename W>
@@ -236,13 +1049,14 @@ rocblas_status rocsolver_gesvdj_template(rocblas_handle handle,
                                          rocblas_int* info,
                                          const rocblas_int batch_count,
                                          T* scalars,
-                                         T* VUtmp,
-                                         void* work1_UVtmp,
+                                         T* Xtmp,
+                                         T* Vtmp,
+                                         T* Qtmp,
+                                         void* work1,
                                          void* work2,
                                          void* work3,
-                                         void* work4,
-                                         void* work5_ipiv,
-                                         void* work6_workArr)
+                                         void* work4_workArr,
+                                         T* ipiv)
 {
     ROCSOLVER_ENTER("gesvdj", "leftsv:", left_svect, "rightsv:", right_svect, "m:", m, "n:", n,
                     "shiftA:", shiftA, "lda:", lda, "abstol:", abstol, "max_sweeps:", max_sweeps,
@@ -255,13 +1069,13 @@ rocblas_status rocsolver_gesvdj_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threadsReset(BS1, 1, 1);
+
     // quick return
     if(m == 0 || n == 0)
     {
-        rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
-        dim3 gridReset(blocksReset, 1, 1);
-        dim3 threadsReset(BS1, 1, 1);
-
         ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, residual,
                                 batch_count, 0);
         ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, n_sweeps,
@@ -280,107 +1094,194 @@ rocblas_status rocsolver_gesvdj_template(rocblas_handle handle,
     bool rightv = right_svect != rocblas_svect_none;
     bool left_full = left_svect == rocblas_svect_all;
     bool right_full = right_svect == rocblas_svect_all;
-    T minone = T(-1);
-    T one = T(1);
-    T zero = T(0);
-
-    if(m >= n)
-    {
-        // compute -A'A
-        T* V_gemm = VUtmp;
-        rocblas_int ldv_gemm = n;
-        rocblas_int strideV_gemm = n * n;
-
-        rocblasCall_gemm<BATCHED, STRIDED, T>(
-            handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, n, n, m, &minone,
-            A, shiftA, lda, strideA, A, shiftA, lda, strideA, &zero, V_gemm, 0, ldv_gemm,
-            strideV_gemm, batch_count, (T**)work6_workArr);
-
-        // apply eigenvalue decomposition to -A'A, obtaining V as eigenvectors
-        rocsolver_syevj_heevj_template<false, STRIDED, T>(
-            handle, rocblas_esort_ascending, rocblas_evect_original, rocblas_fill_upper, n, V_gemm,
-            0, ldv_gemm, strideV_gemm, abstol, residual, max_sweeps, n_sweeps, S, strideS, info,
-            batch_count, (T*)work1_UVtmp, (T*)work2, (SS*)work3, (rocblas_int*)work4,
-            (rocblas_int*)work5_ipiv, (rocblas_int*)work6_workArr);
-
-        // compute AV
-        T* U_gemm = (leftv ? U : (T*)work1_UVtmp);
-        rocblas_int ldu_gemm = (leftv ? ldu : m);
-        rocblas_int strideU_gemm = (leftv ? strideU : m * n);
-
-        rocblasCall_gemm<BATCHED, STRIDED, T>(handle, rocblas_operation_none, rocblas_operation_none,
-                                              m, n, n, &one, A, shiftA, lda, strideA, V_gemm, 0,
-                                              ldv_gemm, strideV_gemm, &zero, U_gemm, 0, ldu_gemm,
-                                              strideU_gemm, batch_count, (T**)work6_workArr);
-
-        // apply QR factorization to AV, obtaining U = Q and S = R
-        rocsolver_geqrf_template<false, STRIDED, T>(handle, m, n, U_gemm, 0, ldu_gemm, strideU_gemm,
-                                                    (T*)work5_ipiv, n, batch_count, scalars, work2,
-                                                    (T*)work3, (T*)work4, (T**)work6_workArr);
-
-        rocblas_int blocks = (n - 1) / BS1 + 1;
-        ROCSOLVER_LAUNCH_KERNEL(gesvdj_finalize<T>, dim3(blocks, batch_count, 1), dim3(BS1, 1, 1),
-                                0, stream, n, S, strideS, U_gemm, ldu_gemm, strideU_gemm, V_gemm,
-                                ldv_gemm, strideV_gemm);
+    rocblas_int k = min(m, n);
+    rocblas_int even_k = k + k % 2;
+    rocblas_int half_k = even_k / 2;
 
-        if(leftv)
-            rocsolver_orgqr_ungqr_template<false, STRIDED, T>(
-                handle, m, (left_full ? m : n), n, U_gemm, 0, ldu_gemm, strideU_gemm, (T*)work5_ipiv,
-                n, batch_count, scalars, (T*)work2, (T*)work3, (T*)work4, (T**)work6_workArr);
+    // if m < n, the Jacobi iterations work on the conjugate transpose of the triangular factor
+    // of A, so that the Gram matrix is AA' (up to the rotations); the normalized columns of X
+    // then give the right singular vectors, and the accumulated rotations the left ones
+    bool xvect = (m < n ? rightv : leftv);
+    bool rotv = (m < n ? leftv : rightv);
+    T* Ux = (m < n ? Vtmp : Xtmp);
+    T* Vx = (m < n ? Xtmp : Vtmp);
 
-        // transpose V
-        if(rightv)
+    // tolerance for the convergence test on the Gram matrix, and relative tolerance for
+    // evaluating when a pair of columns is orthogonal in working precision
+    SS eps = get_epsilon<SS>();
+    SS safmin = get_safemin<SS>();
+    SS tol = (abstol <= 0 ? eps : abstol);
+    SS rot_tol = eps * k;
+
+    rocblas_int blocksm = (m - 1) / BS2 + 1;
+    rocblas_int blocksn = (n - 1) / BS2 + 1;
+    rocblas_int blocksk = (k - 1) / BS2 + 1;
+    dim3 threadsBS2(BS2, BS2, 1);
+
+    // the Jacobi iterations work on a k-by-k matrix X; if A is not square, X is the triangular
+    // factor of the QR factorization (resp. the conjugate transpose of the triangular factor of
+    // the LQ factorization) of A, whose Householder vectors are kept in Qtmp to recover the
+    // singular vectors at the end
+    rocblas_fill uplo = rocblas_fill_full;
+    if(m > n)
+    {
+        uplo = rocblas_fill_upper;
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocksm, blocksn, batch_count), threadsBS2, 0,
+                                stream, m, n, A, shiftA, lda, strideA, Qtmp, 0, m, m * n);
+        rocsolver_geqrf_template<false, STRIDED, T>(handle, m, n, Qtmp, 0, m, m * n, ipiv, k,
+                                                    batch_count, scalars, work1, (T*)work2,
+                                                    (T*)work3, (T**)work4_workArr);
+    }
+    else if(m < n)
+    {
+        uplo = rocblas_fill_lower;
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocksm, blocksn, batch_count), threadsBS2, 0,
+                                stream, m, n, A, shiftA, lda, strideA, Qtmp, 0, m, m * n);
+        rocsolver_gelqf_template<false, STRIDED, T>(handle, m, n, Qtmp, 0, m, m * n, ipiv, k,
+                                                    batch_count, scalars, work1, (T*)work2,
+                                                    (T*)work3, (T**)work4_workArr);
+    }
+
+    if(k <= GESVDJ_SMALL_SIZE)
+    {
+        // *** USE SINGLE SMALL-SIZE KERNEL ***
+
+        dim3 grid(1, 1, batch_count);
+        dim3 threads(half_k, half_k, 1);
+        size_t lmemsize = sizeof(T) * (k * k * (rotv ? 2 : 1) + half_k)
+            + sizeof(SS) * (half_k + half_k * half_k) + sizeof(rocblas_int) * (2 + half_k) * half_k;
+
+        if(m == n)
+            ROCSOLVER_LAUNCH_KERNEL((gesvdj_small_kernel<T>), grid, threads, lmemsize, stream,
+                                    xvect, rotv, uplo, k, A, shiftA, lda, strideA, tol, rot_tol,
+                                    safmin, residual, max_sweeps, n_sweeps, S, strideS, info, Xtmp,
+                                    Vtmp);
+        else
+            ROCSOLVER_LAUNCH_KERNEL((gesvdj_small_kernel<T>), grid, threads, lmemsize, stream,
+                                    xvect, rotv, uplo, k, Qtmp, 0, m, m * n, tol, rot_tol, safmin,
+                                    residual, max_sweeps, n_sweeps, S, strideS, info, Xtmp, Vtmp);
+    }
+    else
+    {
+        // *** USE PAIRWISE KERNELS ***
+
+        rocblas_int* top = (rocblas_int*)work1;
+        rocblas_int* bottom = top + half_k;
+        rocblas_int* completed = (rocblas_int*)work2;
+        SS* pair_res = (SS*)work3;
+        SS* pair_rot = pair_res + half_k * batch_count;
+        SS* gram_off = pair_rot + half_k * batch_count;
+        SS* gram_diag = gram_off + batch_count;
+
+        dim3 grid(1, batch_count, 1);
+        dim3 gridRot(half_k, batch_count, 1);
+        dim3 gridPairs(1, 1, 1);
+        dim3 gridGram((k * k - 1) / BS1 + 1, batch_count, 1);
+        dim3 threads(BS1, 1, 1);
+        size_t lmemsizePairs = (half_k > BS1 ? 2 * sizeof(rocblas_int) * half_k : 0);
+
+        rocblas_int h_sweeps = 0;
+        rocblas_int h_completed = 0;
+
+        // set completed = 0 and clear the convergence accumulators
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(batch_count / BS1 + 1, 1, 1), threadsReset, 0,
+                                stream, completed, batch_count + 1, 0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_info,
+                                dim3((2 * (half_k + 1) * batch_count - 1) / BS1 + 1, 1, 1),
+                                threadsReset, 0, stream, pair_res, 2 * (half_k + 1) * batch_count,
+                                0);
+
+        // copy A (or its triangular factor) to X, set V to the identity (if applicable),
+        // and initialize top/bottom pairs
+        dim3 gridInit(blocksk, blocksk, batch_count);
+        if(m == n)
+            ROCSOLVER_LAUNCH_KERNEL(gesvdj_init<T>, gridInit, threadsBS2, 0, stream, rotv, uplo, k,
+                                    A, shiftA, lda, strideA, Xtmp, Vtmp);
+        else
+            ROCSOLVER_LAUNCH_KERNEL(gesvdj_init<T>, gridInit, threadsBS2, 0, stream, rotv, uplo, k,
+                                    Qtmp, 0, m, m * n, Xtmp, Vtmp);
+        ROCSOLVER_LAUNCH_KERNEL(gesvdj_init_pairs, gridPairs, threads, 0, stream, half_k, top,
+                                bottom);
+
+        // norm of the Gram matrix for the convergence test
+        ROCSOLVER_LAUNCH_KERNEL((gesvdj_gram_norms_kernel<T, SS>), gridGram, threads, 0, stream, k,
+                                Xtmp, gram_off, gram_diag);
+
+        while(h_sweeps < max_sweeps)
         {
-            rocblas_int blocks_n = (n - 1) / BS2 + 1;
-            ROCSOLVER_LAUNCH_KERNEL(copy_trans_mat<T>, dim3(blocks_n, blocks_n, batch_count),
-                                    dim3(BS2, BS2, 1), 0, stream,
-                                    rocblas_operation_conjugate_transpose, n, n, V_gemm, 0,
-                                    ldv_gemm, strideV_gemm, V, 0, ldv, strideV);
+            // if all instances in the batch have finished, exit the loop
+            hipError_t status = hipMemcpyAsync(&h_completed, completed, sizeof(rocblas_int),
+                                               hipMemcpyDeviceToHost, stream);
+            if(status != hipSuccess)
+                return get_rocblas_status_for_hip_status(status);
+
+            status = hipStreamSynchronize(stream);
+            if(status != hipSuccess)
+                return get_rocblas_status_for_hip_status(status);
+
+            if(h_completed == batch_count)
+                break;
+
+            for(rocblas_int b = 0; b < even_k - 1; b++)
+            {
+                // orthogonalize the pairs of columns indexed by top/bottom pairs
+                ROCSOLVER_LAUNCH_KERNEL((gesvdj_rotate<T, SS>), gridRot, threads, 0, stream, rotv,
+                                        k, Xtmp, Vtmp, rot_tol, pair_res, pair_rot, top, bottom,
+                                        completed);
+
+                // cycle top/bottom pairs
+                ROCSOLVER_LAUNCH_KERNEL(syevj_cycle_pairs<T>, gridPairs, threads, lmemsizePairs,
+                                        stream, half_k, top, bottom);
+            }
+
+            // check convergence
+            h_sweeps++;
+            ROCSOLVER_LAUNCH_KERNEL(gesvdj_calc_norm<SS>, grid, threads, 0, stream, half_k,
+                                    h_sweeps, tol, gram_off, gram_diag, pair_res, pair_rot,
+                                    completed);
         }
+
+        // the residual is the off-diagonal norm of the Gram matrix at the final iteration
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3((2 * batch_count - 1) / BS1 + 1, 1, 1),
+                                threadsReset, 0, stream, gram_off, 2 * batch_count, 0);
+        ROCSOLVER_LAUNCH_KERNEL((gesvdj_gram_norms_kernel<T, SS>), gridGram, threads, 0, stream, k,
+                                Xtmp, gram_off, gram_diag);
+
+        // set outputs and compute, sort and normalize singular values & vectors
+        ROCSOLVER_LAUNCH_KERNEL((gesvdj_finalize_onesided<T, SS>), grid, threads, 0, stream, xvect,
+                                rotv, k, max_sweeps, residual, gram_off, n_sweeps, S, strideS, info,
+                                safmin, Xtmp, Vtmp, completed);
     }
-    else
+
+    // recover the singular vectors of A
+    if(leftv)
     {
-        // compute -AA'
-        T* U_gemm = (leftv ? U : VUtmp);
-        rocblas_int ldu_gemm = (leftv ? ldu : m);
-        rocblas_int strideU_gemm = (leftv ? strideU : m * m);
-
-        rocblasCall_gemm<BATCHED, STRIDED, T>(
-            handle, rocblas_operation_none, rocblas_operation_conjugate_transpose, m, m, n, &minone,
-            A, shiftA, lda, strideA, A, shiftA, lda, strideA, &zero, U_gemm, 0, ldu_gemm,
-            strideU_gemm, batch_count, (T**)work6_workArr);
-
-        // apply eigenvalue decomposition to -AA', obtaining U as eigenvectors
-        rocsolver_syevj_heevj_template<false, STRIDED, T>(
-            handle, rocblas_esort_ascending, rocblas_evect_original, rocblas_fill_upper, m, U_gemm,
-            0, ldu_gemm, strideU_gemm, abstol, residual, max_sweeps, n_sweeps, S, strideS, info,
-            batch_count, (T*)work1_UVtmp, (T*)work2, (SS*)work3, (rocblas_int*)work4,
-            (rocblas_int*)work5_ipiv, (rocblas_int*)work6_workArr);
-
-        // compute U'A
-        T* V_gemm = (rightv ? V : (T*)work1_UVtmp);
-        rocblas_int ldv_gemm = (rightv ? ldv : m);
-        rocblas_int strideV_gemm = (rightv ? strideV : m * n);
-
-        rocblasCall_gemm<BATCHED, STRIDED, T>(
-            handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, m, n, m, &one,
-            U_gemm, 0, ldu_gemm, strideU_gemm, A, shiftA, lda, strideA, &zero, V_gemm, 0, ldv_gemm,
-            strideV_gemm, batch_count, (T**)work6_workArr);
-
-        // apply LQ factorization to U'A, obtaining S = L and V' = Q
-        rocsolver_gelqf_template<false, STRIDED, T>(handle, m, n, V_gemm, 0, ldv_gemm, strideV_gemm,
-                                                    (T*)work5_ipiv, m, batch_count, scalars, work2,
-                                                    (T*)work3, (T*)work4, (T**)work6_workArr);
-
-        rocblas_int blocks = (m - 1) / BS1 + 1;
-        ROCSOLVER_LAUNCH_KERNEL(gesvdj_finalize<T>, dim3(blocks, batch_count, 1), dim3(BS1, 1, 1),
-                                0, stream, m, S, strideS, V_gemm, ldv_gemm, strideV_gemm, U_gemm,
-                                ldu_gemm, strideU_gemm);
+        // U = Q * [Ux 0; 0 I] if m > n, or U = Ux otherwise
+        rocblas_int ucols = (m > n && left_full ? m : k);
+        ROCSOLVER_LAUNCH_KERNEL(gesvdj_set_svect<T>,
+                                dim3(blocksm, (ucols - 1) / BS2 + 1, batch_count), threadsBS2, 0,
+                                stream, false, m, ucols, k, Ux, U, ldu, strideU);
 
-        if(rightv)
-            rocsolver_orglq_unglq_template<false, STRIDED, T>(
-                handle, (right_full ? n : m), n, m, V_gemm, 0, ldv_gemm, strideV_gemm, (T*)work5_ipiv,
-                m, batch_count, scalars, (T*)work2, (T*)work3, (T*)work4, (T**)work6_workArr);
+        if(m > n)
+            rocsolver_ormqr_unmqr_template<false, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_none, m, ucols, n, Qtmp, 0, m, m * n,
+                ipiv, k, U, 0, ldu, strideU, batch_count, scalars, (T*)work1, (T*)work2,
+                (T*)work3, (T**)work4_workArr);
+    }
+
+    if(rightv)
+    {
+        // V' = [Vx' 0; 0 I] * Q if m < n, or V' = Vx' otherwise
+        rocblas_int vrows = (m < n && right_full ? n : k);
+        ROCSOLVER_LAUNCH_KERNEL(gesvdj_set_svect<T>,
+                                dim3((vrows - 1) / BS2 + 1, blocksn, batch_count), threadsBS2, 0,
+                                stream, true, vrows, n, k, Vx, V, ldv, strideV);
+
+        if(m < n)
+            rocsolver_ormlq_unmlq_template<false, STRIDED, T>(
+                handle, rocblas_side_right, rocblas_operation_none, vrows, n, m, Qtmp, 0, m, m * n,
+                ipiv, k, V, 0, ldv, strideV, batch_count, scalars, (T*)work1, (T*)work2,
+                (T*)work3, (T**)work4_workArr);
     }
 
     rocblas_set_pointer_mode(handle, old_mode);
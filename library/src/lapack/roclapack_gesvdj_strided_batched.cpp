@@ -51,35 +51,37 @@ rocblas_status rocsolver_gesvdj_strided_batched_impl(rocblas_handle handle,
     // size for constants in rocblas calls
     size_t size_scalars;
     // size for temporary matrix storage
-    size_t size_VUtmp;
-    // extra requirements for calling SYEVJ/HEEVJ, GEQRF, ORGQR/UNGQR, GELQF, ORGLQ/UNGLQ
-    size_t size_work1_UVtmp, size_work2, size_work3, size_work4, size_work5_ipiv, size_work6_workArr;
+    size_t size_Xtmp, size_Vtmp, size_Qtmp;
+    // extra requirements for calling GEQRF, GELQF, ORMQR/UNMQR, ORMLQ/UNMLQ and for Jacobi
+    size_t size_work1, size_work2, size_work3, size_work4_workArr, size_ipiv;
 
-    rocsolver_gesvdj_getMemorySize<false, T, SS>(
-        left_svect, right_svect, m, n, batch_count, &size_scalars, &size_VUtmp, &size_work1_UVtmp,
-        &size_work2, &size_work3, &size_work4, &size_work5_ipiv, &size_work6_workArr);
+    rocsolver_gesvdj_getMemorySize<false, T, SS>(left_svect, right_svect, m, n, batch_count,
+                                                 &size_scalars, &size_Xtmp, &size_Vtmp, &size_Qtmp,
+                                                 &size_work1, &size_work2, &size_work3,
+                                                 &size_work4_workArr, &size_ipiv);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(
-            handle, size_scalars, size_VUtmp, size_work1_UVtmp, size_work2, size_work3, size_work4,
-            size_work5_ipiv, size_work6_workArr);
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_Xtmp, size_Vtmp,
+                                                      size_Qtmp, size_work1, size_work2, size_work3,
+                                                      size_work4_workArr, size_ipiv);
 
     // memory workspace allocation
-    void *scalars, *VUtmp, *work1_UVtmp, *work2, *work3, *work4, *work5_ipiv, *work6_workArr;
-    rocblas_device_malloc mem(handle, size_scalars, size_VUtmp, size_work1_UVtmp, size_work2,
-                              size_work3, size_work4, size_work5_ipiv, size_work6_workArr);
+    void *scalars, *Xtmp, *Vtmp, *Qtmp, *work1, *work2, *work3, *work4_workArr, *ipiv;
+    rocblas_device_malloc mem(handle, size_scalars, size_Xtmp, size_Vtmp, size_Qtmp, size_work1,
+                              size_work2, size_work3, size_work4_workArr, size_ipiv);
 
     if(!mem)
         return rocblas_status_memory_error;
 
     scalars = mem[0];
-    VUtmp = mem[1];
-    work1_UVtmp = mem[2];
-    work2 = mem[3];
-    work3 = mem[4];
-    work4 = mem[5];
-    work5_ipiv = mem[6];
-    work6_workArr = mem[7];
+    Xtmp = mem[1];
+    Vtmp = mem[2];
+    Qtmp = mem[3];
+    work1 = mem[4];
+    work2 = mem[5];
+    work3 = mem[6];
+    work4_workArr = mem[7];
+    ipiv = mem[8];
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
@@ -87,7 +89,7 @@ rocblas_status rocsolver_gesvdj_strided_batched_impl(rocblas_handle handle,
     return rocsolver_gesvdj_template<false, true, T>(
         handle, left_svect, right_svect, m, n, A, shiftA, lda, strideA, abstol, residual,
         max_sweeps, n_sweeps, S, strideS, U, ldu, strideU, V, ldv, strideV, info, batch_count,
-        (T*)scalars, (T*)VUtmp, work1_UVtmp, work2, work3, work4, work5_ipiv, work6_workArr);
+        (T*)scalars, (T*)Xtmp, (T*)Vtmp, (T*)Qtmp, work1, work2, work3, work4_workArr, (T*)ipiv);
 }
 
 /*
@@ -0,0 +1,167 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_ggglm.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_ggglm_impl(rocblas_handle handle,
+                                    const rocblas_int n,
+                                    const rocblas_int m,
+                                    const rocblas_int p,
+                                    U A,
+                                    const rocblas_int lda,
+                                    U B,
+                                    const rocblas_int ldb,
+                                    U D,
+                                    U X,
+                                    U Y,
+                                    rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("ggglm", "-n", n, "-m", m, "-p", p, "--lda", lda, "--ldb", ldb);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_ggglm_argCheck(handle, n, m, p, lda, ldb, A, B, D, X, Y, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+    rocblas_int shiftD = 0;
+    rocblas_int shiftX = 0;
+    rocblas_int shiftY = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideD = 0;
+    rocblas_stride strideX = 0;
+    rocblas_stride strideY = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of workspace (for calling GGQRF, ORMQR, ORMRQ and TRSM)
+    bool optim_mem;
+    size_t size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
+        size_trfact_workTrmm_invA_arr;
+    // size of the Householder scalars
+    size_t size_tau;
+    rocsolver_ggglm_getMemorySize<false, false, T>(n, m, p, batch_count, &size_scalars,
+                                                   &size_work_x_temp, &size_workArr_temp_arr,
+                                                   &size_diag_trfac_invA,
+                                                   &size_trfact_workTrmm_invA_arr, &size_tau,
+                                                   &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_x_temp,
+                                                      size_workArr_temp_arr, size_diag_trfac_invA,
+                                                      size_trfact_workTrmm_invA_arr, size_tau);
+
+    // memory workspace allocation
+    void *scalars, *work_x_temp, *workArr_temp_arr, *diag_trfac_invA, *trfact_workTrmm_invA_arr,
+        *tau;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+                              size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_tau);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_x_temp = mem[1];
+    workArr_temp_arr = mem[2];
+    diag_trfac_invA = mem[3];
+    trfact_workTrmm_invA_arr = mem[4];
+    tau = mem[5];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_ggglm_template<false, false, T>(handle, n, m, p, A, shiftA, lda, strideA, B,
+                                                     shiftB, ldb, strideB, D, shiftD, strideD, X,
+                                                     shiftX, strideX, Y, shiftY, strideY, info,
+                                                     batch_count, (T*)scalars, work_x_temp,
+                                                     workArr_temp_arr, diag_trfac_invA,
+                                                     trfact_workTrmm_invA_arr, (T*)tau, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sggglm(rocblas_handle handle,
+                                const rocblas_int n,
+                                const rocblas_int m,
+                                const rocblas_int p,
+                                float* A,
+                                const rocblas_int lda,
+                                float* B,
+                                const rocblas_int ldb,
+                                float* D,
+                                float* X,
+                                float* Y,
+                                rocblas_int* info)
+{
+    return rocsolver_ggglm_impl<float>(handle, n, m, p, A, lda, B, ldb, D, X, Y, info);
+}
+
+rocblas_status rocsolver_dggglm(rocblas_handle handle,
+                                const rocblas_int n,
+                                const rocblas_int m,
+                                const rocblas_int p,
+                                double* A,
+                                const rocblas_int lda,
+                                double* B,
+                                const rocblas_int ldb,
+                                double* D,
+                                double* X,
+                                double* Y,
+                                rocblas_int* info)
+{
+    return rocsolver_ggglm_impl<double>(handle, n, m, p, A, lda, B, ldb, D, X, Y, info);
+}
+
+rocblas_status rocsolver_cggglm(rocblas_handle handle,
+                                const rocblas_int n,
+                                const rocblas_int m,
+                                const rocblas_int p,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_float_complex* B,
+                                const rocblas_int ldb,
+                                rocblas_float_complex* D,
+                                rocblas_float_complex* X,
+                                rocblas_float_complex* Y,
+                                rocblas_int* info)
+{
+    return rocsolver_ggglm_impl<rocblas_float_complex>(handle, n, m, p, A, lda, B, ldb, D, X, Y,
+                                                       info);
+}
+
+rocblas_status rocsolver_zggglm(rocblas_handle handle,
+                                const rocblas_int n,
+                                const rocblas_int m,
+                                const rocblas_int p,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_double_complex* B,
+                                const rocblas_int ldb,
+                                rocblas_double_complex* D,
+                                rocblas_double_complex* X,
+                                rocblas_double_complex* Y,
+                                rocblas_int* info)
+{
+    return rocsolver_ggglm_impl<rocblas_double_complex>(handle, n, m, p, A, lda, B, ldb, D, X, Y,
+                                                        info);
+}
+
+} // extern C
@@ -0,0 +1,276 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "auxiliary/rocauxiliary_ormrq_unmrq.hpp"
+#include "rocblas.hpp"
+#include "roclapack_ggqrf.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_ggglm_getMemorySize(const rocblas_int n,
+                                   const rocblas_int m,
+                                   const rocblas_int p,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_x_temp,
+                                   size_t* size_workArr_temp_arr,
+                                   size_t* size_diag_trfac_invA,
+                                   size_t* size_trfact_workTrmm_invA_arr,
+                                   size_t* size_tau,
+                                   bool* optim_mem)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_x_temp = 0;
+        *size_workArr_temp_arr = 0;
+        *size_diag_trfac_invA = 0;
+        *size_trfact_workTrmm_invA_arr = 0;
+        *size_tau = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    const rocblas_int np = std::min(n, p);
+    size_t ggqrf_scalars, ggqrf_work, ggqrf_workArr, ggqrf_diag, ggqrf_trfact;
+    size_t ormqr_scalars, ormqr_work, ormqr_workArr, ormqr_trfact, ormqr_workTrmm;
+    size_t ormrq_scalars, ormrq_work, ormrq_workArr, ormrq_trfact, ormrq_workTrmm;
+    size_t trsm_x_temp, trsm_x_temp_arr, trsm_invA, trsm_invA_arr;
+
+    // requirements for calling GGQRF
+    rocsolver_ggqrf_getMemorySize<BATCHED, T>(n, m, p, batch_count, &ggqrf_scalars, &ggqrf_work,
+                                              &ggqrf_workArr, &ggqrf_diag, &ggqrf_trfact);
+
+    // requirements for calling ORMQR/UNMQR
+    rocsolver_ormqr_unmqr_getMemorySize<BATCHED, T>(rocblas_side_left, n, 1, m, batch_count,
+                                                    &ormqr_scalars, &ormqr_work, &ormqr_workArr,
+                                                    &ormqr_trfact, &ormqr_workTrmm);
+
+    // requirements for calling ORMRQ/UNMRQ
+    rocsolver_ormrq_unmrq_getMemorySize<BATCHED, T>(rocblas_side_left, p, 1, np, batch_count,
+                                                    &ormrq_scalars, &ormrq_work, &ormrq_workArr,
+                                                    &ormrq_trfact, &ormrq_workTrmm);
+
+    // requirements for calling TRSM
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_none,
+                                            std::max(m, n - m), 1, batch_count, &trsm_x_temp,
+                                            &trsm_x_temp_arr, &trsm_invA, &trsm_invA_arr, optim_mem);
+
+    // get max values
+    *size_scalars = std::max({ggqrf_scalars, ormqr_scalars, ormrq_scalars});
+    *size_work_x_temp = std::max({ggqrf_work, ormqr_work, ormrq_work, trsm_x_temp});
+    *size_workArr_temp_arr
+        = std::max({ggqrf_workArr, ormqr_workArr, ormrq_workArr, trsm_x_temp_arr});
+    *size_diag_trfac_invA = std::max({ggqrf_diag, ormqr_trfact, ormrq_trfact, trsm_invA});
+    *size_trfact_workTrmm_invA_arr
+        = std::max({ggqrf_trfact, ormqr_workTrmm, ormrq_workTrmm, trsm_invA_arr});
+
+    // size of the Householder scalars of the QR and RQ factorizations
+    *size_tau = sizeof(T) * (m + np) * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_ggglm_argCheck(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        const rocblas_int m,
+                                        const rocblas_int p,
+                                        const rocblas_int lda,
+                                        const rocblas_int ldb,
+                                        T A,
+                                        T B,
+                                        T D,
+                                        T X,
+                                        T Y,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || m < 0 || p < 0 || m > n || n > m + p || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n * m && !A) || (n * p && !B) || (n && !D) || (m && !X) || (p && !Y)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_ggglm_template(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        const rocblas_int m,
+                                        const rocblas_int p,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        U D,
+                                        const rocblas_int shiftD,
+                                        const rocblas_stride strideD,
+                                        U X,
+                                        const rocblas_int shiftX,
+                                        const rocblas_stride strideX,
+                                        U Y,
+                                        const rocblas_int shiftY,
+                                        const rocblas_stride strideY,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_x_temp,
+                                        void* workArr_temp_arr,
+                                        void* diag_trfac_invA,
+                                        void* trfact_workTrmm_invA_arr,
+                                        T* tau,
+                                        bool optim_mem)
+{
+    ROCSOLVER_ENTER("ggglm", "n:", n, "m:", m, "p:", p, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "shiftD:", shiftD, "shiftX:", shiftX,
+                    "shiftY:", shiftY, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+    rocblas_int check_threads, blocks;
+
+    // info=0 (starting with nonsingular matrices)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return if there are no equations
+    // (as m <= n, x is empty, and y = 0)
+    if(n == 0)
+    {
+        if(p > 0)
+        {
+            blocks = (p - 1) / BS1 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocks, 1, batch_count), threads, 0, stream,
+                                    p, 1, Y, shiftY, p, strideY);
+        }
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants in host memory
+    T one = 1;
+    T minone = -1;
+    const rocblas_int np = std::min(n, p);
+    const rocblas_stride strideTa = m;
+    const rocblas_stride strideTb = np;
+    T* taua = tau;
+    T* taub = tau + m * batch_count;
+
+    // compute the GQR factorization of A and B:
+    // A = Q * (R11 0)' and Q' * B = (T11 T12; 0 T22) * Z
+    rocsolver_ggqrf_template<BATCHED, STRIDED>(
+        handle, n, m, p, A, shiftA, lda, strideA, taua, strideTa, B, shiftB, ldb, strideB, taub,
+        strideTb, batch_count, scalars, work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
+        (T**)trfact_workTrmm_invA_arr);
+
+    // update d = Q' * d = (d1 d2)'
+    rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+        handle, rocblas_side_left, rocblas_operation_conjugate_transpose, n, 1, m, A, shiftA, lda,
+        strideA, taua, strideTa, D, shiftD, n, strideD, batch_count, scalars, (T*)work_x_temp,
+        (T*)workArr_temp_arr, (T*)diag_trfac_invA, (T**)trfact_workTrmm_invA_arr);
+
+    if(n > m)
+    {
+        // do the equivalent of trtrs (info = 1 if T22 is singular)
+        check_threads = std::min(((n - m - 1) / 64 + 1) * 64, BS1);
+        ROCSOLVER_LAUNCH_KERNEL(flag_singularity<T>, dim3(batch_count, 1, 1),
+                                dim3(1, check_threads, 1), 0, stream, n - m, B,
+                                shiftB + idx2D(m, m + p - n, ldb), ldb, strideB, info, 1);
+
+        // solve T22 * y2 = d2, overwriting d2 with y2
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, n - m, 1,
+            B, shiftB + idx2D(m, m + p - n, ldb), ldb, strideB, D, shiftD + m, n, strideD,
+            batch_count, optim_mem, work_x_temp, workArr_temp_arr, diag_trfac_invA,
+            trfact_workTrmm_invA_arr);
+
+        // put y2 in y
+        blocks = (n - m - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U, U>), dim3(blocks, 1, batch_count), threads, 0,
+                                stream, n - m, 1, D, shiftD + m, n, strideD, Y,
+                                shiftY + m + p - n, p, strideY);
+    }
+
+    // set y1 = 0
+    if(m + p - n > 0)
+    {
+        blocks = (m + p - n - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocks, 1, batch_count), threads, 0, stream,
+                                m + p - n, 1, Y, shiftY, p, strideY);
+    }
+
+    if(m > 0)
+    {
+        // update d1 = d1 - T12 * y2
+        rocblasCall_gemv<T>(handle, rocblas_operation_none, m, n - m, &minone, 0, B,
+                            shiftB + idx2D(0, m + p - n, ldb), ldb, strideB, Y,
+                            shiftY + m + p - n, 1, strideY, &one, 0, D, shiftD, 1, strideD,
+                            batch_count, (T**)workArr_temp_arr);
+
+        // do the equivalent of trtrs (info = 2 if R11 is singular)
+        check_threads = std::min(((m - 1) / 64 + 1) * 64, BS1);
+        ROCSOLVER_LAUNCH_KERNEL(flag_singularity<T>, dim3(batch_count, 1, 1),
+                                dim3(1, check_threads, 1), 0, stream, m, A, shiftA, lda, strideA,
+                                info, 2);
+
+        // solve R11 * x = d1, overwriting d1 with x
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, m, 1, A,
+            shiftA, lda, strideA, D, shiftD, n, strideD, batch_count, optim_mem, work_x_temp,
+            workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+
+        // put x in the output
+        blocks = (m - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U, U>), dim3(blocks, 1, batch_count), threads, 0,
+                                stream, m, 1, D, shiftD, n, strideD, X, shiftX, m, strideX);
+    }
+
+    // backward transformation y = Z' * y
+    // (the Householder vectors are in the last min(n,p) rows of B)
+    rocsolver_ormrq_unmrq_template<BATCHED, STRIDED>(
+        handle, rocblas_side_left, rocblas_operation_conjugate_transpose, p, 1, np, B,
+        shiftB + idx2D(std::max(n - p, 0), 0, ldb), ldb, strideB, taub, strideTb, Y, shiftY, p,
+        strideY, batch_count, scalars, (T*)work_x_temp, (T*)workArr_temp_arr,
+        (T*)diag_trfac_invA, (T**)trfact_workTrmm_invA_arr);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
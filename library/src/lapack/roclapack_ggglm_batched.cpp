@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_ggglm.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_ggglm_batched_impl(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            const rocblas_int m,
+                                            const rocblas_int p,
+                                            U A,
+                                            const rocblas_int lda,
+                                            U B,
+                                            const rocblas_int ldb,
+                                            U D,
+                                            U X,
+                                            U Y,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("ggglm_batched", "-n", n, "-m", m, "-p", p, "--lda", lda, "--ldb", ldb,
+                        "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_ggglm_argCheck(handle, n, m, p, lda, ldb, A, B, D, X, Y, info,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+    rocblas_int shiftD = 0;
+    rocblas_int shiftX = 0;
+    rocblas_int shiftY = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideD = 0;
+    rocblas_stride strideX = 0;
+    rocblas_stride strideY = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of workspace (for calling GGQRF, ORMQR, ORMRQ and TRSM)
+    bool optim_mem;
+    size_t size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
+        size_trfact_workTrmm_invA_arr;
+    // size of the Householder scalars
+    size_t size_tau;
+    rocsolver_ggglm_getMemorySize<true, false, T>(n, m, p, batch_count, &size_scalars,
+                                                  &size_work_x_temp, &size_workArr_temp_arr,
+                                                  &size_diag_trfac_invA,
+                                                  &size_trfact_workTrmm_invA_arr, &size_tau,
+                                                  &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_x_temp,
+                                                      size_workArr_temp_arr, size_diag_trfac_invA,
+                                                      size_trfact_workTrmm_invA_arr, size_tau);
+
+    // memory workspace allocation
+    void *scalars, *work_x_temp, *workArr_temp_arr, *diag_trfac_invA, *trfact_workTrmm_invA_arr,
+        *tau;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+                              size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_tau);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_x_temp = mem[1];
+    workArr_temp_arr = mem[2];
+    diag_trfac_invA = mem[3];
+    trfact_workTrmm_invA_arr = mem[4];
+    tau = mem[5];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_ggglm_template<true, false, T>(handle, n, m, p, A, shiftA, lda, strideA, B,
+                                                    shiftB, ldb, strideB, D, shiftD, strideD, X,
+                                                    shiftX, strideX, Y, shiftY, strideY, info,
+                                                    batch_count, (T*)scalars, work_x_temp,
+                                                    workArr_temp_arr, diag_trfac_invA,
+                                                    trfact_workTrmm_invA_arr, (T*)tau, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sggglm_batched(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        const rocblas_int m,
+                                        const rocblas_int p,
+                                        float* const A[],
+                                        const rocblas_int lda,
+                                        float* const B[],
+                                        const rocblas_int ldb,
+                                        float* const D[],
+                                        float* const X[],
+                                        float* const Y[],
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_ggglm_batched_impl<float>(handle, n, m, p, A, lda, B, ldb, D, X, Y, info,
+                                               batch_count);
+}
+
+rocblas_status rocsolver_dggglm_batched(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        const rocblas_int m,
+                                        const rocblas_int p,
+                                        double* const A[],
+                                        const rocblas_int lda,
+                                        double* const B[],
+                                        const rocblas_int ldb,
+                                        double* const D[],
+                                        double* const X[],
+                                        double* const Y[],
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_ggglm_batched_impl<double>(handle, n, m, p, A, lda, B, ldb, D, X, Y, info,
+                                                batch_count);
+}
+
+rocblas_status rocsolver_cggglm_batched(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        const rocblas_int m,
+                                        const rocblas_int p,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_float_complex* const B[],
+                                        const rocblas_int ldb,
+                                        rocblas_float_complex* const D[],
+                                        rocblas_float_complex* const X[],
+                                        rocblas_float_complex* const Y[],
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_ggglm_batched_impl<rocblas_float_complex>(handle, n, m, p, A, lda, B, ldb, D,
+                                                               X, Y, info, batch_count);
+}
+
+rocblas_status rocsolver_zggglm_batched(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        const rocblas_int m,
+                                        const rocblas_int p,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_double_complex* const B[],
+                                        const rocblas_int ldb,
+                                        rocblas_double_complex* const D[],
+                                        rocblas_double_complex* const X[],
+                                        rocblas_double_complex* const Y[],
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_ggglm_batched_impl<rocblas_double_complex>(handle, n, m, p, A, lda, B, ldb, D,
+                                                                X, Y, info, batch_count);
+}
+
+} // extern C
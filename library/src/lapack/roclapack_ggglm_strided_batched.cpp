@@ -0,0 +1,201 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_ggglm.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_ggglm_strided_batched_impl(rocblas_handle handle,
+                                                    const rocblas_int n,
+                                                    const rocblas_int m,
+                                                    const rocblas_int p,
+                                                    U A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    U B,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    U D,
+                                                    const rocblas_stride strideD,
+                                                    U X,
+                                                    const rocblas_stride strideX,
+                                                    U Y,
+                                                    const rocblas_stride strideY,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("ggglm_strided_batched", "-n", n, "-m", m, "-p", p, "--lda", lda,
+                        "--strideA", strideA, "--ldb", ldb, "--strideB", strideB, "--strideD",
+                        strideD, "--strideX", strideX, "--strideY", strideY, "--batch_count",
+                        batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_ggglm_argCheck(handle, n, m, p, lda, ldb, A, B, D, X, Y, info,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+    rocblas_int shiftD = 0;
+    rocblas_int shiftX = 0;
+    rocblas_int shiftY = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of workspace (for calling GGQRF, ORMQR, ORMRQ and TRSM)
+    bool optim_mem;
+    size_t size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
+        size_trfact_workTrmm_invA_arr;
+    // size of the Householder scalars
+    size_t size_tau;
+    rocsolver_ggglm_getMemorySize<false, true, T>(n, m, p, batch_count, &size_scalars,
+                                                  &size_work_x_temp, &size_workArr_temp_arr,
+                                                  &size_diag_trfac_invA,
+                                                  &size_trfact_workTrmm_invA_arr, &size_tau,
+                                                  &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_x_temp,
+                                                      size_workArr_temp_arr, size_diag_trfac_invA,
+                                                      size_trfact_workTrmm_invA_arr, size_tau);
+
+    // memory workspace allocation
+    void *scalars, *work_x_temp, *workArr_temp_arr, *diag_trfac_invA, *trfact_workTrmm_invA_arr,
+        *tau;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+                              size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_tau);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_x_temp = mem[1];
+    workArr_temp_arr = mem[2];
+    diag_trfac_invA = mem[3];
+    trfact_workTrmm_invA_arr = mem[4];
+    tau = mem[5];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_ggglm_template<false, true, T>(handle, n, m, p, A, shiftA, lda, strideA, B,
+                                                    shiftB, ldb, strideB, D, shiftD, strideD, X,
+                                                    shiftX, strideX, Y, shiftY, strideY, info,
+                                                    batch_count, (T*)scalars, work_x_temp,
+                                                    workArr_temp_arr, diag_trfac_invA,
+                                                    trfact_workTrmm_invA_arr, (T*)tau, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sggglm_strided_batched(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                const rocblas_int m,
+                                                const rocblas_int p,
+                                                float* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                float* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                float* D,
+                                                const rocblas_stride strideD,
+                                                float* X,
+                                                const rocblas_stride strideX,
+                                                float* Y,
+                                                const rocblas_stride strideY,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_ggglm_strided_batched_impl<float>(handle, n, m, p, A, lda, strideA, B, ldb,
+                                                       strideB, D, strideD, X, strideX, Y, strideY,
+                                                       info, batch_count);
+}
+
+rocblas_status rocsolver_dggglm_strided_batched(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                const rocblas_int m,
+                                                const rocblas_int p,
+                                                double* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                double* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                double* D,
+                                                const rocblas_stride strideD,
+                                                double* X,
+                                                const rocblas_stride strideX,
+                                                double* Y,
+                                                const rocblas_stride strideY,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_ggglm_strided_batched_impl<double>(handle, n, m, p, A, lda, strideA, B, ldb,
+                                                        strideB, D, strideD, X, strideX, Y, strideY,
+                                                        info, batch_count);
+}
+
+rocblas_status rocsolver_cggglm_strided_batched(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                const rocblas_int m,
+                                                const rocblas_int p,
+                                                rocblas_float_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_float_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_float_complex* D,
+                                                const rocblas_stride strideD,
+                                                rocblas_float_complex* X,
+                                                const rocblas_stride strideX,
+                                                rocblas_float_complex* Y,
+                                                const rocblas_stride strideY,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_ggglm_strided_batched_impl<rocblas_float_complex>(handle, n, m, p, A, lda,
+                                                                       strideA, B, ldb, strideB, D,
+                                                                       strideD, X, strideX, Y,
+                                                                       strideY, info, batch_count);
+}
+
+rocblas_status rocsolver_zggglm_strided_batched(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                const rocblas_int m,
+                                                const rocblas_int p,
+                                                rocblas_double_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_double_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_double_complex* D,
+                                                const rocblas_stride strideD,
+                                                rocblas_double_complex* X,
+                                                const rocblas_stride strideX,
+                                                rocblas_double_complex* Y,
+                                                const rocblas_stride strideY,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_ggglm_strided_batched_impl<rocblas_double_complex>(handle, n, m, p, A, lda,
+                                                                        strideA, B, ldb, strideB, D,
+                                                                        strideD, X, strideX, Y,
+                                                                        strideY, info, batch_count);
+}
+
+} // extern C
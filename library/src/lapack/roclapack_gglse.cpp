@@ -0,0 +1,167 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gglse.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_gglse_impl(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int p,
+                                    U A,
+                                    const rocblas_int lda,
+                                    U B,
+                                    const rocblas_int ldb,
+                                    U C,
+                                    U D,
+                                    U X,
+                                    rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("gglse", "-m", m, "-n", n, "-p", p, "--lda", lda, "--ldb", ldb);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gglse_argCheck(handle, m, n, p, lda, ldb, A, B, C, D, X, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+    rocblas_int shiftC = 0;
+    rocblas_int shiftD = 0;
+    rocblas_int shiftX = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideC = 0;
+    rocblas_stride strideD = 0;
+    rocblas_stride strideX = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of workspace (for calling GGRQF, ORMQR, ORMRQ and TRSM)
+    bool optim_mem;
+    size_t size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
+        size_trfact_workTrmm_invA_arr;
+    // size of the Householder scalars
+    size_t size_tau;
+    rocsolver_gglse_getMemorySize<false, false, T>(m, n, p, batch_count, &size_scalars,
+                                                   &size_work_x_temp, &size_workArr_temp_arr,
+                                                   &size_diag_trfac_invA,
+                                                   &size_trfact_workTrmm_invA_arr, &size_tau,
+                                                   &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_x_temp,
+                                                      size_workArr_temp_arr, size_diag_trfac_invA,
+                                                      size_trfact_workTrmm_invA_arr, size_tau);
+
+    // memory workspace allocation
+    void *scalars, *work_x_temp, *workArr_temp_arr, *diag_trfac_invA, *trfact_workTrmm_invA_arr,
+        *tau;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+                              size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_tau);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_x_temp = mem[1];
+    workArr_temp_arr = mem[2];
+    diag_trfac_invA = mem[3];
+    trfact_workTrmm_invA_arr = mem[4];
+    tau = mem[5];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_gglse_template<false, false, T>(handle, m, n, p, A, shiftA, lda, strideA, B,
+                                                     shiftB, ldb, strideB, C, shiftC, strideC, D,
+                                                     shiftD, strideD, X, shiftX, strideX, info,
+                                                     batch_count, (T*)scalars, work_x_temp,
+                                                     workArr_temp_arr, diag_trfac_invA,
+                                                     trfact_workTrmm_invA_arr, (T*)tau, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgglse(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int p,
+                                float* A,
+                                const rocblas_int lda,
+                                float* B,
+                                const rocblas_int ldb,
+                                float* C,
+                                float* D,
+                                float* X,
+                                rocblas_int* info)
+{
+    return rocsolver_gglse_impl<float>(handle, m, n, p, A, lda, B, ldb, C, D, X, info);
+}
+
+rocblas_status rocsolver_dgglse(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int p,
+                                double* A,
+                                const rocblas_int lda,
+                                double* B,
+                                const rocblas_int ldb,
+                                double* C,
+                                double* D,
+                                double* X,
+                                rocblas_int* info)
+{
+    return rocsolver_gglse_impl<double>(handle, m, n, p, A, lda, B, ldb, C, D, X, info);
+}
+
+rocblas_status rocsolver_cgglse(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int p,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_float_complex* B,
+                                const rocblas_int ldb,
+                                rocblas_float_complex* C,
+                                rocblas_float_complex* D,
+                                rocblas_float_complex* X,
+                                rocblas_int* info)
+{
+    return rocsolver_gglse_impl<rocblas_float_complex>(handle, m, n, p, A, lda, B, ldb, C, D, X,
+                                                       info);
+}
+
+rocblas_status rocsolver_zgglse(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int p,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_double_complex* B,
+                                const rocblas_int ldb,
+                                rocblas_double_complex* C,
+                                rocblas_double_complex* D,
+                                rocblas_double_complex* X,
+                                rocblas_int* info)
+{
+    return rocsolver_gglse_impl<rocblas_double_complex>(handle, m, n, p, A, lda, B, ldb, C, D, X,
+                                                        info);
+}
+
+} // extern C
@@ -0,0 +1,280 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "auxiliary/rocauxiliary_ormrq_unmrq.hpp"
+#include "rocblas.hpp"
+#include "roclapack_ggrqf.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gglse_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int p,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_x_temp,
+                                   size_t* size_workArr_temp_arr,
+                                   size_t* size_diag_trfac_invA,
+                                   size_t* size_trfact_workTrmm_invA_arr,
+                                   size_t* size_tau,
+                                   bool* optim_mem)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_x_temp = 0;
+        *size_workArr_temp_arr = 0;
+        *size_diag_trfac_invA = 0;
+        *size_trfact_workTrmm_invA_arr = 0;
+        *size_tau = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    const rocblas_int mn = std::min(m, n);
+    size_t ggrqf_scalars, ggrqf_work, ggrqf_workArr, ggrqf_diag, ggrqf_trfact;
+    size_t ormqr_scalars, ormqr_work, ormqr_workArr, ormqr_trfact, ormqr_workTrmm;
+    size_t ormrq_scalars, ormrq_work, ormrq_workArr, ormrq_trfact, ormrq_workTrmm;
+    size_t trsm_x_temp, trsm_x_temp_arr, trsm_invA, trsm_invA_arr;
+
+    // requirements for calling GGRQF
+    rocsolver_ggrqf_getMemorySize<BATCHED, T>(p, m, n, batch_count, &ggrqf_scalars, &ggrqf_work,
+                                              &ggrqf_workArr, &ggrqf_diag, &ggrqf_trfact);
+
+    // requirements for calling ORMQR/UNMQR
+    rocsolver_ormqr_unmqr_getMemorySize<BATCHED, T>(rocblas_side_left, m, 1, mn, batch_count,
+                                                    &ormqr_scalars, &ormqr_work, &ormqr_workArr,
+                                                    &ormqr_trfact, &ormqr_workTrmm);
+
+    // requirements for calling ORMRQ/UNMRQ
+    rocsolver_ormrq_unmrq_getMemorySize<BATCHED, T>(rocblas_side_left, n, 1, p, batch_count,
+                                                    &ormrq_scalars, &ormrq_work, &ormrq_workArr,
+                                                    &ormrq_trfact, &ormrq_workTrmm);
+
+    // requirements for calling TRSM
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_none,
+                                            std::max(p, n - p), 1, batch_count, &trsm_x_temp,
+                                            &trsm_x_temp_arr, &trsm_invA, &trsm_invA_arr, optim_mem);
+
+    // get max values
+    *size_scalars = std::max({ggrqf_scalars, ormqr_scalars, ormrq_scalars});
+    *size_work_x_temp = std::max({ggrqf_work, ormqr_work, ormrq_work, trsm_x_temp});
+    *size_workArr_temp_arr
+        = std::max({ggrqf_workArr, ormqr_workArr, ormrq_workArr, trsm_x_temp_arr});
+    *size_diag_trfac_invA = std::max({ggrqf_diag, ormqr_trfact, ormrq_trfact, trsm_invA});
+    *size_trfact_workTrmm_invA_arr
+        = std::max({ggrqf_trfact, ormqr_workTrmm, ormrq_workTrmm, trsm_invA_arr});
+
+    // the workspace of TRMV, used to compute the residual, is taken from work_x_temp
+    *size_work_x_temp = std::max(*size_work_x_temp, sizeof(T) * p * batch_count);
+
+    // size of the Householder scalars of the RQ and QR factorizations
+    *size_tau = sizeof(T) * (mn + p) * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_gglse_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int p,
+                                        const rocblas_int lda,
+                                        const rocblas_int ldb,
+                                        T A,
+                                        T B,
+                                        T C,
+                                        T D,
+                                        T X,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || p < 0 || p > n || n > m + p || lda < m || ldb < p || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m * n && !A) || (p * n && !B) || (m && !C) || (p && !D) || (n && !X)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_gglse_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int p,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        U C,
+                                        const rocblas_int shiftC,
+                                        const rocblas_stride strideC,
+                                        U D,
+                                        const rocblas_int shiftD,
+                                        const rocblas_stride strideD,
+                                        U X,
+                                        const rocblas_int shiftX,
+                                        const rocblas_stride strideX,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_x_temp,
+                                        void* workArr_temp_arr,
+                                        void* diag_trfac_invA,
+                                        void* trfact_workTrmm_invA_arr,
+                                        T* tau,
+                                        bool optim_mem)
+{
+    ROCSOLVER_ENTER("gglse", "m:", m, "n:", n, "p:", p, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "shiftC:", shiftC, "shiftD:", shiftD,
+                    "shiftX:", shiftX, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // info=0 (starting with nonsingular matrices)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+
+    // quick return if there is no unknown
+    if(n == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    // constants in host memory
+    T one = 1;
+    T minone = -1;
+    const rocblas_int mn = std::min(m, n);
+    const rocblas_stride strideTa = mn;
+    const rocblas_stride strideTb = p;
+    T* taua = tau;
+    T* taub = tau + mn * batch_count;
+    rocblas_int check_threads, blocks, nr;
+
+    // compute the GRQ factorization of B and A:
+    // B = (0 T12) * Q and A * Q' = Z * R
+    rocsolver_ggrqf_template<BATCHED, STRIDED>(
+        handle, p, m, n, B, shiftB, ldb, strideB, taub, strideTb, A, shiftA, lda, strideA, taua,
+        strideTa, batch_count, scalars, work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
+        (T**)trfact_workTrmm_invA_arr);
+
+    // update c = Z' * c = (c1 c2)'
+    rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+        handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, 1, mn, A, shiftA, lda,
+        strideA, taua, strideTa, C, shiftC, m, strideC, batch_count, scalars, (T*)work_x_temp,
+        (T*)workArr_temp_arr, (T*)diag_trfac_invA, (T**)trfact_workTrmm_invA_arr);
+
+    if(p > 0)
+    {
+        // do the equivalent of trtrs (info = 1 if T12 is singular)
+        check_threads = std::min(((p - 1) / 64 + 1) * 64, BS1);
+        ROCSOLVER_LAUNCH_KERNEL(flag_singularity<T>, dim3(batch_count, 1, 1),
+                                dim3(1, check_threads, 1), 0, stream, p, B,
+                                shiftB + idx2D(0, n - p, ldb), ldb, strideB, info, 1);
+
+        // solve T12 * x2 = d, overwriting d with x2
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, p, 1, B,
+            shiftB + idx2D(0, n - p, ldb), ldb, strideB, D, shiftD, p, strideD, batch_count,
+            optim_mem, work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+
+        // put x2 in x
+        blocks = (p - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U, U>), dim3(blocks, 1, batch_count), threads, 0,
+                                stream, p, 1, D, shiftD, p, strideD, X, shiftX + n - p, n, strideX);
+
+        // update c1 = c1 - A12 * x2
+        rocblasCall_gemv<T>(handle, rocblas_operation_none, n - p, p, &minone, 0, A,
+                            shiftA + idx2D(0, n - p, lda), lda, strideA, D, shiftD, 1, strideD,
+                            &one, 0, C, shiftC, 1, strideC, batch_count, (T**)workArr_temp_arr);
+    }
+
+    if(n > p)
+    {
+        // do the equivalent of trtrs (info = 2 if R11 is singular)
+        check_threads = std::min(((n - p - 1) / 64 + 1) * 64, BS1);
+        ROCSOLVER_LAUNCH_KERNEL(flag_singularity<T>, dim3(batch_count, 1, 1),
+                                dim3(1, check_threads, 1), 0, stream, n - p, A, shiftA, lda,
+                                strideA, info, 2);
+
+        // solve R11 * x1 = c1, overwriting c1 with x1
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, n - p, 1,
+            A, shiftA, lda, strideA, C, shiftC, m, strideC, batch_count, optim_mem, work_x_temp,
+            workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+
+        // put x1 in x
+        blocks = (n - p - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U, U>), dim3(blocks, 1, batch_count), threads, 0,
+                                stream, n - p, 1, C, shiftC, m, strideC, X, shiftX, n, strideX);
+    }
+
+    // compute the residual vector (the residual sum of squares is given by ||c2||^2)
+    if(m < n)
+    {
+        nr = m + p - n;
+        if(nr > 0)
+            rocblasCall_gemv<T>(handle, rocblas_operation_none, nr, n - m, &minone, 0, A,
+                                shiftA + idx2D(n - p, m, lda), lda, strideA, D, shiftD + nr, 1,
+                                strideD, &one, 0, C, shiftC + n - p, 1, strideC, batch_count,
+                                (T**)workArr_temp_arr);
+    }
+    else
+        nr = p;
+
+    if(nr > 0)
+    {
+        rocblasCall_trmv<T>(handle, rocblas_fill_upper, rocblas_operation_none,
+                            rocblas_diagonal_non_unit, nr, A, shiftA + idx2D(n - p, n - p, lda),
+                            lda, strideA, D, shiftD, 1, strideD, (T*)work_x_temp, nr, batch_count);
+
+        rocblasCall_axpy<T>(handle, nr, &minone, 0, D, shiftD, 1, strideD, C, shiftC + n - p, 1,
+                            strideC, batch_count);
+    }
+
+    // backward transformation x = Q' * x
+    rocsolver_ormrq_unmrq_template<BATCHED, STRIDED>(
+        handle, rocblas_side_left, rocblas_operation_conjugate_transpose, n, 1, p, B, shiftB, ldb,
+        strideB, taub, strideTb, X, shiftX, n, strideX, batch_count, scalars, (T*)work_x_temp,
+        (T*)workArr_temp_arr, (T*)diag_trfac_invA, (T**)trfact_workTrmm_invA_arr);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
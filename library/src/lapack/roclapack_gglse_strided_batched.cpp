@@ -0,0 +1,201 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_gglse.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_gglse_strided_batched_impl(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    const rocblas_int p,
+                                                    U A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    U B,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    U C,
+                                                    const rocblas_stride strideC,
+                                                    U D,
+                                                    const rocblas_stride strideD,
+                                                    U X,
+                                                    const rocblas_stride strideX,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gglse_strided_batched", "-m", m, "-n", n, "-p", p, "--lda", lda,
+                        "--strideA", strideA, "--ldb", ldb, "--strideB", strideB, "--strideC",
+                        strideC, "--strideD", strideD, "--strideX", strideX, "--batch_count",
+                        batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gglse_argCheck(handle, m, n, p, lda, ldb, A, B, C, D, X, info,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+    rocblas_int shiftC = 0;
+    rocblas_int shiftD = 0;
+    rocblas_int shiftX = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of workspace (for calling GGRQF, ORMQR, ORMRQ and TRSM)
+    bool optim_mem;
+    size_t size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
+        size_trfact_workTrmm_invA_arr;
+    // size of the Householder scalars
+    size_t size_tau;
+    rocsolver_gglse_getMemorySize<false, true, T>(m, n, p, batch_count, &size_scalars,
+                                                  &size_work_x_temp, &size_workArr_temp_arr,
+                                                  &size_diag_trfac_invA,
+                                                  &size_trfact_workTrmm_invA_arr, &size_tau,
+                                                  &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_x_temp,
+                                                      size_workArr_temp_arr, size_diag_trfac_invA,
+                                                      size_trfact_workTrmm_invA_arr, size_tau);
+
+    // memory workspace allocation
+    void *scalars, *work_x_temp, *workArr_temp_arr, *diag_trfac_invA, *trfact_workTrmm_invA_arr,
+        *tau;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+                              size_diag_trfac_invA, size_trfact_workTrmm_invA_arr, size_tau);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_x_temp = mem[1];
+    workArr_temp_arr = mem[2];
+    diag_trfac_invA = mem[3];
+    trfact_workTrmm_invA_arr = mem[4];
+    tau = mem[5];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_gglse_template<false, true, T>(handle, m, n, p, A, shiftA, lda, strideA, B,
+                                                    shiftB, ldb, strideB, C, shiftC, strideC, D,
+                                                    shiftD, strideD, X, shiftX, strideX, info,
+                                                    batch_count, (T*)scalars, work_x_temp,
+                                                    workArr_temp_arr, diag_trfac_invA,
+                                                    trfact_workTrmm_invA_arr, (T*)tau, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgglse_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int p,
+                                                float* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                float* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                float* C,
+                                                const rocblas_stride strideC,
+                                                float* D,
+                                                const rocblas_stride strideD,
+                                                float* X,
+                                                const rocblas_stride strideX,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gglse_strided_batched_impl<float>(handle, m, n, p, A, lda, strideA, B, ldb,
+                                                       strideB, C, strideC, D, strideD, X, strideX,
+                                                       info, batch_count);
+}
+
+rocblas_status rocsolver_dgglse_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int p,
+                                                double* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                double* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                double* C,
+                                                const rocblas_stride strideC,
+                                                double* D,
+                                                const rocblas_stride strideD,
+                                                double* X,
+                                                const rocblas_stride strideX,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gglse_strided_batched_impl<double>(handle, m, n, p, A, lda, strideA, B, ldb,
+                                                        strideB, C, strideC, D, strideD, X, strideX,
+                                                        info, batch_count);
+}
+
+rocblas_status rocsolver_cgglse_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int p,
+                                                rocblas_float_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_float_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_float_complex* C,
+                                                const rocblas_stride strideC,
+                                                rocblas_float_complex* D,
+                                                const rocblas_stride strideD,
+                                                rocblas_float_complex* X,
+                                                const rocblas_stride strideX,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gglse_strided_batched_impl<rocblas_float_complex>(handle, m, n, p, A, lda,
+                                                                       strideA, B, ldb, strideB, C,
+                                                                       strideC, D, strideD, X,
+                                                                       strideX, info, batch_count);
+}
+
+rocblas_status rocsolver_zgglse_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int p,
+                                                rocblas_double_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_double_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_double_complex* C,
+                                                const rocblas_stride strideC,
+                                                rocblas_double_complex* D,
+                                                const rocblas_stride strideD,
+                                                rocblas_double_complex* X,
+                                                const rocblas_stride strideX,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gglse_strided_batched_impl<rocblas_double_complex>(handle, m, n, p, A, lda,
+                                                                        strideA, B, ldb, strideB, C,
+                                                                        strideC, D, strideD, X,
+                                                                        strideX, info, batch_count);
+}
+
+} // extern C
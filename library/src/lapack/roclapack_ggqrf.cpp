@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_ggqrf.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_ggqrf_impl(rocblas_handle handle,
+                                    const rocblas_int n,
+                                    const rocblas_int m,
+                                    const rocblas_int p,
+                                    U A,
+                                    const rocblas_int lda,
+                                    T* taua,
+                                    U B,
+                                    const rocblas_int ldb,
+                                    T* taub)
+{
+    ROCSOLVER_ENTER_TOP("ggqrf", "-n", n, "-m", m, "-p", p, "--lda", lda, "--ldb", ldb);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_ggqrf_argCheck(handle, n, m, p, lda, ldb, A, taua, B, taub);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideTa = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideTb = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases) and re-usable workspace
+    size_t size_work_workArr, size_workArr;
+    // extra requirements for calling GEQRF, GERQF and the application of Q
+    size_t size_Abyx_norms_trfact, size_diag_tmptr;
+    rocsolver_ggqrf_getMemorySize<false, T>(n, m, p, batch_count, &size_scalars, &size_work_workArr,
+                                            &size_Abyx_norms_trfact, &size_diag_tmptr,
+                                            &size_workArr);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+                                                      size_Abyx_norms_trfact, size_diag_tmptr,
+                                                      size_workArr);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
+                              size_diag_tmptr, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms_trfact = mem[2];
+    diag_tmptr = mem[3];
+    workArr = mem[4];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_ggqrf_template<false, false, T>(handle, n, m, p, A, shiftA, lda, strideA, taua,
+                                                     strideTa, B, shiftB, ldb, strideB, taub,
+                                                     strideTb, batch_count, (T*)scalars,
+                                                     work_workArr, (T*)Abyx_norms_trfact,
+                                                     (T*)diag_tmptr, (T**)workArr);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sggqrf(rocblas_handle handle,
+                                const rocblas_int n,
+                                const rocblas_int m,
+                                const rocblas_int p,
+                                float* A,
+                                const rocblas_int lda,
+                                float* taua,
+                                float* B,
+                                const rocblas_int ldb,
+                                float* taub)
+{
+    return rocsolver_ggqrf_impl<float>(handle, n, m, p, A, lda, taua, B, ldb, taub);
+}
+
+rocblas_status rocsolver_dggqrf(rocblas_handle handle,
+                                const rocblas_int n,
+                                const rocblas_int m,
+                                const rocblas_int p,
+                                double* A,
+                                const rocblas_int lda,
+                                double* taua,
+                                double* B,
+                                const rocblas_int ldb,
+                                double* taub)
+{
+    return rocsolver_ggqrf_impl<double>(handle, n, m, p, A, lda, taua, B, ldb, taub);
+}
+
+rocblas_status rocsolver_cggqrf(rocblas_handle handle,
+                                const rocblas_int n,
+                                const rocblas_int m,
+                                const rocblas_int p,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_float_complex* taua,
+                                rocblas_float_complex* B,
+                                const rocblas_int ldb,
+                                rocblas_float_complex* taub)
+{
+    return rocsolver_ggqrf_impl<rocblas_float_complex>(handle, n, m, p, A, lda, taua, B, ldb, taub);
+}
+
+rocblas_status rocsolver_zggqrf(rocblas_handle handle,
+                                const rocblas_int n,
+                                const rocblas_int m,
+                                const rocblas_int p,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_double_complex* taua,
+                                rocblas_double_complex* B,
+                                const rocblas_int ldb,
+                                rocblas_double_complex* taub)
+{
+    return rocsolver_ggqrf_impl<rocblas_double_complex>(handle, n, m, p, A, lda, taua, B, ldb,
+                                                        taub);
+}
+
+} // extern C
@@ -0,0 +1,140 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqrf.hpp"
+#include "roclapack_gerqf.hpp"
+#include "rocsolver/rocsolver.h"
+
+template <bool BATCHED, typename T>
+void rocsolver_ggqrf_getMemorySize(const rocblas_int n,
+                                   const rocblas_int m,
+                                   const rocblas_int p,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_Abyx_norms_trfact,
+                                   size_t* size_diag_tmptr,
+                                   size_t* size_workArr)
+{
+    // if quick return no workspace needed
+    if(n == 0 || (m == 0 && p == 0) || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms_trfact = 0;
+        *size_diag_tmptr = 0;
+        *size_workArr = 0;
+        return;
+    }
+
+    size_t s1, s2, s3, w1, w2, w3, a1, a2, a3, d1, d2, d3, r1, r2, r3;
+
+    // requirements for calling GEQRF
+    rocsolver_geqrf_getMemorySize<BATCHED, T>(n, m, batch_count, &s1, &w1, &a1, &d1, &r1);
+
+    // requirements for calling ORMQR/UNMQR
+    rocsolver_ormqr_unmqr_getMemorySize<BATCHED, T>(rocblas_side_left, n, p, min(n, m), batch_count,
+                                                    &s2, &w2, &a2, &d2, &r2);
+
+    // requirements for calling GERQF
+    rocsolver_gerqf_getMemorySize<BATCHED, T>(n, p, batch_count, &s3, &w3, &a3, &d3, &r3);
+
+    *size_scalars = std::max({s1, s2, s3});
+    *size_work_workArr = std::max({w1, w2, w3});
+    *size_Abyx_norms_trfact = std::max({a1, a2, a3});
+    *size_diag_tmptr = std::max({d1, d2, d3});
+    *size_workArr = std::max({r1, r2, r3});
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_ggqrf_argCheck(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        const rocblas_int m,
+                                        const rocblas_int p,
+                                        const rocblas_int lda,
+                                        const rocblas_int ldb,
+                                        T A,
+                                        U taua,
+                                        T B,
+                                        U taub,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || m < 0 || p < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n * m && !A) || (n * m && !taua) || (n * p && !B) || (n * p && !taub))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_ggqrf_template(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        const rocblas_int m,
+                                        const rocblas_int p,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        T* taua,
+                                        const rocblas_stride strideTa,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        T* taub,
+                                        const rocblas_stride strideTb,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* Abyx_norms_trfact,
+                                        T* diag_tmptr,
+                                        T** workArr)
+{
+    ROCSOLVER_ENTER("ggqrf", "n:", n, "m:", m, "p:", p, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // QR factorization of A: A = Q * R
+    rocsolver_geqrf_template<BATCHED, STRIDED>(handle, n, m, A, shiftA, lda, strideA, taua,
+                                               strideTa, batch_count, scalars, work_workArr,
+                                               Abyx_norms_trfact, diag_tmptr, workArr);
+
+    // update B = Q' * B
+    rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+        handle, rocblas_side_left, rocblas_operation_conjugate_transpose, n, p, min(n, m), A,
+        shiftA, lda, strideA, taua, strideTa, B, shiftB, ldb, strideB, batch_count, scalars,
+        (T*)work_workArr, Abyx_norms_trfact, diag_tmptr, workArr);
+
+    // RQ factorization of Q' * B: Q' * B = T * Z
+    rocsolver_gerqf_template<BATCHED, STRIDED>(handle, n, p, B, shiftB, ldb, strideB, taub,
+                                               strideTb, batch_count, scalars, work_workArr,
+                                               Abyx_norms_trfact, diag_tmptr, workArr);
+
+    return rocblas_status_success;
+}
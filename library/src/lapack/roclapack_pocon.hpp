@@ -0,0 +1,215 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gecon.hpp"
+#include "roclapack_potrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+template <typename T, typename S>
+rocblas_status rocsolver_pocon_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !anorm) || (batch_count && !rcond))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S>
+void rocsolver_pocon_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_work,
+                                   size_t* size_sgn,
+                                   size_t* size_est,
+                                   size_t* size_state,
+                                   size_t* size_workArr,
+                                   bool* optim_mem)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_work = 0;
+        *size_sgn = 0;
+        *size_est = 0;
+        *size_state = 0;
+        *size_workArr = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // workspace required for calling POTRS with one right-hand side
+    rocsolver_potrs_getMemorySize<BATCHED, STRIDED, T>(n, 1, batch_count, size_work1, size_work2,
+                                                       size_work3, size_work4, optim_mem);
+
+    // workspace required by the estimator
+    rocsolver_lacn2_getMemorySize<BATCHED, T, S>(n, batch_count, size_work, size_sgn, size_est,
+                                                 size_state, size_workArr);
+}
+
+/** Helper to call POTRS on the estimator vectors; if the matrices are given
+    as an array of pointers, the vectors must be passed the same way **/
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_pocon_potrs(rocblas_handle handle,
+                           const rocblas_fill uplo,
+                           const rocblas_int n,
+                           T* A,
+                           const rocblas_int shiftA,
+                           const rocblas_int lda,
+                           const rocblas_stride strideA,
+                           T* x,
+                           T** workArr,
+                           const rocblas_int batch_count,
+                           void* work1,
+                           void* work2,
+                           void* work3,
+                           void* work4,
+                           const bool optim_mem)
+{
+    rocsolver_potrs_template<BATCHED, STRIDED, T>(handle, uplo, n, 1, A, shiftA, lda, strideA, x, 0,
+                                                  n, n, batch_count, work1, work2, work3, work4,
+                                                  optim_mem);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_pocon_potrs(rocblas_handle handle,
+                           const rocblas_fill uplo,
+                           const rocblas_int n,
+                           T* const A[],
+                           const rocblas_int shiftA,
+                           const rocblas_int lda,
+                           const rocblas_stride strideA,
+                           T* x,
+                           T** workArr,
+                           const rocblas_int batch_count,
+                           void* work1,
+                           void* work2,
+                           void* work3,
+                           void* work4,
+                           const bool optim_mem)
+{
+    rocsolver_potrs_template<BATCHED, STRIDED, T>(handle, uplo, n, 1, A, shiftA, lda, strideA,
+                                                  (T* const*)workArr, 0, n, n, batch_count, work1,
+                                                  work2, work3, work4, optim_mem);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_pocon_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const S* anorm,
+                                        S* rcond,
+                                        const rocblas_int batch_count,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* work,
+                                        T* sgn,
+                                        S* est,
+                                        rocblas_int* state,
+                                        T** workArr,
+                                        const bool optim_mem)
+{
+    ROCSOLVER_ENTER("pocon", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 gridB(batch_count, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return with rcond = 1
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, rcond, batch_count, 1);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    if(BATCHED)
+        ROCSOLVER_LAUNCH_KERNEL(get_array, gridReset, threads, 0, stream, workArr, work, n,
+                                batch_count);
+
+    // check for singular Cholesky factor and zero anorm, and initialize estimator
+    ROCSOLVER_LAUNCH_KERNEL((con_check<T>), gridB, threads, 0, stream, n, rocblas_diagonal_non_unit,
+                            A, shiftA, lda, strideA, anorm, est, state, rcond);
+
+    // estimate the 1-norm of inv(A). As inv(A) is hermitian,
+    // products with inv(A) and inv(A)' are both computed with POTRS
+    ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<BS1, T>), gridB, threads, 0, stream, n, 0, 1, work, sgn,
+                            est, state);
+
+    rocblas_int kase, kase_next;
+    for(rocblas_int r = 0; r < LACN2_MAX_SOLVES; r++)
+    {
+        kase = (r % 2 == 0 ? 1 : 2);
+        kase_next = (r + 1 < LACN2_MAX_SOLVES ? 3 - kase : 0);
+
+        rocsolver_pocon_potrs<BATCHED, STRIDED, T>(handle, uplo, n, A, shiftA, lda, strideA, work,
+                                                   workArr, batch_count, work1, work2, work3, work4,
+                                                   optim_mem);
+
+        ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<BS1, T>), gridB, threads, 0, stream, n, kase,
+                                kase_next, work, sgn, est, state);
+    }
+
+    // compute the reciprocal condition number
+    ROCSOLVER_LAUNCH_KERNEL(con_rcond<S>, gridReset, threads, 0, stream, batch_count, anorm, est,
+                            state, rcond);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_pocon.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_pocon_strided_batched_impl(rocblas_handle handle,
+                                                    const rocblas_fill uplo,
+                                                    const rocblas_int n,
+                                                    U A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    const S* anorm,
+                                                    S* rcond,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("pocon_strided_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--strideA",
+                        strideA, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_pocon_argCheck(handle, uplo, n, lda, A, anorm, rcond,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // memory workspace sizes:
+    // size of workspace (for calling POTRS)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // size of vectors and state of the norm estimator
+    size_t size_work, size_sgn, size_est, size_state;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_pocon_getMemorySize<false, true, T, S>(n, batch_count, &size_work1, &size_work2,
+                                                     &size_work3, &size_work4, &size_work,
+                                                     &size_sgn, &size_est, &size_state,
+                                                     &size_workArr, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+                                                      size_work4, size_work, size_sgn, size_est,
+                                                      size_state, size_workArr);
+
+    // memory workspace allocation
+    void *work1, *work2, *work3, *work4, *work, *sgn, *est, *state, *workArr;
+    rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4, size_work,
+                              size_sgn, size_est, size_state, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work1 = mem[0];
+    work2 = mem[1];
+    work3 = mem[2];
+    work4 = mem[3];
+    work = mem[4];
+    sgn = mem[5];
+    est = mem[6];
+    state = mem[7];
+    workArr = mem[8];
+
+    // execution
+    return rocsolver_pocon_template<false, true, T>(handle, uplo, n, A, shiftA, lda, strideA, anorm,
+                                                    rcond, batch_count, work1, work2, work3, work4,
+                                                    (T*)work, (T*)sgn, (S*)est, (rocblas_int*)state,
+                                                    (T**)workArr, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_spocon_strided_batched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int n,
+                                                           float* A,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           const float* anorm,
+                                                           float* rcond,
+                                                           const rocblas_int batch_count)
+{
+    return rocsolver_pocon_strided_batched_impl<float>(handle, uplo, n, A, lda, strideA, anorm,
+                                                       rcond, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_dpocon_strided_batched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int n,
+                                                           double* A,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           const double* anorm,
+                                                           double* rcond,
+                                                           const rocblas_int batch_count)
+{
+    return rocsolver_pocon_strided_batched_impl<double>(handle, uplo, n, A, lda, strideA, anorm,
+                                                        rcond, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_cpocon_strided_batched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int n,
+                                                           rocblas_float_complex* A,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           const float* anorm,
+                                                           float* rcond,
+                                                           const rocblas_int batch_count)
+{
+    return rocsolver_pocon_strided_batched_impl<rocblas_float_complex>(handle, uplo, n, A, lda,
+                                                                       strideA, anorm, rcond,
+                                                                       batch_count);
+}
+
+extern "C" rocblas_status rocsolver_zpocon_strided_batched(rocblas_handle handle,
+                                                           const rocblas_fill uplo,
+                                                           const rocblas_int n,
+                                                           rocblas_double_complex* A,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           const double* anorm,
+                                                           double* rcond,
+                                                           const rocblas_int batch_count)
+{
+    return rocsolver_pocon_strided_batched_impl<rocblas_double_complex>(handle, uplo, n, A, lda,
+                                                                        strideA, anorm, rcond,
+                                                                        batch_count);
+}
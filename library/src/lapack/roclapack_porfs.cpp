@@ -0,0 +1,182 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_porfs.hpp"
+
+template <typename T, typename S>
+rocblas_status rocsolver_porfs_impl(rocblas_handle handle,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    T* A,
+                                    const rocblas_int lda,
+                                    T* AF,
+                                    const rocblas_int ldaf,
+                                    T* B,
+                                    const rocblas_int ldb,
+                                    T* X,
+                                    const rocblas_int ldx,
+                                    S* ferr,
+                                    S* berr)
+{
+    ROCSOLVER_ENTER_TOP("porfs", "--uplo", uplo, "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldaf",
+                        ldaf, "--ldb", ldb, "--ldx", ldx);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_porfs_argCheck(handle, uplo, n, nrhs, lda, ldaf, ldb, ldx, A, AF,
+                                                 B, X, ferr, berr);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftAF = 0;
+    rocblas_int shiftB = 0;
+    rocblas_int shiftX = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideAF = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideX = 0;
+    rocblas_stride strideE = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of workspace (for calling the solver)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // size of residuals, componentwise bounds, and state of the refinement and the norm estimator
+    size_t size_work, size_sgn, size_wvec, size_est, size_lstres, size_state, size_count;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_porfs_getMemorySize<false, false, T, S>(n, nrhs, batch_count, &size_work1,
+                                                      &size_work2, &size_work3, &size_work4,
+                                                      &size_work, &size_sgn, &size_wvec, &size_est,
+                                                      &size_lstres, &size_state, &size_count,
+                                                      &size_workArr, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+                                                      size_work4, size_work, size_sgn, size_wvec,
+                                                      size_est, size_lstres, size_state, size_count,
+                                                      size_workArr);
+
+    // memory workspace allocation
+    void *work1, *work2, *work3, *work4, *work, *sgn, *wvec, *est, *lstres, *state, *count,
+        *workArr;
+    rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4, size_work,
+                              size_sgn, size_wvec, size_est, size_lstres, size_state, size_count,
+                              size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work1 = mem[0];
+    work2 = mem[1];
+    work3 = mem[2];
+    work4 = mem[3];
+    work = mem[4];
+    sgn = mem[5];
+    wvec = mem[6];
+    est = mem[7];
+    lstres = mem[8];
+    state = mem[9];
+    count = mem[10];
+    workArr = mem[11];
+
+    // execution
+    return rocsolver_porfs_template<false, false, T>(handle, uplo, n, nrhs, A, shiftA, lda, strideA,
+                                                     AF, shiftAF, ldaf, strideAF, B, shiftB, ldb,
+                                                     strideB, X, shiftX, ldx, strideX, ferr, berr,
+                                                     strideE, batch_count, work1, work2, work3,
+                                                     work4, (T*)work, (T*)sgn, (S*)wvec, (S*)est,
+                                                     (S*)lstres, (rocblas_int*)state,
+                                                     (rocblas_int*)count, (T**)workArr, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_sporfs(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           float* A,
+                                           const rocblas_int lda,
+                                           float* AF,
+                                           const rocblas_int ldaf,
+                                           float* B,
+                                           const rocblas_int ldb,
+                                           float* X,
+                                           const rocblas_int ldx,
+                                           float* ferr,
+                                           float* berr)
+{
+    return rocsolver_porfs_impl<float>(handle, uplo, n, nrhs, A, lda, AF, ldaf, B, ldb, X, ldx,
+                                       ferr, berr);
+}
+
+extern "C" rocblas_status rocsolver_dporfs(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           double* A,
+                                           const rocblas_int lda,
+                                           double* AF,
+                                           const rocblas_int ldaf,
+                                           double* B,
+                                           const rocblas_int ldb,
+                                           double* X,
+                                           const rocblas_int ldx,
+                                           double* ferr,
+                                           double* berr)
+{
+    return rocsolver_porfs_impl<double>(handle, uplo, n, nrhs, A, lda, AF, ldaf, B, ldb, X, ldx,
+                                        ferr, berr);
+}
+
+extern "C" rocblas_status rocsolver_cporfs(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           rocblas_float_complex* A,
+                                           const rocblas_int lda,
+                                           rocblas_float_complex* AF,
+                                           const rocblas_int ldaf,
+                                           rocblas_float_complex* B,
+                                           const rocblas_int ldb,
+                                           rocblas_float_complex* X,
+                                           const rocblas_int ldx,
+                                           float* ferr,
+                                           float* berr)
+{
+    return rocsolver_porfs_impl<rocblas_float_complex>(handle, uplo, n, nrhs, A, lda, AF, ldaf, B,
+                                                       ldb, X, ldx, ferr, berr);
+}
+
+extern "C" rocblas_status rocsolver_zporfs(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           rocblas_double_complex* A,
+                                           const rocblas_int lda,
+                                           rocblas_double_complex* AF,
+                                           const rocblas_int ldaf,
+                                           rocblas_double_complex* B,
+                                           const rocblas_int ldb,
+                                           rocblas_double_complex* X,
+                                           const rocblas_int ldx,
+                                           double* ferr,
+                                           double* berr)
+{
+    return rocsolver_porfs_impl<rocblas_double_complex>(handle, uplo, n, nrhs, A, lda, AF, ldaf, B,
+                                                        ldb, X, ldx, ferr, berr);
+}
@@ -0,0 +1,361 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gerfs.hpp"
+#include "roclapack_potrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+template <typename T, typename S>
+rocblas_status rocsolver_porfs_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int lda,
+                                        const rocblas_int ldaf,
+                                        const rocblas_int ldb,
+                                        const rocblas_int ldx,
+                                        T A,
+                                        T AF,
+                                        T B,
+                                        T X,
+                                        S* ferr,
+                                        S* berr,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldaf < n || ldb < n || ldx < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !AF) || (nrhs * n && !B) || (nrhs * n && !X)
+       || (nrhs && batch_count && !ferr) || (nrhs && batch_count && !berr))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S>
+void rocsolver_porfs_getMemorySize(const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_work,
+                                   size_t* size_sgn,
+                                   size_t* size_wvec,
+                                   size_t* size_est,
+                                   size_t* size_lstres,
+                                   size_t* size_state,
+                                   size_t* size_count,
+                                   size_t* size_workArr,
+                                   bool* optim_mem)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_work = 0;
+        *size_sgn = 0;
+        *size_wvec = 0;
+        *size_est = 0;
+        *size_lstres = 0;
+        *size_state = 0;
+        *size_count = 0;
+        *size_workArr = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // workspace required for calling POTRS with nrhs right-hand sides
+    rocsolver_potrs_getMemorySize<BATCHED, STRIDED, T>(n, nrhs, batch_count, size_work1, size_work2,
+                                                       size_work3, size_work4, optim_mem);
+
+    // workspace required by the refinement and the error estimator
+    rocsolver_rfs_getMemorySize<BATCHED, T, S>(n, nrhs, batch_count, size_work, size_sgn, size_wvec,
+                                               size_est, size_lstres, size_state, size_count,
+                                               size_workArr);
+}
+
+/** Helpers to compute the residuals R = B - A*X and to call POTRS on R; if the
+    matrices are given as an array of pointers, the residuals must be passed the same way **/
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_porfs_residual(rocblas_handle handle,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              const rocblas_int nrhs,
+                              T* A,
+                              const rocblas_int shiftA,
+                              const rocblas_int lda,
+                              const rocblas_stride strideA,
+                              T* X,
+                              const rocblas_int shiftX,
+                              const rocblas_int ldx,
+                              const rocblas_stride strideX,
+                              T* R,
+                              T** workArr,
+                              const rocblas_int batch_count)
+{
+    T one = T(1);
+    T minone = T(-1);
+
+    rocblasCall_symm_hemm<BATCHED, T>(handle, rocblas_side_left, uplo, n, nrhs, &minone, A, shiftA,
+                                      lda, strideA, X, shiftX, ldx, strideX, &one, R, 0, n,
+                                      n * nrhs, batch_count);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_porfs_residual(rocblas_handle handle,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              const rocblas_int nrhs,
+                              T* const A[],
+                              const rocblas_int shiftA,
+                              const rocblas_int lda,
+                              const rocblas_stride strideA,
+                              T* const X[],
+                              const rocblas_int shiftX,
+                              const rocblas_int ldx,
+                              const rocblas_stride strideX,
+                              T* R,
+                              T** workArr,
+                              const rocblas_int batch_count)
+{
+    T one = T(1);
+    T minone = T(-1);
+
+    rocblasCall_symm_hemm<BATCHED, T>(handle, rocblas_side_left, uplo, n, nrhs, &minone, A, shiftA,
+                                      lda, strideA, X, shiftX, ldx, strideX, &one,
+                                      (T* const*)workArr, 0, n, n * nrhs, batch_count);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_porfs_potrs(rocblas_handle handle,
+                           const rocblas_fill uplo,
+                           const rocblas_int n,
+                           const rocblas_int nrhs,
+                           T* AF,
+                           const rocblas_int shiftAF,
+                           const rocblas_int ldaf,
+                           const rocblas_stride strideAF,
+                           T* R,
+                           T** workArr,
+                           const rocblas_int batch_count,
+                           void* work1,
+                           void* work2,
+                           void* work3,
+                           void* work4,
+                           const bool optim_mem)
+{
+    rocsolver_potrs_template<BATCHED, STRIDED, T>(handle, uplo, n, nrhs, AF, shiftAF, ldaf,
+                                                  strideAF, R, 0, n, n * nrhs, batch_count, work1,
+                                                  work2, work3, work4, optim_mem);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_porfs_potrs(rocblas_handle handle,
+                           const rocblas_fill uplo,
+                           const rocblas_int n,
+                           const rocblas_int nrhs,
+                           T* const AF[],
+                           const rocblas_int shiftAF,
+                           const rocblas_int ldaf,
+                           const rocblas_stride strideAF,
+                           T* R,
+                           T** workArr,
+                           const rocblas_int batch_count,
+                           void* work1,
+                           void* work2,
+                           void* work3,
+                           void* work4,
+                           const bool optim_mem)
+{
+    rocsolver_potrs_template<BATCHED, STRIDED, T>(handle, uplo, n, nrhs, AF, shiftAF, ldaf,
+                                                  strideAF, (T* const*)workArr, 0, n, n * nrhs,
+                                                  batch_count, work1, work2, work3, work4,
+                                                  optim_mem);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_porfs_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U AF,
+                                        const rocblas_int shiftAF,
+                                        const rocblas_int ldaf,
+                                        const rocblas_stride strideAF,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        U X,
+                                        const rocblas_int shiftX,
+                                        const rocblas_int ldx,
+                                        const rocblas_stride strideX,
+                                        S* ferr,
+                                        S* berr,
+                                        const rocblas_stride strideE,
+                                        const rocblas_int batch_count,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        T* work,
+                                        T* sgn,
+                                        S* wvec,
+                                        S* est,
+                                        S* lstres,
+                                        rocblas_int* state,
+                                        rocblas_int* count,
+                                        T** workArr,
+                                        const bool optim_mem)
+{
+    ROCSOLVER_ENTER("porfs", "uplo:", uplo, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftAF:", shiftAF, "ldaf:", ldaf, "shiftB:", shiftB, "ldb:", ldb,
+                    "shiftX:", shiftX, "ldx:", ldx, "bc:", batch_count);
+
+    // quick return
+    if(nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int ncols = nrhs * batch_count;
+    dim3 threads(BS1, 1, 1);
+
+    // quick return with zero error bounds
+    if(n == 0)
+    {
+        dim3 gridReset((nrhs - 1) / BS1 + 1, batch_count, 1);
+        ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<S>, gridReset, threads, 0, stream, ferr, strideE,
+                                nrhs, 0);
+        ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<S>, gridReset, threads, 0, stream, berr, strideE,
+                                nrhs, 0);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    rocblas_int blocksCols = (ncols - 1) / BS1 + 1;
+    rocblas_int blocksScale = (n * ncols - 1) / BS1 + 1;
+    rocblas_int blocksx = (n - 1) / BS2 + 1;
+    rocblas_int blocksy = (nrhs - 1) / BS2 + 1;
+    dim3 gridCols(blocksCols, 1, 1);
+    dim3 gridScale(blocksScale, 1, 1);
+    dim3 gridRHS(nrhs, batch_count, 1);
+    dim3 gridCopy(blocksx, blocksy, batch_count);
+    dim3 gridEst(ncols, 1, 1);
+    dim3 threadsCopy(BS2, BS2, 1);
+
+    S eps = get_epsilon<T>();
+    S safmin = get_safemin<T>();
+
+    if(BATCHED)
+        ROCSOLVER_LAUNCH_KERNEL(get_array, dim3((batch_count - 1) / BS1 + 1), threads, 0, stream,
+                                workArr, work, n * nrhs, batch_count);
+
+    ROCSOLVER_LAUNCH_KERNEL(rfs_init<S>, gridCols, threads, 0, stream, ncols, lstres, count, est,
+                            state);
+
+    // iterative refinement: the schedule is fixed (at most RFS_ITMAX corrections), and
+    // the stopping criterion is evaluated on the device for every right-hand side
+    for(rocblas_int it = 0; it <= RFS_ITMAX; it++)
+    {
+        // compute residual R = B - A*X
+        ROCSOLVER_LAUNCH_KERNEL((copy_mat<T>), gridCopy, threadsCopy, 0, stream, copymat_to_buffer,
+                                n, nrhs, B, shiftB, ldb, strideB, work);
+        rocsolver_porfs_residual<BATCHED, STRIDED, T>(handle, uplo, n, nrhs, A, shiftA, lda,
+                                                      strideA, X, shiftX, ldx, strideX, work,
+                                                      workArr, batch_count);
+
+        // compute backward error and check stopping criterion
+        ROCSOLVER_LAUNCH_KERNEL((rfs_berr<T>), gridRHS, threads, 0, stream, rocblas_operation_none,
+                                uplo, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, X,
+                                shiftX, ldx, strideX, work, wvec, berr, strideE, lstres, count, eps,
+                                safmin);
+
+        // after RFS_ITMAX corrections the refinement has finished for all solutions
+        if(it == RFS_ITMAX)
+            break;
+
+        // solve A*dX = R and update X = X + dX
+        rocsolver_porfs_potrs<BATCHED, STRIDED, T>(handle, uplo, n, nrhs, AF, shiftAF, ldaf,
+                                                   strideAF, work, workArr, batch_count, work1,
+                                                   work2, work3, work4, optim_mem);
+        ROCSOLVER_LAUNCH_KERNEL((rfs_update<T>), gridCopy, threadsCopy, 0, stream, n, nrhs, X,
+                                shiftX, ldx, strideX, work);
+    }
+
+    // bound the forward error by estimating the infinity-norm of inv(A)*diag(W).
+    // As inv(A) is hermitian, all products with inv(A) are computed with POTRS
+    ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<BS1, T>), gridEst, threads, 0, stream, n, 0, 1, work, sgn,
+                            est, state);
+
+    rocblas_int kase, kase_next;
+    for(rocblas_int r = 0; r < LACN2_MAX_SOLVES; r++)
+    {
+        kase = (r % 2 == 0 ? 1 : 2);
+        kase_next = (r + 1 < LACN2_MAX_SOLVES ? 3 - kase : 0);
+
+        if(kase == 1)
+        {
+            // multiply by diag(W)*inv(A)
+            rocsolver_porfs_potrs<BATCHED, STRIDED, T>(handle, uplo, n, nrhs, AF, shiftAF, ldaf,
+                                                       strideAF, work, workArr, batch_count, work1,
+                                                       work2, work3, work4, optim_mem);
+            ROCSOLVER_LAUNCH_KERNEL((rfs_scale<T>), gridScale, threads, 0, stream, n * ncols, work,
+                                    wvec);
+        }
+        else
+        {
+            // multiply by inv(A)*diag(W)
+            ROCSOLVER_LAUNCH_KERNEL((rfs_scale<T>), gridScale, threads, 0, stream, n * ncols, work,
+                                    wvec);
+            rocsolver_porfs_potrs<BATCHED, STRIDED, T>(handle, uplo, n, nrhs, AF, shiftAF, ldaf,
+                                                       strideAF, work, workArr, batch_count, work1,
+                                                       work2, work3, work4, optim_mem);
+        }
+
+        ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<BS1, T>), gridEst, threads, 0, stream, n, kase,
+                                kase_next, work, sgn, est, state);
+    }
+
+    // normalize the error bounds
+    ROCSOLVER_LAUNCH_KERNEL((rfs_ferr<T>), gridRHS, threads, 0, stream, n, nrhs, X, shiftX, ldx,
+                            strideX, est, ferr, strideE);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "../auxiliary/rocauxiliary_lauum.hpp"
 #include "rocblas.hpp"
 #include "roclapack_trtri.hpp"
 #include "rocsolver/rocsolver.h"
@@ -123,25 +124,20 @@ rocblas_status rocsolver_potri_template(rocblas_handle handle,
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
 
-    // constants in host memory
     const rocblas_int copyblocks = (n - 1) / 32 + 1;
-    T one = 1;
 
-    // copy elements of A to serve as B matrix for TRMM
+    // save the triangular factor in cases where info is nonzero
     ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocks, copyblocks, batch_count), dim3(32, 32), 0,
                             stream, copymat_to_buffer, n, n, A, shiftA, lda, strideA, tmpcopy,
-                            no_mask{}, uplo);
+                            info_mask(info), uplo);
 
-    // compute inv(U) * inv(U)' or inv(L)' * inv(L) and store in tmpcopy
-    rocblas_side side = (uplo == rocblas_fill_upper ? rocblas_side_right : rocblas_side_left);
-    rocblasCall_trmm(handle, side, uplo, rocblas_operation_conjugate_transpose,
-                     rocblas_diagonal_non_unit, n, n, &one, 0, A, shiftA, lda, strideA, tmpcopy, 0,
-                     n, n * n, batch_count, workArr);
+    // compute inv(U) * inv(U)' or inv(L)' * inv(L) in place
+    lauum_recursive<BATCHED, T>(handle, uplo, n, A, shiftA, lda, strideA, batch_count);
 
-    // copy elements of tmpcopy into A in cases where info is zero
+    // restore the triangular factor in cases where info is nonzero
     ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocks, copyblocks, batch_count), dim3(32, 32), 0,
                             stream, copymat_from_buffer, n, n, A, shiftA, lda, strideA, tmpcopy,
-                            info_mask(info, info_mask::negate), uplo, rocblas_diagonal_non_unit);
+                            info_mask(info), uplo);
 
     rocblas_set_pointer_mode(handle, old_mode);
     return rocblas_status_success;
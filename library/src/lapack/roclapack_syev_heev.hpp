@@ -59,6 +59,286 @@ ROCSOLVER_KERNEL void scalar_case(const rocblas_evect evect,
     }
 }
 
+/** RUN_SYEV_SMALL computes the eigenvalues, and optionally the eigenvectors, of the
+    n-by-n symmetric/hermitian matrix A using a single workgroup. A is copied to As and
+    reduced to tridiagonal form as in SYTD2/HETD2 with uplo = lower. The eigenvalues are
+    then computed with the QL/QR algorithm and, if required, the eigenvectors are accumulated
+    in Z. If DE is given, the tridiagonal matrix is also saved there before the iteration: the
+    diagonal in DE[0:n-1], the off-diagonal in DE[n:2n-2] and its squares in DE[2n:3n-2].
+    Except for A, all arrays are expected in shared memory **/
+template <typename T, typename S>
+__device__ void run_syev_small(const rocblas_int tid,
+                               const rocblas_evect evect,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               T* A,
+                               const rocblas_int lda,
+                               T* As,
+                               T* Z,
+                               T* tau,
+                               T* w,
+                               S* D,
+                               S* E,
+                               S* work,
+                               T* sval,
+                               rocblas_int* info,
+                               const S eps,
+                               const S ssfmin,
+                               const S ssfmax,
+                               S* DE = nullptr)
+{
+    const rocblas_int nthr = hipBlockDim_x;
+    rocblas_int i, j, k, c, m;
+    T aij, temp, t;
+
+    // copy A to shared memory (both triangles)
+    for(k = tid; k < n * n; k += nthr)
+    {
+        i = k % n;
+        j = k / n;
+        if(i == j)
+            As[i + j * n] = std::real(A[i + j * lda]);
+        else if((uplo == rocblas_fill_lower && i > j) || (uplo == rocblas_fill_upper && i < j))
+        {
+            aij = A[i + j * lda];
+            As[i + j * n] = aij;
+            As[j + i * n] = conj(aij);
+        }
+    }
+    __syncthreads();
+
+    // reduce to tridiagonal form
+    for(j = 0; j < n - 1; j++)
+    {
+        // the householder vector v is stored in place of the column that it annihilates
+        T* v = As + (j + 1) + j * n;
+        T* A22 = As + (j + 1) + (j + 1) * n;
+        m = n - j - 1;
+
+        // generate the householder reflector
+        if(tid == 0)
+        {
+            S xnorm = 0;
+            for(i = 1; i < m; i++)
+                xnorm += std::norm(v[i]);
+
+            T alpha = v[0];
+            if(xnorm == 0 && std::imag(alpha) == 0)
+            {
+                tau[j] = 0;
+                sval[0] = 1;
+                E[j] = std::real(alpha);
+            }
+            else
+            {
+                S beta = -copysign(sqrt(std::norm(alpha) + xnorm), std::real(alpha));
+                tau[j] = (T(beta) - alpha) / T(beta);
+                sval[0] = T(1) / (alpha - T(beta));
+                E[j] = beta;
+            }
+            D[j] = std::real(As[j + j * n]);
+            v[0] = 1;
+        }
+        __syncthreads();
+
+        t = tau[j];
+        for(i = tid + 1; i < m; i += nthr)
+            v[i] *= sval[0];
+        __syncthreads();
+
+        // w = tau * A22 * v
+        for(i = tid; i < m; i += nthr)
+        {
+            temp = 0;
+            for(k = 0; k < m; k++)
+                temp += A22[i + k * n] * v[k];
+            w[i] = t * temp;
+        }
+        __syncthreads();
+
+        // w = w - 1/2 * tau * (w' * v) * v
+        if(tid == 0)
+        {
+            temp = 0;
+            for(k = 0; k < m; k++)
+                temp += conj(w[k]) * v[k];
+            sval[0] = -S(0.5) * t * temp;
+        }
+        __syncthreads();
+
+        for(i = tid; i < m; i += nthr)
+            w[i] += sval[0] * v[i];
+        __syncthreads();
+
+        // A22 = A22 - v * w' - w * v'
+        for(k = tid; k < m * m; k += nthr)
+        {
+            i = k % m;
+            c = k / m;
+            A22[i + c * n] -= v[i] * conj(w[c]) + w[i] * conj(v[c]);
+        }
+        __syncthreads();
+    }
+
+    if(evect == rocblas_evect_original)
+    {
+        // form the unitary matrix Q = H(0) * H(1) * ... * H(n-2) in Z
+        for(k = tid; k < n * n; k += nthr)
+            Z[k] = (k % n == k / n) ? 1 : 0;
+        __syncthreads();
+
+        // (every thread keeps working on the same columns of Z)
+        for(j = n - 2; j >= 0; j--)
+        {
+            T* v = As + (j + 1) + j * n;
+            m = n - j - 1;
+            t = tau[j];
+
+            for(c = tid; c < n; c += nthr)
+            {
+                if(c > j)
+                {
+                    temp = 0;
+                    for(i = 0; i < m; i++)
+                        temp += conj(v[i]) * Z[(j + 1 + i) + c * n];
+                    temp *= t;
+                    for(i = 0; i < m; i++)
+                        Z[(j + 1 + i) + c * n] -= v[i] * temp;
+                }
+            }
+        }
+        __syncthreads();
+    }
+
+    // compute eigenvalues (and eigenvectors)
+    if(tid == 0)
+    {
+        D[n - 1] = std::real(As[(n - 1) + (n - 1) * n]);
+        info[0] = 0;
+
+        if(DE)
+        {
+            for(i = 0; i < n; i++)
+                DE[i] = D[i];
+            for(i = 0; i < n - 1; i++)
+            {
+                DE[n + i] = E[i];
+                DE[2 * n + i] = E[i] * E[i];
+            }
+        }
+
+        if(evect == rocblas_evect_original)
+            run_steqr(n, D, E, Z, n, info, work, 30 * n, eps, ssfmin, ssfmax);
+        else
+            run_sterf(n, D, E, info, (rocblas_int*)nullptr, 30 * n, eps, ssfmin, ssfmax);
+    }
+    __syncthreads();
+}
+
+/** SYEV_SMALL_KERNEL computes the eigenvalues, and optionally the eigenvectors, of
+    small symmetric/hermitian matrices, keeping every matrix in shared memory.
+
+    Call this kernel with batch_count groups in z, and up to n*n threads in x **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void syev_small_kernel(const rocblas_evect evect,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U AA,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        S* DD,
+                                        const rocblas_stride strideD,
+                                        S* EE,
+                                        const rocblas_stride strideE,
+                                        rocblas_int* infoA,
+                                        const S eps,
+                                        const S ssfmin,
+                                        const S ssfmax)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_z;
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    S* D = DD + bid * strideD;
+    S* E = EE + bid * strideE;
+
+    // shared memory
+    extern __shared__ double lmem[];
+    T* As = reinterpret_cast<T*>(lmem);
+    T* Z = As + n * n;
+    T* tau = Z + (evect == rocblas_evect_original ? n * n : 0);
+    T* w = tau + n;
+    S* Ds = reinterpret_cast<S*>(w + n);
+    S* Es = Ds + n;
+    S* work = Es + n;
+    __shared__ T sval;
+    __shared__ rocblas_int info;
+
+    run_syev_small(tid, evect, uplo, n, A, lda, As, Z, tau, w, Ds, Es, work, &sval, &info, eps,
+                   ssfmin, ssfmax);
+
+    // write results
+    for(rocblas_int i = tid; i < n; i += hipBlockDim_x)
+    {
+        D[i] = Ds[i];
+        if(i < n - 1)
+            E[i] = Es[i];
+    }
+
+    if(evect == rocblas_evect_original)
+    {
+        for(rocblas_int k = tid; k < n * n; k += hipBlockDim_x)
+            A[(k % n) + (k / n) * lda] = Z[k];
+    }
+
+    if(tid == 0)
+        infoA[bid] = info;
+}
+
+/** Returns the size of the shared memory required by the small-size kernels **/
+template <typename T, typename S>
+size_t syev_small_lmemsize(const rocblas_evect evect, const rocblas_int n)
+{
+    rocblas_int nz = (evect == rocblas_evect_original ? n * n : 0);
+    return sizeof(T) * (n * n + nz + 2 * n) + sizeof(S) * 4 * n;
+}
+
+/** Helper to launch the small-size kernel of SYEV and SYEVD **/
+template <typename T, typename S, typename U>
+void rocsolver_syev_heev_small(rocblas_handle handle,
+                               const rocblas_evect evect,
+                               const rocblas_fill uplo,
+                               const rocblas_int n,
+                               U A,
+                               const rocblas_int shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               S* D,
+                               const rocblas_stride strideD,
+                               S* E,
+                               const rocblas_stride strideE,
+                               rocblas_int* info,
+                               const rocblas_int batch_count)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    S eps = get_epsilon<S>();
+    S ssfmin = get_safemin<S>();
+    S ssfmax = S(1.0) / ssfmin;
+    ssfmin = sqrt(ssfmin) / (eps * eps);
+    ssfmax = sqrt(ssfmax) / S(3.0);
+
+    dim3 grid(1, 1, batch_count);
+    dim3 threads(min(n * n, BS1), 1, 1);
+    size_t lmemsize = syev_small_lmemsize<T, S>(evect, n);
+
+    ROCSOLVER_LAUNCH_KERNEL(syev_small_kernel<T>, grid, threads, lmemsize, stream, evect, uplo, n, A,
+                            shiftA, lda, strideA, D, strideD, E, strideE, info, eps, ssfmin, ssfmax);
+}
+
 /** Helper to calculate workspace sizes **/
 template <bool BATCHED, typename T, typename S>
 void rocsolver_syev_heev_getMemorySize(const rocblas_evect evect,
@@ -72,8 +352,8 @@ void rocsolver_syev_heev_getMemorySize(const rocblas_evect evect,
                                        size_t* size_tau,
                                        size_t* size_workArr)
 {
-    // if quick return, set workspace to zero
-    if(n <= 1 || batch_count == 0)
+    // if quick return, or if the small-size kernel is used, set workspace to zero
+    if(n <= SYEV_SMALL_SIZE || batch_count == 0)
     {
         *size_scalars = 0;
         *size_work_stack = 0;
@@ -203,6 +483,14 @@ rocblas_status rocsolver_syev_heev_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    // small-size kernel (the whole computation in shared memory)
+    if(n <= SYEV_SMALL_SIZE)
+    {
+        rocsolver_syev_heev_small<T>(handle, evect, uplo, n, A, shiftA, lda, strideA, D, strideD,
+                                     E, strideE, info, batch_count);
+        return rocblas_status_success;
+    }
+
     // reduce A to tridiagonal form
     rocsolver_sytrd_hetrd_template<BATCHED>(handle, uplo, n, A, shiftA, lda, strideA, D, strideD, E,
                                             strideE, tau, n, batch_count, scalars, (T*)work_stack,
@@ -10,13 +10,121 @@
 #pragma once
 
 #include "auxiliary/rocauxiliary_ormtr_unmtr.hpp"
+#include "auxiliary/rocauxiliary_stebz.hpp"
 #include "auxiliary/rocauxiliary_stedc.hpp"
-#include "auxiliary/rocauxiliary_sterf.hpp"
 #include "rocblas.hpp"
 #include "roclapack_syev_heev.hpp"
 #include "roclapack_sytrd_hetrd.hpp"
 #include "rocsolver/rocsolver.h"
 
+/** SYEVD_BISECT_INIT prepares the bisection of the tridiagonal matrix (D,E).
+    For every matrix in the batch it stores in work the squared off-diagonal
+    elements (n-1 values), followed by the minimum pivot allowed in the Sturm
+    sequences and the lower and upper bounds of an interval containing all the eigenvalues.
+    Call this kernel with batch_count groups in y, and BS1 threads in x. **/
+template <typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) syevd_bisect_init(const rocblas_int n,
+                                                               S* DD,
+                                                               const rocblas_stride strideD,
+                                                               S* EE,
+                                                               const rocblas_stride strideE,
+                                                               S* work,
+                                                               const rocblas_stride strideW,
+                                                               const S eps,
+                                                               const S sfmin)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    // select batch instance
+    S* D = DD + bid * strideD;
+    S* E = EE + bid * strideE;
+    S* Esqr = work + bid * strideW;
+
+    __shared__ S sval[BS1];
+
+    // square the off-diagonal elements and find the largest one
+    S emax = 1;
+    for(rocblas_int i = tid; i < n - 1; i += BS1)
+    {
+        S e2 = E[i] * E[i];
+        Esqr[i] = e2;
+        emax = std::max(emax, e2);
+    }
+    sval[tid] = emax;
+    __syncthreads();
+
+    for(rocblas_int r = BS1 / 2; r > 0; r /= 2)
+    {
+        if(tid < r)
+            sval[tid] = std::max(sval[tid], sval[tid + r]);
+        __syncthreads();
+    }
+
+    if(tid == 0)
+    {
+        S pmin = sval[0] * sfmin;
+        S gl, gu;
+        gershgorin_bounds(n, D, E, &gl, &gu);
+
+        // widen the interval to account for rounding errors
+        S bnorm = std::max(std::abs(gl), std::abs(gu));
+        gl = gl - bnorm * eps * n - pmin;
+        gu = gu + bnorm * eps * n + pmin;
+
+        Esqr[n - 1] = pmin;
+        Esqr[n] = gl;
+        Esqr[n + 1] = gu;
+    }
+}
+
+/** SYEVD_BISECT_KERNEL computes all the eigenvalues of the tridiagonal matrix (D,E)
+    by bisection on the Sturm count. Each thread computes the k-th eigenvalue independently
+    of the others and stores it in work after the data prepared by syevd_bisect_init.
+    Call this kernel with ceil(n/BS1) groups in x, batch_count groups in y, and BS1 threads in x. **/
+template <typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) syevd_bisect_kernel(const rocblas_int n,
+                                                                 S* DD,
+                                                                 const rocblas_stride strideD,
+                                                                 S* work,
+                                                                 const rocblas_stride strideW,
+                                                                 const S eps)
+{
+    rocblas_int k = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(k < n)
+    {
+        // select batch instance
+        S* D = DD + bid * strideD;
+        S* Esqr = work + bid * strideW;
+        S* W = Esqr + n + 2;
+
+        S pmin = Esqr[n - 1];
+        S lo = Esqr[n];
+        S hi = Esqr[n + 1];
+
+        // maximum number of iterations needed to reduce the interval to pmin
+        rocblas_int maxiter = rocblas_int((log(hi - lo + pmin) - log(pmin)) / log(2)) + 2;
+
+        // invariant: sturm_count(lo) <= k < sturm_count(hi)
+        for(rocblas_int iter = 0; iter < maxiter; ++iter)
+        {
+            S tol = std::max(2 * eps * std::max(std::abs(lo), std::abs(hi)), pmin);
+            if(hi - lo <= tol)
+                break;
+
+            S mid = (lo + hi) / 2;
+            if(sturm_count(n, D, Esqr, pmin, mid) > k)
+                hi = mid;
+            else
+                lo = mid;
+        }
+
+        W[k] = (lo + hi) / 2;
+    }
+}
+
 /** Helper to calculate workspace sizes **/
 template <bool BATCHED, typename T, typename S>
 void rocsolver_syevd_heevd_getMemorySize(const rocblas_evect evect,
@@ -33,8 +141,8 @@ void rocsolver_syevd_heevd_getMemorySize(const rocblas_evect evect,
                                          size_t* size_tau,
                                          size_t* size_workArr)
 {
-    // if quick return, set workspace to zero
-    if(n <= 1 || batch_count == 0)
+    // if quick return, or if the small-size kernel is used, set workspace to zero
+    if(n <= SYEV_SMALL_SIZE || batch_count == 0)
     {
         *size_scalars = 0;
         *size_work1 = 0;
@@ -69,20 +177,18 @@ void rocsolver_syevd_heevd_getMemorySize(const rocblas_evect evect,
                                                         &unused, &w13, &w23, &w32, &unused);
 
         *size_work3 = std::max(w31, w32);
+
+        // size of array for temporary matrix products
+        t2 = sizeof(T) * n * n * batch_count;
     }
     else
     {
-        // extra requirements for computing only the eigenvalues (sterf)
-        rocsolver_sterf_getMemorySize<T>(n, batch_count, &w12);
-
-        *size_work3 = 0;
+        // extra requirements for computing only the eigenvalues (bisection)
+        *size_work3 = sizeof(S) * (2 * n + 2) * batch_count;
         *size_tmpz = 0;
         *size_splits = 0;
     }
 
-    // size of array for temporary matrix products
-    t2 = sizeof(T) * n * n * batch_count;
-
     // get max values
     *size_work1 = std::max({w11, w12, w13});
     *size_work2 = std::max({w21, w22, w23});
@@ -152,6 +258,14 @@ rocblas_status rocsolver_syevd_heevd_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    // small-size kernel (the whole computation in shared memory)
+    if(n <= SYEV_SMALL_SIZE)
+    {
+        rocsolver_syev_heev_small<T>(handle, evect, uplo, n, A, shiftA, lda, strideA, D, strideD,
+                                     E, strideE, info, batch_count);
+        return rocblas_status_success;
+    }
+
     // TODO: Scale the matrix
 
     // reduce A to tridiagonal form
@@ -161,9 +275,21 @@ rocblas_status rocsolver_syevd_heevd_template(rocblas_handle handle,
 
     if(evect != rocblas_evect_original)
     {
-        // only compute eigenvalues
-        rocsolver_sterf_template<S>(handle, n, D, 0, strideD, E, 0, strideE, info, batch_count,
-                                    (rocblas_int*)work1);
+        // only compute eigenvalues (one thread per eigenvalue)
+        S eps = get_epsilon<S>();
+        S sfmin = get_safemin<S>();
+        const rocblas_stride strideW = 2 * n + 2;
+        const rocblas_int blocks = (n - 1) / BS1 + 1;
+
+        ROCSOLVER_LAUNCH_KERNEL(syevd_bisect_init<S>, dim3(1, batch_count), dim3(BS1), 0, stream,
+                                n, D, strideD, E, strideE, (S*)work3, strideW, eps, sfmin);
+        ROCSOLVER_LAUNCH_KERNEL(syevd_bisect_kernel<S>, dim3(blocks, batch_count), dim3(BS1), 0,
+                                stream, n, D, strideD, (S*)work3, strideW, eps);
+
+        // copy the eigenvalues (in ascending order) into D
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<S>, dim3(1, (n - 1) / BS2 + 1, batch_count),
+                                dim3(BS2, BS2), 0, stream, 1, n, (S*)work3, n + 2, 1, strideW, D,
+                                0, 1, strideD);
     }
     else
     {
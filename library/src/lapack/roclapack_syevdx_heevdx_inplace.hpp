@@ -11,12 +11,119 @@
 
 #include "auxiliary/rocauxiliary_ormtr_unmtr.hpp"
 #include "auxiliary/rocauxiliary_stebz.hpp"
+#include "auxiliary/rocauxiliary_stedc.hpp"
 #include "auxiliary/rocauxiliary_stein.hpp"
+#include "auxiliary/rocauxiliary_stemr.hpp"
 #include "rocblas.hpp"
 #include "roclapack_syevx_heevx.hpp"
 #include "roclapack_sytrd_hetrd.hpp"
 #include "rocsolver/rocsolver.h"
 
+/** SYEVDX_DC_SELECT sorts the eigenvalues computed by the divide-and-conquer kernel and selects
+    those in the requested range. The selected eigenvalues are written to W in increasing order, and
+    the indices of the corresponding columns of the eigenvector matrix are written to cols.
+    Call this kernel with batch_count groups in y, and BS1 threads in x. **/
+template <typename S>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) syevdx_dc_select(const rocblas_erange erange,
+                                                              const rocblas_int n,
+                                                              const S vl,
+                                                              const S vu,
+                                                              const rocblas_int il,
+                                                              const rocblas_int iu,
+                                                              S* DD,
+                                                              const rocblas_stride strideD,
+                                                              S* WW,
+                                                              const rocblas_stride strideW,
+                                                              rocblas_int* permA,
+                                                              rocblas_int* colsA,
+                                                              const rocblas_stride strideP,
+                                                              rocblas_int* nevA)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // select batch instance
+    S* D = DD + bid * strideD;
+    S* W = WW + bid * strideW;
+    rocblas_int* perm = permA + bid * strideP;
+    rocblas_int* cols = colsA + bid * strideP;
+
+    __shared__ rocblas_int sfirst, snev;
+
+    // position of every eigenvalue in increasing order
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        S d = D[i];
+        rocblas_int r = 0;
+        for(rocblas_int j = 0; j < n; j++)
+            r += (D[j] < d || (D[j] == d && j < i)) ? 1 : 0;
+        perm[r] = i;
+    }
+    __syncthreads();
+
+    // find the range of selected eigenvalues
+    if(tid == 0)
+    {
+        rocblas_int first = 0, nev = n;
+        if(erange == rocblas_erange_index)
+        {
+            first = il - 1;
+            nev = iu - il + 1;
+        }
+        else if(erange == rocblas_erange_value)
+        {
+            while(first < n && D[perm[first]] <= vl)
+                first++;
+            nev = 0;
+            while(first + nev < n && D[perm[first + nev]] <= vu)
+                nev++;
+        }
+
+        sfirst = first;
+        snev = nev;
+        nevA[bid] = nev;
+    }
+    __syncthreads();
+
+    for(rocblas_int j = tid; j < snev; j += BS1)
+    {
+        rocblas_int c = perm[sfirst + j];
+        W[j] = D[c];
+        cols[j] = c;
+    }
+}
+
+/** SYEVDX_DC_COPYVECT copies the columns of the (real) eigenvector matrix V selected by
+    syevdx_dc_select to the first nev columns of Z.
+    Call this kernel with ceil(n/BS2) groups in x and y, batch_count groups in z,
+    and BS2 x BS2 threads. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void syevdx_dc_copyvect(const rocblas_int n,
+                                         S* VV,
+                                         const rocblas_int ldv,
+                                         const rocblas_stride strideV,
+                                         rocblas_int* colsA,
+                                         const rocblas_stride strideP,
+                                         rocblas_int* nevA,
+                                         U ZZ,
+                                         const rocblas_int shiftZ,
+                                         const rocblas_int ldz,
+                                         const rocblas_stride strideZ)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < nevA[b])
+    {
+        S* V = VV + b * strideV;
+        rocblas_int* cols = colsA + b * strideP;
+        T* Z = load_ptr_batch<T>(ZZ, b, shiftZ, strideZ);
+
+        Z[i + j * ldz] = T(V[i + cols[j] * ldv]);
+    }
+}
+
 /** Argument checking **/
 template <typename T, typename S>
 rocblas_status rocsolver_syevdx_heevdx_inplace_argCheck(rocblas_handle handle,
@@ -70,6 +177,9 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_argCheck(rocblas_handle handle,
 /** Helper to calculate workspace sizes **/
 template <bool BATCHED, typename T, typename S>
 void rocsolver_syevdx_heevdx_inplace_getMemorySize(const rocblas_evect evect,
+                                                   const rocblas_erange erange,
+                                                   const rocblas_int il,
+                                                   const rocblas_int iu,
                                                    const rocblas_fill uplo,
                                                    const rocblas_int n,
                                                    const rocblas_int batch_count,
@@ -127,8 +237,25 @@ void rocsolver_syevdx_heevdx_inplace_getMemorySize(const rocblas_evect evect,
         rocsolver_ormtr_unmtr_getMemorySize<BATCHED, T>(rocblas_side_left, uplo, n, n, batch_count,
                                                         &unused, &a3, &b3, &c3, &unused);
 
-        // extra requirements for computing the eigenvectors (stein)
-        rocsolver_stein_getMemorySize<T, S>(n, batch_count, &a4, &b4);
+        if(n >= SYEVDX_DC_MIN_SIZE)
+        {
+            // extra requirements for computing the eigenvectors (stedc)
+            size_t d3, d5, d6;
+            rocsolver_stedc_getMemorySize<BATCHED, T, S>(rocblas_evect_tridiagonal, n, batch_count,
+                                                         &a4, &b4, &d3, &d5, &d6, &unused);
+            c3 = max(c3, d3);
+            *size_work5 = max(*size_work5, d5);
+            *size_work6 = max(*size_work6, d6);
+        }
+        else
+        {
+            // extra requirements for computing the eigenvectors (stemr or stein)
+            rocblas_int nev_max = (erange == rocblas_erange_index ? iu - il + 1 : n);
+            if(rocsolver_stemr_selected(n, erange, il, iu))
+                rocsolver_stemr_getMemorySize<T, S>(n, nev_max, batch_count, &a4, &b4);
+            else
+                rocsolver_stein_getMemorySize<T, S>(n, nev_max, batch_count, &a4, &b4);
+        }
 
         // extra space to store A
         *size_work4 = max(*size_work4, sizeof(T) * n * n * batch_count);
@@ -224,6 +351,56 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_template(rocblas_handle handle,
                                                E, stride, tau, stride, batch_count, scalars,
                                                (T*)work1, (T*)work2, (T*)work3, (T**)nsplit_workArr);
 
+    // if many eigenvectors of a large matrix are requested, use divide and conquer
+    if(evect == rocblas_evect_original && n >= SYEVDX_DC_MIN_SIZE)
+    {
+        rocblas_int blocks2 = (n - 1) / BS2 + 1;
+        dim3 grid2(blocks2, blocks2, batch_count);
+        dim3 threads2(BS2, BS2, 1);
+
+        // copy A to work4
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, grid2, threads2, 0, stream, copymat_to_buffer, n, n, A,
+                                shiftA, lda, strideA, (T*)work4);
+
+        // compute all eigenvalues and eigenvectors of the tridiagonal matrix
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3((batch_count - 1) / BS1 + 1, 1, 1),
+                                dim3(BS1, 1, 1), 0, stream, info, batch_count, 0);
+        rocsolver_stedc_run_dc<S>(handle, n, D, 0, stride, E, 0, stride, (S*)work2, n, n * n, info,
+                                  batch_count, (S*)work1, (S*)work3, (S*)work5,
+                                  (rocblas_int*)work6);
+
+        // select the requested eigenvalues, and copy the corresponding eigenvectors to A
+        ROCSOLVER_LAUNCH_KERNEL(syevdx_dc_select<S>, dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                                stream, erange, n, vl, vu, il, iu, D, stride, W, strideW, iblock,
+                                isplit, stride, d_nev);
+        ROCSOLVER_LAUNCH_KERNEL(syevdx_dc_copyvect<T>, grid2, threads2, 0, stream, n, (S*)work2, n,
+                                n * n, isplit, stride, d_nev, A, shiftA, lda, strideA);
+
+        // copy nev from device to host
+        std::vector<rocblas_int> hnev(batch_count);
+        hipError_t status = hipMemcpyAsync(hnev.data(), d_nev, sizeof(rocblas_int) * batch_count,
+                                           hipMemcpyDeviceToHost, stream);
+        if(status != hipSuccess)
+            return get_rocblas_status_for_hip_status(status);
+
+        status = hipStreamSynchronize(stream);
+        if(status != hipSuccess)
+            return get_rocblas_status_for_hip_status(status);
+
+        if(h_nev)
+            std::copy(hnev.begin(), hnev.end(), h_nev);
+
+        // apply unitary matrix only to the selected eigenvectors
+        rocblas_int max_nev = *std::max_element(hnev.begin(), hnev.end());
+        if(max_nev > 0)
+            rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
+                handle, rocblas_side_left, uplo, rocblas_operation_none, n, max_nev, (T*)work4, 0,
+                n, n * n, tau, stride, A, shiftA, lda, strideA, batch_count, scalars, (T*)work1,
+                (T*)work2, (T*)work3, (T**)nsplit_workArr);
+
+        return rocblas_status_success;
+    }
+
     // compute eigenvalues
     rocblas_eorder eorder
         = (evect == rocblas_evect_none ? rocblas_eorder_entire : rocblas_eorder_blocks);
@@ -247,13 +424,19 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_template(rocblas_handle handle,
                                 shiftA, lda, strideA, (T*)work4);
 
         // compute eigenvectors
-        rocsolver_stein_template<T>(handle, n, D, 0, stride, E, 0, stride, d_nev, W, 0, strideW,
-                                    iblock, stride, isplit, stride, A, shiftA, lda, strideA,
-                                    (rocblas_int*)nullptr, 0, info, batch_count, (S*)work1,
-                                    (rocblas_int*)work2);
+        rocblas_int temp_nev = (erange == rocblas_erange_index ? iu - il + 1 : n);
+        if(rocsolver_stemr_selected(n, erange, il, iu))
+            rocsolver_stemr_template<T>(handle, n, D, 0, stride, E, 0, stride, d_nev, temp_nev, W,
+                                        0, strideW, iblock, stride, isplit, stride, A, shiftA, lda,
+                                        strideA, (rocblas_int*)nullptr, 0, info, batch_count,
+                                        (S*)work1, (rocblas_int*)work2);
+        else
+            rocsolver_stein_template<T>(handle, n, D, 0, stride, E, 0, stride, d_nev, temp_nev, W,
+                                        0, strideW, iblock, stride, isplit, stride, A, shiftA, lda,
+                                        strideA, (rocblas_int*)nullptr, 0, info, batch_count,
+                                        (S*)work1, (rocblas_int*)work2);
 
         // apply unitary matrix to eigenvectors
-        rocblas_int temp_nev = (erange == rocblas_erange_index ? iu - il + 1 : n);
         rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
             handle, rocblas_side_left, uplo, rocblas_operation_none, n, temp_nev, (T*)work4, 0, n,
             n * n, tau, stride, A, shiftA, lda, strideA, batch_count, scalars, (T*)work1, (T*)work2,
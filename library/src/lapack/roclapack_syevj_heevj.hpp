@@ -740,6 +740,11 @@ ROCSOLVER_KERNEL void syevj_diag_rotate(const bool skip_block,
     rotations do not conflict between thread groups. We use block-level top/bottom pairs
     to obtain off-diagonal block indices that do not conflict.
 
+    Block pairs whose off-diagonal block has a squared Frobenius norm below norms / b^2 are
+    skipped (threshold Jacobi); as the diagonal blocks are always decomposed, skipping these pairs
+    does not prevent the residual from reaching the tolerance. The decision is stored in skip so
+    that SYEVJ_OFFD_ROTATE can also return early for the same pair.
+
     Call this kernel with batch_count groups in z, and BS2 threads in x and y. Each thread group
     will work on four matrix blocks; for a matrix consisting of b * b blocks, use b / 2 groups in x. **/
 template <typename T, typename S, typename U>
@@ -751,8 +756,10 @@ ROCSOLVER_KERNEL void syevj_offd_kernel(const rocblas_int blocks,
                                         const rocblas_stride strideA,
                                         const S eps,
                                         T* JA,
+                                        S* norms,
                                         rocblas_int* top,
                                         rocblas_int* bottom,
+                                        rocblas_int* skip,
                                         rocblas_int* completed)
 {
     rocblas_int tix = hipThreadIdx_x;
@@ -784,9 +791,6 @@ ROCSOLVER_KERNEL void syevj_offd_kernel(const rocblas_int blocks,
     rocblas_int x1 = tix + offseti, x2 = tix + offsetj;
     rocblas_int y1 = tiy + offseti, y2 = tiy + offsetj;
 
-    if(y1 >= n)
-        return;
-
     // array pointers
     T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
     T* J = (JA ? JA + (jid * 4 * nb_max * nb_max) : nullptr);
@@ -795,6 +799,35 @@ ROCSOLVER_KERNEL void syevj_offd_kernel(const rocblas_int blocks,
     extern __shared__ double lmem[];
     S* sh_cosines = reinterpret_cast<S*>(lmem);
     T* sh_sines = reinterpret_cast<T*>(sh_cosines + nb_max);
+    __shared__ rocblas_int sh_skip;
+
+    // calculate the squared Frobenius norm of the off-diagonal block (by column)
+    if(tiy == 0)
+    {
+        S local_res = 0;
+        if(x2 < n)
+        {
+            for(k = 0; k < nb_max; k++)
+                local_res += std::norm(A[(k + offseti) + x2 * lda]);
+        }
+        sh_cosines[tix] = local_res;
+    }
+    __syncthreads();
+
+    if(tix == 0 && tiy == 0)
+    {
+        S local_res = 0;
+        for(k = 0; k < nb_max; k++)
+            local_res += sh_cosines[k];
+
+        sh_skip = (local_res < norms[bid] / (S(blocks) * blocks) ? 1 : 0);
+        skip[jid] = sh_skip;
+    }
+    __syncthreads();
+
+    // skip the block pair if it is already converged
+    if(sh_skip || y1 >= n)
+        return;
 
     // initialize J to the identity
     if(J)
@@ -906,6 +939,7 @@ ROCSOLVER_KERNEL void syevj_offd_kernel(const rocblas_int blocks,
 }
 
 /** SYEVJ_OFFD_ROTATE rotates off-diagonal blocks using the rotations calculated by SYEVJ_OFFD_KERNEL.
+    Block pairs marked in skip by SYEVJ_OFFD_KERNEL are left untouched.
 
     Call this kernel with batch_count groups in z, 2*BS2 threads in x and BS2/2 threads in y.
     For a matrix consisting of b * b blocks, use b / 2 groups in x and 2(b - 2) groups in y. **/
@@ -920,6 +954,7 @@ ROCSOLVER_KERNEL void syevj_offd_rotate(const bool skip_block,
                                         T* JA,
                                         rocblas_int* top,
                                         rocblas_int* bottom,
+                                        rocblas_int* skip,
                                         rocblas_int* completed)
 {
     rocblas_int tix = hipThreadIdx_x;
@@ -929,7 +964,7 @@ ROCSOLVER_KERNEL void syevj_offd_rotate(const bool skip_block,
     rocblas_int bid = hipBlockIdx_z;
     rocblas_int jid = bid * hipGridDim_x + hipBlockIdx_x;
 
-    if(completed[bid + 1])
+    if(completed[bid + 1] || skip[jid])
         return;
 
     rocblas_int i = top[bix];
@@ -1244,8 +1279,9 @@ void rocsolver_syevj_heevj_getMemorySize(const rocblas_evect evect,
     *size_top = sizeof(rocblas_int) * half_blocks * batch_count;
     *size_bottom = sizeof(rocblas_int) * half_blocks * batch_count;
 
-    // size of temporary workspace to indicate problem completion
-    *size_completed = sizeof(rocblas_int) * (batch_count + 1);
+    // size of temporary workspace to indicate problem completion, followed by the
+    // mask of skipped block pairs
+    *size_completed = sizeof(rocblas_int) * (batch_count + 1 + half_blocks * batch_count);
 }
 
 /** Argument checking **/
@@ -1400,6 +1436,7 @@ rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
         bool ev = (evect != rocblas_evect_none);
         rocblas_int h_sweeps = 0;
         rocblas_int h_completed = 0;
+        rocblas_int* skip = completed + batch_count + 1;
 
         // set completed = 0
         ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, completed,
@@ -1447,13 +1484,13 @@ rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
                 // decompose off-diagonal block
                 ROCSOLVER_LAUNCH_KERNEL((syevj_offd_kernel<T, S>), gridOK, threadsOK, lmemsizeOK,
                                         stream, blocks, n, Acpy, 0, n, n * n, eps,
-                                        (ev ? J : nullptr), top, bottom, completed);
+                                        (ev ? J : nullptr), norms, top, bottom, skip, completed);
 
                 // update eigenvectors
                 if(ev)
                     ROCSOLVER_LAUNCH_KERNEL((syevj_offd_rotate<false, T, S>), gridOR, threadsOR, 0,
                                             stream, false, blocks, n, A, shiftA, lda, strideA, J,
-                                            top, bottom, completed);
+                                            top, bottom, skip, completed);
             }
             else
             {
@@ -1462,21 +1499,21 @@ rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
                     // decompose off-diagonal blocks, indexed by top/bottom pairs
                     ROCSOLVER_LAUNCH_KERNEL((syevj_offd_kernel<T, S>), gridOK, threadsOK,
                                             lmemsizeOK, stream, blocks, n, Acpy, 0, n, n * n, eps,
-                                            J, top, bottom, completed);
+                                            J, norms, top, bottom, skip, completed);
 
                     // apply rotations calculated by offd_kernel
                     ROCSOLVER_LAUNCH_KERNEL((syevj_offd_rotate<false, T, S>), gridOR, threadsOR, 0,
                                             stream, true, blocks, n, Acpy, 0, n, n * n, J, top,
-                                            bottom, completed);
+                                            bottom, skip, completed);
                     ROCSOLVER_LAUNCH_KERNEL((syevj_offd_rotate<true, T, S>), gridOR, threadsOR, 0,
                                             stream, true, blocks, n, Acpy, 0, n, n * n, J, top,
-                                            bottom, completed);
+                                            bottom, skip, completed);
 
                     // update eigenvectors
                     if(ev)
                         ROCSOLVER_LAUNCH_KERNEL((syevj_offd_rotate<false, T, S>), gridOR, threadsOR,
                                                 0, stream, false, blocks, n, A, shiftA, lda,
-                                                strideA, J, top, bottom, completed);
+                                                strideA, J, top, bottom, skip, completed);
 
                     // cycle top/bottom pairs
                     ROCSOLVER_LAUNCH_KERNEL(syevj_cycle_pairs<T>, gridPairs, threads, lmemsizePairs,
@@ -12,7 +12,9 @@
 #include "auxiliary/rocauxiliary_ormtr_unmtr.hpp"
 #include "auxiliary/rocauxiliary_stebz.hpp"
 #include "auxiliary/rocauxiliary_stein.hpp"
+#include "auxiliary/rocauxiliary_stemr.hpp"
 #include "rocblas.hpp"
+#include "roclapack_syev_heev.hpp"
 #include "roclapack_sytrd_hetrd.hpp"
 #include "rocsolver/rocsolver.h"
 
@@ -139,9 +141,164 @@ rocblas_status rocsolver_syevx_heevx_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
+/** SYEVX_SMALL_KERNEL computes the eigenvalues, and optionally the eigenvectors, of
+    small symmetric/hermitian matrices keeping every matrix in shared memory, and returns
+    those selected by erange. As in STEBZ, the selected eigenvalues are computed by bisection
+    to the accuracy given by abstol; the eigenvectors are those of the QL/QR iteration. If the
+    iteration fails, all the selected eigenvectors are reported as not converged, as in STEIN.
+
+    Call this kernel with batch_count groups in z, and up to n*n threads in x **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void syevx_small_kernel(const rocblas_evect evect,
+                                         const rocblas_erange erange,
+                                         const rocblas_fill uplo,
+                                         const rocblas_int n,
+                                         U AA,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         const S vl,
+                                         const S vu,
+                                         const rocblas_int il,
+                                         const rocblas_int iu,
+                                         const S abstol,
+                                         rocblas_int* nevA,
+                                         S* WW,
+                                         const rocblas_stride strideW,
+                                         U ZZ,
+                                         const rocblas_int shiftZ,
+                                         const rocblas_int ldz,
+                                         const rocblas_stride strideZ,
+                                         rocblas_int* ifailA,
+                                         const rocblas_stride strideF,
+                                         rocblas_int* infoA,
+                                         const S eps,
+                                         const S sfmin,
+                                         const S ssfmin,
+                                         const S ssfmax)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_z;
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    S* W = WW + bid * strideW;
+
+    // shared memory
+    extern __shared__ double lmem[];
+    T* As = reinterpret_cast<T*>(lmem);
+    T* Z = As + n * n;
+    T* tau = Z + (evect == rocblas_evect_original ? n * n : 0);
+    T* w = tau + n;
+    S* Ds = reinterpret_cast<S*>(w + n);
+    S* Es = Ds + n;
+    S* work = Es + n;
+    S* Dt = work + 2 * n;
+    S* Et = Dt + n;
+    S* Esqr = Et + n;
+    __shared__ T sval;
+    __shared__ rocblas_int info;
+    __shared__ rocblas_int first, nev, nfail;
+    __shared__ S pmin;
+
+    run_syev_small(tid, evect, uplo, n, A, lda, As, Z, tau, w, Ds, Es, work, &sval, &info, eps,
+                   ssfmin, ssfmax, Dt);
+
+    // find the selected eigenvalues using the Sturm sequence of the tridiagonal matrix
+    if(tid == 0)
+    {
+        S emax = 1;
+        for(rocblas_int i = 0; i < n - 1; i++)
+            emax = std::max(emax, Esqr[i]);
+        pmin = emax * sfmin;
+
+        first = 0;
+        nev = n;
+        nfail = 0;
+        if(erange == rocblas_erange_index)
+        {
+            first = il - 1;
+            nev = iu - il + 1;
+        }
+        else if(erange == rocblas_erange_value)
+        {
+            // eigenvalues in the half-open interval (vl, vu]
+            first = sturm_count(n, Dt, Esqr, pmin, vl);
+            nev = sturm_count(n, Dt, Esqr, pmin, vu) - first;
+        }
+    }
+    __syncthreads();
+
+    // bisection of the selected eigenvalues (one per thread)
+    for(rocblas_int i = tid; i < nev; i += hipBlockDim_x)
+    {
+        rocblas_int k = first + i;
+        S gl, gu, mid, bnorm, tol;
+
+        if(n == 1)
+            W[i] = Dt[0];
+        else
+        {
+            gershgorin_bounds(n, Dt, Et, &gl, &gu);
+            bnorm = std::max(std::abs(gl), std::abs(gu));
+            tol = abstol < 0 ? eps * bnorm : (abstol == 0 ? 2 * sfmin : abstol);
+            tol = std::max(tol, pmin);
+            gl = gl - bnorm * eps * n - pmin;
+            gu = gu + bnorm * eps * n + pmin;
+
+            rocblas_int ite = 0;
+            rocblas_int maxite = rocblas_int((log(gu - gl + pmin) - log(pmin)) / log(2)) + 2;
+            bool converged = false;
+            while(!converged && ite < maxite)
+            {
+                mid = (gl + gu) / 2;
+                if(sturm_count(n, Dt, Esqr, pmin, mid) > k)
+                    gu = mid;
+                else
+                    gl = mid;
+                bnorm = std::max(std::abs(gl), std::abs(gu));
+                converged = (gu - gl < std::max(tol, 2 * eps * bnorm));
+                ite++;
+            }
+
+            if(!converged)
+                atomicAdd(&nfail, 1);
+            W[i] = (gl + gu) / 2;
+        }
+    }
+    __syncthreads();
+
+    // write results
+    if(evect == rocblas_evect_original)
+    {
+        T* Zg = load_ptr_batch<T>(ZZ, bid, shiftZ, strideZ);
+        for(rocblas_int k = tid; k < n * nev; k += hipBlockDim_x)
+            Zg[(k % n) + (k / n) * ldz] = Z[(k % n) + (first + k / n) * n];
+
+        if(ifailA)
+        {
+            rocblas_int* ifail = ifailA + bid * strideF;
+            for(rocblas_int i = tid; i < nev; i += hipBlockDim_x)
+                ifail[i] = (info == 0 ? 0 : i + 1);
+        }
+    }
+
+    if(tid == 0)
+    {
+        nevA[bid] = nev;
+        if(evect == rocblas_evect_original)
+            infoA[bid] = (info == 0 ? 0 : nev);
+        else
+            infoA[bid] = (nfail == 0 ? 0 : 1);
+    }
+}
+
 /** Helper to calculate workspace sizes **/
 template <bool BATCHED, typename T, typename S>
 void rocsolver_syevx_heevx_getMemorySize(const rocblas_evect evect,
+                                         const rocblas_erange erange,
+                                         const rocblas_int il,
+                                         const rocblas_int iu,
                                          const rocblas_fill uplo,
                                          const rocblas_int n,
                                          const rocblas_int batch_count,
@@ -159,8 +316,8 @@ void rocsolver_syevx_heevx_getMemorySize(const rocblas_evect evect,
                                          size_t* size_tau,
                                          size_t* size_nsplit_workArr)
 {
-    // if quick return, set workspace to zero
-    if(n == 0 || batch_count == 0)
+    // if quick return, or if the small-size kernel is used, set workspace to zero
+    if(n <= SYEV_SMALL_SIZE || batch_count == 0)
     {
         *size_scalars = 0;
         *size_work1 = 0;
@@ -197,8 +354,12 @@ void rocsolver_syevx_heevx_getMemorySize(const rocblas_evect evect,
         rocsolver_ormtr_unmtr_getMemorySize<BATCHED, T>(rocblas_side_left, uplo, n, n, batch_count,
                                                         &unused, &a3, &b3, &c3, &unused);
 
-        // extra requirements for computing the eigenvectors (stein)
-        rocsolver_stein_getMemorySize<T, S>(n, batch_count, &a4, &b4);
+        // extra requirements for computing the eigenvectors (stemr or stein)
+        rocblas_int nev_max = (erange == rocblas_erange_index ? iu - il + 1 : n);
+        if(rocsolver_stemr_selected(n, erange, il, iu))
+            rocsolver_stemr_getMemorySize<T, S>(n, nev_max, batch_count, &a4, &b4);
+        else
+            rocsolver_stein_getMemorySize<T, S>(n, nev_max, batch_count, &a4, &b4);
     }
 
     // get max values
@@ -284,6 +445,25 @@ rocblas_status rocsolver_syevx_heevx_template(rocblas_handle handle,
         return rocblas_status_success;
     }
 
+    // small-size kernel (the whole computation in shared memory)
+    if(n <= SYEV_SMALL_SIZE)
+    {
+        S eps = get_epsilon<S>();
+        S sfmin = get_safemin<S>();
+        S ssfmin = sqrt(sfmin) / (eps * eps);
+        S ssfmax = sqrt(S(1.0) / sfmin) / S(3.0);
+
+        dim3 grid(1, 1, batch_count);
+        dim3 threads(min(n * n, BS1), 1, 1);
+        size_t lmemsize = syev_small_lmemsize<T, S>(evect, n) + sizeof(S) * 3 * n;
+
+        ROCSOLVER_LAUNCH_KERNEL(syevx_small_kernel<T>, grid, threads, lmemsize, stream, evect,
+                                erange, uplo, n, A, shiftA, lda, strideA, vl, vu, il, iu, abstol,
+                                nev, W, strideW, Z, shiftZ, ldz, strideZ, ifail, strideF, info,
+                                eps, sfmin, ssfmin, ssfmax);
+        return rocblas_status_success;
+    }
+
     // TODO: Scale the matrix
 
     const rocblas_stride stride = n;
@@ -303,13 +483,21 @@ rocblas_status rocsolver_syevx_heevx_template(rocblas_handle handle,
 
     if(evect != rocblas_evect_none)
     {
+        rocblas_int h_nev = (erange == rocblas_erange_index ? iu - il + 1 : n);
+
         // compute eigenvectors
-        rocsolver_stein_template<T>(handle, n, D, 0, stride, E, 0, stride, nev, W, 0, strideW,
-                                    iblock, stride, isplit, stride, Z, shiftZ, ldz, strideZ, ifail,
-                                    strideF, info, batch_count, (S*)work1, (rocblas_int*)work2);
+        if(rocsolver_stemr_selected(n, erange, il, iu))
+            rocsolver_stemr_template<T>(handle, n, D, 0, stride, E, 0, stride, nev, h_nev, W, 0,
+                                        strideW, iblock, stride, isplit, stride, Z, shiftZ, ldz,
+                                        strideZ, ifail, strideF, info, batch_count, (S*)work1,
+                                        (rocblas_int*)work2);
+        else
+            rocsolver_stein_template<T>(handle, n, D, 0, stride, E, 0, stride, nev, h_nev, W, 0,
+                                        strideW, iblock, stride, isplit, stride, Z, shiftZ, ldz,
+                                        strideZ, ifail, strideF, info, batch_count, (S*)work1,
+                                        (rocblas_int*)work2);
 
         // apply unitary matrix to eigenvectors
-        rocblas_int h_nev = (erange == rocblas_erange_index ? iu - il + 1 : n);
         rocsolver_ormtr_unmtr_template<BATCHED, STRIDED>(
             handle, rocblas_side_left, uplo, rocblas_operation_none, n, h_nev, A, shiftA, lda,
             strideA, tau, stride, Z, shiftZ, ldz, strideZ, batch_count, scalars, (T*)work1,
@@ -58,9 +58,9 @@ rocblas_status rocsolver_syevx_heevx_strided_batched_impl(rocblas_handle handle,
     size_t size_D, size_E, size_iblock, size_isplit, size_tau, size_nsplit_workArr;
 
     rocsolver_syevx_heevx_getMemorySize<false, T, S>(
-        evect, uplo, n, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3,
-        &size_work4, &size_work5, &size_work6, &size_D, &size_E, &size_iblock, &size_isplit,
-        &size_tau, &size_nsplit_workArr);
+        evect, erange, il, iu, uplo, n, batch_count, &size_scalars, &size_work1, &size_work2,
+        &size_work3, &size_work4, &size_work5, &size_work6, &size_D, &size_E, &size_iblock,
+        &size_isplit, &size_tau, &size_nsplit_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
         return rocblas_set_optimal_device_memory_size(
@@ -99,6 +99,170 @@ ROCSOLVER_KERNEL void sygs2_set_diag3(const rocblas_int k,
     }
 }
 
+/** SYGS2_SMALL_KERNEL reduces the n-by-n matrix A to standard form with a single work-group
+    per matrix in the batch (n <= SYGS2_SMALL_SIZE). The upper-triangular case is executed
+    as the lower-triangular one on the conjugate-transposed matrices.
+    Call this kernel with batch_count groups in y, and SYGS2_SMALL_SIZE threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void sygs2_small_kernel(const rocblas_eform itype,
+                                         const rocblas_fill uplo,
+                                         const rocblas_int n,
+                                         U AA,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         U BB,
+                                         const rocblas_int shiftB,
+                                         const rocblas_int ldb,
+                                         const rocblas_stride strideB)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int nthds = hipBlockDim_x;
+
+    // select batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+
+    // element (i,j) of the lower-triangular matrices is Ai(i,j) = A[i * rsA + j * csA]
+    // (conjugated if uplo is upper)
+    const bool upper = (uplo == rocblas_fill_upper);
+    const rocblas_int rsA = upper ? lda : 1;
+    const rocblas_int csA = upper ? 1 : lda;
+    const rocblas_int rsB = upper ? ldb : 1;
+    const rocblas_int csB = upper ? 1 : ldb;
+
+    __shared__ T x[SYGS2_SMALL_SIZE];
+    __shared__ T y[SYGS2_SMALL_SIZE];
+    __shared__ T z[SYGS2_SMALL_SIZE];
+
+    T aij, akk, bkk, ct;
+
+    if(itype == rocblas_eform_ax)
+    {
+        // Compute inv(L)*A*inv(L')
+        for(rocblas_int k = 0; k < n; k++)
+        {
+            rocblas_int m = n - k - 1;
+            bkk = B[k * rsB + k * csB];
+            akk = A[k * rsA + k * csA] / (bkk * bkk);
+            ct = T(-0.5) * akk;
+
+            // x = A(k+1:n,k) / bkk + ct * B(k+1:n,k)
+            for(rocblas_int i = k + 1 + tid; i < n; i += nthds)
+            {
+                aij = A[i * rsA + k * csA];
+                y[i] = B[i * rsB + k * csB];
+                if(upper)
+                {
+                    aij = conj(aij);
+                    y[i] = conj(y[i]);
+                }
+                x[i] = aij / bkk + ct * y[i];
+            }
+            __syncthreads();
+
+            // (all threads have read A(k,k) at this point)
+            if(tid == 0)
+                A[k * rsA + k * csA] = akk;
+
+            // A(k+1:n,k+1:n) -= x*y' + y*x'
+            for(rocblas_int idx = tid; idx < m * m; idx += nthds)
+            {
+                rocblas_int i = k + 1 + idx % m;
+                rocblas_int j = k + 1 + idx / m;
+                if(i >= j)
+                {
+                    aij = x[i] * conj(y[j]) + y[i] * conj(x[j]);
+                    A[i * rsA + j * csA] -= (upper ? conj(aij) : aij);
+                }
+            }
+            __syncthreads();
+
+            for(rocblas_int i = k + 1 + tid; i < n; i += nthds)
+                x[i] += ct * y[i];
+            __syncthreads();
+
+            // x = inv(L(k+1:n,k+1:n)) * x
+            for(rocblas_int j = k + 1; j < n; j++)
+            {
+                if(tid == 0)
+                    x[j] /= B[j * rsB + j * csB];
+                __syncthreads();
+
+                for(rocblas_int i = j + 1 + tid; i < n; i += nthds)
+                {
+                    aij = B[i * rsB + j * csB];
+                    x[i] -= (upper ? conj(aij) : aij) * x[j];
+                }
+                __syncthreads();
+            }
+
+            for(rocblas_int i = k + 1 + tid; i < n; i += nthds)
+                A[i * rsA + k * csA] = (upper ? conj(x[i]) : x[i]);
+            __syncthreads();
+        }
+    }
+    else
+    {
+        // Compute L'*A*L
+        for(rocblas_int k = 0; k < n; k++)
+        {
+            akk = A[k * rsA + k * csA];
+            bkk = B[k * rsB + k * csB];
+            ct = T(0.5) * akk;
+
+            // x = A(k,0:k)' and y = B(k,0:k)'
+            for(rocblas_int j = tid; j < k; j += nthds)
+            {
+                x[j] = A[k * rsA + j * csA];
+                y[j] = B[k * rsB + j * csB];
+                if(!upper)
+                {
+                    x[j] = conj(x[j]);
+                    y[j] = conj(y[j]);
+                }
+            }
+            __syncthreads();
+
+            // z = L(0:k,0:k)' * x + ct * y
+            for(rocblas_int j = tid; j < k; j += nthds)
+            {
+                T temp = 0;
+                for(rocblas_int i = j; i < k; i++)
+                {
+                    aij = B[i * rsB + j * csB];
+                    temp += (upper ? aij : conj(aij)) * x[i];
+                }
+                z[j] = temp + ct * y[j];
+            }
+            __syncthreads();
+
+            // A(0:k,0:k) += z*y' + y*z'
+            for(rocblas_int idx = tid; idx < k * k; idx += nthds)
+            {
+                rocblas_int i = idx % k;
+                rocblas_int j = idx / k;
+                if(i >= j)
+                {
+                    aij = z[i] * conj(y[j]) + y[i] * conj(z[j]);
+                    A[i * rsA + j * csA] += (upper ? conj(aij) : aij);
+                }
+            }
+
+            // A(k,0:k) = bkk * (z + ct * y)'
+            for(rocblas_int j = tid; j < k; j += nthds)
+            {
+                aij = bkk * (z[j] + ct * y[j]);
+                A[k * rsA + j * csA] = (upper ? aij : conj(aij));
+            }
+            if(tid == 0)
+                A[k * rsA + k * csA] = akk * bkk * bkk;
+            __syncthreads();
+        }
+    }
+}
+
 template <bool BATCHED, typename T>
 void rocsolver_sygs2_hegs2_getMemorySize(const rocblas_eform itype,
                                          const rocblas_int n,
@@ -108,8 +272,8 @@ void rocsolver_sygs2_hegs2_getMemorySize(const rocblas_eform itype,
                                          size_t* size_store_wcs,
                                          size_t* size_workArr)
 {
-    // if quick return no need of workspace
-    if(n == 0 || batch_count == 0)
+    // if quick return, or if the single-kernel version is used, no need of workspace
+    if(n == 0 || batch_count == 0 || n <= SYGS2_SMALL_SIZE)
     {
         *size_scalars = 0;
         *size_work = 0;
@@ -206,6 +370,15 @@ rocblas_status rocsolver_sygs2_hegs2_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // if the matrix is small, use the single-kernel version
+    if(n <= SYGS2_SMALL_SIZE)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(sygs2_small_kernel<T>, dim3(1, batch_count, 1),
+                                dim3(SYGS2_SMALL_SIZE, 1, 1), 0, stream, itype, uplo, n, A, shiftA,
+                                lda, strideA, B, shiftB, ldb, strideB);
+        return rocblas_status_success;
+    }
+
     // everything must be executed with scalars on the device
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
@@ -14,6 +14,46 @@
 #include "rocsolver/rocsolver.h"
 #include "rocsolver_run_specialized_kernels.hpp"
 
+/** SYGST_TWOSIDED_COPY copies A to W, filling both triangular parts, and the triangular
+    factor stored in B to the same triangular part of X.
+    Call this kernel with ceil(n/BS2) groups in x and y, batch_count groups in z,
+    and BS2 x BS2 threads. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void sygst_twosided_copy(const rocblas_fill uplo,
+                                          const rocblas_int n,
+                                          U AA,
+                                          const rocblas_int shiftA,
+                                          const rocblas_int lda,
+                                          const rocblas_stride strideA,
+                                          U BB,
+                                          const rocblas_int shiftB,
+                                          const rocblas_int ldb,
+                                          const rocblas_stride strideB,
+                                          T* WW,
+                                          T* XX)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i < n && j < n)
+    {
+        T* A = load_ptr_batch<T>(AA, b, shiftA, strideA);
+        T* B = load_ptr_batch<T>(BB, b, shiftB, strideB);
+        T* W = WW + b * n * n;
+        T* X = XX + b * n * n;
+
+        const bool intri = (uplo == rocblas_fill_upper) ? (i <= j) : (i >= j);
+        if(intri)
+        {
+            W[i + j * n] = A[i + j * lda];
+            X[i + j * n] = B[i + j * ldb];
+        }
+        else
+            W[i + j * n] = conj(A[j + i * lda]);
+    }
+}
+
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_sygst_hegst_getMemorySize(const rocblas_fill uplo,
                                          const rocblas_eform itype,
@@ -47,6 +87,42 @@ void rocsolver_sygst_hegst_getMemorySize(const rocblas_fill uplo,
         *size_invA_arr = 0;
         *optim_mem = true;
     }
+    else if(n >= xxGST_TWOSIDED_SWITCH)
+    {
+        size_t temp1, temp2, temp3, temp4, temp5, temp6, temp7, temp8;
+        *size_scalars = 0;
+
+        if(itype == rocblas_eform_ax)
+        {
+            // requirements for calling the two TRSM on the workspace copies
+            rocblas_operation transL = (uplo == rocblas_fill_upper)
+                ? rocblas_operation_conjugate_transpose
+                : rocblas_operation_none;
+            rocblas_operation transR = (uplo == rocblas_fill_upper)
+                ? rocblas_operation_none
+                : rocblas_operation_conjugate_transpose;
+            rocsolver_trsm_mem<false, true, T>(rocblas_side_left, transL, n, n, batch_count, &temp1,
+                                               &temp2, &temp3, &temp4, optim_mem);
+            rocsolver_trsm_mem<false, true, T>(rocblas_side_right, transR, n, n, batch_count,
+                                               &temp5, &temp6, &temp7, &temp8, optim_mem);
+
+            *size_work_x_temp = max(temp1, temp5);
+            *size_workArr_temp_arr = max(temp2, temp6);
+            *size_store_wcs_invA = max(temp3, temp7);
+            *size_invA_arr = max(temp4, temp8);
+        }
+        else
+        {
+            *size_work_x_temp = 0;
+            *size_workArr_temp_arr = 0;
+            *size_store_wcs_invA = 0;
+            *size_invA_arr = 0;
+            *optim_mem = true;
+        }
+
+        // size of the copies of A and B (stored in front of the TRSM workspace)
+        *size_work_x_temp += 2 * sizeof(T) * n * n * batch_count;
+    }
     else
     {
         rocblas_int kb = xxGST_BLOCKSIZE;
@@ -58,6 +134,10 @@ void rocsolver_sygst_hegst_getMemorySize(const rocblas_fill uplo,
                                                         size_workArr_temp_arr);
         *size_invA_arr = 0;
 
+        // size of array of pointers to workspace (for calling TRMM)
+        if(BATCHED)
+            *size_workArr_temp_arr = max(*size_workArr_temp_arr, sizeof(T*) * batch_count);
+
         if(itype == rocblas_eform_ax)
         {
             // extra requirements for calling TRSM
@@ -140,6 +220,82 @@ rocblas_status rocsolver_sygst_hegst_template(rocblas_handle handle,
     T t_minone = -1;
     T t_minhalf = -0.5;
 
+    // if the matrix is large, use the two-sided formulation on a copy of the whole matrix
+    if(n >= xxGST_TWOSIDED_SWITCH)
+    {
+        const rocblas_int ldw = n;
+        const rocblas_stride strideW = rocblas_stride(n) * n;
+        T* W = (T*)work_x_temp;
+        T* X = W + strideW * batch_count;
+        void* work = (void*)(X + strideW * batch_count);
+
+        const rocblas_int blocks = (n - 1) / BS2 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(sygst_twosided_copy<T>, dim3(blocks, blocks, batch_count),
+                                dim3(BS2, BS2), 0, stream, uplo, n, A, shiftA, lda, strideA, B,
+                                shiftB, ldb, strideB, W, X);
+
+        if(itype == rocblas_eform_ax)
+        {
+            if(uplo == rocblas_fill_upper)
+            {
+                // Compute inv(U')*A*inv(U)
+                rocsolver_trsm_upper<false, true, T>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                    rocblas_diagonal_non_unit, n, n, X, 0, ldw, strideW, W, 0, ldw, strideW,
+                    batch_count, optim_mem, work, workArr_temp_arr, store_wcs_invA, invA_arr);
+                rocsolver_trsm_upper<false, true, T>(
+                    handle, rocblas_side_right, rocblas_operation_none, rocblas_diagonal_non_unit, n,
+                    n, X, 0, ldw, strideW, W, 0, ldw, strideW, batch_count, optim_mem, work,
+                    workArr_temp_arr, store_wcs_invA, invA_arr);
+            }
+            else
+            {
+                // Compute inv(L)*A*inv(L')
+                rocsolver_trsm_lower<false, true, T>(
+                    handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, n,
+                    n, X, 0, ldw, strideW, W, 0, ldw, strideW, batch_count, optim_mem, work,
+                    workArr_temp_arr, store_wcs_invA, invA_arr);
+                rocsolver_trsm_lower<false, true, T>(
+                    handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+                    rocblas_diagonal_non_unit, n, n, X, 0, ldw, strideW, W, 0, ldw, strideW,
+                    batch_count, optim_mem, work, workArr_temp_arr, store_wcs_invA, invA_arr);
+            }
+        }
+        else
+        {
+            if(uplo == rocblas_fill_upper)
+            {
+                // Compute U*A*U'
+                rocblasCall_trmm(handle, rocblas_side_left, uplo, rocblas_operation_none,
+                                 rocblas_diagonal_non_unit, n, n, &t_one, 0, X, 0, ldw, strideW, W,
+                                 0, ldw, strideW, batch_count);
+                rocblasCall_trmm(handle, rocblas_side_right, uplo,
+                                 rocblas_operation_conjugate_transpose, rocblas_diagonal_non_unit,
+                                 n, n, &t_one, 0, X, 0, ldw, strideW, W, 0, ldw, strideW,
+                                 batch_count);
+            }
+            else
+            {
+                // Compute L'*A*L
+                rocblasCall_trmm(handle, rocblas_side_left, uplo,
+                                 rocblas_operation_conjugate_transpose, rocblas_diagonal_non_unit,
+                                 n, n, &t_one, 0, X, 0, ldw, strideW, W, 0, ldw, strideW,
+                                 batch_count);
+                rocblasCall_trmm(handle, rocblas_side_right, uplo, rocblas_operation_none,
+                                 rocblas_diagonal_non_unit, n, n, &t_one, 0, X, 0, ldw, strideW, W,
+                                 0, ldw, strideW, batch_count);
+            }
+        }
+
+        // copy the result back into the referenced triangular part of A
+        ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(blocks, blocks, batch_count), dim3(BS2, BS2), 0,
+                                stream, n, n, W, 0, ldw, strideW, A, shiftA, lda, strideA,
+                                no_mask{}, uplo);
+
+        rocblas_set_pointer_mode(handle, old_mode);
+        return rocblas_status_success;
+    }
+
     if(itype == rocblas_eform_ax)
     {
         if(uplo == rocblas_fill_upper)
@@ -73,6 +73,9 @@ rocblas_status rocsolver_sygvdx_hegvdx_inplace_argCheck(rocblas_handle handle,
 template <bool BATCHED, bool STRIDED, typename T, typename S>
 void rocsolver_sygvdx_hegvdx_inplace_getMemorySize(const rocblas_eform itype,
                                                    const rocblas_evect evect,
+                                                   const rocblas_erange erange,
+                                                   const rocblas_int il,
+                                                   const rocblas_int iu,
                                                    const rocblas_fill uplo,
                                                    const rocblas_int n,
                                                    const rocblas_int batch_count,
@@ -134,8 +137,9 @@ void rocsolver_sygvdx_hegvdx_inplace_getMemorySize(const rocblas_eform itype,
 
     // requirements for calling SYEVDX/HEEVDX
     rocsolver_syevdx_heevdx_inplace_getMemorySize<BATCHED, T, S>(
-        evect, uplo, n, batch_count, &unused, &temp1, &temp2, &temp3, &temp4, size_work5,
-        size_work6, size_D, size_E, size_iblock, size_isplit, size_tau, size_nev, &temp5);
+        evect, erange, il, iu, uplo, n, batch_count, &unused, &temp1, &temp2, &temp3, &temp4,
+        size_work5, size_work6, size_D, size_E, size_iblock, size_isplit, size_tau, size_nev,
+        &temp5);
     *size_work1 = max(*size_work1, temp1);
     *size_work2 = max(*size_work2, temp2);
     *size_work3 = max(*size_work3, temp3);
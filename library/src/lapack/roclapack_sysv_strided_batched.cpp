@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_sysv.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_sysv_strided_batched_impl(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   U A,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   rocblas_int* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   U B,
+                                                   const rocblas_int ldb,
+                                                   const rocblas_stride strideB,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("sysv_strided_batched", "--uplo", uplo, "-n", n, "--nrhs", nrhs, "--lda",
+                        lda, "--strideA", strideA, "--strideP", strideP, "--ldb", ldb, "--strideB",
+                        strideB, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_sysv_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B, ipiv, info,
+                                                batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // memory workspace sizes:
+    // size of reusable workspace (for calling SYTRF and to copy B)
+    size_t size_work;
+    // extra requirements for calling SYTRS
+    bool optim_mem;
+    size_t size_E, size_work1, size_work2, size_work3, size_work4;
+    rocsolver_sysv_getMemorySize<false, true, T>(n, nrhs, batch_count, &size_work, &size_E,
+                                                 &size_work1, &size_work2, &size_work3, &size_work4,
+                                                 &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work, size_E, size_work1,
+                                                      size_work2, size_work3, size_work4);
+
+    // memory workspace allocation
+    void *work, *E, *work1, *work2, *work3, *work4;
+    rocblas_device_malloc mem(handle, size_work, size_E, size_work1, size_work2, size_work3,
+                              size_work4);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+    E = mem[1];
+    work1 = mem[2];
+    work2 = mem[3];
+    work3 = mem[4];
+    work4 = mem[5];
+
+    // execution
+    return rocsolver_sysv_template<false, true, T>(handle, uplo, n, nrhs, A, shiftA, lda, strideA,
+                                                   ipiv, strideP, B, shiftB, ldb, strideB, info,
+                                                   batch_count, (T*)work, (T*)E, work1, work2,
+                                                   work3, work4, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_ssysv_strided_batched(rocblas_handle handle,
+                                                          const rocblas_fill uplo,
+                                                          const rocblas_int n,
+                                                          const rocblas_int nrhs,
+                                                          float* A,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          rocblas_int* ipiv,
+                                                          const rocblas_stride strideP,
+                                                          float* B,
+                                                          const rocblas_int ldb,
+                                                          const rocblas_stride strideB,
+                                                          rocblas_int* info,
+                                                          const rocblas_int batch_count)
+{
+    return rocsolver_sysv_strided_batched_impl<float>(handle, uplo, n, nrhs, A, lda, strideA, ipiv,
+                                                      strideP, B, ldb, strideB, info, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_dsysv_strided_batched(rocblas_handle handle,
+                                                          const rocblas_fill uplo,
+                                                          const rocblas_int n,
+                                                          const rocblas_int nrhs,
+                                                          double* A,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          rocblas_int* ipiv,
+                                                          const rocblas_stride strideP,
+                                                          double* B,
+                                                          const rocblas_int ldb,
+                                                          const rocblas_stride strideB,
+                                                          rocblas_int* info,
+                                                          const rocblas_int batch_count)
+{
+    return rocsolver_sysv_strided_batched_impl<double>(handle, uplo, n, nrhs, A, lda, strideA, ipiv,
+                                                       strideP, B, ldb, strideB, info, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_csysv_strided_batched(rocblas_handle handle,
+                                                          const rocblas_fill uplo,
+                                                          const rocblas_int n,
+                                                          const rocblas_int nrhs,
+                                                          rocblas_float_complex* A,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          rocblas_int* ipiv,
+                                                          const rocblas_stride strideP,
+                                                          rocblas_float_complex* B,
+                                                          const rocblas_int ldb,
+                                                          const rocblas_stride strideB,
+                                                          rocblas_int* info,
+                                                          const rocblas_int batch_count)
+{
+    return rocsolver_sysv_strided_batched_impl<rocblas_float_complex>(handle, uplo, n, nrhs, A, lda,
+                                                                      strideA, ipiv, strideP, B,
+                                                                      ldb, strideB, info,
+                                                                      batch_count);
+}
+
+extern "C" rocblas_status rocsolver_zsysv_strided_batched(rocblas_handle handle,
+                                                          const rocblas_fill uplo,
+                                                          const rocblas_int n,
+                                                          const rocblas_int nrhs,
+                                                          rocblas_double_complex* A,
+                                                          const rocblas_int lda,
+                                                          const rocblas_stride strideA,
+                                                          rocblas_int* ipiv,
+                                                          const rocblas_stride strideP,
+                                                          rocblas_double_complex* B,
+                                                          const rocblas_int ldb,
+                                                          const rocblas_stride strideB,
+                                                          rocblas_int* info,
+                                                          const rocblas_int batch_count)
+{
+    return rocsolver_sysv_strided_batched_impl<rocblas_double_complex>(handle, uplo, n, nrhs, A,
+                                                                       lda, strideA, ipiv, strideP,
+                                                                       B, ldb, strideB, info,
+                                                                       batch_count);
+}
@@ -0,0 +1,477 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.10.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     June 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** thread-block size for calling the sytri kernel.
+    (MAX_THDS sizes must be one of 128, 256, 512, or 1024) **/
+#define SYTRI_MAX_THDS 256
+
+/** SYTRI_SYMV computes y = -A * x, where A is the k-by-k symmetric matrix
+    stored in the upper or lower triangular part of A. **/
+template <int MAX_THDS, typename T>
+__device__ void sytri_symv(const rocblas_int tid,
+                           const rocblas_fill uplo,
+                           const rocblas_int k,
+                           T* A,
+                           const rocblas_int lda,
+                           T* x,
+                           T* y)
+{
+    T temp;
+    rocblas_int i, l;
+
+    for(i = tid; i < k; i += MAX_THDS)
+    {
+        temp = 0;
+        if(uplo == rocblas_fill_upper)
+        {
+            for(l = 0; l < i; l++)
+                temp += A[l + i * lda] * x[l];
+            for(l = i; l < k; l++)
+                temp += A[i + l * lda] * x[l];
+        }
+        else
+        {
+            for(l = 0; l < i; l++)
+                temp += A[i + l * lda] * x[l];
+            for(l = i; l < k; l++)
+                temp += A[l + i * lda] * x[l];
+        }
+        y[i] = -temp;
+    }
+}
+
+/** SYTRI_KERNEL_UPPER computes the inverse of A = U * D * U' from the factorization
+    computed by SYTRF. The upper triangular part of A is overwritten with the upper
+    triangular part of inv(A). If D is singular, A is not modified.
+
+    Call this kernel with 1 group in x, batch_count groups in y, and
+    SYTRI_MAX_THDS threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(SYTRI_MAX_THDS)
+    sytri_kernel_upper(const rocblas_int n,
+                       U AA,
+                       const rocblas_int shiftA,
+                       const rocblas_int lda,
+                       const rocblas_stride strideA,
+                       const rocblas_int* ipivA,
+                       const rocblas_stride strideP,
+                       rocblas_int* infoA,
+                       T* WW)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // get array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    const rocblas_int* ipiv = ipivA + bid * strideP;
+    T* w = WW + bid * n;
+
+    // shared variables
+    __shared__ T sval[SYTRI_MAX_THDS];
+    __shared__ rocblas_int _info;
+
+    rocblas_int i, k, kp, kstep;
+    T t, ak, akp1, akkp1, d;
+
+    // check that the diagonal matrix D is nonsingular
+    if(tid == 0)
+    {
+        _info = 0;
+        for(k = n - 1; k >= 0; k--)
+        {
+            if(ipiv[k] > 0 && A[k + k * lda] == 0)
+            {
+                _info = k + 1;
+                break;
+            }
+        }
+        infoA[bid] = _info;
+    }
+    __syncthreads();
+
+    if(_info != 0)
+        return;
+
+    // compute inv(A) from the factorization
+    k = 0;
+    while(k < n)
+    {
+        if(ipiv[k] > 0)
+        {
+            // 1-by-1 diagonal block
+
+            // invert the diagonal block
+            if(tid == 0)
+                A[k + k * lda] = T(1) / A[k + k * lda];
+
+            // compute column k of the inverse
+            if(k > 0)
+            {
+                for(i = tid; i < k; i += SYTRI_MAX_THDS)
+                    w[i] = A[i + k * lda];
+                __syncthreads();
+
+                sytri_symv<SYTRI_MAX_THDS>(tid, rocblas_fill_upper, k, A, lda, w, A + k * lda);
+                __syncthreads();
+
+                dot<SYTRI_MAX_THDS>(tid, k, w, 1, A + k * lda, 1, sval);
+                __syncthreads();
+
+                if(tid == 0)
+                    A[k + k * lda] -= sval[0];
+            }
+            kstep = 1;
+        }
+        else
+        {
+            // 2-by-2 diagonal block
+
+            // invert the diagonal block
+            if(tid == 0)
+            {
+                t = A[k + (k + 1) * lda];
+                ak = A[k + k * lda] / t;
+                akp1 = A[(k + 1) + (k + 1) * lda] / t;
+                akkp1 = A[k + (k + 1) * lda] / t;
+                d = t * (ak * akp1 - T(1));
+                A[k + k * lda] = akp1 / d;
+                A[(k + 1) + (k + 1) * lda] = ak / d;
+                A[k + (k + 1) * lda] = -akkp1 / d;
+            }
+
+            // compute columns k and k+1 of the inverse
+            if(k > 0)
+            {
+                for(i = tid; i < k; i += SYTRI_MAX_THDS)
+                    w[i] = A[i + k * lda];
+                __syncthreads();
+
+                sytri_symv<SYTRI_MAX_THDS>(tid, rocblas_fill_upper, k, A, lda, w, A + k * lda);
+                __syncthreads();
+
+                dot<SYTRI_MAX_THDS>(tid, k, w, 1, A + k * lda, 1, sval);
+                __syncthreads();
+
+                if(tid == 0)
+                    A[k + k * lda] -= sval[0];
+                __syncthreads();
+
+                dot<SYTRI_MAX_THDS>(tid, k, A + k * lda, 1, A + (k + 1) * lda, 1, sval);
+                __syncthreads();
+
+                if(tid == 0)
+                    A[k + (k + 1) * lda] -= sval[0];
+
+                for(i = tid; i < k; i += SYTRI_MAX_THDS)
+                    w[i] = A[i + (k + 1) * lda];
+                __syncthreads();
+
+                sytri_symv<SYTRI_MAX_THDS>(tid, rocblas_fill_upper, k, A, lda, w,
+                                           A + (k + 1) * lda);
+                __syncthreads();
+
+                dot<SYTRI_MAX_THDS>(tid, k, w, 1, A + (k + 1) * lda, 1, sval);
+                __syncthreads();
+
+                if(tid == 0)
+                    A[(k + 1) + (k + 1) * lda] -= sval[0];
+            }
+            kstep = 2;
+        }
+        __syncthreads();
+
+        // interchange rows and columns k and kp in the leading submatrix
+        kp = (ipiv[k] > 0 ? ipiv[k] : -ipiv[k]) - 1;
+        if(kp != k)
+        {
+            for(i = tid; i < kp; i += SYTRI_MAX_THDS)
+                swap(A[i + k * lda], A[i + kp * lda]);
+            for(i = tid; i < k - kp - 1; i += SYTRI_MAX_THDS)
+                swap(A[(kp + i + 1) + k * lda], A[kp + (kp + i + 1) * lda]);
+
+            if(tid == 0)
+            {
+                swap(A[k + k * lda], A[kp + kp * lda]);
+                if(kstep == 2)
+                    swap(A[k + (k + 1) * lda], A[kp + (k + 1) * lda]);
+            }
+        }
+        __syncthreads();
+
+        k += kstep;
+    }
+}
+
+/** SYTRI_KERNEL_LOWER computes the inverse of A = L * D * L' from the factorization
+    computed by SYTRF. The lower triangular part of A is overwritten with the lower
+    triangular part of inv(A). If D is singular, A is not modified.
+
+    Call this kernel with 1 group in x, batch_count groups in y, and
+    SYTRI_MAX_THDS threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(SYTRI_MAX_THDS)
+    sytri_kernel_lower(const rocblas_int n,
+                       U AA,
+                       const rocblas_int shiftA,
+                       const rocblas_int lda,
+                       const rocblas_stride strideA,
+                       const rocblas_int* ipivA,
+                       const rocblas_stride strideP,
+                       rocblas_int* infoA,
+                       T* WW)
+{
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // get array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    const rocblas_int* ipiv = ipivA + bid * strideP;
+    T* w = WW + bid * n;
+
+    // shared variables
+    __shared__ T sval[SYTRI_MAX_THDS];
+    __shared__ rocblas_int _info;
+
+    rocblas_int i, k, kp, kstep, m;
+    T t, ak, akp1, akkp1, d;
+
+    // check that the diagonal matrix D is nonsingular
+    if(tid == 0)
+    {
+        _info = 0;
+        for(k = 0; k < n; k++)
+        {
+            if(ipiv[k] > 0 && A[k + k * lda] == 0)
+            {
+                _info = k + 1;
+                break;
+            }
+        }
+        infoA[bid] = _info;
+    }
+    __syncthreads();
+
+    if(_info != 0)
+        return;
+
+    // compute inv(A) from the factorization
+    k = n - 1;
+    while(k >= 0)
+    {
+        // size of the trailing submatrix
+        m = n - k - 1;
+
+        if(ipiv[k] > 0)
+        {
+            // 1-by-1 diagonal block
+
+            // invert the diagonal block
+            if(tid == 0)
+                A[k + k * lda] = T(1) / A[k + k * lda];
+
+            // compute column k of the inverse
+            if(m > 0)
+            {
+                for(i = tid; i < m; i += SYTRI_MAX_THDS)
+                    w[i] = A[(k + 1 + i) + k * lda];
+                __syncthreads();
+
+                sytri_symv<SYTRI_MAX_THDS>(tid, rocblas_fill_lower, m, A + (k + 1) + (k + 1) * lda,
+                                           lda, w, A + (k + 1) + k * lda);
+                __syncthreads();
+
+                dot<SYTRI_MAX_THDS>(tid, m, w, 1, A + (k + 1) + k * lda, 1, sval);
+                __syncthreads();
+
+                if(tid == 0)
+                    A[k + k * lda] -= sval[0];
+            }
+            kstep = 1;
+        }
+        else
+        {
+            // 2-by-2 diagonal block
+
+            // invert the diagonal block
+            if(tid == 0)
+            {
+                t = A[k + (k - 1) * lda];
+                ak = A[(k - 1) + (k - 1) * lda] / t;
+                akp1 = A[k + k * lda] / t;
+                akkp1 = A[k + (k - 1) * lda] / t;
+                d = t * (ak * akp1 - T(1));
+                A[(k - 1) + (k - 1) * lda] = akp1 / d;
+                A[k + k * lda] = ak / d;
+                A[k + (k - 1) * lda] = -akkp1 / d;
+            }
+
+            // compute columns k-1 and k of the inverse
+            if(m > 0)
+            {
+                for(i = tid; i < m; i += SYTRI_MAX_THDS)
+                    w[i] = A[(k + 1 + i) + k * lda];
+                __syncthreads();
+
+                sytri_symv<SYTRI_MAX_THDS>(tid, rocblas_fill_lower, m, A + (k + 1) + (k + 1) * lda,
+                                           lda, w, A + (k + 1) + k * lda);
+                __syncthreads();
+
+                dot<SYTRI_MAX_THDS>(tid, m, w, 1, A + (k + 1) + k * lda, 1, sval);
+                __syncthreads();
+
+                if(tid == 0)
+                    A[k + k * lda] -= sval[0];
+                __syncthreads();
+
+                dot<SYTRI_MAX_THDS>(tid, m, A + (k + 1) + k * lda, 1, A + (k + 1) + (k - 1) * lda,
+                                    1, sval);
+                __syncthreads();
+
+                if(tid == 0)
+                    A[k + (k - 1) * lda] -= sval[0];
+
+                for(i = tid; i < m; i += SYTRI_MAX_THDS)
+                    w[i] = A[(k + 1 + i) + (k - 1) * lda];
+                __syncthreads();
+
+                sytri_symv<SYTRI_MAX_THDS>(tid, rocblas_fill_lower, m, A + (k + 1) + (k + 1) * lda,
+                                           lda, w, A + (k + 1) + (k - 1) * lda);
+                __syncthreads();
+
+                dot<SYTRI_MAX_THDS>(tid, m, w, 1, A + (k + 1) + (k - 1) * lda, 1, sval);
+                __syncthreads();
+
+                if(tid == 0)
+                    A[(k - 1) + (k - 1) * lda] -= sval[0];
+            }
+            kstep = 2;
+        }
+        __syncthreads();
+
+        // interchange rows and columns k and kp in the trailing submatrix
+        kp = (ipiv[k] > 0 ? ipiv[k] : -ipiv[k]) - 1;
+        if(kp != k)
+        {
+            for(i = tid; i < n - kp - 1; i += SYTRI_MAX_THDS)
+                swap(A[(kp + i + 1) + k * lda], A[(kp + i + 1) + kp * lda]);
+            for(i = tid; i < kp - k - 1; i += SYTRI_MAX_THDS)
+                swap(A[(k + i + 1) + k * lda], A[kp + (k + i + 1) * lda]);
+
+            if(tid == 0)
+            {
+                swap(A[k + k * lda], A[kp + kp * lda]);
+                if(kstep == 2)
+                    swap(A[k + (k - 1) * lda], A[kp + (k - 1) * lda]);
+            }
+        }
+        __syncthreads();
+
+        k -= kstep;
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_sytri_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        const rocblas_int* ipiv,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+void rocsolver_sytri_getMemorySize(const rocblas_int n, const rocblas_int batch_count, size_t* size_work)
+{
+    // if quick return no workspace needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // size of the temporary column vector
+    *size_work = sizeof(T) * n * batch_count;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_sytri_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        T* work)
+{
+    ROCSOLVER_ENTER("sytri", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return
+    if(n == 0)
+    {
+        // set info = 0
+        rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+        dim3 gridReset(blocksReset, 1, 1);
+        dim3 threadsReset(BS1, 1, 1);
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, info, batch_count, 0);
+
+        return rocblas_status_success;
+    }
+
+    dim3 grid(1, batch_count, 1);
+    dim3 threads(SYTRI_MAX_THDS, 1, 1);
+
+    if(uplo == rocblas_fill_upper)
+        ROCSOLVER_LAUNCH_KERNEL(sytri_kernel_upper<T>, grid, threads, 0, stream, n, A, shiftA, lda,
+                                strideA, ipiv, strideP, info, work);
+    else
+        ROCSOLVER_LAUNCH_KERNEL(sytri_kernel_lower<T>, grid, threads, 0, stream, n, A, shiftA, lda,
+                                strideA, ipiv, strideP, info, work);
+
+    return rocblas_status_success;
+}
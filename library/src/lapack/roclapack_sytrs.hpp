@@ -0,0 +1,894 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.10.1) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     June 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+/** thread-block size for calling the sytrs kernel.
+    (MAX_THDS sizes must be one of 128, 256, 512, or 1024) **/
+#define SYTRS_MAX_THDS 256
+
+/** SYTRS_KERNEL_UPPER solves A * X = B for one column of B, where A = U * D * U' was
+    computed by SYTRF. The factorization is applied one pivot block at a time
+    (unblocked algorithm).
+
+    Call this kernel with nrhs groups in x, batch_count groups in y, and
+    SYTRS_MAX_THDS threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(SYTRS_MAX_THDS)
+    sytrs_kernel_upper(const rocblas_int n,
+                       U AA,
+                       const rocblas_int shiftA,
+                       const rocblas_int lda,
+                       const rocblas_stride strideA,
+                       const rocblas_int* ipivA,
+                       const rocblas_stride strideP,
+                       U BB,
+                       const rocblas_int shiftB,
+                       const rocblas_int ldb,
+                       const rocblas_stride strideB)
+{
+    rocblas_int j = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // get array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* b = load_ptr_batch<T>(BB, bid, shiftB, strideB) + j * ldb;
+    const rocblas_int* ipiv = ipivA + bid * strideP;
+
+    // shared variables
+    __shared__ T sval[SYTRS_MAX_THDS];
+    __shared__ T temp;
+
+    rocblas_int i, k, kp;
+    T bk, bkm1, akm1k, akm1, ak, denom;
+
+    // solve U * D * X = B, overwriting B with X
+    k = n - 1;
+    while(k >= 0)
+    {
+        if(ipiv[k] > 0)
+        {
+            // 1-by-1 pivot block
+
+            // interchange rows k and ipiv(k)
+            kp = ipiv[k] - 1;
+            if(tid == 0 && kp != k)
+                swap(b[k], b[kp]);
+            __syncthreads();
+
+            // multiply by inv(U(k)) (ger)
+            bk = b[k];
+            for(i = tid; i < k; i += SYTRS_MAX_THDS)
+                b[i] -= A[i + k * lda] * bk;
+            __syncthreads();
+
+            // multiply by the inverse of the diagonal block
+            if(tid == 0)
+                b[k] = bk / A[k + k * lda];
+
+            k--;
+        }
+        else
+        {
+            // 2-by-2 pivot block
+
+            // interchange rows k-1 and -ipiv(k)
+            kp = -ipiv[k] - 1;
+            if(tid == 0 && kp != k - 1)
+                swap(b[k - 1], b[kp]);
+            __syncthreads();
+
+            // multiply by inv(U(k)) (ger)
+            bk = b[k];
+            bkm1 = b[k - 1];
+            for(i = tid; i < k - 1; i += SYTRS_MAX_THDS)
+                b[i] -= A[i + k * lda] * bk + A[i + (k - 1) * lda] * bkm1;
+            __syncthreads();
+
+            // multiply by the inverse of the diagonal block
+            if(tid == 0)
+            {
+                akm1k = A[(k - 1) + k * lda];
+                akm1 = A[(k - 1) + (k - 1) * lda] / akm1k;
+                ak = A[k + k * lda] / akm1k;
+                denom = akm1 * ak - T(1);
+                bkm1 = bkm1 / akm1k;
+                bk = bk / akm1k;
+                b[k - 1] = (ak * bkm1 - bk) / denom;
+                b[k] = (akm1 * bk - bkm1) / denom;
+            }
+
+            k -= 2;
+        }
+    }
+    __syncthreads();
+
+    // solve U' * X = B, overwriting B with X
+    k = 0;
+    while(k < n)
+    {
+        // multiply by inv(U'(k)) (gemv)
+        dot<SYTRS_MAX_THDS>(tid, k, A + k * lda, 1, b, 1, sval);
+        __syncthreads();
+
+        if(ipiv[k] > 0)
+        {
+            // 1-by-1 pivot block
+            if(tid == 0)
+            {
+                b[k] -= sval[0];
+
+                // interchange rows k and ipiv(k)
+                kp = ipiv[k] - 1;
+                if(kp != k)
+                    swap(b[k], b[kp]);
+            }
+
+            k++;
+        }
+        else
+        {
+            // 2-by-2 pivot block
+            if(tid == 0)
+                temp = sval[0];
+            __syncthreads();
+
+            dot<SYTRS_MAX_THDS>(tid, k, A + (k + 1) * lda, 1, b, 1, sval);
+            __syncthreads();
+
+            if(tid == 0)
+            {
+                b[k] -= temp;
+                b[k + 1] -= sval[0];
+
+                // interchange rows k and -ipiv(k)
+                kp = -ipiv[k] - 1;
+                if(kp != k)
+                    swap(b[k], b[kp]);
+            }
+
+            k += 2;
+        }
+        __syncthreads();
+    }
+}
+
+/** SYTRS_KERNEL_LOWER solves A * X = B for one column of B, where A = L * D * L' was
+    computed by SYTRF. The factorization is applied one pivot block at a time
+    (unblocked algorithm).
+
+    Call this kernel with nrhs groups in x, batch_count groups in y, and
+    SYTRS_MAX_THDS threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(SYTRS_MAX_THDS)
+    sytrs_kernel_lower(const rocblas_int n,
+                       U AA,
+                       const rocblas_int shiftA,
+                       const rocblas_int lda,
+                       const rocblas_stride strideA,
+                       const rocblas_int* ipivA,
+                       const rocblas_stride strideP,
+                       U BB,
+                       const rocblas_int shiftB,
+                       const rocblas_int ldb,
+                       const rocblas_stride strideB)
+{
+    rocblas_int j = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // get array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* b = load_ptr_batch<T>(BB, bid, shiftB, strideB) + j * ldb;
+    const rocblas_int* ipiv = ipivA + bid * strideP;
+
+    // shared variables
+    __shared__ T sval[SYTRS_MAX_THDS];
+    __shared__ T temp;
+
+    rocblas_int i, k, kp;
+    T bk, bkp1, akm1k, akm1, ak, denom;
+
+    // solve L * D * X = B, overwriting B with X
+    k = 0;
+    while(k < n)
+    {
+        if(ipiv[k] > 0)
+        {
+            // 1-by-1 pivot block
+
+            // interchange rows k and ipiv(k)
+            kp = ipiv[k] - 1;
+            if(tid == 0 && kp != k)
+                swap(b[k], b[kp]);
+            __syncthreads();
+
+            // multiply by inv(L(k)) (ger)
+            bk = b[k];
+            for(i = k + 1 + tid; i < n; i += SYTRS_MAX_THDS)
+                b[i] -= A[i + k * lda] * bk;
+            __syncthreads();
+
+            // multiply by the inverse of the diagonal block
+            if(tid == 0)
+                b[k] = bk / A[k + k * lda];
+
+            k++;
+        }
+        else
+        {
+            // 2-by-2 pivot block
+
+            // interchange rows k+1 and -ipiv(k)
+            kp = -ipiv[k] - 1;
+            if(tid == 0 && kp != k + 1)
+                swap(b[k + 1], b[kp]);
+            __syncthreads();
+
+            // multiply by inv(L(k)) (ger)
+            bk = b[k];
+            bkp1 = b[k + 1];
+            for(i = k + 2 + tid; i < n; i += SYTRS_MAX_THDS)
+                b[i] -= A[i + k * lda] * bk + A[i + (k + 1) * lda] * bkp1;
+            __syncthreads();
+
+            // multiply by the inverse of the diagonal block
+            if(tid == 0)
+            {
+                akm1k = A[(k + 1) + k * lda];
+                akm1 = A[k + k * lda] / akm1k;
+                ak = A[(k + 1) + (k + 1) * lda] / akm1k;
+                denom = akm1 * ak - T(1);
+                bk = bk / akm1k;
+                bkp1 = bkp1 / akm1k;
+                b[k] = (ak * bk - bkp1) / denom;
+                b[k + 1] = (akm1 * bkp1 - bk) / denom;
+            }
+
+            k += 2;
+        }
+    }
+    __syncthreads();
+
+    // solve L' * X = B, overwriting B with X
+    k = n - 1;
+    while(k >= 0)
+    {
+        // multiply by inv(L'(k)) (gemv)
+        dot<SYTRS_MAX_THDS>(tid, n - k - 1, A + (k + 1) + k * lda, 1, b + k + 1, 1, sval);
+        __syncthreads();
+
+        if(ipiv[k] > 0)
+        {
+            // 1-by-1 pivot block
+            if(tid == 0)
+            {
+                b[k] -= sval[0];
+
+                // interchange rows k and ipiv(k)
+                kp = ipiv[k] - 1;
+                if(kp != k)
+                    swap(b[k], b[kp]);
+            }
+
+            k--;
+        }
+        else
+        {
+            // 2-by-2 pivot block
+            if(tid == 0)
+                temp = sval[0];
+            __syncthreads();
+
+            dot<SYTRS_MAX_THDS>(tid, n - k - 1, A + (k + 1) + (k - 1) * lda, 1, b + k + 1, 1,
+                                sval);
+            __syncthreads();
+
+            if(tid == 0)
+            {
+                b[k] -= temp;
+                b[k - 1] -= sval[0];
+
+                // interchange rows k and -ipiv(k)
+                kp = -ipiv[k] - 1;
+                if(kp != k)
+                    swap(b[k], b[kp]);
+            }
+
+            k -= 2;
+        }
+        __syncthreads();
+    }
+}
+
+/** SYTRS_SYCONV converts the factor computed by SYTRF into a unit triangular matrix whose
+    columns are permuted as the rows of the right-hand sides, storing the off-diagonal
+    elements of the 2-by-2 blocks of D in E (revert = false). It also reverts the conversion
+    (revert = true). Each thread works on one column of A.
+
+    Call this kernel with ceil(n / BS1) groups in x, batch_count groups in y, and
+    BS1 threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void sytrs_syconv(const bool revert,
+                                   const rocblas_fill uplo,
+                                   const rocblas_int n,
+                                   U AA,
+                                   const rocblas_int shiftA,
+                                   const rocblas_int lda,
+                                   const rocblas_stride strideA,
+                                   const rocblas_int* ipivA,
+                                   const rocblas_stride strideP,
+                                   T* EE)
+{
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(j < n)
+    {
+        // get array pointers
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+        const rocblas_int* ipiv = ipivA + bid * strideP;
+        T* E = EE + bid * n;
+
+        rocblas_int i, ip;
+
+        if(uplo == rocblas_fill_upper)
+        {
+            if(!revert)
+            {
+                // extract the off-diagonal elements of D
+                i = n - 1;
+                while(i >= 0)
+                {
+                    if(i > 0 && ipiv[i] < 0)
+                    {
+                        if(j == i)
+                        {
+                            E[i] = A[(i - 1) + i * lda];
+                            A[(i - 1) + i * lda] = 0;
+                        }
+                        else if(j == i - 1)
+                            E[i - 1] = 0;
+                        i -= 2;
+                    }
+                    else
+                    {
+                        if(j == i)
+                            E[i] = 0;
+                        i--;
+                    }
+                }
+
+                // apply the interchanges to the columns of U
+                i = n - 1;
+                while(i >= 0)
+                {
+                    if(ipiv[i] > 0)
+                    {
+                        ip = ipiv[i] - 1;
+                        if(j > i)
+                            swap(A[ip + j * lda], A[i + j * lda]);
+                        i--;
+                    }
+                    else
+                    {
+                        ip = -ipiv[i] - 1;
+                        if(j > i)
+                            swap(A[ip + j * lda], A[(i - 1) + j * lda]);
+                        i -= 2;
+                    }
+                }
+            }
+            else
+            {
+                // revert the interchanges
+                i = 0;
+                while(i < n)
+                {
+                    if(ipiv[i] > 0)
+                    {
+                        ip = ipiv[i] - 1;
+                        if(j > i)
+                            swap(A[ip + j * lda], A[i + j * lda]);
+                        i++;
+                    }
+                    else
+                    {
+                        ip = -ipiv[i] - 1;
+                        i++;
+                        if(j > i)
+                            swap(A[ip + j * lda], A[(i - 1) + j * lda]);
+                        i++;
+                    }
+                }
+
+                // restore the off-diagonal elements of D
+                i = n - 1;
+                while(i > 0)
+                {
+                    if(ipiv[i] < 0)
+                    {
+                        if(j == i)
+                            A[(i - 1) + i * lda] = E[i];
+                        i--;
+                    }
+                    i--;
+                }
+            }
+        }
+        else
+        {
+            if(!revert)
+            {
+                // extract the off-diagonal elements of D
+                i = 0;
+                while(i < n)
+                {
+                    if(i < n - 1 && ipiv[i] < 0)
+                    {
+                        if(j == i)
+                        {
+                            E[i] = A[(i + 1) + i * lda];
+                            A[(i + 1) + i * lda] = 0;
+                        }
+                        else if(j == i + 1)
+                            E[i + 1] = 0;
+                        i += 2;
+                    }
+                    else
+                    {
+                        if(j == i)
+                            E[i] = 0;
+                        i++;
+                    }
+                }
+
+                // apply the interchanges to the columns of L
+                i = 0;
+                while(i < n)
+                {
+                    if(ipiv[i] > 0)
+                    {
+                        ip = ipiv[i] - 1;
+                        if(j < i)
+                            swap(A[ip + j * lda], A[i + j * lda]);
+                        i++;
+                    }
+                    else
+                    {
+                        ip = -ipiv[i] - 1;
+                        if(j < i)
+                            swap(A[ip + j * lda], A[(i + 1) + j * lda]);
+                        i += 2;
+                    }
+                }
+            }
+            else
+            {
+                // revert the interchanges
+                i = n - 1;
+                while(i >= 0)
+                {
+                    if(ipiv[i] > 0)
+                    {
+                        ip = ipiv[i] - 1;
+                        if(j < i)
+                            swap(A[i + j * lda], A[ip + j * lda]);
+                        i--;
+                    }
+                    else
+                    {
+                        ip = -ipiv[i] - 1;
+                        i--;
+                        if(j < i)
+                            swap(A[(i + 1) + j * lda], A[ip + j * lda]);
+                        i--;
+                    }
+                }
+
+                // restore the off-diagonal elements of D
+                i = 0;
+                while(i < n - 1)
+                {
+                    if(ipiv[i] < 0)
+                    {
+                        if(j == i)
+                            A[(i + 1) + i * lda] = E[i];
+                        i++;
+                    }
+                    i++;
+                }
+            }
+        }
+    }
+}
+
+/** SYTRS_PERMUTE applies the row interchanges P' (forward = true) or P (forward = false)
+    of the factorization to the right-hand sides. Each thread works on one column of B.
+
+    Call this kernel with ceil(nrhs / BS1) groups in x, batch_count groups in y, and
+    BS1 threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void sytrs_permute(const bool forward,
+                                    const rocblas_fill uplo,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    const rocblas_int* ipivA,
+                                    const rocblas_stride strideP,
+                                    U BB,
+                                    const rocblas_int shiftB,
+                                    const rocblas_int ldb,
+                                    const rocblas_stride strideB)
+{
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(j < nrhs)
+    {
+        // get array pointers
+        T* b = load_ptr_batch<T>(BB, bid, shiftB, strideB) + j * ldb;
+        const rocblas_int* ipiv = ipivA + bid * strideP;
+
+        rocblas_int k, kp;
+
+        if(uplo == rocblas_fill_upper)
+        {
+            if(forward)
+            {
+                k = n - 1;
+                while(k >= 0)
+                {
+                    if(ipiv[k] > 0)
+                    {
+                        kp = ipiv[k] - 1;
+                        if(kp != k)
+                            swap(b[k], b[kp]);
+                        k--;
+                    }
+                    else
+                    {
+                        kp = -ipiv[k] - 1;
+                        if(kp == -ipiv[k - 1] - 1)
+                            swap(b[k - 1], b[kp]);
+                        k -= 2;
+                    }
+                }
+            }
+            else
+            {
+                k = 0;
+                while(k < n)
+                {
+                    if(ipiv[k] > 0)
+                    {
+                        kp = ipiv[k] - 1;
+                        if(kp != k)
+                            swap(b[k], b[kp]);
+                        k++;
+                    }
+                    else
+                    {
+                        kp = -ipiv[k] - 1;
+                        if(k < n - 1 && kp == -ipiv[k + 1] - 1)
+                            swap(b[k], b[kp]);
+                        k += 2;
+                    }
+                }
+            }
+        }
+        else
+        {
+            if(forward)
+            {
+                k = 0;
+                while(k < n)
+                {
+                    if(ipiv[k] > 0)
+                    {
+                        kp = ipiv[k] - 1;
+                        if(kp != k)
+                            swap(b[k], b[kp]);
+                        k++;
+                    }
+                    else
+                    {
+                        kp = -ipiv[k + 1] - 1;
+                        if(kp == -ipiv[k] - 1)
+                            swap(b[k + 1], b[kp]);
+                        k += 2;
+                    }
+                }
+            }
+            else
+            {
+                k = n - 1;
+                while(k >= 0)
+                {
+                    if(ipiv[k] > 0)
+                    {
+                        kp = ipiv[k] - 1;
+                        if(kp != k)
+                            swap(b[k], b[kp]);
+                        k--;
+                    }
+                    else
+                    {
+                        kp = -ipiv[k] - 1;
+                        if(k > 0 && kp == -ipiv[k - 1] - 1)
+                            swap(b[k], b[kp]);
+                        k -= 2;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/** SYTRS_DIAGSOLVE solves D * X = B, where D is the block diagonal matrix of the
+    factorization (with the off-diagonal elements of the 2-by-2 blocks stored in E).
+    Each thread works on one column of B.
+
+    Call this kernel with ceil(nrhs / BS1) groups in x, batch_count groups in y, and
+    BS1 threads in x. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void sytrs_diagsolve(const rocblas_fill uplo,
+                                      const rocblas_int n,
+                                      const rocblas_int nrhs,
+                                      U AA,
+                                      const rocblas_int shiftA,
+                                      const rocblas_int lda,
+                                      const rocblas_stride strideA,
+                                      const rocblas_int* ipivA,
+                                      const rocblas_stride strideP,
+                                      T* EE,
+                                      U BB,
+                                      const rocblas_int shiftB,
+                                      const rocblas_int ldb,
+                                      const rocblas_stride strideB)
+{
+    rocblas_int j = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+
+    if(j < nrhs)
+    {
+        // get array pointers
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+        T* b = load_ptr_batch<T>(BB, bid, shiftB, strideB) + j * ldb;
+        const rocblas_int* ipiv = ipivA + bid * strideP;
+        T* E = EE + bid * n;
+
+        rocblas_int i = 0;
+        rocblas_int i1, i2;
+        T akm1k, akm1, ak, denom, bkm1, bk;
+
+        while(i < n)
+        {
+            if(ipiv[i] > 0)
+            {
+                b[i] = b[i] / A[i + i * lda];
+                i++;
+            }
+            else
+            {
+                // 2-by-2 block in rows i and i+1
+                // (the off-diagonal element is stored in E[i+1] if upper, or E[i] if lower)
+                i1 = i;
+                i2 = i + 1;
+                akm1k = (uplo == rocblas_fill_upper) ? E[i2] : E[i1];
+                akm1 = A[i1 + i1 * lda] / akm1k;
+                ak = A[i2 + i2 * lda] / akm1k;
+                denom = akm1 * ak - T(1);
+                bkm1 = b[i1] / akm1k;
+                bk = b[i2] / akm1k;
+                b[i1] = (ak * bkm1 - bk) / denom;
+                b[i2] = (akm1 * bk - bkm1) / denom;
+                i += 2;
+            }
+        }
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_sytrs_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int lda,
+                                        const rocblas_int ldb,
+                                        T A,
+                                        T B,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (nrhs * n && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_sytrs_getMemorySize(const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_E,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   bool* optim_mem)
+{
+    // if quick return, or if using the unblocked algorithm, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0 || nrhs < SYTRS_BLOCKED_SWITCH)
+    {
+        *size_E = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    bool opt1, opt2;
+    size_t w1, w2, w3, w4;
+
+    // size to store the off-diagonal elements of D
+    *size_E = sizeof(T) * n * batch_count;
+
+    // workspace required for calling TRSM
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_none, n, nrhs,
+                                            batch_count, size_work1, size_work2, size_work3,
+                                            size_work4, &opt1);
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_transpose, n,
+                                            nrhs, batch_count, &w1, &w2, &w3, &w4, &opt2);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *optim_mem = opt1 && opt2;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status rocsolver_sytrs_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        const rocblas_int batch_count,
+                                        T* E,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        const bool optim_mem)
+{
+    ROCSOLVER_ENTER("sytrs", "uplo:", uplo, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // use the unblocked algorithm for a small number of right-hand sides
+    if(nrhs < SYTRS_BLOCKED_SWITCH)
+    {
+        dim3 grid(nrhs, batch_count, 1);
+        dim3 threads(SYTRS_MAX_THDS, 1, 1);
+
+        if(uplo == rocblas_fill_upper)
+            ROCSOLVER_LAUNCH_KERNEL(sytrs_kernel_upper<T>, grid, threads, 0, stream, n, A, shiftA,
+                                    lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB);
+        else
+            ROCSOLVER_LAUNCH_KERNEL(sytrs_kernel_lower<T>, grid, threads, 0, stream, n, A, shiftA,
+                                    lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB);
+
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    rocblas_int blocksA = (n - 1) / BS1 + 1;
+    rocblas_int blocksB = (nrhs - 1) / BS1 + 1;
+    dim3 gridA(blocksA, batch_count, 1);
+    dim3 gridB(blocksB, batch_count, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // convert the factor into a unit triangular matrix and a block diagonal matrix
+    ROCSOLVER_LAUNCH_KERNEL(sytrs_syconv<T>, gridA, threads, 0, stream, false, uplo, n, A, shiftA,
+                            lda, strideA, ipiv, strideP, E);
+
+    // apply row interchanges to the right-hand sides
+    ROCSOLVER_LAUNCH_KERNEL(sytrs_permute<T>, gridB, threads, 0, stream, true, uplo, n, nrhs, ipiv,
+                            strideP, B, shiftB, ldb, strideB);
+
+    if(uplo == rocblas_fill_upper)
+    {
+        // solve U*X = B, overwriting B with X
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, n, nrhs, A,
+            shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, optim_mem, work1, work2,
+            work3, work4);
+
+        // solve D*X = B, overwriting B with X
+        ROCSOLVER_LAUNCH_KERNEL(sytrs_diagsolve<T>, gridB, threads, 0, stream, uplo, n, nrhs, A,
+                                shiftA, lda, strideA, ipiv, strideP, E, B, shiftB, ldb, strideB);
+
+        // solve U'*X = B, overwriting B with X
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_transpose, rocblas_diagonal_unit, n, nrhs,
+            A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, optim_mem, work1, work2,
+            work3, work4);
+    }
+    else
+    {
+        // solve L*X = B, overwriting B with X
+        rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, n, nrhs, A,
+            shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, optim_mem, work1, work2,
+            work3, work4);
+
+        // solve D*X = B, overwriting B with X
+        ROCSOLVER_LAUNCH_KERNEL(sytrs_diagsolve<T>, gridB, threads, 0, stream, uplo, n, nrhs, A,
+                                shiftA, lda, strideA, ipiv, strideP, E, B, shiftB, ldb, strideB);
+
+        // solve L'*X = B, overwriting B with X
+        rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_transpose, rocblas_diagonal_unit, n, nrhs,
+            A, shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, optim_mem, work1, work2,
+            work3, work4);
+    }
+
+    // apply the inverse row interchanges to the solution vectors
+    ROCSOLVER_LAUNCH_KERNEL(sytrs_permute<T>, gridB, threads, 0, stream, false, uplo, n, nrhs, ipiv,
+                            strideP, B, shiftB, ldb, strideB);
+
+    // revert the conversion of the factor
+    ROCSOLVER_LAUNCH_KERNEL(sytrs_syconv<T>, gridA, threads, 0, stream, true, uplo, n, A, shiftA,
+                            lda, strideA, ipiv, strideP, E);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -0,0 +1,141 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_sytrs.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_sytrs_batched_impl(rocblas_handle handle,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            U A,
+                                            const rocblas_int lda,
+                                            const rocblas_int* ipiv,
+                                            const rocblas_stride strideP,
+                                            U B,
+                                            const rocblas_int ldb,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("sytrs_batched", "--uplo", uplo, "-n", n, "--nrhs", nrhs, "--lda", lda,
+                        "--strideP", strideP, "--ldb", ldb, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_sytrs_argCheck(handle, uplo, n, nrhs, lda, ldb, A, B, ipiv,
+                                                 batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+
+    // memory workspace sizes:
+    // size to store the off-diagonal elements of the block diagonal factor
+    size_t size_E;
+    // size of workspace (for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    rocsolver_sytrs_getMemorySize<true, true, T>(n, nrhs, batch_count, &size_E, &size_work1,
+                                                 &size_work2, &size_work3, &size_work4, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_E, size_work1, size_work2,
+                                                      size_work3, size_work4);
+
+    // memory workspace allocation
+    void *E, *work1, *work2, *work3, *work4;
+    rocblas_device_malloc mem(handle, size_E, size_work1, size_work2, size_work3, size_work4);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    E = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+
+    // execution
+    return rocsolver_sytrs_template<true, true, T>(handle, uplo, n, nrhs, A, shiftA, lda, strideA,
+                                                   ipiv, strideP, B, shiftB, ldb, strideB,
+                                                   batch_count, (T*)E, work1, work2, work3, work4,
+                                                   optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_ssytrs_batched(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   float* const A[],
+                                                   const rocblas_int lda,
+                                                   const rocblas_int* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   float* const B[],
+                                                   const rocblas_int ldb,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_sytrs_batched_impl<float>(handle, uplo, n, nrhs, A, lda, ipiv, strideP, B, ldb,
+                                               batch_count);
+}
+
+extern "C" rocblas_status rocsolver_dsytrs_batched(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   double* const A[],
+                                                   const rocblas_int lda,
+                                                   const rocblas_int* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   double* const B[],
+                                                   const rocblas_int ldb,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_sytrs_batched_impl<double>(handle, uplo, n, nrhs, A, lda, ipiv, strideP, B,
+                                                ldb, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_csytrs_batched(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   rocblas_float_complex* const A[],
+                                                   const rocblas_int lda,
+                                                   const rocblas_int* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   rocblas_float_complex* const B[],
+                                                   const rocblas_int ldb,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_sytrs_batched_impl<rocblas_float_complex>(handle, uplo, n, nrhs, A, lda, ipiv,
+                                                               strideP, B, ldb, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_zsytrs_batched(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   rocblas_double_complex* const A[],
+                                                   const rocblas_int lda,
+                                                   const rocblas_int* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   rocblas_double_complex* const B[],
+                                                   const rocblas_int ldb,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_sytrs_batched_impl<rocblas_double_complex>(handle, uplo, n, nrhs, A, lda, ipiv,
+                                                                strideP, B, ldb, batch_count);
+}
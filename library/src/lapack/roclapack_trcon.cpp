@@ -0,0 +1,136 @@
+/* ************************************************************************
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "roclapack_trcon.hpp"
+
+template <typename T, typename S>
+rocblas_status rocsolver_trcon_impl(rocblas_handle handle,
+                                    const rocblas_norm_type norm_type,
+                                    const rocblas_fill uplo,
+                                    const rocblas_diagonal diag,
+                                    const rocblas_int n,
+                                    T* A,
+                                    const rocblas_int lda,
+                                    S* rcond)
+{
+    ROCSOLVER_ENTER_TOP("trcon", "--norm", norm_type, "--uplo", uplo, "--diag", diag, "-n", n,
+                        "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_trcon_argCheck(handle, norm_type, uplo, diag, n, lda, A, rcond);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of workspace (for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // size to store the norms of the matrices
+    size_t size_anorm;
+    // size of vectors and state of the norm estimator
+    size_t size_work, size_sgn, size_est, size_state;
+    // size of array of pointers (only for batched case)
+    size_t size_workArr;
+    rocsolver_trcon_getMemorySize<false, false, T, S>(n, batch_count, &size_work1, &size_work2,
+                                                      &size_work3, &size_work4, &size_anorm,
+                                                      &size_work, &size_sgn, &size_est, &size_state,
+                                                      &size_workArr, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+                                                      size_work4, size_anorm, size_work, size_sgn,
+                                                      size_est, size_state, size_workArr);
+
+    // memory workspace allocation
+    void *work1, *work2, *work3, *work4, *anorm, *work, *sgn, *est, *state, *workArr;
+    rocblas_device_malloc mem(handle, size_work1, size_work2, size_work3, size_work4, size_anorm,
+                              size_work, size_sgn, size_est, size_state, size_workArr);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work1 = mem[0];
+    work2 = mem[1];
+    work3 = mem[2];
+    work4 = mem[3];
+    anorm = mem[4];
+    work = mem[5];
+    sgn = mem[6];
+    est = mem[7];
+    state = mem[8];
+    workArr = mem[9];
+
+    // execution
+    return rocsolver_trcon_template<false, false, T>(handle, norm_type, uplo, diag, n, A, shiftA,
+                                                     lda, strideA, rcond, batch_count, work1, work2,
+                                                     work3, work4, (S*)anorm, (T*)work, (T*)sgn,
+                                                     (S*)est, (rocblas_int*)state, (T**)workArr,
+                                                     optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" rocblas_status rocsolver_strcon(rocblas_handle handle,
+                                           const rocblas_norm_type norm_type,
+                                           const rocblas_fill uplo,
+                                           const rocblas_diagonal diag,
+                                           const rocblas_int n,
+                                           float* A,
+                                           const rocblas_int lda,
+                                           float* rcond)
+{
+    return rocsolver_trcon_impl<float>(handle, norm_type, uplo, diag, n, A, lda, rcond);
+}
+
+extern "C" rocblas_status rocsolver_dtrcon(rocblas_handle handle,
+                                           const rocblas_norm_type norm_type,
+                                           const rocblas_fill uplo,
+                                           const rocblas_diagonal diag,
+                                           const rocblas_int n,
+                                           double* A,
+                                           const rocblas_int lda,
+                                           double* rcond)
+{
+    return rocsolver_trcon_impl<double>(handle, norm_type, uplo, diag, n, A, lda, rcond);
+}
+
+extern "C" rocblas_status rocsolver_ctrcon(rocblas_handle handle,
+                                           const rocblas_norm_type norm_type,
+                                           const rocblas_fill uplo,
+                                           const rocblas_diagonal diag,
+                                           const rocblas_int n,
+                                           rocblas_float_complex* A,
+                                           const rocblas_int lda,
+                                           float* rcond)
+{
+    return rocsolver_trcon_impl<rocblas_float_complex>(handle, norm_type, uplo, diag, n, A, lda,
+                                                       rcond);
+}
+
+extern "C" rocblas_status rocsolver_ztrcon(rocblas_handle handle,
+                                           const rocblas_norm_type norm_type,
+                                           const rocblas_fill uplo,
+                                           const rocblas_diagonal diag,
+                                           const rocblas_int n,
+                                           rocblas_double_complex* A,
+                                           const rocblas_int lda,
+                                           double* rcond)
+{
+    return rocsolver_trcon_impl<rocblas_double_complex>(handle, norm_type, uplo, diag, n, A, lda,
+                                                        rcond);
+}
@@ -0,0 +1,354 @@
+/************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (c) 2022 Advanced Micro Devices, Inc.
+ * ***********************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gecon.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+/** TRCON_LANTR computes the 1-norm or the infinity-norm of the triangular matrix A
+    (LAPACK's xLANTR).
+
+    Call this kernel with batch_count groups in x, and BS1 threads in x. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) trcon_lantr(const rocblas_norm_type norm_type,
+                                                         const rocblas_fill uplo,
+                                                         const rocblas_diagonal diag,
+                                                         const rocblas_int n,
+                                                         U AA,
+                                                         const rocblas_int shiftA,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         S* anorm)
+{
+    rocblas_int tid = hipThreadIdx_x;
+    rocblas_int bid = hipBlockIdx_x;
+
+    // array pointers
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+    // shared memory
+    __shared__ S sval[BS1];
+
+    bool upper = (uplo == rocblas_fill_upper);
+    bool unit = (diag == rocblas_diagonal_unit);
+
+    // each thread computes the sum of a column (1-norm) or a row (infinity-norm)
+    // and keeps the maximum
+    S val = 0, sum;
+    rocblas_int i1, i2;
+    for(rocblas_int k = tid; k < n; k += BS1)
+    {
+        sum = unit ? S(1) : S(0);
+        if(norm_type == rocblas_norm_one)
+        {
+            // sum of column k
+            i1 = upper ? 0 : k + 1;
+            i2 = upper ? k : n;
+            for(rocblas_int i = i1; i < i2; i++)
+                sum += std::abs(A[i + k * lda]);
+        }
+        else
+        {
+            // sum of row k
+            i1 = upper ? k + 1 : 0;
+            i2 = upper ? n : k;
+            for(rocblas_int j = i1; j < i2; j++)
+                sum += std::abs(A[k + j * lda]);
+        }
+        if(!unit)
+            sum += std::abs(A[k + k * lda]);
+
+        // propagate NaNs
+        val = (sum > val || sum != sum) ? sum : val;
+    }
+    sval[tid] = val;
+    __syncthreads();
+
+    for(rocblas_int i = BS1 / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+        {
+            val = sval[tid + i];
+            if(val > sval[tid] || val != val)
+                sval[tid] = val;
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0)
+        anorm[bid] = sval[0];
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_trcon_argCheck(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_fill uplo,
+                                        const rocblas_diagonal diag,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        S* rcond,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(norm_type != rocblas_norm_one && norm_type != rocblas_norm_inf)
+        return rocblas_status_invalid_value;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+    if(diag != rocblas_diagonal_non_unit && diag != rocblas_diagonal_unit)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !rcond))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S>
+void rocsolver_trcon_getMemorySize(const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_work1,
+                                   size_t* size_work2,
+                                   size_t* size_work3,
+                                   size_t* size_work4,
+                                   size_t* size_anorm,
+                                   size_t* size_work,
+                                   size_t* size_sgn,
+                                   size_t* size_est,
+                                   size_t* size_state,
+                                   size_t* size_workArr,
+                                   bool* optim_mem)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_anorm = 0;
+        *size_work = 0;
+        *size_sgn = 0;
+        *size_est = 0;
+        *size_state = 0;
+        *size_workArr = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // workspace required for calling TRSM with one right-hand side
+    // call with both rocblas_operation_none and rocblas_operation_conjugate_transpose and take maximum memory
+    size_t w1a, w1b, w2a, w2b, w3a, w3b, w4a, w4b;
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_none, n, 1,
+                                            batch_count, &w1a, &w2a, &w3a, &w4a, optim_mem);
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_conjugate_transpose,
+                                            n, 1, batch_count, &w1b, &w2b, &w3b, &w4b, optim_mem);
+    *size_work1 = std::max(w1a, w1b);
+    *size_work2 = std::max(w2a, w2b);
+    *size_work3 = std::max(w3a, w3b);
+    *size_work4 = std::max(w4a, w4b);
+
+    // norm of the triangular matrices
+    *size_anorm = sizeof(S) * batch_count;
+
+    // workspace required by the estimator
+    rocsolver_lacn2_getMemorySize<BATCHED, T, S>(n, batch_count, size_work, size_sgn, size_est,
+                                                 size_state, size_workArr);
+}
+
+/** Helper to call TRSM on the estimator vectors; if the matrices are given
+    as an array of pointers, the vectors must be passed the same way **/
+template <bool BATCHED, bool STRIDED, typename T, typename U>
+void rocsolver_trcon_trsm(rocblas_handle handle,
+                          const rocblas_fill uplo,
+                          const rocblas_operation trans,
+                          const rocblas_diagonal diag,
+                          const rocblas_int n,
+                          U A,
+                          const rocblas_int shiftA,
+                          const rocblas_int lda,
+                          const rocblas_stride strideA,
+                          U x,
+                          const rocblas_int batch_count,
+                          void* work1,
+                          void* work2,
+                          void* work3,
+                          void* work4,
+                          const bool optim_mem)
+{
+    if(uplo == rocblas_fill_upper)
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(handle, rocblas_side_left, trans, diag, n, 1, A,
+                                                  shiftA, lda, strideA, x, 0, n, n, batch_count,
+                                                  optim_mem, work1, work2, work3, work4);
+    else
+        rocsolver_trsm_lower<BATCHED, STRIDED, T>(handle, rocblas_side_left, trans, diag, n, 1, A,
+                                                  shiftA, lda, strideA, x, 0, n, n, batch_count,
+                                                  optim_mem, work1, work2, work3, work4);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_trcon_trsm(rocblas_handle handle,
+                          const rocblas_fill uplo,
+                          const rocblas_operation trans,
+                          const rocblas_diagonal diag,
+                          const rocblas_int n,
+                          T* const A[],
+                          const rocblas_int shiftA,
+                          const rocblas_int lda,
+                          const rocblas_stride strideA,
+                          T* x,
+                          T** workArr,
+                          const rocblas_int batch_count,
+                          void* work1,
+                          void* work2,
+                          void* work3,
+                          void* work4,
+                          const bool optim_mem)
+{
+    rocsolver_trcon_trsm<BATCHED, STRIDED, T>(handle, uplo, trans, diag, n, A, shiftA, lda, strideA,
+                                              (T* const*)workArr, batch_count, work1, work2, work3,
+                                              work4, optim_mem);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_trcon_trsm(rocblas_handle handle,
+                          const rocblas_fill uplo,
+                          const rocblas_operation trans,
+                          const rocblas_diagonal diag,
+                          const rocblas_int n,
+                          T* A,
+                          const rocblas_int shiftA,
+                          const rocblas_int lda,
+                          const rocblas_stride strideA,
+                          T* x,
+                          T** workArr,
+                          const rocblas_int batch_count,
+                          void* work1,
+                          void* work2,
+                          void* work3,
+                          void* work4,
+                          const bool optim_mem)
+{
+    rocsolver_trcon_trsm<BATCHED, STRIDED, T>(handle, uplo, trans, diag, n, A, shiftA, lda, strideA,
+                                              x, batch_count, work1, work2, work3, work4, optim_mem);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_trcon_template(rocblas_handle handle,
+                                        const rocblas_norm_type norm_type,
+                                        const rocblas_fill uplo,
+                                        const rocblas_diagonal diag,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        S* rcond,
+                                        const rocblas_int batch_count,
+                                        void* work1,
+                                        void* work2,
+                                        void* work3,
+                                        void* work4,
+                                        S* anorm,
+                                        T* work,
+                                        T* sgn,
+                                        S* est,
+                                        rocblas_int* state,
+                                        T** workArr,
+                                        const bool optim_mem)
+{
+    ROCSOLVER_ENTER("trcon", "norm:", norm_type, "uplo:", uplo, "diag:", diag, "n:", n,
+                    "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 gridB(batch_count, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // quick return with rcond = 1
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, rcond, batch_count, 1);
+        return rocblas_status_success;
+    }
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    if(BATCHED)
+        ROCSOLVER_LAUNCH_KERNEL(get_array, gridReset, threads, 0, stream, workArr, work, n,
+                                batch_count);
+
+    // compute the norm of A
+    ROCSOLVER_LAUNCH_KERNEL((trcon_lantr<T>), gridB, threads, 0, stream, norm_type, uplo, diag, n,
+                            A, shiftA, lda, strideA, anorm);
+
+    // check for singular A and zero anorm, and initialize estimator
+    ROCSOLVER_LAUNCH_KERNEL((con_check<T>), gridB, threads, 0, stream, n, diag, A, shiftA, lda,
+                            strideA, anorm, est, state, rcond);
+
+    // estimate the 1-norm of inv(A) (or of inv(A)' if using the infinity-norm)
+    rocblas_operation trans1 = (norm_type == rocblas_norm_one)
+        ? rocblas_operation_none
+        : rocblas_operation_conjugate_transpose;
+    rocblas_operation trans2 = (norm_type == rocblas_norm_one)
+        ? rocblas_operation_conjugate_transpose
+        : rocblas_operation_none;
+
+    // initialize the estimator vectors
+    ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<BS1, T>), gridB, threads, 0, stream, n, 0, 1, work, sgn,
+                            est, state);
+
+    // alternate products with inv(A) and inv(A)'; problems that have converged
+    // (or are waiting for a product of the other kind) work on zero vectors
+    rocblas_int kase, kase_next;
+    for(rocblas_int r = 0; r < LACN2_MAX_SOLVES; r++)
+    {
+        kase = (r % 2 == 0 ? 1 : 2);
+        kase_next = (r + 1 < LACN2_MAX_SOLVES ? 3 - kase : 0);
+
+        rocsolver_trcon_trsm<BATCHED, STRIDED, T>(handle, uplo, kase == 1 ? trans1 : trans2, diag,
+                                                  n, A, shiftA, lda, strideA, work, workArr,
+                                                  batch_count, work1, work2, work3, work4,
+                                                  optim_mem);
+
+        ROCSOLVER_LAUNCH_KERNEL((lacn2_kernel<BS1, T>), gridB, threads, 0, stream, n, kase,
+                                kase_next, work, sgn, est, state);
+    }
+
+    // compute the reciprocal condition number
+    ROCSOLVER_LAUNCH_KERNEL(con_rcond<S>, gridReset, threads, 0, stream, batch_count, anorm, est,
+                            state, rcond);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
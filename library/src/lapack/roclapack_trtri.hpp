@@ -95,7 +95,7 @@ void rocsolver_trtri_getMemorySize(const rocblas_diagonal diag,
     rocblas_int blk = trtri_get_blksize<ISBATCHED>(n);
 
     // size of temporary array required for copies
-    if(diag == rocblas_diagonal_unit && blk > 0)
+    if(diag == rocblas_diagonal_unit && blk != 0)
         *size_tmpcopy = 0;
     else
         *size_tmpcopy = n * n * sizeof(T) * batch_count;
@@ -109,7 +109,7 @@ void rocsolver_trtri_getMemorySize(const rocblas_diagonal diag,
     size_t w1a, w1b, w3a, w3b;
 
     // requirements for TRTI2
-    rocblas_int nn = (blk == 1) ? n : blk;
+    rocblas_int nn = (blk == 1) ? n : (blk < 0 ? min(n, TRTRI_MAX_COLS) : blk);
 #ifdef OPTIMAL
     if(nn <= TRTRI_MAX_COLS)
     {
@@ -139,8 +139,9 @@ void rocsolver_trtri_getMemorySize(const rocblas_diagonal diag,
         *size_work4 = 0;
         *optim_mem = true;
     }
-    else if(blk == 1)
+    else if(blk == 1 || blk < 0)
     {
+        // the recursive algorithm only adds in-place TRMMs to the unblocked requirements
         *size_work1 = w1a;
         *size_work2 = 0;
         *size_work3 = w3a;
@@ -256,6 +257,64 @@ void trti2(rocblas_handle handle,
     rocblas_set_pointer_mode(handle, old_mode);
 }
 
+/** TRTRI_RECURSIVE inverts the triangular matrix A by splitting it in two halves,
+    inverting the diagonal blocks recursively and updating the off-diagonal block with TRMM.
+    Diagonal blocks with no more than TRTRI_MAX_COLS columns are inverted with TRTI2.
+    Scalars must be on the host. **/
+template <typename T, typename U>
+void trtri_recursive(rocblas_handle handle,
+                     const rocblas_fill uplo,
+                     const rocblas_diagonal diag,
+                     const rocblas_int n,
+                     U A,
+                     const rocblas_int shiftA,
+                     const rocblas_int lda,
+                     const rocblas_stride strideA,
+                     const rocblas_int batch_count,
+                     T* work,
+                     T* alphas)
+{
+    if(n <= TRTRI_MAX_COLS)
+    {
+        trti2<T>(handle, uplo, diag, n, A, shiftA, lda, strideA, batch_count, work, alphas);
+        return;
+    }
+
+    // split in two halves, keeping the leading block a multiple of the leaf size
+    rocblas_int n1 = ((n / 2 - 1) / TRTRI_MAX_COLS + 1) * TRTRI_MAX_COLS;
+    rocblas_int n2 = n - n1;
+    T one = 1;
+    T minone = -1;
+
+    // inverses of the diagonal blocks
+    trtri_recursive<T>(handle, uplo, diag, n1, A, shiftA, lda, strideA, batch_count, work, alphas);
+    trtri_recursive<T>(handle, uplo, diag, n2, A, shiftA + idx2D(n1, n1, lda), lda, strideA,
+                       batch_count, work, alphas);
+
+    if(uplo == rocblas_fill_upper)
+    {
+        // A12 = -inv(A11) * A12 * inv(A22)
+        rocblasCall_trmm(handle, rocblas_side_left, uplo, rocblas_operation_none, diag, n1, n2,
+                         &minone, 0, A, shiftA, lda, strideA, A, shiftA + idx2D(0, n1, lda), lda,
+                         strideA, batch_count);
+
+        rocblasCall_trmm(handle, rocblas_side_right, uplo, rocblas_operation_none, diag, n1, n2,
+                         &one, 0, A, shiftA + idx2D(n1, n1, lda), lda, strideA, A,
+                         shiftA + idx2D(0, n1, lda), lda, strideA, batch_count);
+    }
+    else // rocblas_fill_lower
+    {
+        // A21 = -inv(A22) * A21 * inv(A11)
+        rocblasCall_trmm(handle, rocblas_side_left, uplo, rocblas_operation_none, diag, n2, n1,
+                         &minone, 0, A, shiftA + idx2D(n1, n1, lda), lda, strideA, A,
+                         shiftA + idx2D(n1, 0, lda), lda, strideA, batch_count);
+
+        rocblasCall_trmm(handle, rocblas_side_right, uplo, rocblas_operation_none, diag, n2, n1,
+                         &one, 0, A, shiftA, lda, strideA, A, shiftA + idx2D(n1, 0, lda), lda,
+                         strideA, batch_count);
+    }
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename U>
 rocblas_status rocsolver_trtri_template(rocblas_handle handle,
                                         const rocblas_fill uplo,
@@ -317,7 +376,7 @@ rocblas_status rocsolver_trtri_template(rocblas_handle handle,
     rocblas_int blk = trtri_get_blksize<ISBATCHED>(n);
     rocblas_int jb;
 
-    if(diag == rocblas_diagonal_non_unit && blk > 0)
+    if(diag == rocblas_diagonal_non_unit && blk != 0)
     {
         // save copy of A to restore it in cases where info is nonzero
         ROCSOLVER_LAUNCH_KERNEL((copy_mat<T>), dim3(blocks, blocks, batch_count), dim3(32, 32), 0,
@@ -343,6 +402,13 @@ rocblas_status rocsolver_trtri_template(rocblas_handle handle,
         trti2<T>(handle, uplo, diag, n, A, shiftA, lda, strideA, batch_count, (T*)work1, (T*)work3);
     }
 
+    else if(blk < 0)
+    {
+        // use the recursive algorithm
+        trtri_recursive<T>(handle, uplo, diag, n, A, shiftA, lda, strideA, batch_count, (T*)work1,
+                           (T*)work3);
+    }
+
     else
     {
         // use blocked algorithm with block size blk
@@ -391,7 +457,7 @@ rocblas_status rocsolver_trtri_template(rocblas_handle handle,
         }
     }
 
-    if(diag == rocblas_diagonal_non_unit && blk > 0)
+    if(diag == rocblas_diagonal_non_unit && blk != 0)
     {
         // restore A in cases where info is nonzero
         ROCSOLVER_LAUNCH_KERNEL((copy_mat<T>), dim3(blocks, blocks, batch_count), dim3(32, 32), 0,